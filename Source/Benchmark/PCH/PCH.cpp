@@ -0,0 +1 @@
+#include "PCH.hpp"
\ No newline at end of file
@@ -0,0 +1,48 @@
+#ifndef __PCH_HPP__
+#define __PCH_HPP__
+
+// ============================== [STL] ============================== //
+
+#include <array>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cmath>
+#include <cassert>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <algorithm>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <condition_variable>
+
+// ============================== [OS] ============================== //
+
+#include "HAL/Platform.hpp"
+
+#if defined(_WIN64) || defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+
+    #include <windows.h>
+#endif
+
+// ============================== [External Tools] ============================== //
+
+#include <json.hpp>
+
+using Json = nlohmann::json;
+
+#endif // !__PCH_HPP__
\ No newline at end of file
@@ -0,0 +1,197 @@
+#include "PCH.hpp"
+
+#include "Benchmark.hpp"
+
+// ============================== [Public Structure] ============================== //
+
+Benchmark::Registrar::Registrar (char const*    p_name,
+                                 Function       p_function) noexcept
+{
+    GetRegistry().emplace_back(p_name, p_function);
+}
+
+// ============================== [Public Static Methods] ============================== //
+
+int32   Benchmark::RunAll           (int32  p_argc,
+                                     char*  p_argv[]) noexcept
+{
+    char const* filter   = "";
+    char const* json     = nullptr;
+    char const* baseline = nullptr;
+    Session&    session  = GetSession();
+
+    for (int32 i = 1; i < p_argc; ++i)
+    {
+        if (std::strcmp(p_argv[i], "--samples") == 0 && i + 1 < p_argc)
+            session.sampleCount = std::max(std::atoi(p_argv[++i]), 1);
+
+        else if (std::strcmp(p_argv[i], "--json") == 0 && i + 1 < p_argc)
+            json = p_argv[++i];
+
+        else if (std::strcmp(p_argv[i], "--baseline") == 0 && i + 1 < p_argc)
+            baseline = p_argv[++i];
+
+        else
+            filter = p_argv[i];
+    }
+
+    for (auto const& [name, function] : GetRegistry())
+    {
+        if (std::strstr(name, filter) == nullptr)
+            continue;
+
+        std::printf("\n[%s]\n", name);
+
+        session.current = name;
+
+        function();
+    }
+
+    if (session.failures > 0u)
+        std::printf("\n%u check(s) failed\n", session.failures);
+
+    if (json && !WriteBaseline(json))
+        return EXIT_FAILURE;
+
+    if (baseline && CompareBaseline(baseline))
+        return EXIT_FAILURE;
+
+    return session.failures > 0u ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+void    Benchmark::Report           (char const*    p_name,
+                                     uint64         p_operations,
+                                     double         p_seconds) noexcept
+{
+    Record(p_name, p_operations, { p_seconds });
+}
+
+bool    Benchmark::Check            (char const*    p_name,
+                                     double         p_error,
+                                     double         p_bound) noexcept
+{
+    // Written so that a NaN error fails.
+    bool passed = p_error <= p_bound;
+
+    std::printf("  %-48s %12.3g max error (bound %g)%s\n", p_name, p_error, p_bound, passed ? "" : "  FAILED");
+
+    GetSession().failures += !passed;
+
+    return passed;
+}
+
+// ============================== [Private Static Methods] ============================== //
+
+bool    Benchmark::CompareBaseline  (char const*    p_path) noexcept
+{
+    std::ifstream file(p_path);
+
+    if (!file)
+    {
+        std::printf("\nCould not read the baseline \"%s\".\n", p_path);
+        return true;
+    }
+
+    Json baseline = Json::parse(file, nullptr, false);
+
+    if (baseline.is_discarded() || !baseline.contains("Results"))
+    {
+        std::printf("\n\"%s\" is not a baseline.\n", p_path);
+        return true;
+    }
+
+    Json const& previous    = baseline["Results"];
+    uint32      regressions = 0u;
+
+    std::printf("\n[Baseline %s]\n", p_path);
+
+    for (Result const& result : GetSession().results)
+    {
+        if (!previous.contains(result.name))
+            continue;
+
+        double mean      = previous[result.name]["Mean"].get<double>();
+        double deviation = previous[result.name]["Deviation"].get<double>();
+        double change    = (result.mean - mean) * 100.0 / mean;
+
+        // A slowdown only counts when it is out of the noise of both runs.
+        bool   regressed = change > RegressionThreshold &&
+                           result.mean - mean > 3.0 * std::sqrt(deviation * deviation + result.deviation * result.deviation);
+
+        std::printf("  %-64s %10.2f -> %10.2f ns/op %+7.1f%%%s\n", result.name.c_str(), mean, result.mean, change,
+                    regressed ? "  REGRESSION" : "");
+
+        regressions += regressed;
+    }
+
+    std::printf("  %u regression(s)\n", regressions);
+
+    return regressions > 0u;
+}
+
+void    Benchmark::Record           (char const*                p_name,
+                                     uint64                     p_operations,
+                                     std::vector<double> const& p_seconds) noexcept
+{
+    double mean     = 0.0;
+    double variance = 0.0;
+
+    for (double seconds : p_seconds)
+        mean += seconds;
+
+    mean /= static_cast<double>(p_seconds.size());
+
+    for (double seconds : p_seconds)
+        variance += (seconds - mean) * (seconds - mean);
+
+    if (p_seconds.size() > 1u)
+        variance /= static_cast<double>(p_seconds.size() - 1u);
+
+    double nanoseconds = mean * 1e9 / static_cast<double>(p_operations);
+    double deviation   = std::sqrt(variance) * 1e9 / static_cast<double>(p_operations);
+
+    std::printf("  %-48s %12.2f ns/op +- %5.1f%% %14.0f op/s\n", p_name, nanoseconds,
+                nanoseconds > 0.0 ? deviation * 100.0 / nanoseconds : 0.0,
+                static_cast<double>(p_operations) / mean);
+
+    Session& session = GetSession();
+
+    session.results.push_back({ std::string(session.current) + "/" + p_name, nanoseconds, deviation,
+                                static_cast<uint32>(p_seconds.size()) });
+}
+
+bool    Benchmark::WriteBaseline    (char const*    p_path) noexcept
+{
+    Json results = Json::object();
+
+    for (Result const& result : GetSession().results)
+        results[result.name] = { { "Mean", result.mean }, { "Deviation", result.deviation }, { "Samples", result.samples } };
+
+    std::ofstream file(p_path);
+
+    if (!file)
+    {
+        std::printf("\nCould not write the baseline \"%s\".\n", p_path);
+        return false;
+    }
+
+    file << Json { { "Unit", "ns/op" }, { "Results", results } }.dump(4);
+
+    std::printf("\nBaseline written to \"%s\".\n", p_path);
+
+    return true;
+}
+
+std::vector<std::pair<char const*, Benchmark::Function>>&   Benchmark::GetRegistry  () noexcept
+{
+    static std::vector<std::pair<char const*, Function>> registry;
+
+    return registry;
+}
+
+Benchmark::Session&                                         Benchmark::GetSession   () noexcept
+{
+    static Session session;
+
+    return session;
+}
\ No newline at end of file
@@ -0,0 +1,815 @@
+#include "PCH.hpp"
+
+#include "Benchmark.hpp"
+
+#define VK_NO_PROTOTYPES
+
+#include <vulkan.h>
+
+#if !defined(_WIN64) && !defined(_WIN32)
+    #include <dlfcn.h>
+#endif
+
+/**
+ * Scaling of the render passes' parallel recording: the draws of a subpass are split into one chunk per thread,
+ * each one recorded in a secondary command buffer of the thread's own pool, then executed by a primary command buffer.
+ *
+ * Recording is the driver's work, so the benchmark is meant for a software device such as lavapipe (Mesa's CPU Vulkan driver),
+ * which behaves the same on any machine and is picked over the other devices:
+ *
+ *  VK_ICD_FILENAMES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json Benchmark CommandBuffer
+ *
+ * The Vulkan library is loaded at run time, the benchmark is skipped when it or a device is missing.
+ */
+
+// ============================== [Vulkan Functions] ============================== //
+
+#define VULKAN_GLOBAL_FUNCTIONS(X)              \
+    X(vkCreateInstance)
+
+#define VULKAN_INSTANCE_FUNCTIONS(X)            \
+    X(vkDestroyInstance)                        \
+    X(vkEnumeratePhysicalDevices)               \
+    X(vkGetPhysicalDeviceProperties)            \
+    X(vkGetPhysicalDeviceQueueFamilyProperties) \
+    X(vkGetPhysicalDeviceMemoryProperties)      \
+    X(vkCreateDevice)                           \
+    X(vkGetDeviceProcAddr)
+
+#define VULKAN_DEVICE_FUNCTIONS(X)              \
+    X(vkDestroyDevice)                          \
+    X(vkDeviceWaitIdle)                         \
+    X(vkAllocateMemory)                         \
+    X(vkFreeMemory)                             \
+    X(vkCreateBuffer)                           \
+    X(vkDestroyBuffer)                          \
+    X(vkGetBufferMemoryRequirements)            \
+    X(vkBindBufferMemory)                       \
+    X(vkCreateImage)                            \
+    X(vkDestroyImage)                           \
+    X(vkGetImageMemoryRequirements)             \
+    X(vkBindImageMemory)                        \
+    X(vkCreateImageView)                        \
+    X(vkDestroyImageView)                       \
+    X(vkCreateRenderPass)                       \
+    X(vkDestroyRenderPass)                      \
+    X(vkCreateFramebuffer)                      \
+    X(vkDestroyFramebuffer)                     \
+    X(vkCreateShaderModule)                     \
+    X(vkDestroyShaderModule)                    \
+    X(vkCreatePipelineLayout)                   \
+    X(vkDestroyPipelineLayout)                  \
+    X(vkCreateGraphicsPipelines)                \
+    X(vkDestroyPipeline)                        \
+    X(vkCreateCommandPool)                      \
+    X(vkDestroyCommandPool)                     \
+    X(vkAllocateCommandBuffers)                 \
+    X(vkBeginCommandBuffer)                     \
+    X(vkEndCommandBuffer)                       \
+    X(vkCmdBeginRenderPass)                     \
+    X(vkCmdEndRenderPass)                       \
+    X(vkCmdExecuteCommands)                     \
+    X(vkCmdSetViewport)                         \
+    X(vkCmdSetScissor)                          \
+    X(vkCmdBindPipeline)                        \
+    X(vkCmdBindVertexBuffers)                   \
+    X(vkCmdBindIndexBuffer)                     \
+    X(vkCmdDrawIndexed)
+
+#define VULKAN_DECLARE_FUNCTION(Name) static PFN_##Name Name = nullptr;
+
+static PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr = nullptr;
+
+VULKAN_GLOBAL_FUNCTIONS  (VULKAN_DECLARE_FUNCTION)
+VULKAN_INSTANCE_FUNCTIONS(VULKAN_DECLARE_FUNCTION)
+VULKAN_DEVICE_FUNCTIONS  (VULKAN_DECLARE_FUNCTION)
+
+// ============================== [Helpers] ============================== //
+
+/** Draws of a subpass, about the opaque batches of a large level. */
+static constexpr size_t DrawCount           = 16384u;
+
+/** Draws between two pipeline changes, as the materials of a sorted render list. */
+static constexpr size_t DrawsPerMaterial    = 64u;
+
+static constexpr uint32 TargetSize          = 64u;
+
+/**
+ * Vertex shader writing a null position, assembled by hand so the benchmark needs no shader compiler:
+ *
+ *  OpEntryPoint Vertex %main "main" %position, OpDecorate %position BuiltIn Position, OpStore %position (OpConstantNull vec4)
+ */
+static constexpr uint32 VertexShader[] =
+{
+    0x07230203u, 0x00010000u, 0x00000000u, 10u, 0u,
+    (2u << 16u) | 17u,  1u,                                                 // OpCapability Shader
+    (3u << 16u) | 14u,  0u, 1u,                                             // OpMemoryModel Logical GLSL450
+    (6u << 16u) | 15u,  0u, 1u, 0x6E69616Du, 0x00000000u, 2u,               // OpEntryPoint Vertex %1 "main" %2
+    (4u << 16u) | 71u,  2u, 11u, 0u,                                        // OpDecorate %2 BuiltIn Position
+    (2u << 16u) | 19u,  3u,                                                 // %3 = OpTypeVoid
+    (3u << 16u) | 33u,  4u, 3u,                                             // %4 = OpTypeFunction %3
+    (3u << 16u) | 22u,  5u, 32u,                                            // %5 = OpTypeFloat 32
+    (4u << 16u) | 23u,  6u, 5u, 4u,                                         // %6 = OpTypeVector %5 4
+    (4u << 16u) | 32u,  7u, 3u, 6u,                                         // %7 = OpTypePointer Output %6
+    (4u << 16u) | 59u,  7u, 2u, 3u,                                         // %2 = OpVariable %7 Output
+    (3u << 16u) | 46u,  6u, 8u,                                             // %8 = OpConstantNull %6
+    (5u << 16u) | 54u,  3u, 1u, 0u, 4u,                                     // %1 = OpFunction %3 None %4
+    (2u << 16u) | 248u, 9u,                                                 // %9 = OpLabel
+    (3u << 16u) | 62u,  2u, 8u,                                             // OpStore %2 %8
+    (1u << 16u) | 253u,                                                     // OpReturn
+    (1u << 16u) | 56u                                                       // OpFunctionEnd
+};
+
+// ============================== [Vulkan Context] ============================== //
+
+/**
+ * Device and objects the recorded draws use: a render pass with one color target, two pipelines and a buffer.
+ */
+class VulkanContext
+{
+    public:
+
+        VulkanContext   () = default;
+
+        ~VulkanContext  () noexcept
+        {
+            if (m_device != VK_NULL_HANDLE)
+            {
+                vkDeviceWaitIdle(m_device);
+
+                for (VkPipeline pipeline : m_pipelines)
+                    vkDestroyPipeline(m_device, pipeline, nullptr);
+
+                vkDestroyPipelineLayout(m_device, m_pipelineLayout, nullptr);
+                vkDestroyFramebuffer   (m_device, m_framebuffer,    nullptr);
+                vkDestroyRenderPass    (m_device, m_renderPass,     nullptr);
+                vkDestroyImageView     (m_device, m_imageView,      nullptr);
+                vkDestroyImage         (m_device, m_image,          nullptr);
+                vkDestroyBuffer        (m_device, m_buffer,         nullptr);
+
+                for (VkDeviceMemory memory : m_memories)
+                    vkFreeMemory(m_device, memory, nullptr);
+
+                vkDestroyDevice(m_device, nullptr);
+            }
+
+            if (m_instance != VK_NULL_HANDLE)
+                vkDestroyInstance(m_instance, nullptr);
+
+            if (m_library != nullptr)
+            {
+                #if defined(_WIN64) || defined(_WIN32)
+                    FreeLibrary(static_cast<HMODULE>(m_library));
+                #else
+                    dlclose(m_library);
+                #endif
+            }
+        }
+
+        /**
+         * Loads the Vulkan library and creates the device, preferring a CPU one, and the objects of the draws.
+         *
+         * @return Whether or not a device could be created.
+         */
+        bool    Initialize  () noexcept
+        {
+            #if defined(_WIN64) || defined(_WIN32)
+                m_library             = LoadLibraryA("vulkan-1.dll");
+                vkGetInstanceProcAddr = m_library ? reinterpret_cast<PFN_vkGetInstanceProcAddr>(GetProcAddress(static_cast<HMODULE>(m_library), "vkGetInstanceProcAddr")) : nullptr;
+            #else
+                m_library             = dlopen("libvulkan.so.1", RTLD_NOW | RTLD_LOCAL);
+                vkGetInstanceProcAddr = m_library ? reinterpret_cast<PFN_vkGetInstanceProcAddr>(dlsym(m_library, "vkGetInstanceProcAddr")) : nullptr;
+            #endif
+
+            if (vkGetInstanceProcAddr == nullptr)
+                return false;
+
+            #define VULKAN_LOAD_GLOBAL_FUNCTION(Name) Name = reinterpret_cast<PFN_##Name>(vkGetInstanceProcAddr(VK_NULL_HANDLE, #Name));
+
+            VULKAN_GLOBAL_FUNCTIONS(VULKAN_LOAD_GLOBAL_FUNCTION)
+
+            VkApplicationInfo applicationInfo = { VK_STRUCTURE_TYPE_APPLICATION_INFO };
+
+            applicationInfo.pApplicationName = "Benchmark";
+            applicationInfo.apiVersion       = VK_API_VERSION_1_0;
+
+            VkInstanceCreateInfo instanceCI = { VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO };
+
+            instanceCI.pApplicationInfo = &applicationInfo;
+
+            if (vkCreateInstance == nullptr || vkCreateInstance(&instanceCI, nullptr, &m_instance) != VK_SUCCESS)
+                return false;
+
+            #define VULKAN_LOAD_INSTANCE_FUNCTION(Name) Name = reinterpret_cast<PFN_##Name>(vkGetInstanceProcAddr(m_instance, #Name));
+
+            VULKAN_INSTANCE_FUNCTIONS(VULKAN_LOAD_INSTANCE_FUNCTION)
+
+            return PickPhysicalDevice() && CreateDevice() && CreateTarget() && CreatePipelines() && CreateBuffer();
+        }
+
+        /**
+         * Records the draws [p_first, p_last), binding the whole state first as a chunk of the render passes does.
+         */
+        void    RecordDraws (VkCommandBuffer    p_cmdBuffer,
+                             size_t             p_first,
+                             size_t             p_last)     const noexcept
+        {
+            VkViewport   const viewport = { 0.0f, 0.0f, static_cast<float>(TargetSize), static_cast<float>(TargetSize), 0.0f, 1.0f };
+            VkRect2D     const scissor  = { { 0, 0 }, { TargetSize, TargetSize } };
+            VkDeviceSize const offset   = 0u;
+
+            vkCmdSetViewport(p_cmdBuffer, 0u, 1u, &viewport);
+            vkCmdSetScissor (p_cmdBuffer, 0u, 1u, &scissor);
+
+            for (size_t i = p_first; i < p_last; ++i)
+            {
+                if (i == p_first || i % DrawsPerMaterial == 0u)
+                    vkCmdBindPipeline(p_cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipelines[(i / DrawsPerMaterial) % m_pipelines.size()]);
+
+                vkCmdBindVertexBuffers(p_cmdBuffer, 0u, 1u, &m_buffer, &offset);
+
+                vkCmdBindIndexBuffer(p_cmdBuffer, m_buffer, 0u, VK_INDEX_TYPE_UINT16);
+
+                vkCmdDrawIndexed(p_cmdBuffer, 36u, 1u, 0u, 0, static_cast<uint32>(i));
+            }
+        }
+
+        /**
+         * @return A pool whose buffers are reset as they are begun, like the Device's.
+         */
+        VkCommandPool   CreateCommandPool       ()                                  const noexcept
+        {
+            VkCommandPool           cmdPool   = VK_NULL_HANDLE;
+            VkCommandPoolCreateInfo cmdPoolCI = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+
+            cmdPoolCI.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+            cmdPoolCI.queueFamilyIndex = m_queueFamily;
+
+            vkCreateCommandPool(m_device, &cmdPoolCI, nullptr, &cmdPool);
+
+            return cmdPool;
+        }
+
+        VkCommandBuffer AllocateCommandBuffer   (VkCommandPool          p_cmdPool,
+                                                 VkCommandBufferLevel   p_level)    const noexcept
+        {
+            VkCommandBuffer             cmdBuffer   = VK_NULL_HANDLE;
+            VkCommandBufferAllocateInfo cmdBufferAI = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+
+            cmdBufferAI.commandPool        = p_cmdPool;
+            cmdBufferAI.level              = p_level;
+            cmdBufferAI.commandBufferCount = 1u;
+
+            vkAllocateCommandBuffers(m_device, &cmdBufferAI, &cmdBuffer);
+
+            return cmdBuffer;
+        }
+
+        INLINE VkDevice         GetDevice       () const noexcept { return m_device; }
+
+        INLINE VkRenderPass     GetRenderPass   () const noexcept { return m_renderPass; }
+
+        INLINE VkFramebuffer    GetFramebuffer  () const noexcept { return m_framebuffer; }
+
+        INLINE char const*      GetDeviceName   () const noexcept { return m_properties.deviceName; }
+
+    private:
+
+        void*                       m_library           = nullptr;
+
+        VkInstance                  m_instance          = VK_NULL_HANDLE;
+
+        VkPhysicalDevice            m_physicalDevice    = VK_NULL_HANDLE;
+
+        VkPhysicalDeviceProperties  m_properties        = {};
+
+        VkDevice                    m_device            = VK_NULL_HANDLE;
+
+        uint32                      m_queueFamily       = 0u;
+
+        std::vector<VkDeviceMemory> m_memories;
+
+        VkImage                     m_image             = VK_NULL_HANDLE;
+
+        VkImageView                 m_imageView         = VK_NULL_HANDLE;
+
+        VkRenderPass                m_renderPass        = VK_NULL_HANDLE;
+
+        VkFramebuffer               m_framebuffer       = VK_NULL_HANDLE;
+
+        VkPipelineLayout            m_pipelineLayout    = VK_NULL_HANDLE;
+
+        std::array<VkPipeline, 2>   m_pipelines         = {};
+
+        VkBuffer                    m_buffer            = VK_NULL_HANDLE;
+
+        bool    PickPhysicalDevice  () noexcept
+        {
+            uint32 count = 0u;
+
+            vkEnumeratePhysicalDevices(m_instance, &count, nullptr);
+
+            std::vector<VkPhysicalDevice> physicalDevices(count);
+
+            vkEnumeratePhysicalDevices(m_instance, &count, physicalDevices.data());
+
+            for (VkPhysicalDevice physicalDevice : physicalDevices)
+            {
+                VkPhysicalDeviceProperties properties;
+
+                vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+
+                // A CPU device first, then whichever comes first.
+                if (m_physicalDevice == VK_NULL_HANDLE || properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_CPU)
+                {
+                    m_physicalDevice = physicalDevice;
+                    m_properties     = properties;
+                }
+
+                if (properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_CPU)
+                    break;
+            }
+
+            if (m_physicalDevice == VK_NULL_HANDLE)
+                return false;
+
+            vkGetPhysicalDeviceQueueFamilyProperties(m_physicalDevice, &count, nullptr);
+
+            std::vector<VkQueueFamilyProperties> queueFamilies(count);
+
+            vkGetPhysicalDeviceQueueFamilyProperties(m_physicalDevice, &count, queueFamilies.data());
+
+            for (m_queueFamily = 0u; m_queueFamily < count; ++m_queueFamily)
+            {
+                if (queueFamilies[m_queueFamily].queueFlags & VK_QUEUE_GRAPHICS_BIT)
+                    return true;
+            }
+
+            return false;
+        }
+
+        bool    CreateDevice        () noexcept
+        {
+            float const priority = 1.0f;
+
+            VkDeviceQueueCreateInfo queueCI = { VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO };
+
+            queueCI.queueFamilyIndex = m_queueFamily;
+            queueCI.queueCount       = 1u;
+            queueCI.pQueuePriorities = &priority;
+
+            VkDeviceCreateInfo deviceCI = { VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO };
+
+            deviceCI.queueCreateInfoCount = 1u;
+            deviceCI.pQueueCreateInfos    = &queueCI;
+
+            if (vkCreateDevice(m_physicalDevice, &deviceCI, nullptr, &m_device) != VK_SUCCESS)
+                return false;
+
+            #define VULKAN_LOAD_DEVICE_FUNCTION(Name) Name = reinterpret_cast<PFN_##Name>(vkGetDeviceProcAddr(m_device, #Name));
+
+            VULKAN_DEVICE_FUNCTIONS(VULKAN_LOAD_DEVICE_FUNCTION)
+
+            return true;
+        }
+
+        /**
+         * @return Memory fitting the requirements, of the first type allowed.
+         */
+        VkDeviceMemory  AllocateMemory  (VkMemoryRequirements const& p_requirements) noexcept
+        {
+            VkPhysicalDeviceMemoryProperties properties;
+
+            vkGetPhysicalDeviceMemoryProperties(m_physicalDevice, &properties);
+
+            VkMemoryAllocateInfo memoryAI = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+
+            memoryAI.allocationSize = p_requirements.size;
+
+            while (memoryAI.memoryTypeIndex < properties.memoryTypeCount && (p_requirements.memoryTypeBits & (1u << memoryAI.memoryTypeIndex)) == 0u)
+                ++memoryAI.memoryTypeIndex;
+
+            VkDeviceMemory memory = VK_NULL_HANDLE;
+
+            if (vkAllocateMemory(m_device, &memoryAI, nullptr, &memory) == VK_SUCCESS)
+                m_memories.push_back(memory);
+
+            return memory;
+        }
+
+        bool    CreateTarget        () noexcept
+        {
+            VkImageCreateInfo imageCI = { VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
+
+            imageCI.imageType     = VK_IMAGE_TYPE_2D;
+            imageCI.format        = VK_FORMAT_R8G8B8A8_UNORM;
+            imageCI.extent        = { TargetSize, TargetSize, 1u };
+            imageCI.mipLevels     = 1u;
+            imageCI.arrayLayers   = 1u;
+            imageCI.samples       = VK_SAMPLE_COUNT_1_BIT;
+            imageCI.tiling        = VK_IMAGE_TILING_OPTIMAL;
+            imageCI.usage         = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+
+            if (vkCreateImage(m_device, &imageCI, nullptr, &m_image) != VK_SUCCESS)
+                return false;
+
+            VkMemoryRequirements requirements;
+
+            vkGetImageMemoryRequirements(m_device, m_image, &requirements);
+            vkBindImageMemory           (m_device, m_image, AllocateMemory(requirements), 0u);
+
+            VkImageViewCreateInfo imageViewCI = { VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
+
+            imageViewCI.image                       = m_image;
+            imageViewCI.viewType                    = VK_IMAGE_VIEW_TYPE_2D;
+            imageViewCI.format                      = imageCI.format;
+            imageViewCI.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            imageViewCI.subresourceRange.levelCount = 1u;
+            imageViewCI.subresourceRange.layerCount = 1u;
+
+            if (vkCreateImageView(m_device, &imageViewCI, nullptr, &m_imageView) != VK_SUCCESS)
+                return false;
+
+            VkAttachmentDescription attachment = {};
+
+            attachment.format         = imageCI.format;
+            attachment.samples        = VK_SAMPLE_COUNT_1_BIT;
+            attachment.loadOp         = VK_ATTACHMENT_LOAD_OP_CLEAR;
+            attachment.storeOp        = VK_ATTACHMENT_STORE_OP_STORE;
+            attachment.stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+            attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+            attachment.initialLayout  = VK_IMAGE_LAYOUT_UNDEFINED;
+            attachment.finalLayout    = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+            VkAttachmentReference const colorReference = { 0u, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+
+            VkSubpassDescription subpass = {};
+
+            subpass.pipelineBindPoint    = VK_PIPELINE_BIND_POINT_GRAPHICS;
+            subpass.colorAttachmentCount = 1u;
+            subpass.pColorAttachments    = &colorReference;
+
+            VkRenderPassCreateInfo renderPassCI = { VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO };
+
+            renderPassCI.attachmentCount = 1u;
+            renderPassCI.pAttachments    = &attachment;
+            renderPassCI.subpassCount    = 1u;
+            renderPassCI.pSubpasses      = &subpass;
+
+            if (vkCreateRenderPass(m_device, &renderPassCI, nullptr, &m_renderPass) != VK_SUCCESS)
+                return false;
+
+            VkFramebufferCreateInfo framebufferCI = { VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO };
+
+            framebufferCI.renderPass      = m_renderPass;
+            framebufferCI.attachmentCount = 1u;
+            framebufferCI.pAttachments    = &m_imageView;
+            framebufferCI.width           = TargetSize;
+            framebufferCI.height          = TargetSize;
+            framebufferCI.layers          = 1u;
+
+            return vkCreateFramebuffer(m_device, &framebufferCI, nullptr, &m_framebuffer) == VK_SUCCESS;
+        }
+
+        bool    CreatePipelines     () noexcept
+        {
+            VkShaderModuleCreateInfo shaderModuleCI = { VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO };
+
+            shaderModuleCI.codeSize = sizeof(VertexShader);
+            shaderModuleCI.pCode    = VertexShader;
+
+            VkShaderModule shaderModule = VK_NULL_HANDLE;
+
+            if (vkCreateShaderModule(m_device, &shaderModuleCI, nullptr, &shaderModule) != VK_SUCCESS)
+                return false;
+
+            VkPipelineLayoutCreateInfo pipelineLayoutCI = { VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
+
+            vkCreatePipelineLayout(m_device, &pipelineLayoutCI, nullptr, &m_pipelineLayout);
+
+            VkPipelineShaderStageCreateInfo stage = { VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO };
+
+            stage.stage  = VK_SHADER_STAGE_VERTEX_BIT;
+            stage.module = shaderModule;
+            stage.pName  = "main";
+
+            VkVertexInputBindingDescription const binding = { 0u, 12u, VK_VERTEX_INPUT_RATE_VERTEX };
+
+            VkPipelineVertexInputStateCreateInfo vertexInputState = { VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO };
+
+            vertexInputState.vertexBindingDescriptionCount = 1u;
+            vertexInputState.pVertexBindingDescriptions    = &binding;
+
+            VkPipelineInputAssemblyStateCreateInfo inputAssemblyState = { VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO };
+
+            inputAssemblyState.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+            VkPipelineViewportStateCreateInfo viewportState = { VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO };
+
+            viewportState.viewportCount = 1u;
+            viewportState.scissorCount  = 1u;
+
+            VkPipelineRasterizationStateCreateInfo rasterizationState = { VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO };
+
+            rasterizationState.polygonMode = VK_POLYGON_MODE_FILL;
+            rasterizationState.cullMode    = VK_CULL_MODE_NONE;
+            rasterizationState.frontFace   = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+            rasterizationState.lineWidth   = 1.0f;
+
+            VkPipelineMultisampleStateCreateInfo multisampleState = { VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO };
+
+            multisampleState.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+            VkPipelineColorBlendAttachmentState colorBlendAttachment = {};
+
+            colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+            VkPipelineColorBlendStateCreateInfo colorBlendState = { VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO };
+
+            colorBlendState.attachmentCount = 1u;
+            colorBlendState.pAttachments    = &colorBlendAttachment;
+
+            std::array<VkDynamicState, 2> const dynamicStates = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+
+            VkPipelineDynamicStateCreateInfo dynamicState = { VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO };
+
+            dynamicState.dynamicStateCount = static_cast<uint32>(dynamicStates.size());
+            dynamicState.pDynamicStates    = dynamicStates.data();
+
+            VkGraphicsPipelineCreateInfo pipelineCI = { VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO };
+
+            pipelineCI.stageCount          = 1u;
+            pipelineCI.pStages             = &stage;
+            pipelineCI.pVertexInputState   = &vertexInputState;
+            pipelineCI.pInputAssemblyState = &inputAssemblyState;
+            pipelineCI.pViewportState      = &viewportState;
+            pipelineCI.pRasterizationState = &rasterizationState;
+            pipelineCI.pMultisampleState   = &multisampleState;
+            pipelineCI.pColorBlendState    = &colorBlendState;
+            pipelineCI.pDynamicState       = &dynamicState;
+            pipelineCI.layout              = m_pipelineLayout;
+            pipelineCI.renderPass          = m_renderPass;
+
+            // Two identical pipelines, so the draws change pipelines as they change materials.
+            std::array<VkGraphicsPipelineCreateInfo, 2> const pipelineCIs = { pipelineCI, pipelineCI };
+
+            VkResult const result = vkCreateGraphicsPipelines(m_device, VK_NULL_HANDLE, static_cast<uint32>(pipelineCIs.size()), pipelineCIs.data(), nullptr, m_pipelines.data());
+
+            vkDestroyShaderModule(m_device, shaderModule, nullptr);
+
+            return result == VK_SUCCESS;
+        }
+
+        bool    CreateBuffer        () noexcept
+        {
+            VkBufferCreateInfo bufferCI = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+
+            bufferCI.size  = 65536u;
+            bufferCI.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+
+            if (vkCreateBuffer(m_device, &bufferCI, nullptr, &m_buffer) != VK_SUCCESS)
+                return false;
+
+            VkMemoryRequirements requirements;
+
+            vkGetBufferMemoryRequirements(m_device, m_buffer, &requirements);
+
+            return vkBindBufferMemory(m_device, m_buffer, AllocateMemory(requirements), 0u) == VK_SUCCESS;
+        }
+};
+
+// ============================== [Recording Threads] ============================== //
+
+/**
+ * Threads recording one chunk of the draws each, in a secondary command buffer of their own pool.
+ * The calling thread records the first chunk and the primary command buffer, as the render thread does.
+ */
+class RecordingThreads
+{
+    public:
+
+        RecordingThreads    (VulkanContext const&   p_context,
+                             uint32                 p_threadCount) noexcept :
+            m_context   { p_context },
+            m_pools     (p_threadCount),
+            m_cmdBuffers(p_threadCount)
+        {
+            for (uint32 i = 0u; i < p_threadCount; ++i)
+            {
+                m_pools     [i] = m_context.CreateCommandPool    ();
+                m_cmdBuffers[i] = m_context.AllocateCommandBuffer(m_pools[i], VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+            }
+
+            m_primary = m_context.AllocateCommandBuffer(m_pools[0], VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
+            for (uint32 i = 1u; i < p_threadCount; ++i)
+                m_threads.emplace_back(&RecordingThreads::Work, this, i);
+        }
+
+        ~RecordingThreads   () noexcept
+        {
+            {
+                std::unique_lock lock(m_mutex);
+
+                m_running = false;
+            }
+
+            m_start.notify_all();
+
+            for (std::thread& thread : m_threads)
+                thread.join();
+
+            for (VkCommandPool pool : m_pools)
+                vkDestroyCommandPool(m_context.GetDevice(), pool, nullptr);
+        }
+
+        /**
+         * Records the draws in one secondary command buffer per thread, then the primary command buffer executing them.
+         */
+        void    Record          (size_t p_drawCount) noexcept
+        {
+            {
+                std::unique_lock lock(m_mutex);
+
+                m_drawCount = p_drawCount;
+                m_pending   = static_cast<uint32>(m_threads.size());
+
+                ++m_generation;
+            }
+
+            m_start.notify_all();
+
+            RecordChunk(0u);
+
+            {
+                std::unique_lock lock(m_mutex);
+
+                m_done.wait(lock, [this] { return m_pending == 0u; });
+            }
+
+            BeginPrimary(VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+
+            vkCmdExecuteCommands(m_primary, static_cast<uint32>(m_cmdBuffers.size()), m_cmdBuffers.data());
+
+            EndPrimary();
+        }
+
+        /**
+         * Records the draws in the primary command buffer, as a subpass with too few draws to split does.
+         */
+        void    RecordInline    (size_t p_drawCount) noexcept
+        {
+            BeginPrimary(VK_SUBPASS_CONTENTS_INLINE);
+
+            m_context.RecordDraws(m_primary, 0u, p_drawCount);
+
+            EndPrimary();
+        }
+
+    private:
+
+        VulkanContext const&            m_context;
+
+        std::vector<VkCommandPool>      m_pools;
+
+        std::vector<VkCommandBuffer>    m_cmdBuffers;
+
+        VkCommandBuffer                 m_primary       = VK_NULL_HANDLE;
+
+        std::vector<std::thread>        m_threads;
+
+        std::mutex                      m_mutex;
+
+        std::condition_variable         m_start;
+
+        std::condition_variable         m_done;
+
+        /** Incremented by every Record call, a thread records once per value. */
+        uint64                          m_generation    = 0u;
+
+        /** Threads still recording their chunk. */
+        uint32                          m_pending       = 0u;
+
+        size_t                          m_drawCount     = 0u;
+
+        bool                            m_running       = true;
+
+        void    BeginPrimary    (VkSubpassContents p_contents) noexcept
+        {
+            VkCommandBufferBeginInfo cmdBufferBI = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+
+            cmdBufferBI.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+            vkBeginCommandBuffer(m_primary, &cmdBufferBI);
+
+            VkClearValue const clearValue = {};
+
+            VkRenderPassBeginInfo renderPassBI = { VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO };
+
+            renderPassBI.renderPass        = m_context.GetRenderPass ();
+            renderPassBI.framebuffer       = m_context.GetFramebuffer();
+            renderPassBI.renderArea.extent = { TargetSize, TargetSize };
+            renderPassBI.clearValueCount   = 1u;
+            renderPassBI.pClearValues      = &clearValue;
+
+            vkCmdBeginRenderPass(m_primary, &renderPassBI, p_contents);
+        }
+
+        void    EndPrimary      () noexcept
+        {
+            vkCmdEndRenderPass(m_primary);
+            vkEndCommandBuffer(m_primary);
+        }
+
+        void    RecordChunk     (uint32 p_index) noexcept
+        {
+            size_t const chunkCount = m_cmdBuffers.size();
+
+            VkCommandBufferInheritanceInfo inheritanceInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO };
+
+            inheritanceInfo.renderPass  = m_context.GetRenderPass ();
+            inheritanceInfo.subpass     = 0u;
+            inheritanceInfo.framebuffer = m_context.GetFramebuffer();
+
+            VkCommandBufferBeginInfo cmdBufferBI = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+
+            cmdBufferBI.flags            = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+            cmdBufferBI.pInheritanceInfo = &inheritanceInfo;
+
+            vkBeginCommandBuffer(m_cmdBuffers[p_index], &cmdBufferBI);
+
+            m_context.RecordDraws(m_cmdBuffers[p_index], p_index * m_drawCount / chunkCount, (p_index + 1u) * m_drawCount / chunkCount);
+
+            vkEndCommandBuffer(m_cmdBuffers[p_index]);
+        }
+
+        void    Work            (uint32 p_index) noexcept
+        {
+            uint64 generation = 0u;
+
+            for (;;)
+            {
+                {
+                    std::unique_lock lock(m_mutex);
+
+                    m_start.wait(lock, [this, generation] { return !m_running || m_generation != generation; });
+
+                    if (!m_running)
+                        return;
+
+                    generation = m_generation;
+                }
+
+                RecordChunk(p_index);
+
+                {
+                    std::unique_lock lock(m_mutex);
+
+                    if (--m_pending == 0u)
+                        m_done.notify_one();
+                }
+            }
+        }
+};
+
+// ============================== [Benchmarks] ============================== //
+
+BENCHMARK(CommandBufferRecording)
+{
+    VulkanContext context;
+
+    if (!context.Initialize())
+    {
+        std::printf("  Skipped: no Vulkan library or device\n");
+        return;
+    }
+
+    std::printf("  Device: %s, %zu draws\n", context.GetDeviceName(), DrawCount);
+
+    {
+        RecordingThreads threads(context, 1u);
+
+        Benchmark::Measure("Inline", DrawCount, [&]
+        {
+            threads.RecordInline(DrawCount);
+        });
+    }
+
+    uint32 const maxThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    char         name[64];
+
+    for (uint32 threadCount = 1u; ; threadCount = std::min(threadCount * 2u, maxThreadCount))
+    {
+        RecordingThreads threads(context, threadCount);
+
+        std::snprintf(name, sizeof(name), "Secondary %2u threads", threadCount);
+
+        Benchmark::Measure(name, DrawCount, [&]
+        {
+            threads.Record(DrawCount);
+        });
+
+        if (threadCount == maxThreadCount)
+            break;
+    }
+}
\ No newline at end of file
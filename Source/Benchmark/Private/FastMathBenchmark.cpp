@@ -0,0 +1,292 @@
+#include "PCH.hpp"
+
+#include "Benchmark.hpp"
+#include "Mathematic/Utility.hpp"
+
+/**
+ * Throughput of the Math::Fast* approximations, one call at a time and in batch, against the libm functions,
+ * and their accuracy against the double precision functions, which fails the run when a documented bound is exceeded.
+ */
+
+// ============================== [Helpers] ============================== //
+
+static constexpr size_t ValueCount  = 16384u;
+static constexpr uint32 Repetitions = 50u;
+
+/** Number of values each approximation is checked on, over its whole documented domain. */
+static constexpr size_t CheckCount  = 1u << 22u;
+
+/** Max errors documented in Utility.inl. */
+static constexpr double SinCosBound     = 1e-7;
+static constexpr double Atan2Bound      = 2e-6;
+static constexpr double ExpBound        = 1e-7;
+static constexpr double LogBound        = 3e-7;
+static constexpr double LogUlpBound     = 1.0;
+
+#if defined(MATH_SIMD_SSE4)
+static constexpr double InvSqrtBound    = 3e-7;
+#else
+static constexpr double InvSqrtBound    = 5e-6;
+#endif
+
+static std::vector<float>   MakeValues  (float  p_min,
+                                         float  p_max,
+                                         size_t p_count = ValueCount) noexcept
+{
+    std::mt19937                          random(1u);
+    std::uniform_real_distribution<float> distribution(p_min, p_max);
+    std::vector<float>                    values(p_count);
+
+    for (float& value : values)
+        value = distribution(random);
+
+    return values;
+}
+
+/**
+ * Uniformly distributed bit patterns of positive normal floats, which covers every exponent.
+ */
+static std::vector<float>   MakeNormals () noexcept
+{
+    std::mt19937                           random(1u);
+    std::uniform_int_distribution<uint32>  distribution(0x00800000u, 0x7f7fffffu);
+    std::vector<float>                     values(CheckCount);
+
+    for (float& value : values)
+    {
+        uint32 bits = distribution(random);
+
+        std::memcpy(&value, &bits, sizeof(value));
+    }
+
+    return values;
+}
+
+/**
+ * @return The largest "p_error(i)" for i in [0, p_count), NaN if any of them is NaN.
+ */
+template<typename Error>
+static double   MaxError    (size_t         p_count,
+                             Error&&        p_error) noexcept
+{
+    double maxError = 0.0;
+
+    for (size_t i = 0u; i < p_count; ++i)
+    {
+        double error = p_error(i);
+
+        if (!(error <= maxError))
+            maxError = error;
+    }
+
+    return maxError;
+}
+
+/**
+ * @return The distance between "p_value" and "p_reference", in units in the last place of the reference rounded to a float.
+ */
+static double   UlpError    (float          p_value,
+                             double         p_reference) noexcept
+{
+    float magnitude = std::fabs(static_cast<float>(p_reference));
+
+    return std::fabs(p_value - p_reference) / (std::nextafter(magnitude, INFINITY) - magnitude);
+}
+
+/**
+ * Runs "p_function" Repetitions times per sample, each call processing ValueCount values.
+ */
+template<typename Function>
+static void     Measure     (char const*    p_name,
+                             Function&&     p_function) noexcept
+{
+    Benchmark::Measure(p_name, static_cast<uint64>(Repetitions) * ValueCount, [&]
+    {
+        for (uint32 repetition = 0u; repetition < Repetitions; ++repetition)
+            p_function();
+    });
+}
+
+// ============================== [Benchmarks] ============================== //
+
+BENCHMARK(FastMath)
+{
+    std::vector<float> angles    = MakeValues(-MATH_PI_F, MATH_PI_F);
+    std::vector<float> powers    = MakeValues(-80.0f, 80.0f);
+    std::vector<float> positives = MakeValues(1e-3f, 1e3f);
+    std::vector<float> results   (ValueCount);
+    std::vector<float> others    (ValueCount);
+
+    // Sine and cosine //
+    Measure("SinCos    Math::Sin + Math::Cos", [&]
+    {
+        for (size_t i = 0u; i < ValueCount; ++i)
+        {
+            results[i] = Math::Sin(angles[i]);
+            others [i] = Math::Cos(angles[i]);
+        }
+
+        Benchmark::DoNotOptimize(results);
+        Benchmark::DoNotOptimize(others);
+    });
+
+    Measure("SinCos    Math::FastSinCos", [&]
+    {
+        for (size_t i = 0u; i < ValueCount; ++i)
+            Math::FastSinCos(angles[i], results[i], others[i]);
+
+        Benchmark::DoNotOptimize(results);
+        Benchmark::DoNotOptimize(others);
+    });
+
+    Measure("SinCos    Math::FastSinCos batch", [&]
+    {
+        Math::FastSinCos(angles.data(), results.data(), others.data(), ValueCount);
+        Benchmark::DoNotOptimize(results);
+        Benchmark::DoNotOptimize(others);
+    });
+
+    // Atan2 //
+    Measure("Atan2     Math::Atan2", [&]
+    {
+        for (size_t i = 0u; i < ValueCount; ++i)
+            results[i] = Math::Atan2(angles[i], powers[i]);
+
+        Benchmark::DoNotOptimize(results);
+    });
+
+    Measure("Atan2     Math::FastAtan2 batch", [&]
+    {
+        Math::FastAtan2(angles.data(), powers.data(), results.data(), ValueCount);
+        Benchmark::DoNotOptimize(results);
+    });
+
+    // Exp //
+    Measure("Exp       Math::Exp", [&]
+    {
+        for (size_t i = 0u; i < ValueCount; ++i)
+            results[i] = Math::Exp(powers[i]);
+
+        Benchmark::DoNotOptimize(results);
+    });
+
+    Measure("Exp       Math::FastExp batch", [&]
+    {
+        Math::FastExp(powers.data(), results.data(), ValueCount);
+        Benchmark::DoNotOptimize(results);
+    });
+
+    // Log //
+    Measure("Log       std::log", [&]
+    {
+        for (size_t i = 0u; i < ValueCount; ++i)
+            results[i] = std::log(positives[i]);
+
+        Benchmark::DoNotOptimize(results);
+    });
+
+    Measure("Log       Math::FastLog batch", [&]
+    {
+        Math::FastLog(positives.data(), results.data(), ValueCount);
+        Benchmark::DoNotOptimize(results);
+    });
+
+    // Inverse square root //
+    Measure("InvSqrt   Math::InvSqrt", [&]
+    {
+        for (size_t i = 0u; i < ValueCount; ++i)
+            results[i] = Math::InvSqrt(positives[i]);
+
+        Benchmark::DoNotOptimize(results);
+    });
+
+    Measure("InvSqrt   Math::FastInvSqrt", [&]
+    {
+        for (size_t i = 0u; i < ValueCount; ++i)
+            results[i] = Math::FastInvSqrt(positives[i]);
+
+        Benchmark::DoNotOptimize(results);
+    });
+
+    Measure("InvSqrt   Math::FastInvSqrt batch", [&]
+    {
+        Math::FastInvSqrt(positives.data(), results.data(), ValueCount);
+        Benchmark::DoNotOptimize(results);
+    });
+}
+
+BENCHMARK(FastMathAccuracy)
+{
+    std::vector<float> angles   = MakeValues(-8192.0f, 8192.0f, CheckCount);
+    std::vector<float> powers   = MakeValues(-87.0f,   88.0f,   CheckCount);
+    std::vector<float> logs     = MakeValues(0x1p-10f, 0x1p10f, CheckCount);
+    std::vector<float> normals  = MakeNormals();
+    std::vector<float> results  (CheckCount);
+    std::vector<float> others   (CheckCount);
+
+    // Sine and cosine, absolute //
+    Math::FastSinCos(angles.data(), results.data(), others.data(), CheckCount);
+
+    Benchmark::Check("SinCos    Math::FastSinCos", MaxError(CheckCount, [&] (size_t i)
+    {
+        float sine;
+        float cosine;
+
+        Math::FastSinCos(angles[i], sine, cosine);
+
+        double referenceSine   = std::sin(static_cast<double>(angles[i]));
+        double referenceCosine = std::cos(static_cast<double>(angles[i]));
+
+        return std::max({ std::fabs(sine       - referenceSine), std::fabs(cosine     - referenceCosine),
+                          std::fabs(results[i] - referenceSine), std::fabs(others[i]  - referenceCosine) });
+    }), SinCosBound);
+
+    // Atan2, absolute //
+    Math::FastAtan2(angles.data(), powers.data(), results.data(), CheckCount);
+
+    Benchmark::Check("Atan2     Math::FastAtan2", MaxError(CheckCount, [&] (size_t i)
+    {
+        double reference = std::atan2(static_cast<double>(angles[i]), static_cast<double>(powers[i]));
+
+        return std::max(std::fabs(Math::FastAtan2(angles[i], powers[i]) - reference), std::fabs(results[i] - reference));
+    }), Atan2Bound);
+
+    // Exp, relative //
+    Math::FastExp(powers.data(), results.data(), CheckCount);
+
+    Benchmark::Check("Exp       Math::FastExp", MaxError(CheckCount, [&] (size_t i)
+    {
+        double reference = std::exp(static_cast<double>(powers[i]));
+
+        return std::max(std::fabs(Math::FastExp(powers[i]) - reference), std::fabs(results[i] - reference)) / reference;
+    }), ExpBound);
+
+    // Log, absolute on [2^-10, 2^10] and in ulps on every normal //
+    Math::FastLog(logs.data(), results.data(), CheckCount);
+
+    Benchmark::Check("Log       Math::FastLog [2^-10, 2^10]", MaxError(CheckCount, [&] (size_t i)
+    {
+        double reference = std::log(static_cast<double>(logs[i]));
+
+        return std::max(std::fabs(Math::FastLog(logs[i]) - reference), std::fabs(results[i] - reference));
+    }), LogBound);
+
+    Math::FastLog(normals.data(), results.data(), CheckCount);
+
+    Benchmark::Check("Log       Math::FastLog (ulp)", MaxError(CheckCount, [&] (size_t i)
+    {
+        double reference = std::log(static_cast<double>(normals[i]));
+
+        return std::max(UlpError(Math::FastLog(normals[i]), reference), UlpError(results[i], reference));
+    }), LogUlpBound);
+
+    // Inverse square root, relative //
+    Math::FastInvSqrt(normals.data(), results.data(), CheckCount);
+
+    Benchmark::Check("InvSqrt   Math::FastInvSqrt", MaxError(CheckCount, [&] (size_t i)
+    {
+        double reference = 1.0 / std::sqrt(static_cast<double>(normals[i]));
+
+        return std::max(std::fabs(Math::FastInvSqrt(normals[i]) - reference), std::fabs(results[i] - reference)) / reference;
+    }), InvSqrtBound);
+}
\ No newline at end of file
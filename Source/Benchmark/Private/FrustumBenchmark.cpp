@@ -0,0 +1,97 @@
+#include "PCH.hpp"
+
+#include "Benchmark.hpp"
+#include "Mathematic/Frustum.hpp"
+#include "Mathematic/SIMDLanes.hpp"
+
+/**
+ * Throughput of the Frustum culling kernels against the same tests done one box or one sphere at a time.
+ */
+
+// ============================== [Helpers] ============================== //
+
+static constexpr size_t BoundsCount = 16384u;
+static constexpr uint32 Repetitions = 50u;
+
+/**
+ * A camera looking at the origin, seeing roughly a fifth of the boxes spread around it.
+ */
+static Frustum  MakeFrustum () noexcept
+{
+    Matrix4x4 const projection {Matrix4x4::Perspective(Math::DegToRad(60.0f), 16.0f / 9.0f, 0.1f, 200.0f)};
+    Matrix4x4 const view       {Matrix4x4::LookAt(Vector3(5.0f, 3.0f, -20.0f), Vector3::Zero, Vector3::Up).GetInverse()};
+
+    return Frustum(projection * view);
+}
+
+/**
+ * Runs "p_function" Repetitions times per sample, each call processing BoundsCount elements.
+ */
+template<typename Function>
+static void     Measure     (char const*    p_name,
+                             Function&&     p_function) noexcept
+{
+    Benchmark::Measure(p_name, static_cast<uint64>(Repetitions) * BoundsCount, [&]
+    {
+        for (uint32 repetition = 0u; repetition < Repetitions; ++repetition)
+            p_function();
+    });
+}
+
+// ============================== [Benchmarks] ============================== //
+
+BENCHMARK(FrustumCulling)
+{
+    std::mt19937                          random(1u);
+    std::uniform_real_distribution<float> position(-150.0f, 150.0f);
+    std::uniform_real_distribution<float> extent  (0.01f, 15.0f);
+    std::vector<Bounds>                   bounds;
+    std::vector<Vector4>                  spheres;
+    std::vector<uint64>                   visibility(Frustum::GetVisibilityWordCount(BoundsCount));
+    Frustum const                         frustum   {MakeFrustum()};
+
+    for (size_t i = 0u; i < BoundsCount; ++i)
+    {
+        Vector3 const center {position(random), position(random), position(random)};
+        Vector3 const size   {extent(random), extent(random), extent(random)};
+
+        bounds .emplace_back(center - size, center + size);
+        spheres.emplace_back(center.m_x, center.m_y, center.m_z, size.m_x);
+    }
+
+    std::printf("  Lanes per instruction: %zu\n", WideLanes::Width);
+
+    // Bounds //
+    Measure("Bounds    per box", [&]
+    {
+        std::fill(visibility.begin(), visibility.end(), 0ull);
+
+        for (size_t i = 0u; i < BoundsCount; ++i)
+            visibility[i / 64u] |= static_cast<uint64>(frustum.IsVisible(bounds[i])) << (i % 64u);
+
+        Benchmark::DoNotOptimize(visibility);
+    });
+
+    Measure("Bounds    CullBounds", [&]
+    {
+        frustum.CullBounds(bounds.data(), BoundsCount, visibility.data());
+        Benchmark::DoNotOptimize(visibility);
+    });
+
+    // Spheres //
+    Measure("Spheres   per sphere", [&]
+    {
+        std::fill(visibility.begin(), visibility.end(), 0ull);
+
+        for (size_t i = 0u; i < BoundsCount; ++i)
+            visibility[i / 64u] |= static_cast<uint64>(frustum.IsVisible(Vector3(spheres[i].m_x, spheres[i].m_y, spheres[i].m_z), spheres[i].m_w)) << (i % 64u);
+
+        Benchmark::DoNotOptimize(visibility);
+    });
+
+    Measure("Spheres   CullSpheres", [&]
+    {
+        frustum.CullSpheres(spheres.data(), BoundsCount, visibility.data());
+        Benchmark::DoNotOptimize(visibility);
+    });
+}
\ No newline at end of file
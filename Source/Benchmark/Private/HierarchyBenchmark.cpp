@@ -0,0 +1,121 @@
+#include "PCH.hpp"
+
+#include "Benchmark.hpp"
+#include "BoundingVolumeHierarchy.hpp"
+
+/**
+ * Cost of culling a large scene with the Renderer's bounding volume hierarchy against the flat CullBounds kernel,
+ * and cost of keeping the hierarchy up to date as part of the scene moves.
+ */
+
+// ============================== [Helpers] ============================== //
+
+static constexpr size_t ProxyCount  = 131072u;
+static constexpr size_t MovedCount  = 4096u;
+static constexpr uint32 Repetitions = 10u;
+
+/**
+ * A camera in a scene spread over a kilometer, seeing a small part of it as in a large level.
+ */
+static Frustum  MakeFrustum () noexcept
+{
+    Matrix4x4 const projection {Matrix4x4::Perspective(Math::DegToRad(60.0f), 16.0f / 9.0f, 0.1f, 150.0f)};
+    Matrix4x4 const view       {Matrix4x4::LookAt(Vector3(5.0f, 3.0f, -20.0f), Vector3::Zero, Vector3::Up).GetInverse()};
+
+    return Frustum(projection * view);
+}
+
+// ============================== [Benchmarks] ============================== //
+
+BENCHMARK(HierarchyCulling)
+{
+    std::mt19937                          random(1u);
+    std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> extent  (0.1f, 4.0f);
+    std::uniform_real_distribution<float> offset  (-0.5f, 0.5f);
+    std::vector<Bounds>                   bounds;
+    std::vector<int32>                    proxies;
+    std::vector<uint64>                   visibility(Frustum::GetVisibilityWordCount(ProxyCount));
+    Frustum const                         frustum   {MakeFrustum()};
+    BoundingVolumeHierarchy               hierarchy;
+
+    for (size_t i = 0u; i < ProxyCount; ++i)
+    {
+        Vector3 const center {position(random), position(random) * 0.05f, position(random)};
+        Vector3 const size   {extent(random), extent(random), extent(random)};
+
+        bounds .emplace_back(center - size, center + size);
+        proxies.push_back   (hierarchy.CreateProxy(bounds.back(), nullptr));
+    }
+
+    std::printf("  Height: %d for %zu proxies\n", hierarchy.GetHeight(), hierarchy.GetProxyCount());
+
+    Benchmark::Measure("Flat CullBounds", static_cast<uint64>(Repetitions) * ProxyCount, [&]
+    {
+        for (uint32 repetition = 0u; repetition < Repetitions; ++repetition)
+        {
+            frustum.CullBounds(bounds.data(), ProxyCount, visibility.data());
+            Benchmark::DoNotOptimize(visibility);
+        }
+    });
+
+    size_t visibleCount = 0u;
+
+    Benchmark::Measure("Hierarchy Query (Frustum)", static_cast<uint64>(Repetitions) * ProxyCount, [&]
+    {
+        for (uint32 repetition = 0u; repetition < Repetitions; ++repetition)
+        {
+            visibleCount = 0u;
+
+            hierarchy.Query(frustum, [&visibleCount] (int32) { ++visibleCount; });
+
+            Benchmark::DoNotOptimize(visibleCount);
+        }
+    });
+
+    std::printf("  Visible: %zu\n", visibleCount);
+
+    // Moves a part of the scene per frame, the way the Renderer does, with its reinsertion budget.
+    Benchmark::Measure("Hierarchy MoveProxy + Update", static_cast<uint64>(Repetitions) * MovedCount, [&]
+    {
+        for (uint32 repetition = 0u; repetition < Repetitions; ++repetition)
+        {
+            for (size_t i = 0u; i < MovedCount; ++i)
+            {
+                size_t const  index = static_cast<size_t>(random()) % ProxyCount;
+                Vector3 const move {offset(random), offset(random), offset(random)};
+
+                bounds[index] = Bounds(bounds[index].m_min + move, bounds[index].m_max + move);
+
+                hierarchy.MoveProxy(proxies[index], bounds[index]);
+            }
+
+            Benchmark::DoNotOptimize(hierarchy.Update(256u));
+        }
+    });
+
+    std::printf("  Queued: %zu\n", hierarchy.GetQueuedCount());
+
+    // The queued proxies are tested one by one, this is what they cost the queries.
+    Benchmark::Measure("Hierarchy Query (Frustum) after moves", static_cast<uint64>(Repetitions) * ProxyCount, [&]
+    {
+        for (uint32 repetition = 0u; repetition < Repetitions; ++repetition)
+        {
+            visibleCount = 0u;
+
+            hierarchy.Query(frustum, [&visibleCount] (int32) { ++visibleCount; });
+
+            Benchmark::DoNotOptimize(visibleCount);
+        }
+    });
+
+    // Moved or not, queued or not, the hierarchy finds the proxies the flat kernel finds.
+    size_t flatCount = 0u;
+
+    frustum.CullBounds(bounds.data(), ProxyCount, visibility.data());
+
+    for (size_t i = 0u; i < ProxyCount; ++i)
+        flatCount += (visibility[i / 64u] >> (i % 64u)) & 1u;
+
+    Benchmark::Check("Hierarchy Query (Frustum) missed proxies", std::fabs(static_cast<double>(flatCount) - static_cast<double>(visibleCount)), 0.0);
+}
\ No newline at end of file
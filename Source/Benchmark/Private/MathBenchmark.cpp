@@ -0,0 +1,220 @@
+#include "PCH.hpp"
+
+#include "Benchmark.hpp"
+#include "Mathematic/Bounds.hpp"
+#include "Mathematic/Transform.hpp"
+
+/**
+ * Throughput of the Core/Mathematic operations the engine runs per object and per vertex:
+ * matrix product and inverse, quaternion slerp, transform composition, bounds tests and vertex hashing.
+ *
+ * Every operation is measured twice:
+ *  - "Hot"  : the operands fit in L1 and are visited in a random order, which measures the arithmetic.
+ *  - "Cold" : the operands are far bigger than the last level cache and visited in a random order,
+ *             which measures the arithmetic plus the cache misses, the way a scene is walked.
+ */
+
+// ============================== [Helpers] ============================== //
+
+static constexpr size_t HotCount        = 256u;
+static constexpr size_t ColdCount       = 1u << 19u;
+static constexpr size_t OperationCount  = ColdCount;
+
+/**
+ * Mirror of the Vertex layout and of its std::hash specialization (RHI/Vulkan/Asset/Model/Vertex.hpp),
+ * which cannot be included without Vulkan. Both only rely on std::hash<Vector2> and std::hash<Vector3>.
+ */
+struct HashedVertex
+{
+    Vector3 position;
+    Vector3 normal;
+    Vector2 uv;
+    Vector3 tangent;
+};
+
+static size_t       HashVertex      (HashedVertex const&    p_vertex) noexcept
+{
+    size_t h1 = std::hash<Vector3>()(p_vertex.position);
+    size_t h2 = std::hash<Vector3>()(p_vertex.normal);
+    size_t h3 = std::hash<Vector2>()(p_vertex.uv);
+    size_t h4 = std::hash<Vector3>()(p_vertex.tangent);
+
+    return ((((h1 ^ (h2 << 1)) >> 1) ^ h3) << 1) ^ h4;
+}
+
+static Vector3      RandomVector    (std::mt19937&          p_random,
+                                     float                  p_min,
+                                     float                  p_max) noexcept
+{
+    std::uniform_real_distribution<float> distribution(p_min, p_max);
+
+    return Vector3(distribution(p_random), distribution(p_random), distribution(p_random));
+}
+
+static Quaternion   RandomRotation  (std::mt19937&          p_random) noexcept
+{
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    return Quaternion(distribution(p_random), distribution(p_random), distribution(p_random), distribution(p_random)).GetSafeNormalized();
+}
+
+static Transform    RandomTransform (std::mt19937&          p_random) noexcept
+{
+    return Transform(RandomVector(p_random, -10.0f, 10.0f), RandomRotation(p_random), RandomVector(p_random, 0.5f, 2.0f));
+}
+
+/**
+ * Order in which the operands are visited: OperationCount indices below "p_count",
+ * a permutation when every operand is visited once.
+ */
+static std::vector<uint32>  MakeIndices (size_t         p_count,
+                                         std::mt19937&  p_random) noexcept
+{
+    std::vector<uint32> indices(OperationCount);
+
+    for (size_t i = 0u; i < OperationCount; ++i)
+        indices[i] = static_cast<uint32>(i % p_count);
+
+    std::shuffle(indices.begin(), indices.end(), p_random);
+
+    return indices;
+}
+
+/**
+ * Measures "p_operation" on hot then on cold operands, both made by "p_generator".
+ */
+template<typename T, typename Generator, typename Operation>
+static void     MeasureHotAndCold   (char const*    p_name,
+                                     Generator&&    p_generator,
+                                     Operation&&    p_operation) noexcept
+{
+    char name[64];
+
+    for (size_t count : { HotCount, ColdCount })
+    {
+        std::mt19937        random(1u);
+        std::vector<T>      a(count);
+        std::vector<T>      b(count);
+        std::vector<uint32> indices = MakeIndices(count, random);
+
+        for (size_t i = 0u; i < count; ++i)
+        {
+            a[i] = p_generator(random);
+            b[i] = p_generator(random);
+        }
+
+        std::snprintf(name, sizeof(name), "%-4s %s", count == HotCount ? "Hot" : "Cold", p_name);
+
+        Benchmark::Measure(name, OperationCount, [&]
+        {
+            for (uint32 index : indices)
+                Benchmark::DoNotOptimize(p_operation(a[index], b[index]));
+        });
+    }
+}
+
+// ============================== [Benchmarks] ============================== //
+
+BENCHMARK(MathMatrix4x4)
+{
+    auto generator = [](std::mt19937& p_random) { return RandomTransform(p_random).GetMatrix(); };
+
+    MeasureHotAndCold<Matrix4x4>("Matrix4x4 * Matrix4x4", generator, [](Matrix4x4 const& p_a, Matrix4x4 const& p_b)
+    {
+        return p_a * p_b;
+    });
+
+    MeasureHotAndCold<Matrix4x4>("Matrix4x4::GetInverse", generator, [](Matrix4x4 const& p_a, Matrix4x4 const&)
+    {
+        return p_a.GetInverse();
+    });
+}
+
+BENCHMARK(MathQuaternion)
+{
+    MeasureHotAndCold<Quaternion>("Quaternion::Slerp", RandomRotation, [](Quaternion const& p_a, Quaternion const& p_b)
+    {
+        return Quaternion::Slerp(p_a, p_b, 0.3f);
+    });
+
+    auto generator = [](std::mt19937& p_random)
+    {
+        Vector3 xyz = RandomVector(p_random, -10.0f, 10.0f);
+
+        return Quaternion(xyz.m_x, xyz.m_y, xyz.m_z, RandomVector(p_random, -10.0f, 10.0f).m_x);
+    };
+
+    MeasureHotAndCold<Quaternion>("Quaternion::GetSafeNormalized", generator, [](Quaternion const& p_a, Quaternion const&)
+    {
+        return p_a.GetSafeNormalized();
+    });
+
+    // The vector path against the scalar formula, and the fallbacks of both.
+    std::mt19937 random(1u);
+    float        error = 0.0f;
+
+    for (size_t i = 0u; i < HotCount; ++i)
+    {
+        Quaternion const quaternion = generator(random);
+        Quaternion const normalized = quaternion.GetSafeNormalized();
+        float const      scale      = Math::InvSqrt(quaternion.m_x * quaternion.m_x + quaternion.m_y * quaternion.m_y +
+                                                    quaternion.m_z * quaternion.m_z + quaternion.m_w * quaternion.m_w);
+
+        error = std::max({ error, std::fabs(normalized.m_x - quaternion.m_x * scale), std::fabs(normalized.m_y - quaternion.m_y * scale),
+                                  std::fabs(normalized.m_z - quaternion.m_z * scale), std::fabs(normalized.m_w - quaternion.m_w * scale) });
+    }
+
+    Benchmark::Check("Quaternion::GetSafeNormalized", error, MATH_SIMD_TOLERANCE_F);
+
+    Benchmark::Check("Quaternion::GetSafeNormalized (NaN)",  Quaternion(NAN, 0.0f, 0.0f, 1.0f).GetSafeNormalized() == Quaternion(0, 0, 0, 1) ? 0.0 : 1.0, 0.0);
+    Benchmark::Check("Quaternion::GetSafeNormalized (zero)", Quaternion(0.0f, 0.0f, 0.0f, 0.0f).GetSafeNormalized() == Quaternion(0, 0, 0, 1) ? 0.0 : 1.0, 0.0);
+}
+
+BENCHMARK(MathTransform)
+{
+    MeasureHotAndCold<Transform>("Transform * Transform", RandomTransform, [](Transform const& p_a, Transform const& p_b)
+    {
+        return p_a * p_b;
+    });
+}
+
+BENCHMARK(MathBounds)
+{
+    auto generator = [](std::mt19937& p_random)
+    {
+        Vector3 min = RandomVector(p_random, -10.0f, 10.0f);
+
+        return Bounds(min, min + RandomVector(p_random, 0.1f, 5.0f));
+    };
+
+    MeasureHotAndCold<Bounds>("Bounds::IsInside (point)", generator, [](Bounds const& p_a, Bounds const& p_b)
+    {
+        return p_a.IsInside(p_b.GetCenter());
+    });
+
+    MeasureHotAndCold<Bounds>("Bounds::IsIntersecting", generator, [](Bounds const& p_a, Bounds const& p_b)
+    {
+        return p_a.IsIntersecting(p_b);
+    });
+
+    MeasureHotAndCold<Bounds>("Bounds::Overlap", generator, [](Bounds const& p_a, Bounds const& p_b)
+    {
+        return Bounds::Overlap(p_a, p_b);
+    });
+}
+
+BENCHMARK(MathHash)
+{
+    auto generator = [](std::mt19937& p_random)
+    {
+        Vector3 uv = RandomVector(p_random, 0.0f, 1.0f);
+
+        return HashedVertex { RandomVector(p_random, -10.0f, 10.0f), RandomVector(p_random, -1.0f, 1.0f),
+                              Vector2(uv.m_x, uv.m_y),               RandomVector(p_random, -1.0f, 1.0f) };
+    };
+
+    MeasureHotAndCold<HashedVertex>("std::hash<Vertex>", generator, [](HashedVertex const& p_a, HashedVertex const&)
+    {
+        return HashVertex(p_a);
+    });
+}
\ No newline at end of file
@@ -0,0 +1,224 @@
+#include "PCH.hpp"
+
+#include "Benchmark.hpp"
+#include "Mathematic/Matrix4x4.hpp"
+
+/**
+ * Throughput of the Matrix4x4 hot paths (product, inverse, point and Vector4 transforms)
+ * against the former scalar implementation, which is mirrored below as the reference.
+ *
+ * Every scenario also reports the largest relative difference with the reference,
+ * to be checked against the accuracy documented in Mathematic/SIMD.hpp.
+ */
+
+// ============================== [Scalar Reference] ============================== //
+
+/**
+ * Unchecked access to the coefficients, Matrix4x4::operator() validates its index.
+ */
+static FORCEINLINE float const* Values  (Matrix4x4 const&   p_matrix) noexcept
+{
+    static_assert(sizeof(Matrix4x4) == 16u * sizeof(float), "Matrix4x4 must only hold its 16 coefficients.");
+
+    return reinterpret_cast<float const*>(&p_matrix);
+}
+
+static Matrix4x4    ScalarMultiply      (Matrix4x4 const&   p_a,
+                                         Matrix4x4 const&   p_b) noexcept
+{
+    Matrix4x4    result;
+    float*       r {result.GetValues()};
+    float const* a {Values(p_a)};
+    float const* b {Values(p_b)};
+
+    for (int32 column = 0; column < 4; ++column)
+        for (int32 row = 0; row < 4; ++row)
+            r[column * 4 + row] = a[row]     * b[column * 4]     + a[4 + row]  * b[column * 4 + 1] +
+                                  a[8 + row] * b[column * 4 + 2] + a[12 + row] * b[column * 4 + 3];
+
+    return result;
+}
+
+static Matrix4x4    ScalarInverse       (Matrix4x4 const&   p_matrix) noexcept
+{
+    Matrix4x4    result;
+    float*       r {result.GetValues()};
+    float const* m {Values(p_matrix)};
+
+    float d12 {m[2]  * m[7]  - m[3]  * m[6] };
+    float d13 {m[2]  * m[11] - m[3]  * m[10]};
+    float d14 {m[2]  * m[15] - m[3]  * m[14]};
+    float d23 {m[6]  * m[11] - m[7]  * m[10]};
+    float d24 {m[6]  * m[15] - m[7]  * m[14]};
+    float d34 {m[10] * m[15] - m[11] * m[14]};
+
+    r[0]  =  (m[5] * d34 - m[9] * d24 + m[13] * d23);
+    r[1]  = -(m[1] * d34 - m[9] * d14 + m[13] * d13);
+    r[2]  =  (m[1] * d24 - m[5] * d14 + m[13] * d12);
+    r[3]  = -(m[1] * d23 - m[5] * d13 + m[9]  * d12);
+
+    float determinant {m[0] * r[0] + m[4] * r[1] + m[8] * r[2] + m[12] * r[3]};
+
+    if (determinant == 0.0f)
+        return Matrix4x4::Identity;
+
+    r[4]  = -(m[4] * d34 - m[8] * d24 + m[12] * d23);
+    r[5]  =  (m[0] * d34 - m[8] * d14 + m[12] * d13);
+    r[6]  = -(m[0] * d24 - m[4] * d14 + m[12] * d12);
+    r[7]  =  (m[0] * d23 - m[4] * d13 + m[8]  * d12);
+
+    d12 = m[0] * m[5]  - m[1] * m[4];
+    d13 = m[0] * m[9]  - m[1] * m[8];
+    d14 = m[0] * m[13] - m[1] * m[12];
+    d23 = m[4] * m[9]  - m[5] * m[8];
+    d24 = m[4] * m[13] - m[5] * m[12];
+    d34 = m[8] * m[13] - m[9] * m[12];
+
+    r[8]  =  (m[7] * d34 - m[11] * d24 + m[15] * d23);
+    r[9]  = -(m[3] * d34 - m[11] * d14 + m[15] * d13);
+    r[10] =  (m[3] * d24 - m[7]  * d14 + m[15] * d12);
+    r[11] = -(m[3] * d23 - m[7]  * d13 + m[11] * d12);
+
+    r[12] = -(m[6] * d34 - m[10] * d24 + m[14] * d23);
+    r[13] =  (m[2] * d34 - m[10] * d14 + m[14] * d13);
+    r[14] = -(m[2] * d24 - m[6]  * d14 + m[14] * d12);
+    r[15] =  (m[2] * d23 - m[6]  * d13 + m[10] * d12);
+
+    return result * (1.0f / determinant);
+}
+
+static Vector4      ScalarTransform     (Matrix4x4 const&   p_matrix,
+                                         Vector4 const&     p_v) noexcept
+{
+    float const* m {Values(p_matrix)};
+
+    return Vector4(m[0] * p_v.m_x + m[4] * p_v.m_y + m[8]  * p_v.m_z + p_v.m_w * m[12],
+                   m[1] * p_v.m_x + m[5] * p_v.m_y + m[9]  * p_v.m_z + p_v.m_w * m[13],
+                   m[2] * p_v.m_x + m[6] * p_v.m_y + m[10] * p_v.m_z + p_v.m_w * m[14],
+                   m[3] * p_v.m_x + m[7] * p_v.m_y + m[11] * p_v.m_z + p_v.m_w * m[15]);
+}
+
+// ============================== [Helpers] ============================== //
+
+#if defined(MATH_SIMD_AVX2)
+    static char const* const    VectorPath  = "AVX2";
+#elif defined(MATH_SIMD_SSE4)
+    static char const* const    VectorPath  = "SSE4.1";
+#else
+    static char const* const    VectorPath  = "Scalar";
+#endif
+
+static constexpr size_t         MatrixCount = 1024u;
+static constexpr uint32         Repetitions = 200u;
+
+/**
+ * Random affine transforms (translation, rotation and non uniform scale) like the ones built by the scene graph.
+ */
+static std::vector<Matrix4x4>   MakeMatrices    (uint32 p_seed) noexcept
+{
+    std::mt19937                          random(p_seed);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::vector<Matrix4x4>                matrices;
+
+    matrices.reserve(MatrixCount);
+
+    for (size_t i = 0u; i < MatrixCount; ++i)
+    {
+        Vector3    translation(distribution(random) * 100.0f, distribution(random) * 100.0f, distribution(random) * 100.0f);
+        Quaternion rotation   (distribution(random), distribution(random), distribution(random), distribution(random));
+        Vector3    scale      (1.5f + distribution(random), 1.5f + distribution(random), 1.5f + distribution(random));
+
+        matrices.emplace_back(Matrix4x4::TRS(translation, rotation.GetSafeNormalized(), scale));
+    }
+
+    return matrices;
+}
+
+/**
+ * @return The largest difference between two matrices, relative to the largest coefficient of the reference.
+ */
+static float    RelativeError   (Matrix4x4 const&   p_value,
+                                 Matrix4x4 const&   p_reference) noexcept
+{
+    float difference = 0.0f;
+    float magnitude  = 0.0f;
+
+    for (int32 i = 0; i < 16; ++i)
+    {
+        difference = std::max(difference, std::fabs(p_value(i) - p_reference(i)));
+        magnitude  = std::max(magnitude,  std::fabs(p_reference(i)));
+    }
+
+    return magnitude > 0.0f ? difference / magnitude : difference;
+}
+
+/**
+ * Times "p_function" over every matrix, "Repetitions" times per sample.
+ */
+template<typename Function>
+static void     Measure         (char const*    p_name,
+                                 Function&&     p_function) noexcept
+{
+    Benchmark::Measure(p_name, static_cast<uint64>(Repetitions) * MatrixCount, [&]
+    {
+        for (uint32 repetition = 0u; repetition < Repetitions; ++repetition)
+            for (size_t i = 0u; i < MatrixCount; ++i)
+                p_function(i);
+    });
+}
+
+static void     ReportError     (char const*    p_name,
+                                 float          p_error) noexcept
+{
+    std::printf("  %-48s %12.3g max relative error (tolerance %g)\n", p_name, p_error, MATH_SIMD_TOLERANCE_F);
+}
+
+// ============================== [Benchmarks] ============================== //
+
+BENCHMARK(Matrix4x4Operations)
+{
+    std::vector<Matrix4x4> left    = MakeMatrices(1u);
+    std::vector<Matrix4x4> right   = MakeMatrices(2u);
+    std::vector<Matrix4x4> results (MatrixCount);
+    Vector4 const          vector  (1.0f, 2.0f, 3.0f, 1.0f);
+    Vector3 const          point   (1.0f, 2.0f, 3.0f);
+    char                   name[64];
+
+    std::printf("  Vector path: %s\n", VectorPath);
+
+    // Product //
+    Measure("Multiply          scalar", [&](size_t i) { results[i] = ScalarMultiply(left[i], right[i]); Benchmark::DoNotOptimize(results[i]); });
+
+    std::snprintf(name, sizeof(name), "Multiply          %s", VectorPath);
+    Measure(name, [&](size_t i) { results[i] = left[i] * right[i]; Benchmark::DoNotOptimize(results[i]); });
+
+    float error = 0.0f;
+
+    for (size_t i = 0u; i < MatrixCount; ++i)
+        error = std::max(error, RelativeError(left[i] * right[i], ScalarMultiply(left[i], right[i])));
+
+    ReportError("Multiply", error);
+
+    // Inverse //
+    Measure("Inverse           scalar", [&](size_t i) { results[i] = ScalarInverse(left[i]); Benchmark::DoNotOptimize(results[i]); });
+
+    std::snprintf(name, sizeof(name), "Inverse           %s", VectorPath);
+    Measure(name, [&](size_t i) { results[i] = left[i].GetInverse(); Benchmark::DoNotOptimize(results[i]); });
+
+    error = 0.0f;
+
+    for (size_t i = 0u; i < MatrixCount; ++i)
+        error = std::max(error, RelativeError(left[i].GetInverse(), ScalarInverse(left[i])));
+
+    ReportError("Inverse", error);
+
+    // Vector4 transform //
+    Measure("Transform Vector4 scalar", [&](size_t i) { Vector4 result = ScalarTransform(left[i], vector); Benchmark::DoNotOptimize(result); });
+
+    std::snprintf(name, sizeof(name), "Transform Vector4 %s", VectorPath);
+    Measure(name, [&](size_t i) { Vector4 result = left[i] * vector; Benchmark::DoNotOptimize(result); });
+
+    // Point transform //
+    std::snprintf(name, sizeof(name), "MultiplyPoint     %s", VectorPath);
+    Measure(name, [&](size_t i) { Vector3 result = left[i].MultiplyPoint(point); Benchmark::DoNotOptimize(result); });
+}
\ No newline at end of file
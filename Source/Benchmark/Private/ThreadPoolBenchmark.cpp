@@ -0,0 +1,275 @@
+#include "PCH.hpp"
+
+#include "Benchmark.hpp"
+#include "TaskGraph.hpp"
+#include "TaskScheduler.hpp"
+
+/**
+ * Benchmarks of the TaskScheduler the ThreadPool is built on, started here with as many workers as the ThreadPool,
+ * and of the TaskGraph the Engine runs its frame with.
+ *
+ * The submission scenarios measure the cost of moving tasks between threads: producers outside the scheduler go through
+ * the global queue, while the children a task spawns stay in the queue of its worker until they are stolen.
+ */
+
+// ============================== [Scenario] ============================== //
+
+/**
+ * Runs "p_producerCount" external threads, each submitting "p_rootTasks" tasks.
+ * Every task spawns "p_children" child tasks from the worker executing it, the way the AssetManager and the Renderer fan out.
+ *
+ * @return The elapsed time in seconds.
+ */
+static double   RunScenario (TaskScheduler& p_scheduler,
+                             uint32         p_producerCount,
+                             uint32         p_rootTasks,
+                             uint32         p_children) noexcept
+{
+    std::atomic<uint64>      executed { 0u };
+    uint64                   expected = static_cast<uint64>(p_producerCount) * p_rootTasks * (1u + p_children);
+    std::vector<std::thread> producers;
+
+    auto start = Benchmark::Clock::now();
+
+    for (uint32 i = 0u; i < p_producerCount; ++i)
+    {
+        producers.emplace_back([&]
+        {
+            for (uint32 j = 0u; j < p_rootTasks; ++j)
+            {
+                p_scheduler.SubmitDetachedTask([&]
+                {
+                    for (uint32 k = 0u; k < p_children; ++k)
+                        p_scheduler.SubmitDetachedTask([&] { executed.fetch_add(1u, std::memory_order_relaxed); });
+
+                    executed.fetch_add(1u, std::memory_order_relaxed);
+                });
+            }
+        });
+    }
+
+    for (auto& producer : producers)
+        producer.join();
+
+    // Helps like any thread waiting on the ThreadPool would.
+    while (executed.load(std::memory_order_relaxed) < expected)
+    {
+        if (!p_scheduler.TryExecuteTask())
+            std::this_thread::yield();
+    }
+
+    return std::chrono::duration<double>(Benchmark::Clock::now() - start).count();
+}
+
+// ============================== [Benchmarks] ============================== //
+
+BENCHMARK(ThreadPoolContention)
+{
+    TaskScheduler scheduler;
+    uint32        rootTasks = 20000u;
+    char          name[64];
+
+    scheduler.Start(std::max(std::thread::hardware_concurrency(), 2u) - 1u);
+
+    for (uint32 producers : { 1u, 4u })
+    {
+        for (uint32 children : { 0u, 16u })
+        {
+            uint64 operations = static_cast<uint64>(producers) * rootTasks * (1u + children);
+
+            std::snprintf(name, sizeof(name), "Submit %2u producers, %2u children", producers, children);
+            Benchmark::Report(name, operations, RunScenario(scheduler, producers, rootTasks, children));
+        }
+    }
+
+    scheduler.Stop();
+}
+
+BENCHMARK(ThreadPoolParallel)
+{
+    constexpr size_t Count = 1u << 20;
+
+    TaskScheduler       scheduler;
+    std::vector<float>  values  (Count);
+    std::vector<uint32> keys    (Count);
+    std::mt19937        random  (42u);
+
+    scheduler.Start(std::max(std::thread::hardware_concurrency(), 2u) - 1u);
+
+    for (size_t i = 0u; i < Count; ++i)
+        values[i] = static_cast<float>(i % 1000u) * 0.001f;
+
+    Benchmark::Measure("ParallelFor    1M iterations", Count, [&]
+    {
+        scheduler.ParallelFor(0u, Count, 0u, [&] (size_t p_index) { values[p_index] = std::sqrt(values[p_index] + 1.0f); });
+    });
+
+    Benchmark::Measure("ParallelReduce 1M iterations", Count, [&]
+    {
+        Benchmark::DoNotOptimize(scheduler.ParallelReduce(0u, Count, 0u, 0.0,
+                                                          [&] (size_t p_index)      { return static_cast<double>(values[p_index]); },
+                                                          [ ] (double p_a, double p_b) { return p_a + p_b; }));
+    });
+
+    Benchmark::Measure("ParallelSort   1M keys", Count, [&]
+    {
+        for (auto& key : keys)
+            key = random();
+
+        scheduler.ParallelSort(keys.begin(), keys.end(), 0u, std::less<uint32>());
+    });
+
+    // Odd bounds and a grain which does not divide the range, so the last chunk is partial.
+    constexpr size_t Begin = 37u;
+    constexpr size_t End   = Begin + 100003u;
+    constexpr size_t Grain = 97u;
+
+    std::vector<std::atomic<uint32>> visits(End + Begin);
+
+    scheduler.ParallelFor(Begin, End, Grain, [&] (size_t p_index) { visits[p_index].fetch_add(1u, std::memory_order_relaxed); });
+
+    uint64 wrongVisits = 0u;
+
+    for (size_t i = 0u; i < visits.size(); ++i)
+        wrongVisits += visits[i].load(std::memory_order_relaxed) != (i >= Begin && i < End ? 1u : 0u);
+
+    Benchmark::Check("ParallelFor    indices not visited once", static_cast<double>(wrongVisits), 0.0);
+
+    // Integers, so the sum is exact whatever the chunks are.
+    uint64 const parallelSum = scheduler.ParallelReduce(Begin, End, Grain, uint64(0u),
+                                                        [ ] (size_t p_index)          { return static_cast<uint64>(p_index) * p_index; },
+                                                        [ ] (uint64 p_a, uint64 p_b)  { return p_a + p_b; });
+    uint64       serialSum   = 0u;
+
+    for (size_t i = Begin; i < End; ++i)
+        serialSum += static_cast<uint64>(i) * i;
+
+    Benchmark::Check("ParallelReduce difference with the serial sum", static_cast<double>(parallelSum > serialSum ? parallelSum - serialSum : serialSum - parallelSum), 0.0);
+
+    // Few distinct keys, so the merges have to deal with runs of equal ones.
+    for (auto& key : keys)
+        key = random() % 1000u;
+
+    std::vector<uint32> sorted = keys;
+
+    scheduler.ParallelSort(keys.begin(), keys.end(), 1000u + Grain, std::less<uint32>());
+    std::sort(sorted.begin(), sorted.end());
+
+    // Both are sorted, so they are equal only if the parallel output is a permutation of the input.
+    uint64 unsortedPairs = 0u;
+    uint64 misplacedKeys = 0u;
+
+    for (size_t i = 0u; i < keys.size(); ++i)
+    {
+        unsortedPairs += i > 0u && keys[i] < keys[i - 1u];
+        misplacedKeys += keys[i] != sorted[i];
+    }
+
+    Benchmark::Check("ParallelSort   unsorted pairs", static_cast<double>(unsortedPairs), 0.0);
+    Benchmark::Check("ParallelSort   keys differing from std::sort", static_cast<double>(misplacedKeys), 0.0);
+
+    // A ParallelFor called from a worker must help rather than block it, or the workers end up waiting on each other.
+    constexpr size_t Outer = 64u;
+    constexpr size_t Inner = 4096u;
+
+    std::atomic<uint64> nestedCount { 0u };
+    std::atomic_bool    isDetachedDone { false };
+
+    scheduler.ParallelFor(0u, Outer, 1u, [&] (size_t)
+    {
+        scheduler.ParallelFor(0u, Inner, 0u, [&] (size_t) { nestedCount.fetch_add(1u, std::memory_order_relaxed); });
+    });
+
+    scheduler.SubmitDetachedTask([&]
+    {
+        scheduler.ParallelFor(0u, Inner, 0u, [&] (size_t) { nestedCount.fetch_add(1u, std::memory_order_relaxed); });
+
+        isDetachedDone.store(true, std::memory_order_release);
+    });
+
+    while (!isDetachedDone.load(std::memory_order_acquire))
+    {
+        if (!scheduler.TryExecuteTask())
+            std::this_thread::yield();
+    }
+
+    Benchmark::Check("ParallelFor    nested iterations missed", static_cast<double>((Outer + 1u) * Inner - nestedCount.load(std::memory_order_relaxed)), 0.0);
+
+    scheduler.Stop();
+}
+
+BENCHMARK(ThreadPoolGraph)
+{
+    constexpr uint32 Width = 64u;
+
+    TaskScheduler scheduler;
+
+    scheduler.Start(std::max(std::thread::hardware_concurrency(), 2u) - 1u);
+
+    {
+        // Fan-out from a source to "Width" nodes, fan-in to a sink. Each node records when it ran.
+        TaskGraph           graph(scheduler);
+        std::atomic<uint32> step { 0u };
+        std::vector<uint32> order(Width + 2u);
+
+        TaskGraph::Node& source = graph.AddNode([&] { order[0u]         = step.fetch_add(1u, std::memory_order_relaxed); }, "Source");
+        TaskGraph::Node& sink   = graph.AddNode([&] { order[Width + 1u] = step.fetch_add(1u, std::memory_order_relaxed); }, "Sink");
+
+        for (uint32 i = 1u; i <= Width; ++i)
+            source.Then([&, i] { order[i] = step.fetch_add(1u, std::memory_order_relaxed); }).Then(sink);
+
+        Benchmark::Measure("TaskGraph      Execute 64 wide fan-out", Width + 2u, [&]
+        {
+            step.store(0u, std::memory_order_relaxed);
+            graph.Execute();
+        });
+
+        // Executed again, the counters of the previous executions must have been reset.
+        uint64 misorderedNodes = 0u;
+
+        for (uint32 execution = 0u; execution < 2u; ++execution)
+        {
+            step.store(0u, std::memory_order_relaxed);
+
+            misorderedNodes += !graph.Execute();
+            misorderedNodes += step.load(std::memory_order_relaxed) != Width + 2u;
+            misorderedNodes += order[0u]         != 0u;
+            misorderedNodes += order[Width + 1u] != Width + 1u;
+        }
+
+        Benchmark::Check("TaskGraph      nodes run out of order", static_cast<double>(misorderedNodes), 0.0);
+    }
+
+    {
+        std::atomic<uint32> runs { 0u };
+
+        TaskGraph cyclic  (scheduler);
+        TaskGraph foreign (scheduler);
+        TaskGraph other   (scheduler);
+
+        TaskGraph::Node& first = cyclic.AddNode([&] { runs.fetch_add(1u, std::memory_order_relaxed); });
+
+        first.Then([&] { runs.fetch_add(1u, std::memory_order_relaxed); }).Then(first);
+
+        foreign.AddNode([&] { runs.fetch_add(1u, std::memory_order_relaxed); })
+               .Then   (other.AddNode([] {}));
+
+        uint64 acceptedGraphs = 0u;
+
+        acceptedGraphs += cyclic .Execute();
+        acceptedGraphs += foreign.Execute();
+        acceptedGraphs += runs.load(std::memory_order_relaxed) != 0u;
+
+        // Clearing drops the rejected edge.
+        foreign.Clear  ();
+        foreign.AddNode([&] { runs.fetch_add(1u, std::memory_order_relaxed); });
+
+        acceptedGraphs += !foreign.Execute();
+        acceptedGraphs += !other  .Execute();
+        acceptedGraphs += runs.load(std::memory_order_relaxed) != 1u;
+
+        Benchmark::Check("TaskGraph      invalid graphs accepted", static_cast<double>(acceptedGraphs), 0.0);
+    }
+
+    scheduler.Stop();
+}
\ No newline at end of file
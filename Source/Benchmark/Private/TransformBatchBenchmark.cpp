@@ -0,0 +1,150 @@
+#include "PCH.hpp"
+
+#include "Benchmark.hpp"
+#include "Mathematic/TransformBatch.hpp"
+
+/**
+ * Throughput of the TransformBatch kernels against the same work done one Transform at a time,
+ * the way SceneComponent and PrimitiveComponent compute their world and render matrices.
+ * The kernels are also checked to give exactly the results of the Transform operations (see -ffp-contract in main.cpp).
+ */
+
+// ============================== [Helpers] ============================== //
+
+static constexpr size_t TransformCount  = 4096u;
+static constexpr uint32 Repetitions     = 50u;
+
+/**
+ * Random transforms with a positive non uniform scale, like the ones of the scene graph.
+ */
+static std::vector<Transform>   MakeTransforms  (uint32 p_seed) noexcept
+{
+    std::mt19937                          random(p_seed);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> scale       (0.5f, 2.0f);
+    std::vector<Transform>                transforms;
+
+    transforms.reserve(TransformCount);
+
+    for (size_t i = 0u; i < TransformCount; ++i)
+    {
+        Quaternion const rotation {Quaternion(distribution(random), distribution(random), distribution(random), distribution(random)).GetSafeNormalized()};
+
+        transforms.emplace_back(Vector3(distribution(random), distribution(random), distribution(random)) * 10.0f,
+                                rotation,
+                                Vector3(scale(random), scale(random), scale(random)));
+    }
+
+    return transforms;
+}
+
+static TransformBatch           MakeBatch       (std::vector<Transform> const& p_transforms) noexcept
+{
+    TransformBatch batch;
+
+    batch.Reserve(p_transforms.size());
+
+    for (Transform const& transform : p_transforms)
+        batch.PushBack(transform);
+
+    return batch;
+}
+
+/**
+ * @return The number of transforms of "p_batch" which differ from "p_transforms".
+ */
+static size_t   CountMismatches (std::vector<Transform> const&  p_transforms,
+                                 TransformBatch const&          p_batch) noexcept
+{
+    size_t mismatches = 0u;
+
+    for (size_t i = 0u; i < p_transforms.size(); ++i)
+        mismatches += !(p_batch.Get(i) == p_transforms[i]);
+
+    return mismatches;
+}
+
+/**
+ * Runs "p_function" Repetitions times per sample, each call processing TransformCount transforms.
+ */
+template<typename Function>
+static void     Measure         (char const*    p_name,
+                                 Function&&     p_function) noexcept
+{
+    Benchmark::Measure(p_name, static_cast<uint64>(Repetitions) * TransformCount, [&]
+    {
+        for (uint32 repetition = 0u; repetition < Repetitions; ++repetition)
+            p_function();
+    });
+}
+
+// ============================== [Benchmarks] ============================== //
+
+BENCHMARK(TransformBatchOperations)
+{
+    std::vector<Transform> parents  = MakeTransforms(1u);
+    std::vector<Transform> locals   = MakeTransforms(2u);
+    std::vector<Transform> results  (TransformCount);
+    std::vector<Matrix4x4> matrices (TransformCount);
+    TransformBatch         parentBatch {MakeBatch(parents)};
+    TransformBatch         localBatch  {MakeBatch(locals)};
+    TransformBatch         resultBatch {TransformCount};
+
+    std::printf("  Lanes per instruction: %zu\n", TransformBatch::LaneCount);
+
+    // Compose //
+    Measure("Compose   per Transform", [&]
+    {
+        for (size_t i = 0u; i < TransformCount; ++i)
+            results[i] = parents[i] * locals[i];
+
+        Benchmark::DoNotOptimize(results);
+    });
+
+    Measure("Compose   TransformBatch", [&]
+    {
+        TransformBatch::Compose(parentBatch, localBatch, resultBatch);
+        Benchmark::DoNotOptimize(resultBatch);
+    });
+
+    Benchmark::Check("Compose   mismatches", static_cast<double>(CountMismatches(results, resultBatch)), 0.0);
+
+    // Inverse //
+    Measure("Inverse   per Transform", [&]
+    {
+        for (size_t i = 0u; i < TransformCount; ++i)
+            results[i] = parents[i].GetInverse();
+
+        Benchmark::DoNotOptimize(results);
+    });
+
+    Measure("Inverse   TransformBatch", [&]
+    {
+        TransformBatch::Inverse(parentBatch, resultBatch);
+        Benchmark::DoNotOptimize(resultBatch);
+    });
+
+    Benchmark::Check("Inverse   mismatches", static_cast<double>(CountMismatches(results, resultBatch)), 0.0);
+
+    // Matrices //
+    Measure("Matrices  per Transform", [&]
+    {
+        for (size_t i = 0u; i < TransformCount; ++i)
+            matrices[i] = parents[i].GetMatrix();
+
+        Benchmark::DoNotOptimize(matrices);
+    });
+
+    Measure("Matrices  TransformBatch", [&]
+    {
+        parentBatch.ToMatrices(matrices.data());
+        Benchmark::DoNotOptimize(matrices);
+    });
+
+    size_t mismatches = 0u;
+
+    for (size_t i = 0u; i < TransformCount; ++i)
+        mismatches += !(matrices[i] == parents[i].GetMatrix());
+
+    Benchmark::Check("Matrices  mismatches", static_cast<double>(mismatches), 0.0);
+}
\ No newline at end of file
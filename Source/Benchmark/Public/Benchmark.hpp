@@ -0,0 +1,137 @@
+#ifndef __BENCHMARK_HPP__
+#define __BENCHMARK_HPP__
+
+/**
+ * Registers a benchmark, the body is run by Benchmark::RunAll when its name matches the command line filter.
+ */
+#define BENCHMARK(Name) \
+    static void Name(); \
+    static Benchmark::Registrar Name##Registrar(#Name, &Name); \
+    static void Name()
+
+/**
+ * Minimal benchmark harness: a registry of functions and a few helpers to time and report them.
+ */
+class Benchmark
+{
+    public:
+
+    // ============================== [Alias] ============================== //
+
+        using Function = void (*)();
+
+        using Clock    = std::chrono::high_resolution_clock;
+
+    // ============================== [Public Structure] ============================== //
+
+        struct Registrar
+        {
+            Registrar   (char const*    p_name,
+                         Function       p_function) noexcept;
+        };
+
+    // ============================== [Public Static Properties] ============================== //
+
+        /** Number of timed runs of each Measure call, overridden by "--samples". */
+        static constexpr uint32 DefaultSampleCount = 10u;
+
+        /** Slowdown below which a difference with the baseline is never flagged, in percent. */
+        static constexpr double RegressionThreshold = 5.0;
+
+    // ============================== [Public Static Methods] ============================== //
+
+        /**
+         * Runs every registered benchmark whose name contains the filter, or all of them.
+         *
+         * Command line: [filter] [--samples count] [--json path] [--baseline path]
+         *  - "--json" writes every result to path, to be used as the baseline of a later run.
+         *  - "--baseline" compares every result with the ones of path and flags the regressions.
+         *
+         * @return The process exit code, EXIT_FAILURE when a regression was flagged or a check failed.
+         */
+        static int32    RunAll          (int32          p_argc,
+                                         char*          p_argv[])       noexcept;
+
+        /**
+         * Prints and records a single timed run.
+         */
+        static void     Report          (char const*    p_name,
+                                         uint64         p_operations,
+                                         double         p_seconds)      noexcept;
+
+        /**
+         * Prints and records an accuracy check, the run fails if "p_error" is above "p_bound" or is NaN.
+         *
+         * @return Whether or not the check passed.
+         */
+        static bool     Check           (char const*    p_name,
+                                         double         p_error,
+                                         double         p_bound)        noexcept;
+
+        /**
+         * Runs "p_function" once to warm up, then times it once per sample,
+         * and prints and records the mean time per operation with its standard deviation.
+         *
+         * @param p_operations  Number of operations performed by one call of "p_function".
+         */
+        template<typename Callable>
+        static void     Measure         (char const*    p_name,
+                                         uint64         p_operations,
+                                         Callable&&     p_function)     noexcept;
+
+        /**
+         * Prevents the compiler from discarding a value computed by a benchmark.
+         */
+        template<typename T>
+        static FORCEINLINE void DoNotOptimize   (T const&   p_value)    noexcept;
+
+    private:
+
+    // ============================== [Private Structures] ============================== //
+
+        struct Result
+        {
+            std::string name;
+            double      mean;
+            double      deviation;
+            uint32      samples;
+        };
+
+        struct Session
+        {
+            uint32              sampleCount = DefaultSampleCount;
+            char const*         current     = "";
+            std::vector<Result> results;
+            uint32              failures    = 0u;
+        };
+
+    // ============================== [Private Static Methods] ============================== //
+
+        /**
+         * Compares the results with the ones stored in "p_path".
+         *
+         * @return Whether or not a regression was flagged.
+         */
+        static bool     CompareBaseline (char const*    p_path)         noexcept;
+
+        /**
+         * Prints and records the statistics of "p_seconds", one duration per sample.
+         */
+        static void     Record          (char const*                p_name,
+                                         uint64                     p_operations,
+                                         std::vector<double> const& p_seconds)  noexcept;
+
+        /**
+         * Writes the results to "p_path".
+         */
+        static bool     WriteBaseline   (char const*    p_path)         noexcept;
+
+        static std::vector<std::pair<char const*, Function>>&   GetRegistry ()  noexcept;
+
+        static Session&                                         GetSession  ()  noexcept;
+
+};  // !class Benchmark
+
+#include "Benchmark.inl"
+
+#endif // !__BENCHMARK_HPP__
\ No newline at end of file
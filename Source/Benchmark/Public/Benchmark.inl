@@ -0,0 +1,38 @@
+#include "Benchmark.hpp"
+
+// ============================== [Public Static Methods] ============================== //
+
+template<typename Callable>
+void                Benchmark::Measure          (char const*    p_name,
+                                                 uint64         p_operations,
+                                                 Callable&&     p_function) noexcept
+{
+    std::vector<double> seconds(GetSession().sampleCount);
+
+    p_function();
+
+    for (double& sample : seconds)
+    {
+        auto start = Clock::now();
+
+        p_function();
+
+        sample = std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    Record(p_name, p_operations, seconds);
+}
+
+template<typename T>
+FORCEINLINE void    Benchmark::DoNotOptimize    (T const& p_value) noexcept
+{
+    #if defined(_MSC_VER)
+        static char const volatile* sink;
+
+        sink = reinterpret_cast<char const volatile*>(&p_value);
+
+        _ReadWriteBarrier();
+    #else
+        asm volatile("" : : "r,m"(p_value) : "memory");
+    #endif
+}
\ No newline at end of file
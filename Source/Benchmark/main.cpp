@@ -0,0 +1,24 @@
+#include "PCH.hpp"
+
+#include "Benchmark.hpp"
+
+// The benchmarks only depend on Core, Renderer and ThreadPool headers plus the Core/Mathematic sources, the Renderer's hierarchy
+// and the ThreadPool's scheduler, and on the Vulkan headers, the library being loaded at run time. Besides Benchmark.vcxproj they also build with GCC or Clang, from Source:
+//
+//  g++ -std=c++17 -O2 -mavx2 -mfma -ffp-contract=off -pthread -DENGINE_EXPORT
+//      -IBenchmark/PCH -IBenchmark/Public -IRuntime/Core/Public -IRuntime/Renderer/Public -IRuntime/ThreadPool/Public -IThirdParty/Json/Include -IThirdParty/Vulkan/Include
+//      Benchmark/main.cpp Benchmark/Private/*.cpp Runtime/Renderer/Private/BoundingVolumeHierarchy.cpp
+//      Runtime/ThreadPool/Private/{TaskAllocator,TaskScheduler}.cpp
+//      Runtime/Core/Private/Mathematic/{Bounds,Frustum,Matrix4x4,Quaternion,Transform,TransformBatch,Utility,Vector2,Vector3,Vector4}.cpp
+//      -ldl -o Benchmark
+//
+//  -ffp-contract=off matches MSVC's /fp:precise: GCC and Clang otherwise fuse the scalar multiply-adds when FMA is enabled,
+//  and the scalar references the vector paths are compared with (TransformBatch, normalization) would no longer be bit exact.
+//
+//  Benchmark Math --json baseline.json       Records a baseline.
+//  Benchmark Math --baseline baseline.json   Compares with it, fails when a regression is flagged.
+//  Every run also fails when an accuracy check exceeds its bound.
+int main(int argc, char* argv[])
+{
+    return Benchmark::RunAll(argc, argv);
+}
\ No newline at end of file
@@ -10,6 +10,7 @@ layout (location = 0) in vec3   in_Position;
 layout (location = 1) in vec3   in_Normal;
 layout (location = 2) in vec2   in_UV;
 layout (location = 3) in mat3   in_TBN;
+layout (location = 6) flat in uint in_Instance;
 
 layout (location = 0) out vec4  out_FragPosition;
 layout (location = 1) out vec4  out_FragNormal;
@@ -21,17 +22,27 @@ layout (set = 2, binding = 2) uniform sampler2D sampler_Metallic;
 layout (set = 2, binding = 3) uniform sampler2D sampler_Roughness;
 layout (set = 2, binding = 4) uniform sampler2D sampler_AO;
 
-layout (push_constant) uniform PushConstant
+struct Instance
 {
-    layout (offset = 64) vec4  albedo;
-    layout (offset = 80) float metallic;
-    layout (offset = 84) float roughness;
-    layout (offset = 88) float ao;
+    mat4  transform;
+    vec4  albedo;
+    float metallic;
+    float roughness;
+    float ao;
+    uint  layerMask;
+    uint  cubeMask;
+};
+
+layout (std430, set = 3, binding = 0) readonly buffer InstanceSSBO
+{
+    Instance instances[];
 
-} Material;
+} Instances;
 
 void main()
 {
+    Instance Material = Instances.instances[in_Instance];
+
 	vec3 normal = HAS_NORMAL_MAP ? normalize(in_TBN * normalize(texture(sampler_Normal, in_UV).rgb * 2.0 - 1.0)) : in_Normal;
     vec3 color  = HAS_ALBEDO_MAP ? pow(texture(sampler_Albedo, in_UV).rgb, vec3(2.2)) * Material.albedo.rgb : Material.albedo.rgb;
 
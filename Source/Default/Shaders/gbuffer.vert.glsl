@@ -5,6 +5,7 @@ layout (constant_id = 1) const bool HAS_NORMAL_MAP    = false;
 layout (constant_id = 2) const bool HAS_METALLIC_MAP  = false;
 layout (constant_id = 3) const bool HAS_ROUGHNESS_MAP = false;
 layout (constant_id = 4) const bool HAS_AO_MAP        = false;
+layout (constant_id = 5) const bool PACKED_VERTEX     = false;
 
 layout (location = 0) in vec3   in_Position;
 layout (location = 1) in vec3   in_Normal;
@@ -15,6 +16,7 @@ layout (location = 0) out vec3  out_Position;
 layout (location = 1) out vec3  out_Normal;
 layout (location = 2) out vec2  out_UV;
 layout (location = 3) out mat3  out_TBN;
+layout (location = 6) flat out uint out_Instance;
 
 layout (set = 0, binding = 0) uniform UBO
 {
@@ -24,23 +26,42 @@ layout (set = 0, binding = 0) uniform UBO
 
 } Camera;
 
-layout (push_constant) uniform PushConstant
+struct Instance
 {
-    layout (offset = 0) mat4 TRS;
+    mat4  transform;
+    vec4  albedo;
+    float metallic;
+    float roughness;
+    float ao;
+    uint  layerMask;
+    uint  cubeMask;
+};
 
-} Model;
+layout (std430, set = 3, binding = 0) readonly buffer InstanceSSBO
+{
+    Instance instances[];
+
+} Instances;
+
+vec3 DecodeOctahedral(vec2 encoded);
 
 void main()
 {
-	gl_Position = Camera.projection * Camera.view * Model.TRS * vec4(in_Position, 1.0);
+    vec3 normal  = PACKED_VERTEX ? DecodeOctahedral(in_Normal .xy) : in_Normal;
+    vec3 tangent = PACKED_VERTEX ? DecodeOctahedral(in_Tangent.xy) : in_Tangent;
+
+    mat4 TRS = Instances.instances[gl_InstanceIndex].transform;
+
+	gl_Position = Camera.projection * Camera.view * TRS * vec4(in_Position, 1.0);
 
-	out_Position = (Model.TRS * vec4(in_Position, 1.0)).xyz;
+	out_Position = (TRS * vec4(in_Position, 1.0)).xyz;
 	out_UV       = in_UV;
+	out_Instance = uint(gl_InstanceIndex);
 
     if (HAS_NORMAL_MAP)
     {
-        vec3 T = normalize(vec3(Model.TRS * vec4(in_Tangent, 0.0)));
-        vec3 N = normalize(vec3(Model.TRS * vec4(in_Normal,  0.0)));
+        vec3 T = normalize(vec3(TRS * vec4(tangent, 0.0)));
+        vec3 N = normalize(vec3(TRS * vec4(normal,  0.0)));
 
         vec3 B = cross(N, T);
 
@@ -48,5 +69,16 @@ void main()
     }
 
     else
-	    out_Normal = mat3(transpose(inverse(Model.TRS))) * normalize(in_Normal);
+	    out_Normal = normalize(mat3(transpose(inverse(TRS))) * normalize(normal));
+}
+
+vec3 DecodeOctahedral(vec2 encoded)
+{
+    vec3  n = vec3(encoded, 1.0 - abs(encoded.x) - abs(encoded.y));
+    float t = max(-n.z, 0.0);
+
+    // Unfolds the lower hemisphere.
+    n.xy += mix(vec2(t), vec2(-t), greaterThanEqual(n.xy, vec2(0.0)));
+
+    return normalize(n);
 }
\ No newline at end of file
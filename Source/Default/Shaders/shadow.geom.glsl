@@ -7,6 +7,8 @@ layout (triangles) in;
 
 layout (triangle_strip, max_vertices = 162) out;
 
+layout (location = 0) in uint in_Instance[];
+
 struct SpotLight
 {
     mat4  view;
@@ -41,10 +43,38 @@ layout (set = 0, binding = 2) uniform LightUBO2
 
 } DirectionalLightUBO;
 
+struct Instance
+{
+    mat4  transform;
+    vec4  albedo;
+    float metallic;
+    float roughness;
+    float ao;
+    uint  layerMask;
+    uint  cubeMask;
+};
+
+layout (std430, set = 1, binding = 0) readonly buffer InstanceSSBO
+{
+    Instance instances[];
+
+} Instances;
+
+/**
+ * Whether or not the caster's bounds intersect the volume of the light drawn in "layer", the layers past the mask are always drawn.
+ */
+bool IsLit(uint layer)
+{
+    return layer >= 32u || (Instances.instances[in_Instance[0]].layerMask & (1u << layer)) != 0u;
+}
+
 void main()
 {
     for (uint layer = 0u; layer < SpotLightUBO.count; ++layer)
     {
+        if (!IsLit(layer))
+            continue;
+
         for (int i = 0; i < 3; ++i)
         {
             gl_Layer    = int(layer);
@@ -58,6 +88,9 @@ void main()
 
     for (uint layer = 0u; layer < DirectionalLightUBO.count; ++layer)
     {
+        if (!IsLit(layer + SpotLightUBO.count))
+            continue;
+
         for (int i = 0; i < 3; ++i)
         {
             gl_Layer    = int(layer + SpotLightUBO.count);
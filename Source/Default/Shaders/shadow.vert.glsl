@@ -5,13 +5,27 @@ layout (location = 1) in vec3 in_Normal;
 layout (location = 2) in vec2 in_UV;
 layout (location = 3) in vec3 in_Tangent;
 
-layout (push_constant) uniform PushConstant
+layout (location = 0) out uint out_Instance;
+
+struct Instance
+{
+    mat4  transform;
+    vec4  albedo;
+    float metallic;
+    float roughness;
+    float ao;
+    uint  layerMask;
+    uint  cubeMask;
+};
+
+layout (std430, set = 1, binding = 0) readonly buffer InstanceSSBO
 {
-    layout (offset = 0) mat4 TRS;
+    Instance instances[];
 
-} Model;
+} Instances;
 
 void main()
 {
-    gl_Position = Model.TRS * vec4(in_Position, 1.0);
+    gl_Position  = Instances.instances[gl_InstanceIndex].transform * vec4(in_Position, 1.0);
+    out_Instance = uint(gl_InstanceIndex);
 }
\ No newline at end of file
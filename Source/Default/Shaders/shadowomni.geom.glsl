@@ -6,6 +6,8 @@ layout (triangles) in;
 
 layout (triangle_strip, max_vertices = 162) out;
 
+layout (location = 0) in uint in_Instance[];
+
 layout (location = 0) out float out_Distance;
 
 struct PointLight
@@ -24,10 +26,38 @@ layout (set = 0, binding = 1) uniform LightUBO
 
 } PointLightUBO;
 
+struct Instance
+{
+    mat4  transform;
+    vec4  albedo;
+    float metallic;
+    float roughness;
+    float ao;
+    uint  layerMask;
+    uint  cubeMask;
+};
+
+layout (std430, set = 1, binding = 0) readonly buffer InstanceSSBO
+{
+    Instance instances[];
+
+} Instances;
+
+/**
+ * Whether or not the caster's bounds are in the range of the light "layer", the lights past the mask are always drawn.
+ */
+bool IsLit(uint layer)
+{
+    return layer >= 32u || (Instances.instances[in_Instance[0]].cubeMask & (1u << layer)) != 0u;
+}
+
 void main()
 {
     for (uint layer = 0u; layer < PointLightUBO.count; ++layer)
     {
+        if (!IsLit(layer))
+            continue;
+
         for (uint face = 0u; face < 6u; ++face)
         {
             for (int i = 0; i < 3; ++i)
@@ -7,6 +7,7 @@ layout (constant_id = 3) const bool HAS_ROUGHNESS_MAP = false;
 layout (constant_id = 4) const bool HAS_AO_MAP        = false;
 
 layout (location = 0) in vec2   in_UV;
+layout (location = 1) flat in uint in_Instance;
 
 layout (location = 0) out vec4  out_FragColor;
 
@@ -16,16 +17,26 @@ layout (set = 2, binding = 2) uniform sampler2D sampler_Metallic;
 layout (set = 2, binding = 3) uniform sampler2D sampler_Roughness;
 layout (set = 2, binding = 4) uniform sampler2D sampler_AO;
 
-layout (push_constant) uniform PushConstant
+struct Instance
 {
-    layout (offset = 64) vec4  albedo;
-    layout (offset = 80) float metallic;
-    layout (offset = 84) float roughness;
-    layout (offset = 88) float ao;
+    mat4  transform;
+    vec4  albedo;
+    float metallic;
+    float roughness;
+    float ao;
+    uint  layerMask;
+    uint  cubeMask;
+};
 
-} Material;
+layout (std430, set = 3, binding = 0) readonly buffer InstanceSSBO
+{
+    Instance instances[];
+
+} Instances;
 
 void main()
 {
+    Instance Material = Instances.instances[in_Instance];
+
     out_FragColor = HAS_ALBEDO_MAP ? pow(texture(sampler_Albedo, in_UV), vec4(2.2)) * Material.albedo : Material.albedo;
 }
\ No newline at end of file
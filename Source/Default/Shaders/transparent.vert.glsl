@@ -12,6 +12,7 @@ layout (location = 2) in vec2   in_UV;
 layout (location = 3) in vec3   in_Tangent;
 
 layout (location = 0) out vec2  out_UV;
+layout (location = 1) flat out uint out_Instance;
 
 layout (set = 0, binding = 0) uniform CameraUBO
 {
@@ -21,15 +22,27 @@ layout (set = 0, binding = 0) uniform CameraUBO
 
 } Camera;
 
-layout (push_constant) uniform PushConstant
+struct Instance
 {
-    layout (offset = 0) mat4 TRS;
+    mat4  transform;
+    vec4  albedo;
+    float metallic;
+    float roughness;
+    float ao;
+    uint  layerMask;
+    uint  cubeMask;
+};
+
+layout (std430, set = 3, binding = 0) readonly buffer InstanceSSBO
+{
+    Instance instances[];
 
-} Model;
+} Instances;
 
 void main()
 {
-	gl_Position = Camera.projection * Camera.view * Model.TRS * vec4(in_Position, 1.0);
+	gl_Position = Camera.projection * Camera.view * Instances.instances[gl_InstanceIndex].transform * vec4(in_Position, 1.0);
 
-	out_UV = in_UV;
+	out_UV       = in_UV;
+	out_Instance = uint(gl_InstanceIndex);
 }
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "PCH.hpp"
+
+#include "Asset.hpp"
+#include "Coroutine.hpp"
+#include "ThreadPool.hpp"
+
+// ============================== [Protected Local Methods] ============================== //
+
+bool    Asset::AddWaiter        (void* p_coroutine) noexcept
+{
+    std::unique_lock lock(m_waitersMutex);
+
+    // Checked under the lock, "ResumeWaiters" cannot miss a coroutine registered while the asset was pending.
+    if (!m_isPending.load(std::memory_order_acquire))
+        return false;
+
+    m_waiters.emplace_back(p_coroutine);
+
+    return true;
+}
+
+void    Asset::ResumeWaiters    () noexcept
+{
+    std::vector<void*> waiters;
+
+    {
+        std::unique_lock lock(m_waitersMutex);
+
+        if (m_isPending.load(std::memory_order_acquire) || m_waiters.empty())
+            return;
+
+        waiters.swap(m_waiters);
+    }
+
+    ThreadPool& threadPool = ThreadPool::Get();
+
+    for (void* waiter : waiters)
+        threadPool.SubmitDetachedTask([waiter] { CoroutineHandle<>::from_address(waiter).resume(); });
+}
\ No newline at end of file
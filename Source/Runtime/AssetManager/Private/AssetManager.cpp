@@ -6,6 +6,11 @@
 #include "Builder/ShaderBuilder.hpp"
 #include "Builder/TextureBuilder.hpp"
 
+// ============================== [Thread Local Variables] ============================== //
+
+/** Serialization tasks gathered by a flush, kept between calls so its capacity is reused every frame. */
+static thread_local std::vector<ThreadPool::Task> LocalTasks;
+
 // ============================== [Module Public Local Methods] ============================== //
 
 void    AssetManager::Initialize    (EngineKey const& p_passkey) noexcept
@@ -164,7 +169,7 @@ void    AssetManager::RemoveUnused  () noexcept
 
 void    AssetManager::FlushUnused   () noexcept
 {
-    std::vector<ThreadPool::Task> tasks;
+    std::vector<ThreadPool::Task>& tasks = LocalTasks;
 
     {
         std::shared_lock lock(m_mutex);
@@ -180,18 +185,24 @@ void    AssetManager::FlushUnused   () noexcept
             {
                 it.second->m_isPending.store(true, std::memory_order_relaxed);
 
-                tasks.push_back([it] { it.second->Serialize(ASSET_DIRECTORY + it.first + ".asset"); });
+                tasks.emplace_back([asset = it.second]
+                {
+                    asset->Serialize(ASSET_DIRECTORY + asset->GetName() + ".asset");
+                    asset->ResumeWaiters();
+                });
             }
         }
     }
     
     if (!tasks.empty())
-        ThreadPool::Get().SubmitTasks(std::move(tasks));
+        ThreadPool::Get().SubmitDetachedTasks(std::move(tasks));
+
+    tasks.clear();
 }
 
 void    AssetManager::FlushAll      () noexcept
 {
-    std::vector<ThreadPool::Task> tasks;
+    std::vector<ThreadPool::Task>& tasks = LocalTasks;
 
     {
         std::unique_lock lock(m_mutex);
@@ -203,11 +214,17 @@ void    AssetManager::FlushAll      () noexcept
             {
                 it.second->m_isPending.store(true, std::memory_order_relaxed);
 
-                tasks.push_back([it] { it.second->Serialize(ASSET_DIRECTORY + it.first + ".asset"); });
+                tasks.emplace_back([asset = it.second]
+                {
+                    asset->Serialize(ASSET_DIRECTORY + asset->GetName() + ".asset");
+                    asset->ResumeWaiters();
+                });
             }
         }
     }
  
     if (!tasks.empty())
-        ThreadPool::Get().SubmitTasks(std::move(tasks));
+        ThreadPool::Get().SubmitDetachedTasks(std::move(tasks));
+
+    tasks.clear();
 }
\ No newline at end of file
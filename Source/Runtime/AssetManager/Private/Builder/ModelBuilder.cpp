@@ -51,6 +51,31 @@ std::shared_ptr<Model>  ModelBuilder::BuildFromFile         (std::string const&
     return nullptr;
 }
 
+// ============================== [Private Static Methods] ============================== //
+
+void                    ModelBuilder::SelectVertexFormats   (std::vector<MeshCreateInfo>& p_outMeshes) noexcept
+{
+    // Largest distance between two quantized positions, beyond which a mesh keeps full float positions.
+    constexpr float MaxQuantizationStep = 0.001f;
+
+    for (auto& mesh : p_outMeshes)
+    {
+        if (mesh.vertices.empty())
+            continue;
+
+        Vector3 min(mesh.vertices.front().position);
+        Vector3 max(mesh.vertices.front().position);
+
+        for (Vertex const& vertex : mesh.vertices)
+        {
+            min = Vector3::Min(min, vertex.position);
+            max = Vector3::Max(max, vertex.position);
+        }
+
+        mesh.format = (max - min).GetMax() / 65535.0f <= MaxQuantizationStep ? EVertexFormat::QUANTIZED : EVertexFormat::PACKED;
+    }
+}
+
 // ============================== [Private Static Methods (OBJ)] ============================== //
 
 namespace OBJLoader
@@ -192,7 +217,7 @@ namespace OBJLoader
                 // Computes tangents.
                 if (float det = Vector2::Cross(deltaUV1, deltaUV2))
                 {
-                    Vector3 tangent(((deltaUV2.m_y * edge1 - deltaUV1.m_y * edge2) * (1.0f / det)).GetSafeNormalized());
+                    Vector3 tangent(((deltaUV2.m_y * edge1 - deltaUV1.m_y * edge2) * (1.0f / det)).GetFastSafeNormalized());
 
                     v1.tangent = tangent;
                     v2.tangent = tangent;
@@ -243,6 +268,8 @@ std::shared_ptr<Model>  ModelBuilder::BuildFromObj  (std::string const& p_name,
     OBJLoader::LoadMaterials  (attribute, materials, p_name, directory);
     OBJLoader::ComputeTangents(meshes);
 
+    SelectVertexFormats(meshes);
+
     return std::make_shared<Model>(p_name, meshes);
 }
 
@@ -350,6 +377,8 @@ std::shared_ptr<Model>  ModelBuilder::BuildFromFbx  (std::string const& p_name,
     scene   ->Destroy();
     manager ->Destroy();
 
+    SelectVertexFormats(submeshes);
+
     return std::make_shared<Model>(p_name, submeshes);
 }
 
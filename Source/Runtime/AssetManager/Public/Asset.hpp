@@ -43,6 +43,14 @@ class ENGINE_API BASE Asset : public UniqueObject
          */
         INLINE bool                 IsValid ()  const noexcept  { return m_isLoaded .load(std::memory_order_acquire)  &&
                                                                         !m_isPending.load(std::memory_order_acquire); }
+
+        /**
+         * Returns whether or not the asset is being loaded or flushed.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        INLINE bool                 IsPending   ()  const noexcept  { return m_isPending.load(std::memory_order_acquire); }
+
     protected:
 
     // ============================== [Protected Local Properties] ============================== //
@@ -54,16 +62,44 @@ class ENGINE_API BASE Asset : public UniqueObject
 
         std::atomic_bool    m_isLoaded  = false;
 
+        /** Guards the waiters. */
+        std::mutex          m_waitersMutex;
+
+        /** Addresses of the coroutines waiting for the asset to stop pending. */
+        std::vector<void*>  m_waiters;
+
     // ============================== [Virtual Protected Local Methods] ============================== //
 
         virtual void    Deserialize (std::string const& p_path) = 0;
 
         virtual void    Serialize   (std::string const& p_path) = 0;
 
-    // ============================== [Friend Class] ============================== //
+    // ============================== [Protected Local Methods] ============================== //
+
+        /**
+         * Registers a coroutine to resume once the asset stops pending.
+         *
+         * @return Whether or not the coroutine was registered, false if the asset is not pending anymore.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        bool            AddWaiter       (void* p_coroutine) noexcept;
+
+        /**
+         * Resumes the waiting coroutines on the ThreadPool, if the asset is not pending anymore.
+         * Must be called whenever a load or a flush completes.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        void            ResumeWaiters   ()                  noexcept;
+
+    // ============================== [Friend Classes] ============================== //
 
         friend class AssetManager;
 
+        template<typename T>
+        friend class AssetAwaitable;
+
 };  // !class Asset
 
 #include "Asset.generated.hpp"
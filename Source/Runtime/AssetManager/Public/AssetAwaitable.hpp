@@ -0,0 +1,40 @@
+#ifndef __ASSET_AWAITABLE_HPP__
+#define __ASSET_AWAITABLE_HPP__
+
+#include "Task.hpp"
+#include "Asset.hpp"
+
+/**
+ * Suspends the awaiting coroutine until an asset has stopped pending, then resumes it on the ThreadPool.
+ * The asset should have been requested beforehand, "co_await" evaluates to the asset, whose validity must still be checked.
+ *
+ *      std::shared_ptr<Texture> texture = co_await AssetAwaitable(AssetManager::Get().Get<Texture>(name));
+ */
+template<typename T>
+class AssetAwaitable
+{
+    public:
+
+    // ============================== [Public Constructor] ============================== //
+
+        explicit AssetAwaitable (std::shared_ptr<T> p_asset) noexcept;
+
+    // ============================== [Awaitable Methods] ============================== //
+
+        bool                await_ready     ()                              const noexcept;
+
+        bool                await_suspend   (CoroutineHandle<>  p_handle)   const noexcept;
+
+        std::shared_ptr<T>  await_resume    ()                                    noexcept;
+
+    private:
+
+    // ============================== [Private Local Properties] ============================== //
+
+        std::shared_ptr<T>  m_asset;
+
+};  // !class AssetAwaitable
+
+#include "AssetAwaitable.inl"
+
+#endif // !__ASSET_AWAITABLE_HPP__
\ No newline at end of file
@@ -0,0 +1,29 @@
+#include "AssetAwaitable.hpp"
+
+// ============================== [Public Constructor] ============================== //
+
+template<typename T>
+INLINE AssetAwaitable<T>::AssetAwaitable    (std::shared_ptr<T> p_asset) noexcept :
+    m_asset { std::move(p_asset) }
+{}
+
+// ============================== [Awaitable Methods] ============================== //
+
+template<typename T>
+INLINE bool                 AssetAwaitable<T>::await_ready      () const noexcept
+{
+    return !m_asset || !m_asset->IsPending();
+}
+
+template<typename T>
+INLINE bool                 AssetAwaitable<T>::await_suspend    (CoroutineHandle<> p_handle) const noexcept
+{
+    // The asset may have stopped pending since "await_ready", the coroutine then goes on.
+    return static_cast<Asset&>(*m_asset).AddWaiter(p_handle.address());
+}
+
+template<typename T>
+INLINE std::shared_ptr<T>   AssetAwaitable<T>::await_resume     () noexcept
+{
+    return std::move(m_asset);
+}
\ No newline at end of file
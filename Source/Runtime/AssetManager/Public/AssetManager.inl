@@ -76,7 +76,11 @@ std::shared_ptr<T>  AssetManager::AsynchronousGet   (std::string const& p_name)
     {
         asset->m_isPending.store(true, std::memory_order_relaxed);
 
-        ThreadPool::Get().SubmitTask([=] { asset->Deserialize(ASSET_DIRECTORY + p_name + ".asset"); });
+        ThreadPool::Get().SubmitDetachedTask([asset]
+        {
+            asset->Deserialize(ASSET_DIRECTORY + asset->GetName() + ".asset");
+            asset->ResumeWaiters();
+        });
     }
 
     return std::dynamic_pointer_cast<T>(asset);
@@ -121,6 +125,20 @@ std::shared_ptr<T>  AssetManager::BlockingGet       (std::string const& p_name)
         asset->m_isPending.store(true, std::memory_order_relaxed);
 
         asset->Deserialize(ASSET_DIRECTORY + p_name + ".asset");
+        asset->ResumeWaiters();
+    }
+
+    // The asset may be loaded by another thread, or by a coroutine which is still awaiting its dependencies.
+    // Helping the pool rather than spinning, as the load may be queued behind the caller.
+    if (asset->m_isPending.load(std::memory_order_acquire))
+    {
+        ThreadPool& threadPool = ThreadPool::Get();
+
+        while (asset->m_isPending.load(std::memory_order_acquire))
+        {
+            if (!threadPool.TryExecuteTask())
+                std::this_thread::yield();
+        }
     }
 
     return std::dynamic_pointer_cast<T>(asset);
@@ -7,6 +7,8 @@
 
 class Model;
 
+struct MeshCreateInfo;
+
 // =================================================================================== //
 
 class ENGINE_API ModelBuilder : public UniqueObject
@@ -43,6 +45,11 @@ class ENGINE_API ModelBuilder : public UniqueObject
         static std::shared_ptr<Model>   BuildFromGLTF   (std::string const& p_name,
                                                          std::string const& p_path) noexcept;
 
+        /**
+         * Picks the most compact vertex format each mesh can be stored with.
+         */
+        static void                     SelectVertexFormats (std::vector<MeshCreateInfo>& p_outMeshes) noexcept;
+
     // ============================== [Private Constructor and Destructor] ============================== //
 
         ModelBuilder    () = default;
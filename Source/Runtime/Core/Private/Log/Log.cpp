@@ -4,6 +4,75 @@
 
 DEFINE_LOG_CATEGORY(LogDefault);
 
+// ============================== [Internal Variables] ============================== //
+
+/** Time after which the writer thread wakes up on its own. */
+static constexpr std::chrono::milliseconds WriterInterval { 100 };
+
+/** Whether or not this thread is the writer thread, which must never wait for itself. */
+static thread_local bool IsWriterThread = false;
+
+// ============================== [Private Structures] ============================== //
+
+struct Logger::Record
+{
+    /** Position the record can be written at, or that position + 1 once it can be read. */
+    std::atomic<uint64>     sequence;
+
+    LogCategoryBase const*  category;
+
+    char const*             file;
+
+    char const*             function;
+
+    int32                   line;
+
+    Log::Level              level;
+
+    /** Message too long for "message", allocated by the producer and freed once written. */
+    char*                   overflow;
+
+    char                    message[RecordMessageSize];
+
+    INLINE char const*  Text    () const noexcept
+    {
+        return overflow ? overflow : message;
+    }
+};
+
+// ============================== [Private Constructors and Destructor] ============================== //
+
+/**
+ * Default constructor
+ */
+Logger::Logger  () :
+    m_records           { std::make_unique<Record[]>(RecordCount) },
+    m_enqueuePosition   { 0u },
+    m_dequeuePosition   { 0u },
+    m_writtenCount      { 0u },
+    m_droppedCount      { 0u },
+    m_overflowPolicy    { Log::Block },
+    m_isWriterRunning   { true },
+    m_isWriterSleeping  { false },
+	m_consoleHandle	    { GetStdHandle(STD_OUTPUT_HANDLE) }
+{
+    for (uint32 i = 0u; i < RecordCount; ++i)
+    {
+        m_records[i].sequence.store(i, std::memory_order_relaxed);
+        m_records[i].overflow = nullptr;
+    }
+
+    m_writer = std::thread([this] () { Work(); });
+}
+
+/**
+ * Default destructor
+ */
+Logger::~Logger ()
+{
+    Shutdown();
+}
+
 // ============================== [Public Local Methods] ============================== //
 
 Logger&  Logger::Get ()
@@ -13,39 +82,269 @@ Logger&  Logger::Get ()
     return logInstance;
 }
 
-void        Logger::Add             (std::string const&         p_file, 
+void        Logger::Add             (char const*                p_file, 
                                      int const                  p_line, 
-                                     std::string const&         p_function, 
+                                     char const*                p_function, 
                                      LogCategoryBase const&     p_logCategory,
                                      Log::Level const           p_level,
-                                     const char*         p_message,
+                                     char const*                p_message,
                                      ...)
 {
     if (!p_level)
        return;
 
-    // Emplace the LogCategory if needed
-    if (m_logs.find(p_logCategory) == m_logs.end())
-        m_logs.emplace(p_logCategory, std::ofstream("Logs/" + p_logCategory.GetCategoryName() + ".log"));
+    // Once the writer thread is stopped, messages are written by the caller.
+    bool    isAsynchronous = m_isWriterRunning.load(std::memory_order_acquire);
+    Record  local;
+    Record* record         = isAsynchronous ? Acquire(p_level) : &local;
+
+    if (!record)
+        return;
+
+    record->category = &p_logCategory;
+    record->file     = p_file;
+    record->function = p_function;
+    record->line     = p_line;
+    record->level    = p_level;
+    record->overflow = nullptr;
 
-    char    message[LOG_MESSAGE_SIZE];
     va_list arglist;
     va_start(arglist, p_message);
 
-    CheckMessage(vsnprintf(message, LOG_MESSAGE_SIZE, p_message, arglist));
+    int size = vsnprintf(record->message, RecordMessageSize, p_message, arglist);
 
     va_end(arglist);
 
-    // If the current logging level is lower than Log::Log, print the message in the console.
-    if (p_level < Log::Log && p_level != Log::Fatal)
-        PrintInConsole(p_logCategory, p_level, message);
-    else if (p_level < Log::Log)
-        PrintInConsole(p_logCategory, p_level, message + GetFatalData(p_file, p_line, p_function));
+    CheckMessage(size);
+
+    if (size >= static_cast<int>(RecordMessageSize))
+    {
+        record->overflow = new char[size + 1];
+
+        va_start(arglist, p_message);
+
+        vsnprintf(record->overflow, size + 1, p_message, arglist);
 
-    PrintInFile(p_file, p_line, p_function, p_logCategory, p_level, message);
+        va_end(arglist);
+    }
+
+    if (isAsynchronous)
+        Publish(*record);
+
+    else
+    {
+        std::unique_lock lock(m_outputMutex);
+
+        Write(local);
+        FlushFiles();
+
+        delete[] local.overflow;
+    }
 
     if (p_level == Log::Fatal)
+    {
+        Flush();
+
         assert(false);
+    }
+}
+
+void        Logger::Flush           ()
+{
+    if (IsWriterThread)
+        return;
+
+    uint64 target = m_enqueuePosition.load(std::memory_order_acquire);
+
+    while (m_isWriterRunning.load(std::memory_order_acquire) && m_writtenCount.load(std::memory_order_acquire) < target)
+    {
+        WakeWriter();
+
+        std::this_thread::yield();
+    }
+}
+
+void        Logger::Shutdown        ()
+{
+    if (!m_writer.joinable())
+        return;
+
+    m_isWriterRunning.store(false, std::memory_order_release);
+
+    WakeWriter();
+
+    m_writer.join();
+
+    // Writes the records published while the writer thread was stopping.
+    std::unique_lock lock(m_outputMutex);
+
+    while (WriteBatch());
+}
+
+// ============================== [Private Local Methods] ============================== //
+
+Logger::Record* Logger::Acquire     (Log::Level const           p_level) noexcept
+{
+    uint64 position = m_enqueuePosition.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        Record& record     = m_records[position % RecordCount];
+        int64   difference = static_cast<int64>(record.sequence.load(std::memory_order_acquire)) - static_cast<int64>(position);
+
+        if (difference == 0)
+        {
+            if (m_enqueuePosition.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+                return &record;
+        }
+
+        // The ring is full, fatal messages are never dropped.
+        else if (difference < 0)
+        {
+            bool mustWait = (p_level == Log::Fatal || GetOverflowPolicy() == Log::Block) && !IsWriterThread;
+
+            if (!mustWait || !m_isWriterRunning.load(std::memory_order_relaxed))
+            {
+                m_droppedCount.fetch_add(1u, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            WakeWriter();
+
+            std::this_thread::yield();
+
+            position = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+
+        else
+            position = m_enqueuePosition.load(std::memory_order_relaxed);
+    }
+}
+
+void        Logger::Publish         (Record&                    p_record) noexcept
+{
+    p_record.sequence.store(p_record.sequence.load(std::memory_order_relaxed) + 1u, std::memory_order_release);
+
+    // Pairs with the fence of the writer thread going to sleep, one of both sees the other.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (m_isWriterSleeping.load(std::memory_order_relaxed))
+        WakeWriter();
+}
+
+void        Logger::WakeWriter      () noexcept
+{
+    std::unique_lock lock(m_mutex);
+
+    m_condition.notify_one();
+}
+
+void        Logger::Work            () noexcept
+{
+    IsWriterThread = true;
+
+    while (true)
+    {
+        uint32 count = 0u;
+
+        {
+            std::unique_lock lock(m_outputMutex);
+
+            count = WriteBatch();
+        }
+
+        if (count)
+            continue;
+
+        std::unique_lock lock(m_mutex);
+
+        if (!m_isWriterRunning.load(std::memory_order_acquire))
+            break;
+
+        m_isWriterSleeping.store(true, std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        Record const& next = m_records[m_dequeuePosition % RecordCount];
+
+        if (next.sequence.load(std::memory_order_relaxed) != m_dequeuePosition + 1u)
+            m_condition.wait_for(lock, WriterInterval);
+
+        m_isWriterSleeping.store(false, std::memory_order_relaxed);
+    }
+
+    IsWriterThread = false;
+}
+
+uint32      Logger::WriteBatch      ()
+{
+    uint32 count = 0u;
+
+    while (count < BatchSize)
+    {
+        Record& record = m_records[m_dequeuePosition % RecordCount];
+
+        if (record.sequence.load(std::memory_order_acquire) != m_dequeuePosition + 1u)
+            break;
+
+        Write(record);
+
+        delete[] record.overflow;
+
+        record.overflow = nullptr;
+
+        // Hands the record back to the producers for the next lap.
+        record.sequence.store(m_dequeuePosition + RecordCount, std::memory_order_release);
+
+        ++m_dequeuePosition;
+        ++count;
+    }
+
+    uint64 dropped = m_droppedCount.exchange(0u, std::memory_order_relaxed);
+
+    if (dropped)
+    {
+        std::string message = std::to_string(dropped) + " message(s) dropped, the log queue was full";
+
+        PrintInConsole(LogDefault, Log::Warning, message);
+        PrintInFile   (__FILE__, __LINE__, __FUNCTION__, LogDefault, Log::Warning, message.c_str());
+    }
+
+    if (count || dropped)
+    {
+        FlushFiles();
+
+        m_writtenCount.store(m_dequeuePosition, std::memory_order_release);
+    }
+
+    return count;
+}
+
+void        Logger::Write           (Record const&              p_record)
+{
+    // If the current logging level is lower than Log::Log, print the message in the console.
+    if (p_record.level < Log::Log && p_record.level != Log::Fatal)
+        PrintInConsole(*p_record.category, p_record.level, p_record.Text());
+    else if (p_record.level < Log::Log)
+        PrintInConsole(*p_record.category, p_record.level, p_record.Text() + GetFatalData(p_record.file, p_record.line, p_record.function));
+
+    PrintInFile(p_record.file, p_record.line, p_record.function, *p_record.category, p_record.level, p_record.Text());
+}
+
+void        Logger::FlushFiles      ()
+{
+    for (auto& [category, log] : m_logs)
+    {
+        if (log.pending.empty())
+            continue;
+
+        log.stream.write(log.pending.data(), log.pending.size());
+        log.stream.flush();
+
+        log.pending.clear();
+    }
+
+    std::cout.flush();
 }
 
 /**
@@ -71,18 +370,19 @@ void        Logger::PrintInConsole  (LogCategoryBase const&     p_logCategory,
     
     m_logOutputDelegate.ExecuteIfBound(output + "\n");
 
-    std::cout << output + "\n" << std::flush;
+    // Flushed once per batch.
+    std::cout << output << '\n';
 }
 
 /**
- * Print a message in a file.
+ * Queue a message for the file of its category.
  */
-void        Logger::PrintInFile     (std::string const&         p_file, 
+void        Logger::PrintInFile     (char const*                p_file, 
                                      int const                  p_line, 
-                                     std::string const&         p_function, 
+                                     char const*                p_function, 
                                      LogCategoryBase const&     p_logCategory,
                                      Log::Level const           p_level,
-                                     std::string const&         p_message)
+                                     char const*                p_message)
 {
     std::string output  = p_message;
     uint64      count   = 0;
@@ -101,9 +401,20 @@ void        Logger::PrintInFile     (std::string const&         p_file,
 
     output = output.substr(0, count + 1);
 
-    output += " (In " + p_file.substr(p_file.find_last_of("/\\") + 1) + " at line " + std::to_string(p_line) + " from function " + p_function + ")\n";
+    std::string file = p_file;
+
+    output += " (In " + file.substr(file.find_last_of("/\\") + 1) + " at line " + std::to_string(p_line) + " from function " + p_function + ")\n";
 
-    m_logs.at(p_logCategory) << output << std::flush;
+    auto it = m_logs.find(&p_logCategory);
+
+    if (it == m_logs.end())
+    {
+        it = m_logs.emplace(&p_logCategory, LogFile()).first;
+
+        it->second.stream.open("Logs/" + p_logCategory.GetCategoryName() + ".log");
+    }
+
+    it->second.pending += output;
 }
 
 /** 
@@ -230,9 +541,11 @@ std::string Logger::GetFileLabel    (Log::Level const           p_level)
 /**
  * Return informations about a fatal error.
  */
-std::string Logger::GetFatalData    (std::string const&         p_file, 
+std::string Logger::GetFatalData    (char const*                p_file, 
                                      int const                  p_line, 
-                                     std::string const&         p_function)             const
+                                     char const*                p_function)             const
 {
-    return " (In " + p_file.substr(p_file.find_last_of("/\\") + 1) + " at line " + std::to_string(p_line) + " from function " + p_function + ")\n";
+    std::string file = p_file;
+
+    return " (In " + file.substr(file.find_last_of("/\\") + 1) + " at line " + std::to_string(p_line) + " from function " + p_function + ")\n";
 }
\ No newline at end of file
@@ -0,0 +1,260 @@
+#include "PCH.hpp"
+
+#include "Mathematic/Frustum.hpp"
+#include "Mathematic/SIMDLanes.hpp"
+
+// ==============================[Kernels]============================== //
+
+/**
+ * The kernels evaluate the same operations in the same order as Frustum::IsVisible,
+ * so the batched and the scalar tests always agree.
+ */
+namespace
+{
+    static_assert(sizeof(Bounds)  == 6u * sizeof(float), "Bounds are expected to be 6 packed floats (max, min).");
+    static_assert(sizeof(Vector4) == 4u * sizeof(float), "Vector4 is expected to be 4 packed floats.");
+
+    // ==============================[Loads]============================== //
+
+    /**
+     * Loads Width bounding boxes and transposes them.
+     *
+     * @param p_bounds  The first bounding box to load.
+     * @param p_values  The lanes of maxX, maxY, maxZ, minX, minY and minZ.
+     */
+    FORCEINLINE void    LoadBounds  (Bounds const*  p_bounds,
+                                     Lanes1*        p_values)
+    {
+        p_values[0].m_value = p_bounds->m_max.m_x;
+        p_values[1].m_value = p_bounds->m_max.m_y;
+        p_values[2].m_value = p_bounds->m_max.m_z;
+        p_values[3].m_value = p_bounds->m_min.m_x;
+        p_values[4].m_value = p_bounds->m_min.m_y;
+        p_values[5].m_value = p_bounds->m_min.m_z;
+    }
+
+    /**
+     * Loads Width spheres and transposes them.
+     *
+     * @param p_spheres The first sphere to load.
+     * @param p_values  The lanes of centerX, centerY, centerZ and radius.
+     */
+    FORCEINLINE void    LoadSpheres (Vector4 const* p_spheres,
+                                     Lanes1*        p_values)
+    {
+        p_values[0].m_value = p_spheres->m_x;
+        p_values[1].m_value = p_spheres->m_y;
+        p_values[2].m_value = p_spheres->m_z;
+        p_values[3].m_value = p_spheres->m_w;
+    }
+
+#if defined(MATH_SIMD_SSE4)
+
+    FORCEINLINE void    LoadBounds  (Bounds const*  p_bounds,
+                                     Lanes4*        p_values)
+    {
+        // (maxX, maxY, maxZ, minX) of each box.
+        __m128 first0 {_mm_loadu_ps(&p_bounds[0].m_max.m_x)};
+        __m128 first1 {_mm_loadu_ps(&p_bounds[1].m_max.m_x)};
+        __m128 first2 {_mm_loadu_ps(&p_bounds[2].m_max.m_x)};
+        __m128 first3 {_mm_loadu_ps(&p_bounds[3].m_max.m_x)};
+
+        _MM_TRANSPOSE4_PS(first0, first1, first2, first3);
+
+        // (minY, minZ) of each box.
+        __m128 const last0 {_mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const*>(&p_bounds[0].m_min.m_y)))};
+        __m128 const last1 {_mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const*>(&p_bounds[1].m_min.m_y)))};
+        __m128 const last2 {_mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const*>(&p_bounds[2].m_min.m_y)))};
+        __m128 const last3 {_mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const*>(&p_bounds[3].m_min.m_y)))};
+
+        __m128 const last01 {_mm_unpacklo_ps(last0, last1)};
+        __m128 const last23 {_mm_unpacklo_ps(last2, last3)};
+
+        p_values[0].m_value = first0;
+        p_values[1].m_value = first1;
+        p_values[2].m_value = first2;
+        p_values[3].m_value = first3;
+        p_values[4].m_value = _mm_movelh_ps(last01, last23);
+        p_values[5].m_value = _mm_movehl_ps(last23, last01);
+    }
+
+    FORCEINLINE void    LoadSpheres (Vector4 const* p_spheres,
+                                     Lanes4*        p_values)
+    {
+        __m128 sphere0 {_mm_loadu_ps(&p_spheres[0].m_x)};
+        __m128 sphere1 {_mm_loadu_ps(&p_spheres[1].m_x)};
+        __m128 sphere2 {_mm_loadu_ps(&p_spheres[2].m_x)};
+        __m128 sphere3 {_mm_loadu_ps(&p_spheres[3].m_x)};
+
+        _MM_TRANSPOSE4_PS(sphere0, sphere1, sphere2, sphere3);
+
+        p_values[0].m_value = sphere0;
+        p_values[1].m_value = sphere1;
+        p_values[2].m_value = sphere2;
+        p_values[3].m_value = sphere3;
+    }
+
+#endif
+
+#if defined(MATH_SIMD_AVX2)
+
+    FORCEINLINE void    LoadBounds  (Bounds const*  p_bounds,
+                                     Lanes8*        p_values)
+    {
+        Lanes4 low  [6u];
+        Lanes4 high [6u];
+
+        LoadBounds(p_bounds,      low);
+        LoadBounds(p_bounds + 4u, high);
+
+        for (size_t component = 0u; component < 6u; ++component)
+            p_values[component].m_value = _mm256_insertf128_ps(_mm256_castps128_ps256(low[component].m_value), high[component].m_value, 1);
+    }
+
+    FORCEINLINE void    LoadSpheres (Vector4 const* p_spheres,
+                                     Lanes8*        p_values)
+    {
+        Lanes4 low  [4u];
+        Lanes4 high [4u];
+
+        LoadSpheres(p_spheres,      low);
+        LoadSpheres(p_spheres + 4u, high);
+
+        for (size_t component = 0u; component < 4u; ++component)
+            p_values[component].m_value = _mm256_insertf128_ps(_mm256_castps128_ps256(low[component].m_value), high[component].m_value, 1);
+    }
+
+#endif
+
+    // ==============================[Tests]============================== //
+
+    /**
+     * Tests Width bounding boxes against the planes.
+     *
+     * @param p_planes  The planes of the frustum.
+     * @param p_bounds  The first bounding box to test.
+     *
+     * @return          A mask where the bit i is set when the box i is visible.
+     */
+    template<typename Lanes>
+    FORCEINLINE uint64  TestBounds  (std::array<Plane, Frustum::PlaneCount> const&  p_planes,
+                                     Bounds const*                                  p_bounds)
+    {
+        Lanes values[6u];
+
+        LoadBounds(p_bounds, values);
+
+        Lanes const half    {Lanes::Set(0.5f)};
+
+        Lanes const centerX {(values[3] + values[0]) * half};
+        Lanes const centerY {(values[4] + values[1]) * half};
+        Lanes const centerZ {(values[5] + values[2]) * half};
+        Lanes const extentX {(values[0] - values[3]) * half};
+        Lanes const extentY {(values[1] - values[4]) * half};
+        Lanes const extentZ {(values[2] - values[5]) * half};
+
+        int32 culled {0};
+
+        for (Plane const& plane : p_planes)
+        {
+            Lanes const distance {Lanes::Set(plane.m_normal.m_x) * centerX + Lanes::Set(plane.m_normal.m_y) * centerY + Lanes::Set(plane.m_normal.m_z) * centerZ + Lanes::Set(plane.m_distance) +
+                                  (Lanes::Set(Math::Abs(plane.m_normal.m_x)) * extentX + Lanes::Set(Math::Abs(plane.m_normal.m_y)) * extentY + Lanes::Set(Math::Abs(plane.m_normal.m_z)) * extentZ)};
+
+            culled |= distance.NegativeMask();
+        }
+
+        return ~static_cast<uint64>(culled) & ((1ull << Lanes::Width) - 1ull);
+    }
+
+    /**
+     * Tests Width spheres against the planes.
+     *
+     * @param p_planes  The planes of the frustum.
+     * @param p_spheres The first sphere to test.
+     *
+     * @return          A mask where the bit i is set when the sphere i is visible.
+     */
+    template<typename Lanes>
+    FORCEINLINE uint64  TestSpheres (std::array<Plane, Frustum::PlaneCount> const&  p_planes,
+                                     Vector4 const*                                 p_spheres)
+    {
+        Lanes values[4u];
+
+        LoadSpheres(p_spheres, values);
+
+        int32 culled {0};
+
+        for (Plane const& plane : p_planes)
+        {
+            Lanes const distance {Lanes::Set(plane.m_normal.m_x) * values[0] + Lanes::Set(plane.m_normal.m_y) * values[1] + Lanes::Set(plane.m_normal.m_z) * values[2] + Lanes::Set(plane.m_distance) + values[3]};
+
+            culled |= distance.NegativeMask();
+        }
+
+        return ~static_cast<uint64>(culled) & ((1ull << Lanes::Width) - 1ull);
+    }
+
+    // ==============================[Dispatch]============================== //
+
+    /**
+     * Runs a test over every element, WideLanes at a time then one by one, and packs the results.
+     * WideLanes::Width divides 64, so a group of lanes never straddles two words.
+     *
+     * @param p_count       The number of elements.
+     * @param p_visibility  The visibility mask, GetVisibilityWordCount(p_count) words.
+     * @param p_test        The test, called with a lanes tag and the index of the first element.
+     */
+    template<typename Test>
+    FORCEINLINE void    Cull    (size_t const   p_count,
+                                 uint64*        p_visibility,
+                                 Test const&    p_test)
+    {
+        static_assert(64u % WideLanes::Width == 0u, "The lanes must divide a visibility word.");
+
+        std::fill_n(p_visibility, Frustum::GetVisibilityWordCount(p_count), 0ull);
+
+        size_t index {0u};
+
+        for (; index + WideLanes::Width <= p_count; index += WideLanes::Width)
+            p_visibility[index / 64u] |= p_test(WideLanes{}, index) << (index % 64u);
+
+        for (; index < p_count; ++index)
+            p_visibility[index / 64u] |= p_test(Lanes1{}, index) << (index % 64u);
+    }
+}
+
+// ==============================[Public Local Methods]============================== //
+
+/**
+ * Tests bounding boxes against the planes, WideLanes at a time.
+ *
+ * @param p_bounds      The bounding boxes to test.
+ * @param p_count       The number of bounding boxes.
+ * @param p_visibility  The visibility mask of GetVisibilityWordCount(p_count) words, the bit i is set when the box i is visible.
+ */
+void    Frustum::CullBounds     (Bounds const*  p_bounds,
+                                 size_t const   p_count,
+                                 uint64*        p_visibility)   const
+{
+    Cull(p_count, p_visibility, [this, p_bounds] (auto p_lanes, size_t p_index)
+    {
+        return TestBounds<decltype(p_lanes)>(m_planes, p_bounds + p_index);
+    });
+}
+
+/**
+ * Tests spheres against the planes, WideLanes at a time.
+ *
+ * @param p_spheres     The spheres to test, with the center in xyz and the radius in w.
+ * @param p_count       The number of spheres.
+ * @param p_visibility  The visibility mask of GetVisibilityWordCount(p_count) words, the bit i is set when the sphere i is visible.
+ */
+void    Frustum::CullSpheres    (Vector4 const* p_spheres,
+                                 size_t const   p_count,
+                                 uint64*        p_visibility)   const
+{
+    Cull(p_count, p_visibility, [this, p_spheres] (auto p_lanes, size_t p_index)
+    {
+        return TestSpheres<decltype(p_lanes)>(m_planes, p_spheres + p_index);
+    });
+}
\ No newline at end of file
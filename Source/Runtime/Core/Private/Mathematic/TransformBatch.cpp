@@ -0,0 +1,395 @@
+#include "PCH.hpp"
+
+#include "Mathematic/TransformBatch.hpp"
+
+// ==============================[Kernels]============================== //
+
+/**
+ * Every kernel evaluates the same operations in the same order as the Transform and Matrix4x4 scalar code,
+ * so the results match them bit for bit (No fused multiply-add is used).
+ */
+namespace
+{
+    // ==============================[Columns Storage]============================== //
+
+    /**
+     * Writes the columns of Width matrices, given as 16 lanes in column-major order.
+     *
+     * @param p_matrices    The values of each destination matrix.
+     * @param p_columns     The lanes of each coefficient, index = column * 4 + row.
+     */
+    FORCEINLINE void    StoreMatrices   (float* const*  p_matrices,
+                                         Lanes1 const*  p_columns)
+    {
+        for (size_t coefficient = 0u; coefficient < 16u; ++coefficient)
+            p_matrices[0][coefficient] = p_columns[coefficient].m_value;
+    }
+
+#if defined(MATH_SIMD_SSE4)
+
+    FORCEINLINE void    StoreMatrices   (float* const*  p_matrices,
+                                         Lanes4 const*  p_columns)
+    {
+        for (size_t column = 0u; column < 4u; ++column)
+        {
+            __m128 row0 {p_columns[column * 4u + 0u].m_value};
+            __m128 row1 {p_columns[column * 4u + 1u].m_value};
+            __m128 row2 {p_columns[column * 4u + 2u].m_value};
+            __m128 row3 {p_columns[column * 4u + 3u].m_value};
+
+            // Lane i of every row becomes the column of the matrix i.
+            _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+            _mm_storeu_ps(p_matrices[0] + column * 4u, row0);
+            _mm_storeu_ps(p_matrices[1] + column * 4u, row1);
+            _mm_storeu_ps(p_matrices[2] + column * 4u, row2);
+            _mm_storeu_ps(p_matrices[3] + column * 4u, row3);
+        }
+    }
+
+#endif
+
+#if defined(MATH_SIMD_AVX2)
+
+    FORCEINLINE void    StoreMatrices   (float* const*  p_matrices,
+                                         Lanes8 const*  p_columns)
+    {
+        for (size_t column = 0u; column < 4u; ++column)
+        {
+            __m256 const row0 {p_columns[column * 4u + 0u].m_value};
+            __m256 const row1 {p_columns[column * 4u + 1u].m_value};
+            __m256 const row2 {p_columns[column * 4u + 2u].m_value};
+            __m256 const row3 {p_columns[column * 4u + 3u].m_value};
+
+            // 4x4 transposes inside each 128-bit half: the low half holds the matrices 0 to 3, the high half the matrices 4 to 7.
+            __m256 const xy01 {_mm256_unpacklo_ps(row0, row1)};
+            __m256 const xy23 {_mm256_unpackhi_ps(row0, row1)};
+            __m256 const zw01 {_mm256_unpacklo_ps(row2, row3)};
+            __m256 const zw23 {_mm256_unpackhi_ps(row2, row3)};
+
+            __m256 const matrix0 {_mm256_shuffle_ps(xy01, zw01, MATH_SIMD_SHUFFLE(0, 1, 0, 1))};
+            __m256 const matrix1 {_mm256_shuffle_ps(xy01, zw01, MATH_SIMD_SHUFFLE(2, 3, 2, 3))};
+            __m256 const matrix2 {_mm256_shuffle_ps(xy23, zw23, MATH_SIMD_SHUFFLE(0, 1, 0, 1))};
+            __m256 const matrix3 {_mm256_shuffle_ps(xy23, zw23, MATH_SIMD_SHUFFLE(2, 3, 2, 3))};
+
+            _mm_storeu_ps(p_matrices[0] + column * 4u, _mm256_castps256_ps128(matrix0));
+            _mm_storeu_ps(p_matrices[1] + column * 4u, _mm256_castps256_ps128(matrix1));
+            _mm_storeu_ps(p_matrices[2] + column * 4u, _mm256_castps256_ps128(matrix2));
+            _mm_storeu_ps(p_matrices[3] + column * 4u, _mm256_castps256_ps128(matrix3));
+            _mm_storeu_ps(p_matrices[4] + column * 4u, _mm256_extractf128_ps(matrix0, 1));
+            _mm_storeu_ps(p_matrices[5] + column * 4u, _mm256_extractf128_ps(matrix1, 1));
+            _mm_storeu_ps(p_matrices[6] + column * 4u, _mm256_extractf128_ps(matrix2, 1));
+            _mm_storeu_ps(p_matrices[7] + column * 4u, _mm256_extractf128_ps(matrix3, 1));
+        }
+    }
+
+#endif
+
+    /**
+     * Lanes of a transform, in the order of the arrays of a batch.
+     */
+    template<typename Lanes>
+    struct TransformLanes
+    {
+        Lanes m_values[10];
+
+        FORCEINLINE Lanes*          Translation ()          { return m_values; }
+        FORCEINLINE Lanes*          Rotation    ()          { return m_values + 3u; }
+        FORCEINLINE Lanes*          Scale       ()          { return m_values + 7u; }
+
+        FORCEINLINE Lanes const*    Translation ()  const   { return m_values; }
+        FORCEINLINE Lanes const*    Rotation    ()  const   { return m_values + 3u; }
+        FORCEINLINE Lanes const*    Scale       ()  const   { return m_values + 7u; }
+    };
+
+    /** Same as Quaternion::RotateVector. */
+    template<typename Lanes>
+    FORCEINLINE void    RotateVector    (Lanes const*   p_rotation,
+                                         Lanes const*   p_vector,
+                                         Lanes*         p_result)
+    {
+        Lanes const two {Lanes::Set(2.0f)};
+
+        // T = 2 * (axis ^ vector)
+        Lanes const T[3]
+        {
+            (p_rotation[1] * p_vector[2] - p_rotation[2] * p_vector[1]) * two,
+            (p_rotation[2] * p_vector[0] - p_rotation[0] * p_vector[2]) * two,
+            (p_rotation[0] * p_vector[1] - p_rotation[1] * p_vector[0]) * two
+        };
+
+        // vector + w * T + (axis ^ T)
+        p_result[0] = p_vector[0] + p_rotation[3] * T[0] + (p_rotation[1] * T[2] - p_rotation[2] * T[1]);
+        p_result[1] = p_vector[1] + p_rotation[3] * T[1] + (p_rotation[2] * T[0] - p_rotation[0] * T[2]);
+        p_result[2] = p_vector[2] + p_rotation[3] * T[2] + (p_rotation[0] * T[1] - p_rotation[1] * T[0]);
+    }
+
+    /** Same as Transform::operator* without negative scales. */
+    template<typename Lanes>
+    FORCEINLINE TransformLanes<Lanes>   ComposeLanes    (TransformLanes<Lanes> const&   p_parent,
+                                                         TransformLanes<Lanes> const&   p_local)
+    {
+        Lanes const*            a           {p_parent.Rotation()};
+        Lanes const*            b           {p_local.Rotation()};
+        TransformLanes<Lanes>   result;
+        Lanes*                  rotation    {result.Rotation()};
+
+        rotation[0] = a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1];
+        rotation[1] = a[3] * b[1] + a[1] * b[3] + a[2] * b[0] - a[0] * b[2];
+        rotation[2] = a[3] * b[2] + a[2] * b[3] + a[0] * b[1] - a[1] * b[0];
+        rotation[3] = a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2];
+
+        Lanes const scaledTranslation[3]
+        {
+            p_parent.Scale()[0] * p_local.Translation()[0],
+            p_parent.Scale()[1] * p_local.Translation()[1],
+            p_parent.Scale()[2] * p_local.Translation()[2]
+        };
+
+        RotateVector(a, scaledTranslation, result.Translation());
+
+        for (size_t axis = 0u; axis < 3u; ++axis)
+        {
+            result.Translation()[axis] = result.Translation()[axis] + p_parent.Translation()[axis];
+            result.Scale()[axis]       = p_parent.Scale()[axis] * p_local.Scale()[axis];
+        }
+
+        return result;
+    }
+
+    /** Same as Transform::GetInverse. */
+    template<typename Lanes>
+    FORCEINLINE TransformLanes<Lanes>   InverseLanes    (TransformLanes<Lanes> const&   p_transform)
+    {
+        Lanes const*            q                   {p_transform.Rotation()};
+        Lanes const             magnitudeSquared    {q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]};
+        TransformLanes<Lanes>   result;
+        Lanes*                  rotation            {result.Rotation()};
+        Lanes*                  scale               {result.Scale()};
+
+        rotation[0] = -q[0] / magnitudeSquared;
+        rotation[1] = -q[1] / magnitudeSquared;
+        rotation[2] = -q[2] / magnitudeSquared;
+        rotation[3] =  q[3] / magnitudeSquared;
+
+        for (size_t axis = 0u; axis < 3u; ++axis)
+            scale[axis] = p_transform.Scale()[axis].SafeReciprocal();
+
+        Lanes const scaledTranslation[3]
+        {
+            scale[0] * -p_transform.Translation()[0],
+            scale[1] * -p_transform.Translation()[1],
+            scale[2] * -p_transform.Translation()[2]
+        };
+
+        RotateVector(rotation, scaledTranslation, result.Translation());
+
+        return result;
+    }
+
+    /** Same as Matrix4x4::TRS, in column-major order. */
+    template<typename Lanes>
+    FORCEINLINE void    ToColumns   (TransformLanes<Lanes> const&   p_transform,
+                                     Lanes*                         p_columns)
+    {
+        Lanes const* q      {p_transform.Rotation()};
+        Lanes const* s      {p_transform.Scale()};
+        Lanes const  one    {Lanes::Set(1.0f)};
+        Lanes const  two    {Lanes::Set(2.0f)};
+        Lanes const  zero   {Lanes::Set(0.0f)};
+        Lanes const  sqrX   {q[0] * q[0]};
+        Lanes const  sqrY   {q[1] * q[1]};
+        Lanes const  sqrZ   {q[2] * q[2]};
+
+        p_columns[0]  = (one - two * (sqrY + sqrZ)) * s[0];
+        p_columns[1]  = two * (q[0] * q[1] + q[2] * q[3]) * s[0];
+        p_columns[2]  = two * (q[0] * q[2] - q[1] * q[3]) * s[0];
+        p_columns[3]  = zero;
+
+        p_columns[4]  = two * (q[0] * q[1] - q[2] * q[3]) * s[1];
+        p_columns[5]  = (one - two * (sqrX + sqrZ)) * s[1];
+        p_columns[6]  = two * (q[1] * q[2] + q[0] * q[3]) * s[1];
+        p_columns[7]  = zero;
+
+        p_columns[8]  = two * (q[0] * q[2] + q[1] * q[3]) * s[2];
+        p_columns[9]  = two * (q[1] * q[2] - q[0] * q[3]) * s[2];
+        p_columns[10] = (one - two * (sqrX + sqrY)) * s[2];
+        p_columns[11] = zero;
+
+        p_columns[12] = p_transform.Translation()[0];
+        p_columns[13] = p_transform.Translation()[1];
+        p_columns[14] = p_transform.Translation()[2];
+        p_columns[15] = one;
+    }
+}
+
+// ==============================[Public Static Methods]============================== //
+
+/**
+ * Composes each parent with the local transform at the same index (result[i] = parents[i] * locals[i]).
+ * Transforms with a negative scale go through Transform::operator*, which handles them with matrices.
+ *
+ * @param p_parents The parent transforms, same size as p_locals.
+ * @param p_locals  The local transforms.
+ * @param p_result  The composed transforms, can be p_parents or p_locals.
+ */
+void    TransformBatch::Compose (TransformBatch const&  p_parents,
+                                 TransformBatch const&  p_locals,
+                                 TransformBatch&        p_result)
+{
+    assert(p_parents.Size() == p_locals.Size());
+
+    size_t const count {p_locals.Size()};
+
+    p_result.Resize(count);
+
+    auto const parents  {p_parents.GetComponents()};
+    auto const locals   {p_locals .GetComponents()};
+    auto const results  {p_result .GetComponents()};
+
+    auto const process = [&] (auto p_lanes, size_t p_index)
+    {
+        using Lanes = decltype(p_lanes);
+
+        TransformLanes<Lanes> parent;
+        TransformLanes<Lanes> local;
+
+        for (uint8 component = 0u; component < ComponentCount; ++component)
+        {
+            parent.m_values[component] = Lanes::Load(parents[component] + p_index);
+            local .m_values[component] = Lanes::Load(locals [component] + p_index);
+        }
+
+        int32 const negativeMask {parent.Scale()[0].NegativeMask() | parent.Scale()[1].NegativeMask() | parent.Scale()[2].NegativeMask() |
+                                  local .Scale()[0].NegativeMask() | local .Scale()[1].NegativeMask() | local .Scale()[2].NegativeMask()};
+
+        TransformLanes<Lanes> const result {ComposeLanes(parent, local)};
+
+        if (negativeMask == 0)
+        {
+            for (uint8 component = 0u; component < ComponentCount; ++component)
+                Lanes::Store(results[component] + p_index, result.m_values[component]);
+
+            return;
+        }
+
+        // Computed before the stores, p_result can alias the inputs.
+        Transform negativeScaled[Lanes::Width];
+
+        for (size_t lane = 0u; lane < Lanes::Width; ++lane)
+        {
+            if (negativeMask & (1 << lane))
+                negativeScaled[lane] = p_parents.Get(p_index + lane) * p_locals.Get(p_index + lane);
+        }
+
+        for (uint8 component = 0u; component < ComponentCount; ++component)
+            Lanes::Store(results[component] + p_index, result.m_values[component]);
+
+        for (size_t lane = 0u; lane < Lanes::Width; ++lane)
+        {
+            if (negativeMask & (1 << lane))
+                p_result.Set(p_index + lane, negativeScaled[lane]);
+        }
+    };
+
+    size_t index {0u};
+
+    for (; index + WideLanes::Width <= count; index += WideLanes::Width)
+        process(WideLanes{}, index);
+
+    for (; index < count; ++index)
+        process(Lanes1{}, index);
+}
+
+/**
+ * Computes the inverse of each transform (Same as Transform::GetInverse).
+ *
+ * @param p_transforms  The transforms to inverse.
+ * @param p_result      The inverse transforms, can be p_transforms.
+ */
+void    TransformBatch::Inverse (TransformBatch const&  p_transforms,
+                                 TransformBatch&        p_result)
+{
+    size_t const count {p_transforms.Size()};
+
+    p_result.Resize(count);
+
+    auto const transforms   {p_transforms.GetComponents()};
+    auto const results      {p_result    .GetComponents()};
+
+    auto const process = [&] (auto p_lanes, size_t p_index)
+    {
+        using Lanes = decltype(p_lanes);
+
+        TransformLanes<Lanes> transform;
+
+        for (uint8 component = 0u; component < ComponentCount; ++component)
+            transform.m_values[component] = Lanes::Load(transforms[component] + p_index);
+
+        TransformLanes<Lanes> const result {InverseLanes(transform)};
+
+        for (uint8 component = 0u; component < ComponentCount; ++component)
+            Lanes::Store(results[component] + p_index, result.m_values[component]);
+    };
+
+    size_t index {0u};
+
+    for (; index + WideLanes::Width <= count; index += WideLanes::Width)
+        process(WideLanes{}, index);
+
+    for (; index < count; ++index)
+        process(Lanes1{}, index);
+}
+
+// ==============================[Public Constructor]============================== //
+
+/**
+ * Constructor creating a number of identity transforms.
+ *
+ * @param p_count   The number of transforms.
+ */
+TransformBatch::TransformBatch  (size_t const   p_count)
+{
+    Resize(p_count);
+}
+
+// ==============================[Public Local Methods]============================== //
+
+/**
+ * Computes the matrix of each transform (Same as Transform::GetMatrix).
+ *
+ * @param p_matrices    The destination, must hold Size() matrices.
+ */
+void    TransformBatch::ToMatrices  (Matrix4x4*     p_matrices)     const
+{
+    size_t const count      {Size()};
+    auto const   transforms {GetComponents()};
+
+    auto const process = [&] (auto p_lanes, size_t p_index)
+    {
+        using Lanes = decltype(p_lanes);
+
+        TransformLanes<Lanes> transform;
+
+        for (uint8 component = 0u; component < ComponentCount; ++component)
+            transform.m_values[component] = Lanes::Load(transforms[component] + p_index);
+
+        Lanes  columns      [16];
+        float* destinations [Lanes::Width];
+
+        ToColumns(transform, columns);
+
+        for (size_t lane = 0u; lane < Lanes::Width; ++lane)
+            destinations[lane] = p_matrices[p_index + lane].GetValues();
+
+        StoreMatrices(destinations, columns);
+    };
+
+    size_t index {0u};
+
+    for (; index + WideLanes::Width <= count; index += WideLanes::Width)
+        process(WideLanes{}, index);
+
+    for (; index < count; ++index)
+        process(Lanes1{}, index);
+}
\ No newline at end of file
@@ -1,6 +1,116 @@
 #include "PCH.hpp"
 
 #include "Mathematic/Utility.hpp"
+#include "Mathematic/SIMDLanes.hpp"
+
+//==============================[Kernels]==============================//
+
+/**
+ * Lanes versions of the Math::Fast* approximations, evaluating the same operations in the same order
+ * as the scalar code of Utility.inl, so the batch forms return the same results.
+ */
+namespace
+{
+    template<typename Lanes>
+    FORCEINLINE Lanes   FastAtan2Lanes      (Lanes const    p_y,
+                                             Lanes const    p_x)
+    {
+        Lanes const zero        {Lanes::Set(0.0f)};
+        Lanes const absY        {p_y.Abs()};
+        Lanes const absX        {p_x.Abs()};
+        Lanes const numerator   {Lanes::Min(absX, absY)};
+        Lanes const denominator {Lanes::Max(absX, absY)};
+        Lanes const ratio       {numerator / Lanes::Max(denominator, Lanes::Set(MIN_FLOAT))};
+        Lanes const square      {ratio * ratio};
+
+        Lanes angle {(((((Lanes::Set(-1.172120e-2f) * square + Lanes::Set(5.265332e-2f)) * square - Lanes::Set(1.1643287e-1f)) * square + Lanes::Set(1.9354346e-1f)) * square - Lanes::Set(3.3262347e-1f)) * square + Lanes::Set(9.9997726e-1f)) * ratio};
+
+        angle = Lanes::Select(Lanes::IsGreater(absY, absX), Lanes::Set(MATH_PI_2_F) - angle, angle);
+        angle = Lanes::Select(Lanes::IsLess(p_x, zero),     Lanes::Set(MATH_PI_F)   - angle, angle);
+        angle = Lanes::Select(Lanes::IsLess(p_y, zero),     -angle,                          angle);
+
+        return angle;
+    }
+
+    template<typename Lanes>
+    FORCEINLINE Lanes   FastExpLanes        (Lanes const    p_values)
+    {
+        Lanes const value       {Lanes::Max(Lanes::Min(p_values, Lanes::Set(88.0f)), Lanes::Set(-87.0f))};
+        Lanes const shifted     {value * Lanes::Set(MATH_LOG2E_F) + Lanes::Set(12583039.0f)};
+        Lanes const exponent    {shifted - Lanes::Set(12583039.0f)};
+        Lanes const reduced     {(value - exponent * Lanes::Set(6.93359375e-1f)) - exponent * Lanes::Set(-2.12194440e-4f)};
+        Lanes const square      {reduced * reduced};
+        Lanes const polynomial  {(((((Lanes::Set(1.9875691500e-4f) * reduced + Lanes::Set(1.3981999507e-3f)) * reduced + Lanes::Set(8.3334519073e-3f)) * reduced + Lanes::Set(4.1665795894e-2f)) * reduced + Lanes::Set(1.6666665459e-1f)) * reduced + Lanes::Set(5.0000001201e-1f)) * square + reduced + Lanes::Set(1.0f)};
+
+        return polynomial * shifted.ShiftBitsLeft(23u);
+    }
+
+    template<typename Lanes>
+    FORCEINLINE Lanes   FastInvSqrtLanes    (Lanes const    p_values)
+    {
+        Lanes const estimate    {p_values.InvSqrtEstimate()};
+
+        return estimate * (Lanes::Set(1.5f) - Lanes::Set(0.5f) * p_values * estimate * estimate);
+    }
+
+    template<typename Lanes>
+    FORCEINLINE Lanes   FastLogLanes        (Lanes const    p_values)
+    {
+        Lanes exponent  {(p_values.ShiftBitsRight(23u) | Lanes::FromBits(0x4b000000u)) - Lanes::Set(8388735.0f)};
+        Lanes mantissa  {(p_values & Lanes::FromBits(0x007fffffu)) | Lanes::FromBits(0x3f800000u)};
+
+        Lanes const isLarge {Lanes::IsGreater(mantissa, Lanes::Set(MATH_SQRT_2_F))};
+
+        mantissa = Lanes::Select(isLarge, mantissa * Lanes::Set(0.5f), mantissa);
+        exponent = Lanes::Select(isLarge, exponent + Lanes::Set(1.0f), exponent);
+
+        Lanes const reduced     {mantissa - Lanes::Set(1.0f)};
+        Lanes const square      {reduced * reduced};
+        Lanes const polynomial  {((((((((Lanes::Set(7.0376836292e-2f) * reduced - Lanes::Set(1.1514610310e-1f)) * reduced + Lanes::Set(1.1676998740e-1f)) * reduced - Lanes::Set(1.2420140846e-1f)) * reduced + Lanes::Set(1.4249322787e-1f)) * reduced - Lanes::Set(1.6668057665e-1f)) * reduced + Lanes::Set(2.0000714765e-1f)) * reduced - Lanes::Set(2.4999993993e-1f)) * reduced + Lanes::Set(3.3333331174e-1f)) * reduced * square};
+
+        return (reduced + ((polynomial + exponent * Lanes::Set(-2.12194440e-4f)) - Lanes::Set(0.5f) * square)) + exponent * Lanes::Set(6.93359375e-1f);
+    }
+
+    template<typename Lanes>
+    FORCEINLINE void    FastSinCosLanes     (Lanes const    p_radAngles,
+                                             Lanes&         p_sines,
+                                             Lanes&         p_cosines)
+    {
+        Lanes const shifted     {p_radAngles * Lanes::Set(MATH_2_PI_F) + Lanes::Set(12582912.0f)};
+        Lanes const quadrant    {shifted - Lanes::Set(12582912.0f)};
+        Lanes const angle       {((p_radAngles - quadrant * Lanes::Set(1.5703125f)) - quadrant * Lanes::Set(4.837512969970703125e-4f)) - quadrant * Lanes::Set(7.54978995489188216e-8f)};
+        Lanes const square      {angle * angle};
+        Lanes const sine        {((Lanes::Set(-1.9515295891e-4f) * square + Lanes::Set(8.3321608736e-3f)) * square - Lanes::Set(1.6666654611e-1f)) * square * angle + angle};
+        Lanes const cosine      {((Lanes::Set(2.443315711809948e-5f) * square - Lanes::Set(1.388731625493765e-3f)) * square + Lanes::Set(4.166664568298827e-2f)) * square * square - Lanes::Set(0.5f) * square + Lanes::Set(1.0f)};
+
+        // The bit 0 of the quadrant moved to the sign bit selects, the bit 1 moved to the sign bit negates.
+        Lanes const swap        {(shifted & Lanes::FromBits(1u)).ShiftBitsLeft(31u)};
+        Lanes const sineSign    {(shifted & Lanes::FromBits(2u)).ShiftBitsLeft(30u)};
+        Lanes const cosineSign  {((shifted + Lanes::Set(1.0f)) & Lanes::FromBits(2u)).ShiftBitsLeft(30u)};
+
+        p_sines     = Lanes::Select(swap, cosine, sine)   ^ sineSign;
+        p_cosines   = Lanes::Select(swap, sine,   cosine) ^ cosineSign;
+    }
+
+    /**
+     * Calls p_kernel WideLanes at a time, then one by one for the remaining elements.
+     *
+     * @param p_count   The number of elements.
+     * @param p_kernel  The kernel, called with a lanes tag and the index of the first element.
+     */
+    template<typename Kernel>
+    FORCEINLINE void    ForEachLanes        (size_t const   p_count,
+                                             Kernel const&  p_kernel)
+    {
+        size_t index {0u};
+
+        for (; index + WideLanes::Width <= p_count; index += WideLanes::Width)
+            p_kernel(WideLanes{}, index);
+
+        for (; index < p_count; ++index)
+            p_kernel(Lanes1{}, index);
+    }
+}
 
 //==============================[Public Static Methods]==============================//
 
@@ -214,6 +324,159 @@ long double Math::ClampAngleRad (long double const  p_angleRadians,
     return Math::UnwindRad(p_angleRadians);
 }
 
+/**
+ * Batch form of FastAtan2, WideLanes at a time. The results may alias the inputs.
+ *
+ * @param p_y       The Y coordinates.
+ * @param p_x       The X coordinates.
+ * @param p_results The angles in radians.
+ * @param p_count   The number of points.
+ */
+void        Math::FastAtan2     (float const*       p_y,
+                                 float const*       p_x,
+                                 float*             p_results,
+                                 size_t const       p_count)
+{
+    ForEachLanes(p_count, [=] (auto p_lanes, size_t p_index)
+    {
+        using Lanes = decltype(p_lanes);
+
+        Lanes::Store(p_results + p_index, FastAtan2Lanes(Lanes::Load(p_y + p_index), Lanes::Load(p_x + p_index)));
+    });
+}
+
+/**
+ * Batch form of FastCos, WideLanes at a time. The results may alias the inputs.
+ *
+ * @param p_radAngles   The angles in radians, in [-8192, 8192].
+ * @param p_results     The cosines.
+ * @param p_count       The number of angles.
+ */
+void        Math::FastCos       (float const*       p_radAngles,
+                                 float*             p_results,
+                                 size_t const       p_count)
+{
+    ForEachLanes(p_count, [=] (auto p_lanes, size_t p_index)
+    {
+        using Lanes = decltype(p_lanes);
+
+        Lanes sines;
+        Lanes cosines;
+
+        FastSinCosLanes(Lanes::Load(p_radAngles + p_index), sines, cosines);
+
+        Lanes::Store(p_results + p_index, cosines);
+    });
+}
+
+/**
+ * Batch form of FastExp, WideLanes at a time. The results may alias the inputs.
+ *
+ * @param p_values  The exponents.
+ * @param p_results The powers of e.
+ * @param p_count   The number of values.
+ */
+void        Math::FastExp       (float const*       p_values,
+                                 float*             p_results,
+                                 size_t const       p_count)
+{
+    ForEachLanes(p_count, [=] (auto p_lanes, size_t p_index)
+    {
+        using Lanes = decltype(p_lanes);
+
+        Lanes::Store(p_results + p_index, FastExpLanes(Lanes::Load(p_values + p_index)));
+    });
+}
+
+/**
+ * Batch form of FastInvSqrt, WideLanes at a time. The results may alias the inputs.
+ *
+ * @param p_values  The strictly positive values.
+ * @param p_results The inverse square roots.
+ * @param p_count   The number of values.
+ */
+void        Math::FastInvSqrt   (float const*       p_values,
+                                 float*             p_results,
+                                 size_t const       p_count)
+{
+    ForEachLanes(p_count, [=] (auto p_lanes, size_t p_index)
+    {
+        using Lanes = decltype(p_lanes);
+
+        Lanes::Store(p_results + p_index, FastInvSqrtLanes(Lanes::Load(p_values + p_index)));
+    });
+}
+
+/**
+ * Batch form of FastLog, WideLanes at a time. The results may alias the inputs.
+ *
+ * @param p_values  The strictly positive values.
+ * @param p_results The natural logarithms.
+ * @param p_count   The number of values.
+ */
+void        Math::FastLog       (float const*       p_values,
+                                 float*             p_results,
+                                 size_t const       p_count)
+{
+    ForEachLanes(p_count, [=] (auto p_lanes, size_t p_index)
+    {
+        using Lanes = decltype(p_lanes);
+
+        Lanes::Store(p_results + p_index, FastLogLanes(Lanes::Load(p_values + p_index)));
+    });
+}
+
+/**
+ * Batch form of FastSin, WideLanes at a time. The results may alias the inputs.
+ *
+ * @param p_radAngles   The angles in radians, in [-8192, 8192].
+ * @param p_results     The sines.
+ * @param p_count       The number of angles.
+ */
+void        Math::FastSin       (float const*       p_radAngles,
+                                 float*             p_results,
+                                 size_t const       p_count)
+{
+    ForEachLanes(p_count, [=] (auto p_lanes, size_t p_index)
+    {
+        using Lanes = decltype(p_lanes);
+
+        Lanes sines;
+        Lanes cosines;
+
+        FastSinCosLanes(Lanes::Load(p_radAngles + p_index), sines, cosines);
+
+        Lanes::Store(p_results + p_index, sines);
+    });
+}
+
+/**
+ * Batch form of FastSinCos, WideLanes at a time. The results may alias the inputs.
+ *
+ * @param p_radAngles   The angles in radians, in [-8192, 8192].
+ * @param p_sines       The sines.
+ * @param p_cosines     The cosines.
+ * @param p_count       The number of angles.
+ */
+void        Math::FastSinCos    (float const*       p_radAngles,
+                                 float*             p_sines,
+                                 float*             p_cosines,
+                                 size_t const       p_count)
+{
+    ForEachLanes(p_count, [=] (auto p_lanes, size_t p_index)
+    {
+        using Lanes = decltype(p_lanes);
+
+        Lanes sines;
+        Lanes cosines;
+
+        FastSinCosLanes(Lanes::Load(p_radAngles + p_index), sines, cosines);
+
+        Lanes::Store(p_sines   + p_index, sines);
+        Lanes::Store(p_cosines + p_index, cosines);
+    });
+}
+
 /**
  * Convert the given angle to an angle between [-180,180] degrees.
  *
@@ -2,71 +2,367 @@
 
 #include "Profiler/Profiler.hpp"
 
-// ============================== [Public Local Methods] ============================== //
+// ============================== [Internal Structures] ============================== //
 
-/** 
- * Start a profiling session on a function. 
- * Note that only 1 function can be under profiling at the same time.
+/**
+ * Single-producer single-consumer ring: the owner thread pushes at the head,
+ * Profiler::NextFrame pops at the tail under the Profiler mutex.
  */
-void    Profiler::StartProfiling    (char const*    p_fileName,
-                                     char const*    p_functionName,
-                                     int const      p_lineNumber)	noexcept
+template<typename T, uint32 Capacity>
+struct ProfilerRing
 {
-    __int64 runtime = GetCPUCount() - m_lastCPUCount;
+    std::unique_ptr<T[]>                items   { std::make_unique<T[]>(Capacity) };
+
+    /** Written by the owner thread only. */
+    alignas(64) std::atomic<uint64>     head    { 0u };
+
+    /** Written by the collecting thread only. */
+    alignas(64) std::atomic<uint64>     tail    { 0u };
 
-    if (m_profilerDataStack.size())
+    /** Items lost since the last collection. */
+    std::atomic<uint64>                 dropped { 0u };
+
+    void    Push    (T const& p_item) noexcept
     {
-        m_profilerDataStack.top()->m_cycles += runtime;
+        uint64 index = head.load(std::memory_order_relaxed);
+
+        if (index - tail.load(std::memory_order_acquire) >= Capacity)
+        {
+            dropped.fetch_add(1u, std::memory_order_relaxed);
+            return;
+        }
+
+        items[index % Capacity] = p_item;
 
-        m_totalCPUCount += runtime;
+        head.store(index + 1u, std::memory_order_release);
     }
 
-    m_profilerDataStack.push(&(m_profilerDataSet.insert(std::make_pair(ProfilerData(p_fileName, p_functionName, p_lineNumber), ProfilerData(p_fileName, p_functionName, p_lineNumber))).first->second));
+    /**
+     * Appends the pending items to "p_items", or discards them if it is null.
+     *
+     * @return The number of items dropped since the last call.
+     */
+    uint64  Pop     (std::vector<T>* p_items) noexcept
+    {
+        uint64 last  = head.load(std::memory_order_acquire);
+        uint64 first = tail.load(std::memory_order_relaxed);
 
-    m_profilerDataStack.top()->m_calls++;
+        if (p_items)
+        {
+            for (uint64 i = first; i < last; ++i)
+                p_items->push_back(items[i % Capacity]);
+        }
 
-    m_lastCPUCount = GetCPUCount();
-}
+        // Hands the slots back to the owner thread.
+        tail.store(last, std::memory_order_release);
+
+        return dropped.exchange(0u, std::memory_order_relaxed);
+    }
+};
 
 /**
- * End a profiling seesion.
+ * Everything recorded by one thread.
  */
-void    Profiler::EndProfiling      ()	noexcept
+struct ProfilerThreadBuffer
 {
-    __int64 runTime = GetCPUCount() - m_lastCPUCount;
+    ProfilerRing<ProfilerEvent,   Profiler::ThreadBufferCapacity>   events;
+
+    ProfilerRing<ProfilerCounter, Profiler::ThreadCounterCapacity>  counters;
+
+    /** Number of open scopes, only accessed by the owner thread. */
+    uint32                                                          depth   = 0u;
+
+    uint32                                                          id      = 0u;
 
-    m_profilerDataStack.top()->m_cycles += runTime;
+    /** Guarded by the Profiler mutex. */
+    std::string                                                     name;
+};
 
-    m_totalCPUCount += runTime;
+// ============================== [Internal Variables] ============================== //
 
-    m_profilerDataStack.pop();
+/** Buffer of this thread, created on its first event. */
+static thread_local ProfilerThreadBuffer* LocalBuffer = nullptr;
 
-    m_lastCPUCount = GetCPUCount();
+// ============================== [Public Static Methods] ============================== //
+
+Profiler*   Profiler::Get           () noexcept
+{
+    static Profiler profilerInstance;
+
+    return &profilerInstance;
 }
 
-/**
- *
- */
-void    Profiler::LogProfiling      ()	noexcept
+void        Profiler::SetThreadName (char const* p_name) noexcept
+{
+    Profiler*             profiler = Get();
+    ProfilerThreadBuffer& buffer   = profiler->GetThreadBuffer();
+
+    std::unique_lock lock(profiler->m_mutex);
+
+    buffer.name = p_name;
+}
+
+// ============================== [Private Constructors and Destructor] ============================== //
+
+Profiler::Profiler  () noexcept :
+    m_isCapturing           { false },
+    m_capturedFrameCount    { DefaultCapturedFrameCount },
+    m_frameIndex            { 0u },
+    m_frameBegin            { GetTimestamp() },
+    m_startTimestamp        { m_frameBegin },
+    m_startTime             { std::chrono::steady_clock::now() }
+{
+
+}
+
+Profiler::~Profiler () noexcept
+{
+    LogProfiling();
+}
+
+// ============================== [Public Local Methods] ============================== //
+
+void    Profiler::StartCapture      (uint32 p_frameCount) noexcept
+{
+    std::unique_lock lock(m_mutex);
+
+    m_tracePath.clear();
+
+    BeginCapture(p_frameCount);
+}
+
+void    Profiler::StopCapture       () noexcept
+{
+    std::unique_lock lock(m_mutex);
+
+    // The frame in progress is incomplete, its events are discarded by the next frame.
+    m_isCapturing.store(false, std::memory_order_relaxed);
+
+    std::string path = std::move(m_tracePath);
+
+    m_tracePath.clear();
+
+    lock.unlock();
+
+    if (!path.empty())
+        ExportChromeTrace(path);
+}
+
+void    Profiler::RequestTrace      (std::string    p_path,
+                                     uint32         p_frameCount) noexcept
+{
+    std::unique_lock lock(m_mutex);
+
+    m_tracePath = std::move(p_path);
+
+    BeginCapture(p_frameCount);
+
+    LOG(LogCore, Profiler, "Capturing %u frame(s) to %s", m_capturedFrameCount, m_tracePath.c_str());
+}
+
+void    Profiler::NextFrame         () noexcept
+{
+    uint64 timestamp = GetTimestamp();
+
+    std::unique_lock lock(m_mutex);
+
+    std::string path = CloseFrame(timestamp);
+
+    lock.unlock();
+
+    if (!path.empty())
+        ExportChromeTrace(path);
+}
+
+uint64  Profiler::BeginEvent        () noexcept
+{
+    ++GetThreadBuffer().depth;
+
+    return GetTimestamp();
+}
+
+void    Profiler::EndEvent          (char const*    p_fileName,
+                                     char const*    p_functionName,
+                                     int32          p_lineNumber,
+                                     uint64         p_begin) noexcept
+{
+    uint64                end    = GetTimestamp();
+    ProfilerThreadBuffer& buffer = GetThreadBuffer();
+
+    --buffer.depth;
+
+    buffer.events.Push({ p_fileName, p_functionName, p_lineNumber, buffer.id, buffer.depth, p_begin, end });
+}
+
+void    Profiler::SetCounter        (char const*    p_name,
+                                     double         p_value) noexcept
+{
+    if (!IsCapturing())
+        return;
+
+    ProfilerThreadBuffer& buffer = GetThreadBuffer();
+
+    buffer.counters.Push({ p_name, buffer.id, GetTimestamp(), p_value });
+}
+
+std::deque<ProfilerFrame>   Profiler::GetCapturedFrames () const
 {
-    std::set<std::pair<ProfilerData, ProfilerData>, ProfilerDataCycleComparator> logs;
+    std::unique_lock lock(m_mutex);
 
-    for (ProfilerDataSet::iterator it = m_profilerDataSet.begin(); it != m_profilerDataSet.end(); it++)
-        logs.insert(*it);
+    return m_frames;
+}
+
+std::vector<ProfilerThread> Profiler::GetThreads        () const
+{
+    std::unique_lock            lock(m_mutex);
+    std::vector<ProfilerThread> threads;
 
-    ProfilerData    data; 
-    double          percent = 0;
+    threads.reserve(m_threadBuffers.size());
+
+    for (auto const& buffer : m_threadBuffers)
+        threads.push_back({ buffer->id, buffer->name });
+
+    return threads;
+}
+
+double  Profiler::GetTicksPerSecond () const noexcept
+{
+    uint64 ticks   = GetTimestamp() - m_startTimestamp;
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_startTime).count();
+
+    return seconds > 0.0 ? static_cast<double>(ticks) / seconds : 1e9;
+}
+
+void    Profiler::LogProfiling      () noexcept
+{
+    std::unique_lock lock(m_mutex);
 
-    for (std::set<std::pair<ProfilerData, ProfilerData>, ProfilerDataLineComparator>::iterator it = logs.begin(); it != logs.end(); it++)
+    if (m_frames.empty())
+        return;
+
+    ProfilerDataSet dataSet;
+    uint64          totalTicks = 0u;
+
+    for (ProfilerFrame const& frame : m_frames)
     {
-        data = it->second;
+        totalTicks += frame.m_end - frame.m_begin;
 
-        if (data.m_lineNumber)
+        for (ProfilerEvent const& event : frame.m_events)
         {
-            percent = double(data.m_cycles) / double(m_totalCPUCount) * 100;
+            ProfilerData  key (event.m_fileName, event.m_functionName, event.m_lineNumber);
+            ProfilerData& data = dataSet.emplace(key, key).first->second;
 
-            LOG(LogCore, Profiler, "[%lld] cycles, (%.3g%%) used in [%lld] call(s) by %s at line %d.",
-                data.m_cycles, percent, data.m_calls, data.m_functionName, data.m_lineNumber);
+            data.m_cycles += static_cast<__int64>(event.m_end - event.m_begin);
+            data.m_calls++;
         }
     }
+
+    std::set<std::pair<ProfilerData, ProfilerData>, ProfilerDataCycleComparator> logs(dataSet.begin(), dataSet.end());
+
+    double ticksPerMillisecond = GetTicksPerSecond() * 1e-3;
+
+    LOG(LogCore, Profiler, "%zu frame(s) captured over %.3f ms.", m_frames.size(), totalTicks / ticksPerMillisecond);
+
+    for (auto const& [key, data] : logs)
+    {
+        LOG(LogCore, Profiler, "[%.3f] ms, (%.3g%%) used in [%lld] call(s) by %s at line %d.",
+            data.m_cycles / ticksPerMillisecond, double(data.m_cycles) / double(totalTicks) * 100,
+            data.m_calls, data.m_functionName, data.m_lineNumber);
+    }
+}
+
+// ============================== [Private Local Methods] ============================== //
+
+ProfilerThreadBuffer&   Profiler::GetThreadBuffer   () noexcept
+{
+    if (!LocalBuffer)
+    {
+        std::unique_lock lock(m_mutex);
+
+        LocalBuffer     = m_threadBuffers.emplace_back(std::make_unique<ProfilerThreadBuffer>()).get();
+        LocalBuffer->id = static_cast<uint32>(m_threadBuffers.size() - 1u);
+    }
+
+    return *LocalBuffer;
+}
+
+void        Profiler::Collect       (ProfilerFrame* p_frame) noexcept
+{
+    for (auto const& buffer : m_threadBuffers)
+    {
+        uint64 dropped = buffer->events.Pop(p_frame ? &p_frame->m_events : nullptr);
+
+        buffer->counters.Pop(p_frame ? &p_frame->m_counters : nullptr);
+
+        if (p_frame)
+            p_frame->m_droppedEvents += dropped;
+    }
+
+    if (p_frame)
+    {
+        std::sort(p_frame->m_events.begin(), p_frame->m_events.end(), [] (ProfilerEvent const& p_lhs,
+                                                                          ProfilerEvent const& p_rhs)
+        {
+            // Parents first when a child starts on the same tick.
+            return p_lhs.m_begin != p_rhs.m_begin ? p_lhs.m_begin < p_rhs.m_begin : p_lhs.m_depth < p_rhs.m_depth;
+        });
+
+        std::sort(p_frame->m_counters.begin(), p_frame->m_counters.end(), [] (ProfilerCounter const& p_lhs,
+                                                                              ProfilerCounter const& p_rhs)
+        {
+            return p_lhs.m_timestamp < p_rhs.m_timestamp;
+        });
+    }
+}
+
+std::string Profiler::CloseFrame    (uint64 p_timestamp) noexcept
+{
+    std::string path;
+
+    if (m_isCapturing.load(std::memory_order_relaxed))
+    {
+        ProfilerFrame& frame = m_frames.emplace_back();
+
+        frame.m_index = m_frameIndex;
+        frame.m_begin = m_frameBegin;
+        frame.m_end   = p_timestamp;
+
+        Collect(&frame);
+
+        while (m_frames.size() > m_capturedFrameCount)
+            m_frames.pop_front();
+
+        // A requested trace ends on its own once every frame is captured.
+        if (!m_tracePath.empty() && m_frames.size() == m_capturedFrameCount)
+        {
+            m_isCapturing.store(false, std::memory_order_relaxed);
+
+            path = std::move(m_tracePath);
+
+            m_tracePath.clear();
+        }
+    }
+
+    else
+        Collect(nullptr);
+
+    ++m_frameIndex;
+
+    m_frameBegin = p_timestamp;
+
+    return path;
+}
+
+void        Profiler::BeginCapture  (uint32 p_frameCount) noexcept
+{
+    m_frames.clear();
+
+    m_capturedFrameCount = std::max(p_frameCount, 1u);
+
+    // Events recorded before the capture are discarded.
+    Collect(nullptr);
+
+    m_frameBegin = GetTimestamp();
+
+    m_isCapturing.store(true, std::memory_order_relaxed);
 }
\ No newline at end of file
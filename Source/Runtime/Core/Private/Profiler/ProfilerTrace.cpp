@@ -0,0 +1,145 @@
+#include "PCH.hpp"
+
+#include "Profiler/Profiler.hpp"
+
+/**
+ * Chrome trace event format writer, the format is described at
+ * https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+ *
+ * Every thread of the engine is a track of the same process, scopes are written as complete events (a timestamp and a duration),
+ * frames as global instant events and counters as counter tracks. A complete event stands on its own, so a scope recorded
+ * in a frame but spanning the next ones needs no matching end event.
+ */
+
+// ============================== [Internal Functions] ============================== //
+
+/**
+ * Writes "p_string" as a JSON string, file names contain backslashes on Windows.
+ */
+static void WriteString (std::ostream&  p_stream,
+                         char const*    p_string) noexcept
+{
+    p_stream << '"';
+
+    for (char const* character = p_string; *character; ++character)
+    {
+        switch (*character)
+        {
+            case '"':  p_stream << "\\\""; break;
+            case '\\': p_stream << "\\\\"; break;
+            case '\n': p_stream << "\\n";  break;
+            case '\t': p_stream << "\\t";  break;
+
+            default:
+            {
+                if (static_cast<unsigned char>(*character) >= 0x20u)
+                    p_stream << *character;
+            }
+        }
+    }
+
+    p_stream << '"';
+}
+
+// ============================== [Public Local Methods] ============================== //
+
+bool    Profiler::ExportChromeTrace (std::string const& p_path) const
+{
+    std::deque<ProfilerFrame>   frames  = GetCapturedFrames();
+    std::vector<ProfilerThread> threads = GetThreads();
+
+    if (frames.empty())
+    {
+        LOG(LogCore, Warning, "No frame captured, %s was not written", p_path.c_str());
+        return false;
+    }
+
+    std::filesystem::path directory = std::filesystem::path(p_path).parent_path();
+    std::error_code       error;
+
+    if (!directory.empty())
+        std::filesystem::create_directories(directory, error);
+
+    std::ofstream file(p_path);
+
+    if (!file.is_open())
+    {
+        LOG(LogCore, Error, "Failed to open %s", p_path.c_str());
+        return false;
+    }
+
+    double ticksPerMicrosecond = GetTicksPerSecond() * 1e-6;
+    uint64 origin              = frames.front().m_begin;
+    bool   isFirst             = true;
+
+    // Timestamps in microseconds from the first frame, scopes may have started before it.
+    auto time = [&] (uint64 p_timestamp)
+    {
+        return static_cast<double>(static_cast<int64>(p_timestamp - origin)) / ticksPerMicrosecond;
+    };
+
+    auto next = [&] () -> std::ostream&
+    {
+        file << (isFirst ? "\n" : ",\n");
+
+        isFirst = false;
+
+        return file;
+    };
+
+    file << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    next() << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Engine\"}}";
+
+    for (ProfilerThread const& thread : threads)
+    {
+        next() << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.m_id << ",\"args\":{\"name\":";
+
+        if (thread.m_name.empty())
+            file << "\"Thread " << thread.m_id << '"';
+        else
+            WriteString(file, thread.m_name.c_str());
+
+        file << "}}";
+
+        next() << "{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.m_id << ",\"args\":{\"sort_index\":" << thread.m_id << "}}";
+    }
+
+    for (ProfilerFrame const& frame : frames)
+    {
+        next() << "{\"name\":\"Frame " << frame.m_index << "\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":" << time(frame.m_begin) << '}';
+
+        next() << "{\"name\":\"Frame Time\",\"ph\":\"C\",\"pid\":1,\"tid\":0,\"ts\":" << time(frame.m_begin)
+               << ",\"args\":{\"ms\":" << (frame.m_end - frame.m_begin) / ticksPerMicrosecond * 1e-3 << "}}";
+
+        if (frame.m_droppedEvents)
+        {
+            next() << "{\"name\":\"Dropped Events\",\"ph\":\"C\",\"pid\":1,\"tid\":0,\"ts\":" << time(frame.m_begin)
+                   << ",\"args\":{\"count\":" << frame.m_droppedEvents << "}}";
+        }
+
+        for (ProfilerEvent const& event : frame.m_events)
+        {
+            next() << "{\"name\":";
+            WriteString(file, event.m_functionName);
+            file << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.m_threadId << ",\"ts\":" << time(event.m_begin)
+                 << ",\"dur\":" << (event.m_end - event.m_begin) / ticksPerMicrosecond << ",\"args\":{\"file\":";
+            WriteString(file, event.m_fileName);
+            file << ",\"line\":" << event.m_lineNumber << "}}";
+        }
+
+        for (ProfilerCounter const& counter : frame.m_counters)
+        {
+            next() << "{\"name\":";
+            WriteString(file, counter.m_name);
+            file << ",\"ph\":\"C\",\"pid\":1,\"tid\":" << counter.m_threadId << ",\"ts\":" << time(counter.m_timestamp)
+                 << ",\"args\":{\"value\":" << counter.m_value << "}}";
+        }
+    }
+
+    file << "\n]}\n";
+
+    LOG(LogCore, Profiler, "%zu frame(s) exported to %s", frames.size(), p_path.c_str());
+
+    return true;
+}
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #if defined(_WIN64) || defined(_WIN32)
     #include "Windows/WindowsPlatform.hpp"
+#elif defined(__linux__)
+    #include "Linux/LinuxPlatform.hpp"
 #endif
 
 // ============================== [Final Defines Setup] ============================== //
@@ -0,0 +1,42 @@
+#ifndef __LINUX_PLATFORM_HPP__
+#define __LINUX_PLATFORM_HPP__
+
+#include "GenericPlatform/GenericPlatform.hpp"
+
+// ============================== [GCC and Clang Macros] ============================== //
+
+#if defined(__GNUC__)
+
+    // Function macros
+    #define INLINE          inline
+    #define FORCEINLINE     inline __attribute__((always_inline))
+    #define FORCENOINLINE   __attribute__((noinline))
+    #define CONSTEXPR       constexpr
+
+    // Data macros
+    #define MS_ALIGN(n) alignas(n)
+
+    // Class attributes
+    #define DLLIMPORT
+    #define DLLEXPORT   __attribute__((visibility("default")))
+
+#endif
+
+// ============================== [Linux Types] ============================== //
+
+/**
+ * Linux specific types.
+ */
+struct LinuxPlatformTypes : public GenericPlatformTypes
+{
+    /** Size of a pointer as an unsigned integer. */
+    typedef __SIZE_TYPE__       SIZE_PTR;
+
+    /** Size of a pointer as a signed integer. */
+    typedef __PTRDIFF_TYPE__    SSIZE_PTR;
+
+}; // !struct LinuxPlatformTypes
+
+typedef LinuxPlatformTypes PlatformTypes;
+
+#endif // !__LINUX_PLATFORM_HPP__
\ No newline at end of file
@@ -30,8 +30,20 @@
 #define __PRETTY_FUNCTION__   __FUNCTION__
 #endif
 
+/**
+ * Logs a message if "Verbosity" is compiled in and enabled for the category.
+ * Both checks happen before the arguments are evaluated.
+ */
 #define LOG(CategoryName, Verbosity, Message, ...) \
-    Logger::Get().Add(__FILE__, __LINE__, __PRETTY_FUNCTION__, CategoryName, Log::##Verbosity, Message, ##__VA_ARGS__)
+    do \
+    { \
+        if constexpr (Log::Verbosity <= LOG_COMPILE_TIME_VERBOSITY) \
+        { \
+            if (CategoryName.IsEnabled(Log::Verbosity)) \
+                Logger::Get().Add(__FILE__, __LINE__, __PRETTY_FUNCTION__, CategoryName, Log::Verbosity, Message, ##__VA_ARGS__); \
+        } \
+    } \
+    while (false)
 
 
  // ============================== [Delegate Declarations] ============================== //
@@ -42,27 +54,90 @@ template <typename T> using LogCallback = void (T::*)(std::string const&);
 
 // ====================================================================================== //
 
+namespace Log
+{
+    /**
+     * What a LOG call does when the record queue is full.
+     */
+    enum OverflowPolicy : uint8
+    {
+        /** The message is lost, the number of lost messages is logged later on. */
+        Drop,
+
+        /** The caller waits for the writer thread to make room. */
+        Block
+    };
+}
+
+/**
+ * Asynchronous logger.
+ *
+ * LOG calls format their message into a record of a bounded multi-producer single-consumer ring,
+ * and a dedicated writer thread prints the records to the console and appends them to one file per category,
+ * writing each file once per batch. Fatal messages are written before the call returns.
+ */
 class ENGINE_API Logger
 {
     public:
-        
+
     // ============================== [Public Static Properties] ============================== //
 
+        /** Number of records the queue holds before applying the overflow policy. */
+        static constexpr uint32 RecordCount         = 4096u;
+
+        /** Number of characters stored in a record, longer messages are allocated on the heap. */
+        static constexpr uint32 RecordMessageSize   = 256u;
+
+        /** Maximum number of records written between two file flushes. */
+        static constexpr uint32 BatchSize           = 256u;
+
+    // ============================== [Public Static Methods] ============================== //
+
         /**
          * Return the singleton instance and create it if it was not 
          */
-    static Logger&  Get ();
+        static Logger&  Get ();
 
     // ============================== [Public Local Methods] ============================== //
 
-        void    Add (std::string const&         p_file, 
+        /**
+         * @thread_safety This function may be called from any thread.
+         */
+        void    Add (char const*                p_file, 
                      int const                  p_line, 
-                     std::string const&         p_function, 
+                     char const*                p_function, 
                      LogCategoryBase const&     p_logCategory,
                      Log::Level const           p_level,
-                     char const*        p_message,
+                     char const*                p_message,
                      ...);
 
+        /**
+         * Blocks until every message logged so far is written.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        void    Flush               ();
+
+        /**
+         * Writes the pending messages and stops the writer thread, later messages are written synchronously.
+         *
+         * @thread_safety This function must only be called from the main thread.
+         */
+        void    Shutdown            ();
+
+        /**
+         * @thread_safety This function may be called from any thread.
+         */
+        INLINE void                 SetOverflowPolicy   (Log::OverflowPolicy p_policy)  noexcept;
+
+        /**
+         * @thread_safety This function may be called from any thread.
+         */
+        INLINE Log::OverflowPolicy  GetOverflowPolicy   ()  const noexcept;
+
+        /**
+         * The Editor output is called from the writer thread.
+         */
         template <typename T, LogCallback<T> function>
         void    RegisterToLogOutput (T* p_object)
         {
@@ -71,6 +146,18 @@ class ENGINE_API Logger
 
     private:
 
+    // ============================== [Private Structures] ============================== //
+
+        struct Record;
+
+        struct LogFile
+        {
+            std::ofstream   stream;
+
+            /** Lines of the current batch, written at once. */
+            std::string     pending;
+        };
+
     // ============================== [Private Constructors and Destructor] ============================== //
 
         Logger  ();
@@ -88,31 +175,92 @@ class ENGINE_API Logger
         Logger& operator=   (Logger&&       p_move) = delete;
 
     // ============================== [Private Local Properties] ============================== //
-        
-        /** */
-        std::unordered_map<LogCategoryBase, std::ofstream>  m_logs;
 
-        /** Mutex used for thread safety */
-        std::mutex                                          m_mutex;
+        /** Ring of records, each one carrying the position it can be written (or read) at. */
+        std::unique_ptr<Record[]>                               m_records;
+
+        /** Next position to write a record at, shared by the producers. */
+        alignas(64) std::atomic<uint64>                         m_enqueuePosition;
+
+        /** Next position to read a record at, only used by the writer thread. */
+        alignas(64) uint64                                      m_dequeuePosition;
+
+        /** Number of records written so far, used by Flush. */
+        std::atomic<uint64>                                     m_writtenCount;
+
+        /** Number of messages lost since the last report. */
+        std::atomic<uint64>                                     m_droppedCount;
+
+        std::atomic<Log::OverflowPolicy>                        m_overflowPolicy;
+
+        std::atomic_bool                                        m_isWriterRunning;
+
+        std::atomic_bool                                        m_isWriterSleeping;
+
+        /** Mutex used to wake the writer thread up. */
+        std::mutex                                              m_mutex;
+
+        std::condition_variable                                 m_condition;
+
+        /** Guards the outputs, owned by the writer thread unless it is stopped. */
+        std::mutex                                              m_outputMutex;
+
+        std::thread                                             m_writer;
+
+        /** File of each category. */
+        std::unordered_map<LogCategoryBase const*, LogFile>     m_logs;
 
 		/** Console handle, note this is only usable under Windows */
-		HANDLE												m_consoleHandle;
+		HANDLE												    m_consoleHandle;
 
         /** Log output delegate for Editor */
-        LogOutput                                           m_logOutputDelegate;
+        LogOutput                                               m_logOutputDelegate;
 
     // ============================== [Private Local Methods] ============================== //
 
+        /**
+         * Reserves a record, following the overflow policy when the ring is full.
+         *
+         * @return The record, or nullptr if the message is dropped.
+         */
+        Record*     Acquire         (Log::Level const       p_level)    noexcept;
+
+        /**
+         * Makes an acquired record visible to the writer thread.
+         */
+        void        Publish         (Record&                p_record)   noexcept;
+
+        void        WakeWriter      ()  noexcept;
+
+        void        Work            ()  noexcept;
+
+        /**
+         * Writes the available records, m_outputMutex must be locked.
+         *
+         * @return The number of records written.
+         */
+        uint32      WriteBatch      ();
+
+        /**
+         * Prints a record in the console and queues it for its file, m_outputMutex must be locked.
+         */
+        void        Write           (Record const&          p_record);
+
+        /**
+         * Writes the queued lines of every file, m_outputMutex must be locked.
+         */
+        void        FlushFiles      ();
+
         void        PrintInConsole  (LogCategoryBase const& p_logCategory,
                                      Log::Level const       p_level,
                                      std::string const&     p_message);
 
-        void        PrintInFile     (std::string const&     p_file, 
+        void        PrintInFile     (char const*            p_file, 
                                      int const              p_line, 
-                                     std::string const&     p_function, 
+                                     char const*            p_function, 
                                      LogCategoryBase const& p_logCategory,
                                      Log::Level const       p_level,
-                                     std::string const&     p_message);
+                                     char const*            p_message);
 
         void        CheckMessage    (int const              p_size)     const;
 
@@ -121,9 +269,9 @@ class ENGINE_API Logger
 
         std::string GetFileLabel    (Log::Level const       p_level)    const;
 
-        std::string GetFatalData    (std::string const&     p_file, 
+        std::string GetFatalData    (char const*            p_file, 
                                      int const              p_line, 
-                                     std::string const&     p_function) const;
+                                     char const*            p_function) const;
 };
 
 DECLARE_LOG_CATEGORY(LogDefault);
@@ -3,25 +3,22 @@
 
 #include "Log.hpp"
 
-// ============================== [Private Constructors and Destructor] ============================== //
+// ============================== [Public Local Methods] ============================== //
 
 /**
- * Default constructor
+ * Set what LOG calls do when the record queue is full.
  */
-INLINE Logger::Logger() :
-    m_logs			{ std::unordered_map<LogCategoryBase, std::ofstream>() },
-    m_mutex			{ },
-	m_consoleHandle	{ GetStdHandle(STD_OUTPUT_HANDLE) }
+INLINE void                 Logger::SetOverflowPolicy   (Log::OverflowPolicy p_policy)  noexcept
 {
-    m_logs.emplace(LogDefault, std::ofstream("Logs\\LogDefault.log"));
+    m_overflowPolicy.store(p_policy, std::memory_order_relaxed);
 }
 
 /**
- * Default destructor
+ * Return what LOG calls do when the record queue is full.
  */
-INLINE  Logger::~Logger()
+INLINE Log::OverflowPolicy  Logger::GetOverflowPolicy   ()  const noexcept
 {
-
+    return m_overflowPolicy.load(std::memory_order_relaxed);
 }
 
 #endif // !__LOG_INL__
\ No newline at end of file
@@ -7,7 +7,8 @@ struct ENGINE_API LogCategoryBase
 {
     // ============================== [Public Constructors and Destructor] ============================== //
 
-        LogCategoryBase     (std::string const& p_categoryName);
+        LogCategoryBase     (std::string const& p_categoryName,
+                             Log::Level         p_verbosity = Log::All);
 
         ~LogCategoryBase    ();
     
@@ -15,6 +16,27 @@ struct ENGINE_API LogCategoryBase
 
         std::string GetCategoryName ()  const;
 
+        /**
+         * @return Whether or not messages of level "p_level" are logged for this category.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        FORCEINLINE bool        IsEnabled       (Log::Level const p_level)  const noexcept;
+
+        /**
+         * @return The most verbose level logged for this category.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        INLINE Log::Level       GetVerbosity    ()  const noexcept;
+
+        /**
+         * Sets the most verbose level logged for this category, levels above LOG_COMPILE_TIME_VERBOSITY stay disabled.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        INLINE void             SetVerbosity    (Log::Level const p_verbosity)  noexcept;
+
     // ============================== [Public Local Operators] ============================== //
 
         bool    operator==  (LogCategoryBase const& p_other)    const;
@@ -24,7 +46,10 @@ struct ENGINE_API LogCategoryBase
     // ============================== [Protected Local Properties] ============================== //
 
         /** Category name, used during the logging. */
-        std::string m_categoryName;
+        std::string             m_categoryName;
+
+        /** Most verbose level logged. */
+        std::atomic<Log::Level> m_verbosity;
 
 }; // !struct LogCategoryBase
 
@@ -32,8 +57,9 @@ struct ENGINE_API LogCategory : public LogCategoryBase
 {
     // ============================== [Public Constructors and Destructor] ============================== //
 
-        LogCategory    (std::string const&  p_categoryName) : 
-            LogCategoryBase(p_categoryName)
+        LogCategory    (std::string const&  p_categoryName,
+                        Log::Level          p_verbosity = Log::All) : 
+            LogCategoryBase(p_categoryName, p_verbosity)
         {}
 
 }; // !struct LogCategory
@@ -8,8 +8,10 @@
 /**
  * Constructor for the LogCategryBase struct.
  */
-INLINE LogCategoryBase::LogCategoryBase    (std::string const&  p_categoryName) :
-    m_categoryName      { p_categoryName }
+INLINE LogCategoryBase::LogCategoryBase    (std::string const&  p_categoryName,
+                                            Log::Level          p_verbosity) :
+    m_categoryName      { p_categoryName },
+    m_verbosity         { p_verbosity }
 {
 
 }
@@ -32,6 +34,30 @@ INLINE std::string  LogCategoryBase::GetCategoryName        ()  const
     return m_categoryName;
 }
 
+/**
+ * Return whether or not messages of the given level are logged.
+ */
+FORCEINLINE bool        LogCategoryBase::IsEnabled      (Log::Level const   p_level)    const noexcept
+{
+    return p_level <= m_verbosity.load(std::memory_order_relaxed);
+}
+
+/**
+ * Return the most verbose level logged.
+ */
+INLINE Log::Level       LogCategoryBase::GetVerbosity   ()  const noexcept
+{
+    return m_verbosity.load(std::memory_order_relaxed);
+}
+
+/**
+ * Set the most verbose level logged.
+ */
+INLINE void             LogCategoryBase::SetVerbosity   (Log::Level const   p_verbosity)    noexcept
+{
+    m_verbosity.store(p_verbosity, std::memory_order_relaxed);
+}
+
 // ============================== [Public Local Operators] ============================== //
 
 /**
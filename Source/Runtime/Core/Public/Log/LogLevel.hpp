@@ -25,4 +25,16 @@ namespace Log
     };
 }
 
+/**
+ * Most verbose level compiled in, messages above it are removed along with their arguments.
+ * Can be overridden from the project settings.
+ */
+#ifndef LOG_COMPILE_TIME_VERBOSITY
+    #ifdef NDEBUG
+        #define LOG_COMPILE_TIME_VERBOSITY Log::Profiler
+    #else
+        #define LOG_COMPILE_TIME_VERBOSITY Log::All
+    #endif
+#endif
+
 #endif // !__LOG_LEVEL_HPP__
\ No newline at end of file
@@ -1,7 +1,7 @@
 #ifndef __BOUNDS_HPP__
 #define __BOUNDS_HPP__
 
-#include "Vector3.hpp"
+#include "Matrix4x4.hpp"
 
 /**
  * Representation of an Axis-Aligned Bounding Box (AABB).
@@ -74,6 +74,8 @@ struct ENGINE_API Bounds
 
         FORCEINLINE Vector3 GetSize             ()                              const;
 
+        FORCEINLINE Bounds  GetTransformed      (Matrix4x4 const& p_matrix)     const;
+
         FORCEINLINE float   GetVolume           ()                              const;
 
         FORCEINLINE bool    IsInside            (Vector3 const& p_point)        const;
@@ -84,6 +86,11 @@ struct ENGINE_API Bounds
 
         FORCEINLINE bool    IsIntersecting      (Bounds const&  p_other)        const;
 
+        FORCEINLINE bool    IsIntersectingRay   (Vector3 const& p_origin,
+                                                 Vector3 const& p_inverseDirection,
+                                                 float const    p_maxDistance,
+                                                 float&         p_outDistance)  const;
+
         FORCEINLINE bool    IsValid             ()                              const;
 
         FORCEINLINE void    Move                (Vector3 const& p_destination);
@@ -262,6 +262,25 @@ FORCEINLINE Vector3 Bounds::GetSize             ()  const
     return m_max - m_min;
 }
 
+/**
+ * Computes the bounding box enclosing this bounding box once transformed.
+ * The extent is projected on the axes of the matrix, which avoids transforming the 8 corners.
+ *
+ * @param p_matrix  The affine transform to apply.
+ *
+ * @return          The transformed bounding box, exact under translation and scale, conservative under rotation.
+ */
+FORCEINLINE Bounds  Bounds::GetTransformed      (Matrix4x4 const& p_matrix) const
+{
+    Vector3 const center    {p_matrix.MultiplyPoint3x4(GetCenter())};
+    Vector3 const extent    {GetExtent()};
+    Vector3 const newExtent {Math::Abs(p_matrix(0, 0)) * extent.m_x + Math::Abs(p_matrix(0, 1)) * extent.m_y + Math::Abs(p_matrix(0, 2)) * extent.m_z,
+                             Math::Abs(p_matrix(1, 0)) * extent.m_x + Math::Abs(p_matrix(1, 1)) * extent.m_y + Math::Abs(p_matrix(1, 2)) * extent.m_z,
+                             Math::Abs(p_matrix(2, 0)) * extent.m_x + Math::Abs(p_matrix(2, 1)) * extent.m_y + Math::Abs(p_matrix(2, 2)) * extent.m_z};
+
+    return Bounds(center - newExtent, center + newExtent);
+}
+
 /**
  * Computes the volume of this bounding box.
  *
@@ -326,6 +345,33 @@ FORCEINLINE bool    Bounds::IsIntersecting      (Bounds const&  p_other)    cons
             );
 }
 
+/**
+ * Checks whether a ray hits this bounding box, with the slab method.
+ * An axis the ray is parallel to gives an infinite inverse direction, which the comparisons handle.
+ *
+ * @param p_origin              The origin of the ray.
+ * @param p_inverseDirection    The inverse of each component of the ray's direction.
+ * @param p_maxDistance         The length of the ray, in units of its direction.
+ * @param p_outDistance         The distance along the ray at which it enters the box, 0 if it starts inside.
+ *
+ * @return True if the ray hits the bounding box before p_maxDistance, false otherwise.
+ */
+FORCEINLINE bool    Bounds::IsIntersectingRay   (Vector3 const& p_origin,
+                                                 Vector3 const& p_inverseDirection,
+                                                 float const    p_maxDistance,
+                                                 float&         p_outDistance)  const
+{
+    Vector3 const first  {(m_min - p_origin) * p_inverseDirection};
+    Vector3 const second {(m_max - p_origin) * p_inverseDirection};
+
+    float const entry {Math::Max(Math::Max(Math::Min(first.m_x, second.m_x), Math::Min(first.m_y, second.m_y)), Math::Min(first.m_z, second.m_z))};
+    float const exit  {Math::Min(Math::Min(Math::Max(first.m_x, second.m_x), Math::Max(first.m_y, second.m_y)), Math::Max(first.m_z, second.m_z))};
+
+    p_outDistance = Math::Max(entry, 0.0f);
+
+    return entry <= exit && exit >= 0.0f && p_outDistance <= p_maxDistance;
+}
+
 /**
  * Check if this is a valid bounding box.
  *
@@ -164,6 +164,8 @@ struct ENGINE_API Color
                                      Color const&   p_color);
     
 #include "Color.inl"
-#include "Color.generated.hpp"
+#if __has_include("Color.generated.hpp")
+    #include "Color.generated.hpp"
+#endif
 
 #endif // !__COLOR_HPP__
\ No newline at end of file
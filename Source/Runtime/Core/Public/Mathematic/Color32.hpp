@@ -142,6 +142,8 @@ struct ENGINE_API Color32
 }; // !struct Color32
 
 #include "Color32.inl"
-#include "Color32.generated.hpp"
+#if __has_include("Color32.generated.hpp")
+    #include "Color32.generated.hpp"
+#endif
 
 #endif // !__COLOR_32_HPP__
\ No newline at end of file
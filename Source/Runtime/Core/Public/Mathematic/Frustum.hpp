@@ -0,0 +1,69 @@
+#ifndef __FRUSTUM_HPP__
+#define __FRUSTUM_HPP__
+
+#include "Bounds.hpp"
+#include "Matrix4x4.hpp"
+#include "Plane.hpp"
+
+/**
+ * Volume seen by a camera, represented by 6 normalized planes whose normals point inside.
+ *
+ * Built from a view-projection matrix with a depth in [0, 1] (Matrix4x4::Perspective, Matrix4x4::Ortho).
+ * The culling tests are conservative: a box crossing two planes outside the corner of the frustum is kept visible.
+ */
+struct ENGINE_API Frustum
+{
+    //=========================[Public Static Properties]=========================//
+
+        /** Number of planes of a frustum. */
+        static constexpr size_t PlaneCount = 6u;
+
+        /** Plane mask of IsVisible with every plane to test. */
+        static constexpr uint32 AllPlanes  = (1u << PlaneCount) - 1u;
+
+    //=========================[Public Static Methods]=========================//
+
+        static  FORCEINLINE constexpr size_t    GetVisibilityWordCount  (size_t const   p_count);
+
+    //=========================[Public Local Properties]=========================//
+
+        /** Left, right, bottom, top, near and far planes. */
+        std::array<Plane, PlaneCount> m_planes;
+
+    //=========================[Constructor + Destructor]=========================//
+
+        FORCEINLINE             Frustum     ();
+
+        FORCEINLINE explicit    Frustum     (Matrix4x4 const&   p_viewProjection);
+
+        FORCEINLINE             Frustum     (Frustum const&     p_copy)     = default;
+
+                                ~Frustum    ()                              = default;
+
+    //=========================[Public Local Methods]=========================//
+
+                    void    CullBounds  (Bounds const*  p_bounds,
+                                         size_t const   p_count,
+                                         uint64*        p_visibility)   const;
+
+                    void    CullSpheres (Vector4 const* p_spheres,
+                                         size_t const   p_count,
+                                         uint64*        p_visibility)   const;
+
+        FORCEINLINE bool    IsVisible   (Bounds const&  p_bounds)       const;
+
+        FORCEINLINE bool    IsVisible   (Bounds const&  p_bounds,
+                                         uint32&        p_planeMask)    const;
+
+        FORCEINLINE bool    IsVisible   (Vector3 const& p_center,
+                                         float const    p_radius)       const;
+
+    //=========================[Public Local Operators]=========================//
+
+        FORCEINLINE Frustum&    operator=   (Frustum const& p_copy)     = default;
+
+}; // !struct Frustum
+
+#include "Frustum.inl"
+
+#endif // !__FRUSTUM_HPP__
\ No newline at end of file
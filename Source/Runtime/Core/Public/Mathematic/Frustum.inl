@@ -0,0 +1,144 @@
+#ifndef __FRUSTUM_INL__
+#define __FRUSTUM_INL__
+
+/*==============================[Public Static Methods]==============================*/
+
+/**
+ * Gets the number of 64-bit words of the visibility mask written by CullBounds and CullSpheres.
+ *
+ * @param p_count   The number of bounds or spheres tested.
+ *
+ * @return          The number of words to allocate.
+ */
+FORCEINLINE constexpr size_t    Frustum::GetVisibilityWordCount (size_t const   p_count)
+{
+    return (p_count + 63u) / 64u;
+}
+
+/*==============================[Constructors + Destructor]==============================*/
+
+/** Default constructor, all planes are zero so everything is visible. */
+FORCEINLINE Frustum::Frustum    ()
+:   m_planes    {}
+{}
+
+/**
+ * Constructor extracting the planes of a view-projection matrix (Gribb and Hartmann).
+ *
+ * A point P is inside when -W <= X <= W, -W <= Y <= W and 0 <= Z <= W with (X, Y, Z, W) = p_viewProjection * P,
+ * so each plane is a sum or a difference of the matrix rows.
+ *
+ * @param p_viewProjection  The view-projection matrix of the camera.
+ */
+FORCEINLINE Frustum::Frustum    (Matrix4x4 const&   p_viewProjection)
+{
+    Vector4 const rowX {p_viewProjection.GetRow(0)};
+    Vector4 const rowY {p_viewProjection.GetRow(1)};
+    Vector4 const rowZ {p_viewProjection.GetRow(2)};
+    Vector4 const rowW {p_viewProjection.GetRow(3)};
+
+    Vector4 const planes[PlaneCount]
+    {
+        rowW + rowX,
+        rowW - rowX,
+        rowW + rowY,
+        rowW - rowY,
+        rowZ,
+        rowW - rowZ
+    };
+
+    for (size_t index = 0u; index < PlaneCount; ++index)
+    {
+        Vector4 const&  plane       {planes[index]};
+        float const     magnitude   {Vector3(plane.m_x, plane.m_y, plane.m_z).GetMagnitude()};
+
+        m_planes[index] = Plane(plane / magnitude);
+    }
+}
+
+/*==============================[Public Local Methods]==============================*/
+
+/**
+ * Tests a bounding box against the planes.
+ *
+ * @param p_bounds  The bounding box to test.
+ *
+ * @return          False if the box is fully behind one of the planes, true otherwise.
+ */
+FORCEINLINE bool    Frustum::IsVisible  (Bounds const&  p_bounds)       const
+{
+    Vector3 const center {p_bounds.GetCenter()};
+    Vector3 const extent {p_bounds.GetExtent()};
+
+    for (Plane const& plane : m_planes)
+    {
+        // Distance of the box corner the furthest along the normal.
+        float const distance {plane.m_normal.m_x * center.m_x + plane.m_normal.m_y * center.m_y + plane.m_normal.m_z * center.m_z + plane.m_distance +
+                              (Math::Abs(plane.m_normal.m_x) * extent.m_x + Math::Abs(plane.m_normal.m_y) * extent.m_y + Math::Abs(plane.m_normal.m_z) * extent.m_z)};
+
+        if (distance < 0.0f)
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * Tests a bounding box against some of the planes, to walk a hierarchy of boxes:
+ * the children of a box fully in front of a plane are too, so they do not test it again.
+ *
+ * @param p_bounds      The bounding box to test.
+ * @param p_planeMask   The planes to test, one bit per plane. Cleared of the planes the box is fully in front of,
+ *                      0 once the box is fully inside the frustum.
+ *
+ * @return              False if the box is fully behind one of the planes, true otherwise.
+ */
+FORCEINLINE bool    Frustum::IsVisible  (Bounds const&  p_bounds,
+                                         uint32&        p_planeMask)    const
+{
+    Vector3 const center {p_bounds.GetCenter()};
+    Vector3 const extent {p_bounds.GetExtent()};
+
+    for (size_t index = 0u; index < PlaneCount; ++index)
+    {
+        if ((p_planeMask & (1u << index)) == 0u)
+            continue;
+
+        Plane const& plane  {m_planes[index]};
+        float const  middle {plane.m_normal.m_x * center.m_x + plane.m_normal.m_y * center.m_y + plane.m_normal.m_z * center.m_z + plane.m_distance};
+        float const  radius {Math::Abs(plane.m_normal.m_x) * extent.m_x + Math::Abs(plane.m_normal.m_y) * extent.m_y + Math::Abs(plane.m_normal.m_z) * extent.m_z};
+
+        if (middle + radius < 0.0f)
+            return false;
+
+        // The box corner the furthest behind the plane is in front of it.
+        if (middle - radius >= 0.0f)
+            p_planeMask &= ~(1u << index);
+    }
+
+    return true;
+}
+
+/**
+ * Tests a sphere against the planes.
+ *
+ * @param p_center  The center of the sphere.
+ * @param p_radius  The radius of the sphere.
+ *
+ * @return          False if the sphere is fully behind one of the planes, true otherwise.
+ */
+FORCEINLINE bool    Frustum::IsVisible  (Vector3 const& p_center,
+                                         float const    p_radius)       const
+{
+    for (Plane const& plane : m_planes)
+    {
+        float const distance {plane.m_normal.m_x * p_center.m_x + plane.m_normal.m_y * p_center.m_y + plane.m_normal.m_z * p_center.m_z + plane.m_distance + p_radius};
+
+        if (distance < 0.0f)
+            return false;
+    }
+
+    return true;
+}
+
+#endif // !__FRUSTUM_INL__
\ No newline at end of file
@@ -4,15 +4,18 @@
 #include "Bounds.hpp"
 #include "Color.hpp"
 #include "Color32.hpp"
+#include "Frustum.hpp"
 #include "MathMacro.hpp"
 #include "Matrix4x4.hpp"
 #include "NumericLimits.hpp"
 #include "Plane.hpp"
 #include "Quaternion.hpp"
 #include "Transform.hpp"
+#include "TransformBatch.hpp"
 #include "Utility.hpp"
 #include "Vector2.hpp"
 #include "Vector3.hpp"
+#include "Vector3A.hpp"
 #include "Vector4.hpp"
 
 #endif // !__MATH_HPP__
\ No newline at end of file
@@ -47,9 +47,9 @@ FORCEINLINE bool        Matrix4x4::IsNearlyEqual    (Matrix4x4 const&   p_a,
  *
  * @return          The look at matrix.
  */
-FORCEINLINE Matrix4x4   Matrix4x4::LookAt           (Vector3 const&     p_from,
-                                                     Vector3 const&     p_to,
-                                                     Vector3 const&     p_up)
+CONSTEXPR FORCEINLINE Matrix4x4   Matrix4x4::LookAt           (Vector3 const&     p_from,
+                                                               Vector3 const&     p_to,
+                                                               Vector3 const&     p_up)
 {
     Vector3 const forward   {(p_to-p_from).GetSafeNormalized()};
     Vector3 const right     {(p_up ^ forward).GetSafeNormalized()};
@@ -76,23 +76,20 @@ FORCEINLINE Matrix4x4   Matrix4x4::LookAt           (Vector3 const&     p_from,
  *
  * @return          The resulting orthogonal projection matrix
  */
-FORCEINLINE Matrix4x4   Matrix4x4::Ortho            (float const        p_left,
-                                                     float const        p_right,
-                                                     float const        p_bottom,
-                                                     float const        p_top,
-                                                     float const        p_near,
-                                                     float const        p_far)
+CONSTEXPR FORCEINLINE Matrix4x4   Matrix4x4::Ortho            (float const        p_left,
+                                                               float const        p_right,
+                                                               float const        p_bottom,
+                                                               float const        p_top,
+                                                               float const        p_near,
+                                                               float const        p_far)
 {
-    Matrix4x4 result(Matrix4x4::Identity);
-
-    result(0, 0) = 2.0f / (p_right - p_left);
-    result(1, 1) = 2.0f / (p_top   - p_bottom);
-    result(2, 2) = 1.0f / (p_far   - p_near);
-    result(0, 3) = - (p_right + p_left)   / (p_right - p_left);
-    result(1, 3) = - (p_top   + p_bottom) / (p_top   - p_bottom);
-    result(2, 3) = - p_near / (p_far - p_near);
-
-    return result;
+    return Matrix4x4
+    (
+        2.0f / (p_right - p_left),  0.0f,                       0.0f,                       -(p_right + p_left) / (p_right - p_left),
+        0.0f,                       2.0f / (p_top - p_bottom),  0.0f,                       -(p_top + p_bottom) / (p_top - p_bottom),
+        0.0f,                       0.0f,                       1.0f / (p_far - p_near),    -p_near / (p_far - p_near),
+        0.0f,                       0.0f,                       0.0f,                       1.0f
+    );
 }
 
 /**
@@ -270,7 +267,7 @@ FORCEINLINE Matrix4x4   Matrix4x4::Rotate           (Quaternion const&  p_q)
  *
  * @return           The scale matrix4x4.
  */
-FORCEINLINE Matrix4x4   Matrix4x4::Scale            (Vector3 const&     p_scale)
+CONSTEXPR FORCEINLINE Matrix4x4   Matrix4x4::Scale            (Vector3 const&     p_scale)
 {
     return Matrix4x4
     (
@@ -288,7 +285,7 @@ FORCEINLINE Matrix4x4   Matrix4x4::Scale            (Vector3 const&     p_scale)
  *
  * @return               The translation matrix4x4.
  */
-FORCEINLINE Matrix4x4   Matrix4x4::Translate        (Vector3 const&     p_translation)
+CONSTEXPR FORCEINLINE Matrix4x4   Matrix4x4::Translate        (Vector3 const&     p_translation)
 {
     return Matrix4x4
     (
@@ -326,9 +323,9 @@ FORCEINLINE Matrix4x4   Matrix4x4::TRS              (Vector3 const&     p_transl
     );
 }
 
-FORCEINLINE Matrix4x4   Matrix4x4::View             (Vector3 const&     p_from,
-                                                     Vector3 const&     p_to,
-                                                     Vector3 const&     p_up)
+CONSTEXPR FORCEINLINE Matrix4x4   Matrix4x4::View             (Vector3 const&     p_from,
+                                                               Vector3 const&     p_to,
+                                                               Vector3 const&     p_up)
 {
     Vector3 const forward   {(p_to-p_from).GetSafeNormalized()};
     Vector3 const right     {(p_up ^ forward).GetSafeNormalized()};
@@ -354,13 +351,9 @@ FORCEINLINE Matrix4x4   Matrix4x4::View             (Vector3 const&     p_from,
  *  |   0.0f,   0.0f,   0.0f,   0.0f    |
  *
  */
-FORCEINLINE Matrix4x4::Matrix4x4 	()
-{
-	m_values[0] = 0.0f; m_values[4] = 0.0f; m_values[8]  = 0.0f; m_values[12] = 0.0f;
-    m_values[1] = 0.0f; m_values[5] = 0.0f; m_values[9]  = 0.0f; m_values[13] = 0.0f;
-    m_values[2] = 0.0f; m_values[6] = 0.0f; m_values[10] = 0.0f; m_values[14] = 0.0f;
-    m_values[3] = 0.0f; m_values[7] = 0.0f; m_values[11] = 0.0f; m_values[15] = 0.0f;
-}
+CONSTEXPR FORCEINLINE Matrix4x4::Matrix4x4 	()
+:   m_values {}
+{}
 
 
 /**
@@ -372,28 +365,27 @@ FORCEINLINE Matrix4x4::Matrix4x4 	()
  *  |   p_m30,   p_m31,   p_m32,   p_m31|
  *
  */       
-FORCEINLINE Matrix4x4::Matrix4x4 	(float const        p_m00, 
-                                     float const        p_m01,    
-                                     float const        p_m02,   
-                                     float const        p_m03,
-                                     float const        p_m10, 
-                                     float const        p_m11,    
-                                     float const        p_m12,   
-                                     float const        p_m13,  
-                                     float const        p_m20, 
-                                     float const        p_m21,    
-                                     float const        p_m22,   
-                                     float const        p_m23, 
-                                     float const        p_m30, 
-                                     float const        p_m31,    
-                                     float const        p_m32,    
-                                     float const        p_m33)
-{
-	m_values[0] = p_m00; m_values[4] = p_m01; m_values[8]  = p_m02; m_values[12] = p_m03;
-    m_values[1] = p_m10; m_values[5] = p_m11; m_values[9]  = p_m12; m_values[13] = p_m13;
-    m_values[2] = p_m20; m_values[6] = p_m21; m_values[10] = p_m22; m_values[14] = p_m23;
-    m_values[3] = p_m30; m_values[7] = p_m31; m_values[11] = p_m32; m_values[15] = p_m33;
-}
+CONSTEXPR FORCEINLINE Matrix4x4::Matrix4x4 	(float const        p_m00, 
+                                               float const        p_m01,    
+                                               float const        p_m02,   
+                                               float const        p_m03,
+                                               float const        p_m10, 
+                                               float const        p_m11,    
+                                               float const        p_m12,   
+                                               float const        p_m13,  
+                                               float const        p_m20, 
+                                               float const        p_m21,    
+                                               float const        p_m22,   
+                                               float const        p_m23, 
+                                               float const        p_m30, 
+                                               float const        p_m31,    
+                                               float const        p_m32,    
+                                               float const        p_m33)
+:   m_values {p_m00, p_m10, p_m20, p_m30,
+              p_m01, p_m11, p_m21, p_m31,
+              p_m02, p_m12, p_m22, p_m32,
+              p_m03, p_m13, p_m23, p_m33}
+{}
 
 /**
  * Constructor using initial values for each component.
@@ -408,16 +400,15 @@ FORCEINLINE Matrix4x4::Matrix4x4 	(float const        p_m00,
  * @param p_columnZ The vector corresponding to Z axis (ForwarD)
  * @param p_columnW The vector corresponding to the origin.
  */       
-FORCEINLINE Matrix4x4::Matrix4x4 	(Vector3 const&     p_columnX,
-                                     Vector3 const&     p_columnY,
-                                     Vector3 const&     p_columnZ,
-                                     Vector3 const&     p_columnW)
-{
-    m_values[0] = p_columnX.m_x;    m_values[4] = p_columnY.m_x;    m_values[8]  = p_columnZ.m_x;   m_values[12] = p_columnW.m_x;
-    m_values[1] = p_columnX.m_y;    m_values[5] = p_columnY.m_y;    m_values[9]  = p_columnZ.m_y;   m_values[13] = p_columnW.m_y;
-    m_values[2] = p_columnX.m_z;    m_values[6] = p_columnY.m_z;    m_values[10] = p_columnZ.m_z;   m_values[14] = p_columnW.m_z;
-    m_values[3] = 0.0f; 		    m_values[7] = 0.0f; 		    m_values[11] = 0.0f; 		    m_values[15] = 1.0f;
-}
+CONSTEXPR FORCEINLINE Matrix4x4::Matrix4x4 	(Vector3 const&     p_columnX,
+                                               Vector3 const&     p_columnY,
+                                               Vector3 const&     p_columnZ,
+                                               Vector3 const&     p_columnW)
+:   m_values {p_columnX.m_x, p_columnX.m_y, p_columnX.m_z, 0.0f,
+              p_columnY.m_x, p_columnY.m_y, p_columnY.m_z, 0.0f,
+              p_columnZ.m_x, p_columnZ.m_y, p_columnZ.m_z, 0.0f,
+              p_columnW.m_x, p_columnW.m_y, p_columnW.m_z, 1.0f}
+{}
 
 /**
  * Constructor using initial values for each component.
@@ -432,42 +423,33 @@ FORCEINLINE Matrix4x4::Matrix4x4 	(Vector3 const&     p_columnX,
  * @param p_columnZ The vector corresponding to Z axis (ForwarD)
  * @param p_columnW The vector corresponding to the origin.
  */
-FORCEINLINE Matrix4x4::Matrix4x4    (Vector4 const&     p_columnX,
-                                     Vector4 const&     p_columnY,
-                                     Vector4 const&     p_columnZ,
-                                     Vector4 const&     p_columnW)
-{
-    m_values[0] = p_columnX.m_x;    m_values[4] = p_columnY.m_x;    m_values[8]  = p_columnZ.m_x;   m_values[12] = p_columnW.m_x;
-    m_values[1] = p_columnX.m_y;    m_values[5] = p_columnY.m_y;    m_values[9]  = p_columnZ.m_y;   m_values[13] = p_columnW.m_y;
-    m_values[2] = p_columnX.m_z;    m_values[6] = p_columnY.m_z;    m_values[10] = p_columnZ.m_z;   m_values[14] = p_columnW.m_z;
-    m_values[3] = p_columnX.m_w;    m_values[7] = p_columnY.m_w;    m_values[11] = p_columnZ.m_w;   m_values[15] = p_columnW.m_w;
-}
+CONSTEXPR FORCEINLINE Matrix4x4::Matrix4x4    (Vector4 const&     p_columnX,
+                                               Vector4 const&     p_columnY,
+                                               Vector4 const&     p_columnZ,
+                                               Vector4 const&     p_columnW)
+:   m_values {p_columnX.m_x, p_columnX.m_y, p_columnX.m_z, p_columnX.m_w,
+              p_columnY.m_x, p_columnY.m_y, p_columnY.m_z, p_columnY.m_w,
+              p_columnZ.m_x, p_columnZ.m_y, p_columnZ.m_z, p_columnZ.m_w,
+              p_columnW.m_x, p_columnW.m_y, p_columnW.m_z, p_columnW.m_w}
+{}
 
 /**
  * Copy constructor using initial matrix4x4 for each component.
  *
  * @param p_copy    The initial matrix4x4 to copy.
  */
-FORCEINLINE Matrix4x4::Matrix4x4    (Matrix4x4 const&   p_copy)
-{
-    m_values[0] = p_copy.m_values[0]; m_values[4] = p_copy.m_values[4]; m_values[8]  = p_copy.m_values[8]  ; m_values[12] = p_copy.m_values[12];
-    m_values[1] = p_copy.m_values[1]; m_values[5] = p_copy.m_values[5]; m_values[9]  = p_copy.m_values[9]  ; m_values[13] = p_copy.m_values[13];
-    m_values[2] = p_copy.m_values[2]; m_values[6] = p_copy.m_values[6]; m_values[10] = p_copy.m_values[10] ; m_values[14] = p_copy.m_values[14];
-    m_values[3] = p_copy.m_values[3]; m_values[7] = p_copy.m_values[7]; m_values[11] = p_copy.m_values[11] ; m_values[15] = p_copy.m_values[15];
-}
+CONSTEXPR FORCEINLINE Matrix4x4::Matrix4x4    (Matrix4x4 const&   p_copy)
+:   m_values {p_copy.m_values}
+{}
 
 /**
  * Move constructor using initial matrix4x4 for each component.
  *
  * @param p_copy    The initial matrix4x4 to move.
  */
-FORCEINLINE Matrix4x4::Matrix4x4    (Matrix4x4&&        p_move)
-{
-    m_values[0] = std::move(p_move.m_values[0]); m_values[4] = std::move(p_move.m_values[4]); m_values[8]  = std::move(p_move.m_values[8] ) ; m_values[12] = std::move(p_move.m_values[12]);
-    m_values[1] = std::move(p_move.m_values[1]); m_values[5] = std::move(p_move.m_values[5]); m_values[9]  = std::move(p_move.m_values[9] ) ; m_values[13] = std::move(p_move.m_values[13]);
-    m_values[2] = std::move(p_move.m_values[2]); m_values[6] = std::move(p_move.m_values[6]); m_values[10] = std::move(p_move.m_values[10]) ; m_values[14] = std::move(p_move.m_values[14]);
-    m_values[3] = std::move(p_move.m_values[3]); m_values[7] = std::move(p_move.m_values[7]); m_values[11] = std::move(p_move.m_values[11]) ; m_values[15] = std::move(p_move.m_values[15]);
-}
+CONSTEXPR FORCEINLINE Matrix4x4::Matrix4x4    (Matrix4x4&&        p_move)
+:   m_values {std::move(p_move.m_values)}
+{}
 
 /*==============================[Public Local Methods]==============================*/
 
@@ -670,11 +652,100 @@ FORCEINLINE Vector3     Matrix4x4::GetForward               ()
  * Computes the inverse of this matrix4x4
  *
  * @return  If the determinant of this matrix4x4 is equal to 0.0f, return Matrix::Identity, otherwise the inverse of this matrix4x4
+ *
+ * @warning The SIMD path differs from the scalar one by at most MATH_SIMD_TOLERANCE_F (see SIMD.hpp).
  */
 FORCEINLINE Matrix4x4   Matrix4x4::GetInverse               ()                              const
 {
-     Matrix4x4   result;
-    
+#if defined(MATH_SIMD_SSE4)
+
+    /*
+     * Block-wise inversion: the matrix is split in four 2x2 blocks | A B | and each block of the inverse is computed
+     *                                                               | C D |
+     * from the adjugates and determinants of A, B, C and D. Loading the columns gives the rows of the transpose,
+     * whose inverse stored row by row is the inverse of this matrix stored column by column.
+     */
+    __m128 const    column0     {_mm_loadu_ps(&m_values[0])};
+    __m128 const    column1     {_mm_loadu_ps(&m_values[4])};
+    __m128 const    column2     {_mm_loadu_ps(&m_values[8])};
+    __m128 const    column3     {_mm_loadu_ps(&m_values[12])};
+
+    // 2x2 blocks stored as (m00, m01, m10, m11) //
+    __m128 const    a           {_mm_movelh_ps(column0, column1)};
+    __m128 const    b           {_mm_movehl_ps(column1, column0)};
+    __m128 const    c           {_mm_movelh_ps(column2, column3)};
+    __m128 const    d           {_mm_movehl_ps(column3, column2)};
+
+    // Determinants of the blocks as (|A|, |B|, |C|, |D|) //
+    __m128 const    blocksDet   {_mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(column0, column2, MATH_SIMD_SHUFFLE(0, 2, 0, 2)),
+                                                       _mm_shuffle_ps(column1, column3, MATH_SIMD_SHUFFLE(1, 3, 1, 3))),
+                                            _mm_mul_ps(_mm_shuffle_ps(column0, column2, MATH_SIMD_SHUFFLE(1, 3, 1, 3)),
+                                                       _mm_shuffle_ps(column1, column3, MATH_SIMD_SHUFFLE(0, 2, 0, 2))))};
+
+    __m128 const    detA        {_mm_shuffle_ps(blocksDet, blocksDet, MATH_SIMD_SHUFFLE(0, 0, 0, 0))};
+    __m128 const    detB        {_mm_shuffle_ps(blocksDet, blocksDet, MATH_SIMD_SHUFFLE(1, 1, 1, 1))};
+    __m128 const    detC        {_mm_shuffle_ps(blocksDet, blocksDet, MATH_SIMD_SHUFFLE(2, 2, 2, 2))};
+    __m128 const    detD        {_mm_shuffle_ps(blocksDet, blocksDet, MATH_SIMD_SHUFFLE(3, 3, 3, 3))};
+
+    // 2x2 products: L * R, adj(L) * R and L * adj(R) //
+    auto const      multiply    {[](__m128 const p_left, __m128 const p_right)
+    {
+        return _mm_add_ps(_mm_mul_ps(p_left,                                                       _mm_shuffle_ps(p_right, p_right, MATH_SIMD_SHUFFLE(0, 3, 0, 3))),
+                          _mm_mul_ps(_mm_shuffle_ps(p_left, p_left, MATH_SIMD_SHUFFLE(1, 0, 3, 2)), _mm_shuffle_ps(p_right, p_right, MATH_SIMD_SHUFFLE(2, 1, 2, 1))));
+    }};
+
+    auto const      adjMultiply {[](__m128 const p_left, __m128 const p_right)
+    {
+        return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(p_left, p_left, MATH_SIMD_SHUFFLE(3, 3, 0, 0)), p_right),
+                          _mm_mul_ps(_mm_shuffle_ps(p_left, p_left, MATH_SIMD_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(p_right, p_right, MATH_SIMD_SHUFFLE(2, 3, 0, 1))));
+    }};
+
+    auto const      multiplyAdj {[](__m128 const p_left, __m128 const p_right)
+    {
+        return _mm_sub_ps(_mm_mul_ps(p_left,                                                       _mm_shuffle_ps(p_right, p_right, MATH_SIMD_SHUFFLE(3, 0, 3, 0))),
+                          _mm_mul_ps(_mm_shuffle_ps(p_left, p_left, MATH_SIMD_SHUFFLE(1, 0, 3, 2)), _mm_shuffle_ps(p_right, p_right, MATH_SIMD_SHUFFLE(2, 1, 2, 1))));
+    }};
+
+    __m128 const    adjDC       {adjMultiply(d, c)};
+    __m128 const    adjAB       {adjMultiply(a, b)};
+
+    // Adjugates of the inverse blocks //
+    __m128          x           {_mm_sub_ps(_mm_mul_ps(detD, a), multiply   (b, adjDC))};
+    __m128          w           {_mm_sub_ps(_mm_mul_ps(detA, d), multiply   (c, adjAB))};
+    __m128          y           {_mm_sub_ps(_mm_mul_ps(detB, c), multiplyAdj(d, adjAB))};
+    __m128          z           {_mm_sub_ps(_mm_mul_ps(detC, b), multiplyAdj(a, adjDC))};
+
+    // |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C) //
+    __m128          trace       {_mm_mul_ps(adjAB, _mm_shuffle_ps(adjDC, adjDC, MATH_SIMD_SHUFFLE(0, 2, 1, 3)))};
+
+    trace                       = _mm_hadd_ps(trace, trace);
+    trace                       = _mm_hadd_ps(trace, trace);
+
+    __m128 const    determinant {_mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace)};
+
+    if (_mm_cvtss_f32(determinant) == 0.0f)
+        return Matrix4x4::Identity;
+
+    __m128 const    inverseDet  {_mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant)};
+
+    x                           = _mm_mul_ps(x, inverseDet);
+    y                           = _mm_mul_ps(y, inverseDet);
+    z                           = _mm_mul_ps(z, inverseDet);
+    w                           = _mm_mul_ps(w, inverseDet);
+
+    Matrix4x4       result;
+
+    _mm_storeu_ps(&result.m_values[0],  _mm_shuffle_ps(x, y, MATH_SIMD_SHUFFLE(3, 1, 3, 1)));
+    _mm_storeu_ps(&result.m_values[4],  _mm_shuffle_ps(x, y, MATH_SIMD_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(&result.m_values[8],  _mm_shuffle_ps(z, w, MATH_SIMD_SHUFFLE(3, 1, 3, 1)));
+    _mm_storeu_ps(&result.m_values[12], _mm_shuffle_ps(z, w, MATH_SIMD_SHUFFLE(2, 0, 2, 0)));
+
+    return result;
+
+#else
+
+    Matrix4x4   result;
+
     float       d12         {m_values[2]  *  m_values[7]  - m_values[3]  *  m_values[6] };
     float       d13         {m_values[2]  *  m_values[11] - m_values[3]  *  m_values[10]};
     float       d14         {m_values[2]  *  m_values[15] - m_values[3]  *  m_values[14]};
@@ -686,40 +757,37 @@ FORCEINLINE Matrix4x4   Matrix4x4::GetInverse               ()
     result.m_values[1]      = -(m_values[1] * d34 - m_values[9] * d14 + m_values[13] * d13);
     result.m_values[2]      =  (m_values[1] * d24 - m_values[5] * d14 + m_values[13] * d12);
     result.m_values[3]      = -(m_values[1] * d23 - m_values[5] * d13 + m_values[9]  * d12);
-          
+
     float       determinant {m_values[0]*result.m_values[0] + m_values[4]*result.m_values[1] + m_values[8] * result.m_values[2] + m_values[12] * result.m_values[3]};
 
-    if (determinant == 0)
-    {
-        result = Matrix4x4::Identity;
-    }
+    if (determinant == 0.0f)
+        return Matrix4x4::Identity;
 
-    else
-    {
-        result.m_values[4]  = -(m_values[4] * d34 - m_values[8] * d24 + m_values[12] * d23);
-        result.m_values[5]  =  (m_values[0] * d34 - m_values[8] * d14 + m_values[12] * d13);
-        result.m_values[6]  = -(m_values[0] * d24 - m_values[4] * d14 + m_values[12] * d12);
-        result.m_values[7]  =  (m_values[0] * d23 - m_values[4] * d13 + m_values[8]  * d12);
-
-        d12                 = m_values[0] * m_values[5]  - m_values[1] * m_values[4];
-        d13                 = m_values[0] * m_values[9]  - m_values[1] * m_values[8];
-        d14                 = m_values[0] * m_values[13] - m_values[1] * m_values[12];
-        d23                 = m_values[4] * m_values[9]  - m_values[5] * m_values[8];
-        d24                 = m_values[4] * m_values[13] - m_values[5] * m_values[12];
-        d34                 = m_values[8] * m_values[13] - m_values[9] * m_values[12];
-
-        result.m_values[8]  =  (m_values[7] * d34 - m_values[11] * d24 + m_values[15] * d23);
-        result.m_values[9]  = -(m_values[3] * d34 - m_values[11] * d14 + m_values[15] * d13);
-        result.m_values[10] =  (m_values[3] * d24 - m_values[7]  * d14 + m_values[15] * d12);
-        result.m_values[11] = -(m_values[3] * d23 - m_values[7]  * d13 + m_values[11] * d12);
-
-        result.m_values[12] = -(m_values[6] * d34 - m_values[10] * d24 + m_values[14] * d23);
-        result.m_values[13] =  (m_values[2] * d34 - m_values[10] * d14 + m_values[14] * d13);
-        result.m_values[14] = -(m_values[2] * d24 - m_values[6]  * d14 + m_values[14] * d12);
-        result.m_values[15] =  (m_values[2] * d23 - m_values[6]  * d13 + m_values[10] * d12);
-    }
- 
-    return result * (1/determinant);
+    result.m_values[4]  = -(m_values[4] * d34 - m_values[8] * d24 + m_values[12] * d23);
+    result.m_values[5]  =  (m_values[0] * d34 - m_values[8] * d14 + m_values[12] * d13);
+    result.m_values[6]  = -(m_values[0] * d24 - m_values[4] * d14 + m_values[12] * d12);
+    result.m_values[7]  =  (m_values[0] * d23 - m_values[4] * d13 + m_values[8]  * d12);
+
+    d12                 = m_values[0] * m_values[5]  - m_values[1] * m_values[4];
+    d13                 = m_values[0] * m_values[9]  - m_values[1] * m_values[8];
+    d14                 = m_values[0] * m_values[13] - m_values[1] * m_values[12];
+    d23                 = m_values[4] * m_values[9]  - m_values[5] * m_values[8];
+    d24                 = m_values[4] * m_values[13] - m_values[5] * m_values[12];
+    d34                 = m_values[8] * m_values[13] - m_values[9] * m_values[12];
+
+    result.m_values[8]  =  (m_values[7] * d34 - m_values[11] * d24 + m_values[15] * d23);
+    result.m_values[9]  = -(m_values[3] * d34 - m_values[11] * d14 + m_values[15] * d13);
+    result.m_values[10] =  (m_values[3] * d24 - m_values[7]  * d14 + m_values[15] * d12);
+    result.m_values[11] = -(m_values[3] * d23 - m_values[7]  * d13 + m_values[11] * d12);
+
+    result.m_values[12] = -(m_values[6] * d34 - m_values[10] * d24 + m_values[14] * d23);
+    result.m_values[13] =  (m_values[2] * d34 - m_values[10] * d14 + m_values[14] * d13);
+    result.m_values[14] = -(m_values[2] * d24 - m_values[6]  * d14 + m_values[14] * d12);
+    result.m_values[15] =  (m_values[2] * d23 - m_values[6]  * d13 + m_values[10] * d12);
+
+    return result * (1.0f / determinant);
+
+#endif
 }
 
 /**
@@ -1013,7 +1081,7 @@ FORCEINLINE Vector3     Matrix4x4::GetScaledUp              ()
  *
  * @return  The transposed of this.
  */
-FORCEINLINE Matrix4x4   Matrix4x4::GetTransposed            ()                              const
+CONSTEXPR FORCEINLINE Matrix4x4   Matrix4x4::GetTransposed            ()                              const
 {
     return Matrix4x4
     (
@@ -1054,6 +1122,23 @@ FORCEINLINE float*      Matrix4x4::GetValues                ()
  */
 FORCEINLINE Vector3     Matrix4x4::MultiplyPoint            (Vector3 const& p_point)        const
 {
+#if defined(MATH_SIMD_SSE4)
+
+    __m128          value   {_mm_mul_ps(_mm_loadu_ps(&m_values[0]), _mm_set1_ps(p_point.m_x))};
+
+    value                   = _mm_add_ps(value, _mm_mul_ps(_mm_loadu_ps(&m_values[4]), _mm_set1_ps(p_point.m_y)));
+    value                   = _mm_add_ps(value, _mm_mul_ps(_mm_loadu_ps(&m_values[8]), _mm_set1_ps(p_point.m_z)));
+    value                   = _mm_add_ps(value, _mm_loadu_ps(&m_values[12]));
+    value                   = _mm_div_ps(value, _mm_shuffle_ps(value, value, MATH_SIMD_SHUFFLE(3, 3, 3, 3)));
+
+    alignas(16) float result[4];
+
+    _mm_store_ps(result, value);
+
+    return Vector3(result[0], result[1], result[2]);
+
+#else
+
     float const w   {m_values[3] * p_point.m_x + m_values[7] * p_point.m_y + m_values[11] * p_point.m_z + m_values[15]};
 
     return Vector3
@@ -1062,6 +1147,8 @@ FORCEINLINE Vector3     Matrix4x4::MultiplyPoint            (Vector3 const& p_po
         (m_values[1] * p_point.m_x + m_values[5] * p_point.m_y + m_values[9]  * p_point.m_z + m_values[13]) / w,
         (m_values[2] * p_point.m_x + m_values[6] * p_point.m_y + m_values[10] * p_point.m_z + m_values[14]) / w
     );
+
+#endif
 }
 
 /**
@@ -1074,12 +1161,30 @@ FORCEINLINE Vector3     Matrix4x4::MultiplyPoint            (Vector3 const& p_po
  */
 FORCEINLINE Vector3     Matrix4x4::MultiplyPoint3x4         (Vector3 const& p_point)        const
 {
+#if defined(MATH_SIMD_SSE4)
+
+    __m128          value   {_mm_mul_ps(_mm_loadu_ps(&m_values[0]), _mm_set1_ps(p_point.m_x))};
+
+    value                   = _mm_add_ps(value, _mm_mul_ps(_mm_loadu_ps(&m_values[4]), _mm_set1_ps(p_point.m_y)));
+    value                   = _mm_add_ps(value, _mm_mul_ps(_mm_loadu_ps(&m_values[8]), _mm_set1_ps(p_point.m_z)));
+    value                   = _mm_add_ps(value, _mm_loadu_ps(&m_values[12]));
+
+    alignas(16) float result[4];
+
+    _mm_store_ps(result, value);
+
+    return Vector3(result[0], result[1], result[2]);
+
+#else
+
     return Vector3
     (
         m_values[0] * p_point.m_x + m_values[4] * p_point.m_y + m_values[8]  * p_point.m_z + m_values[12],
         m_values[1] * p_point.m_x + m_values[5] * p_point.m_y + m_values[9]  * p_point.m_z + m_values[13],
         m_values[2] * p_point.m_x + m_values[6] * p_point.m_y + m_values[10] * p_point.m_z + m_values[14]
     );
+
+#endif
 }
 
 /**
@@ -1092,12 +1197,29 @@ FORCEINLINE Vector3     Matrix4x4::MultiplyPoint3x4         (Vector3 const& p_po
  */
 FORCEINLINE Vector3     Matrix4x4::MultiplyVector           (Vector3 const& p_point)        const
 {
+#if defined(MATH_SIMD_SSE4)
+
+    __m128          value   {_mm_mul_ps(_mm_loadu_ps(&m_values[0]), _mm_set1_ps(p_point.m_x))};
+
+    value                   = _mm_add_ps(value, _mm_mul_ps(_mm_loadu_ps(&m_values[4]), _mm_set1_ps(p_point.m_y)));
+    value                   = _mm_add_ps(value, _mm_mul_ps(_mm_loadu_ps(&m_values[8]), _mm_set1_ps(p_point.m_z)));
+
+    alignas(16) float result[4];
+
+    _mm_store_ps(result, value);
+
+    return Vector3(result[0], result[1], result[2]);
+
+#else
+
     return Vector3
     (
         m_values[0] * p_point.m_x + m_values[4] * p_point.m_y + m_values[8]  * p_point.m_z,
         m_values[1] * p_point.m_x + m_values[5] * p_point.m_y + m_values[9]  * p_point.m_z,
         m_values[2] * p_point.m_x + m_values[6] * p_point.m_y + m_values[10] * p_point.m_z
     );
+
+#endif
 }
 
 /**
@@ -1294,9 +1416,9 @@ FORCEINLINE void        Matrix4x4::SetRow                   (int32 const    p_in
  * @param p_newY The new Y coordinate of the system
  * @param p_newZ The new Z coordinate of the system
  */
-FORCEINLINE void	    Matrix4x4::SetOrigin                (float const    p_newX,    
-                                                             float const    p_newY,
-                                                             float const    p_newZ)
+CONSTEXPR FORCEINLINE void	    Matrix4x4::SetOrigin                (float const    p_newX,    
+                                                                       float const    p_newY,
+                                                                       float const    p_newZ)
 {
     m_values[12] = p_newX;
     m_values[13] = p_newY;
@@ -1309,7 +1431,7 @@ FORCEINLINE void	    Matrix4x4::SetOrigin                (float const    p_newX,
  * @param p_newOrigin   The new coordinate of the system.
  *
  */
-FORCEINLINE void	    Matrix4x4::SetOrigin                (Vector3 const& p_newOrigin)
+CONSTEXPR FORCEINLINE void	    Matrix4x4::SetOrigin                (Vector3 const& p_newOrigin)
 {
     m_values[12] = p_newOrigin.m_x;
     m_values[13] = p_newOrigin.m_y;
@@ -1325,7 +1447,7 @@ FORCEINLINE void	    Matrix4x4::SetOrigin                (Vector3 const& p_newOr
  *
  * @return              True if two matrix are identical, otherwise false.
  */
-FORCEINLINE bool	    Matrix4x4::operator==	(Matrix4x4 const&   p_matrix4x4)    const
+CONSTEXPR FORCEINLINE bool	    Matrix4x4::operator==	(Matrix4x4 const&   p_matrix4x4)    const
 {
     return  m_values[0]  == p_matrix4x4.m_values[0]  &&  
             m_values[1]  == p_matrix4x4.m_values[1]  &&  
@@ -1352,7 +1474,7 @@ FORCEINLINE bool	    Matrix4x4::operator==	(Matrix4x4 const&   p_matrix4x4)    c
  *
  * @return              True if two matrix are different, otherwise false.
  */
-FORCEINLINE bool	    Matrix4x4::operator!=	(Matrix4x4 const&   p_matrix4x4)    const
+CONSTEXPR FORCEINLINE bool	    Matrix4x4::operator!=	(Matrix4x4 const&   p_matrix4x4)    const
 {
     return  m_values[0]  != p_matrix4x4.m_values[0]  ||  
             m_values[1]  != p_matrix4x4.m_values[1]  ||  
@@ -1379,7 +1501,7 @@ FORCEINLINE bool	    Matrix4x4::operator!=	(Matrix4x4 const&   p_matrix4x4)    c
  *
  * @return          The reference to matrix4x4 after copy.
  */
-FORCEINLINE Matrix4x4&  Matrix4x4::operator=    (Matrix4x4 const&   p_copy)
+CONSTEXPR FORCEINLINE Matrix4x4&  Matrix4x4::operator=    (Matrix4x4 const&   p_copy)
 {
     m_values[0]  = p_copy.m_values[0];  
     m_values[1]  = p_copy.m_values[1];  
@@ -1408,7 +1530,7 @@ FORCEINLINE Matrix4x4&  Matrix4x4::operator=    (Matrix4x4 const&   p_copy)
  *
  * @return          The reference to matrix4x4 after move.
  */
-FORCEINLINE Matrix4x4&  Matrix4x4::operator=    (Matrix4x4&&        p_move)
+CONSTEXPR FORCEINLINE Matrix4x4&  Matrix4x4::operator=    (Matrix4x4&&        p_move)
 {
     m_values[0] = std::move(p_move.m_values[0]); m_values[4] = std::move(p_move.m_values[4]); m_values[8]  = std::move(p_move.m_values[8] ) ; m_values[12] = std::move(p_move.m_values[12]);
     m_values[1] = std::move(p_move.m_values[1]); m_values[5] = std::move(p_move.m_values[5]); m_values[9]  = std::move(p_move.m_values[9] ) ; m_values[13] = std::move(p_move.m_values[13]);
@@ -1426,8 +1548,8 @@ FORCEINLINE Matrix4x4&  Matrix4x4::operator=    (Matrix4x4&&        p_move)
  *
  * @return              The copy of the element corresponding to the indexes [p_rowIndex, p_columnIndex] given.
  */
-FORCEINLINE float       Matrix4x4::operator()   (int32 const        p_rowIndex,
-                                                 int32 const        p_columnIndex)  const
+CONSTEXPR FORCEINLINE float       Matrix4x4::operator()   (int32 const        p_rowIndex,
+                                                           int32 const        p_columnIndex)  const
 {
     if (p_rowIndex < 0 || 3 < p_rowIndex)
         throw std::out_of_range("p_index is out of Matrix4x4's row index range : [0,3]");
@@ -1446,8 +1568,8 @@ FORCEINLINE float       Matrix4x4::operator()   (int32 const        p_rowIndex,
  *
  * @return              The reference of the element corresponding to the indexes [p_rowIndex, p_columnIndex] given.
  */
-FORCEINLINE float&      Matrix4x4::operator()   (int32 const        p_rowIndex,
-                                                 int32 const        p_columnIndex)
+CONSTEXPR FORCEINLINE float&      Matrix4x4::operator()   (int32 const        p_rowIndex,
+                                                           int32 const        p_columnIndex)
 {
     return m_values[p_rowIndex + p_columnIndex * 4];
 } 
@@ -1458,7 +1580,7 @@ FORCEINLINE float&      Matrix4x4::operator()   (int32 const        p_rowIndex,
  *
  * @return              The copy of the element corresponding to the indexes [p_rowIndex, p_columnIndex] given.
  */
-FORCEINLINE float       Matrix4x4::operator()   (int32 const        p_index)        const
+CONSTEXPR FORCEINLINE float       Matrix4x4::operator()   (int32 const        p_index)        const
 {
     if (p_index < 0 || 15 < p_index)
         throw std::out_of_range("p_index is out of Matrix4x4's index range : [0,15]");
@@ -1473,7 +1595,7 @@ FORCEINLINE float       Matrix4x4::operator()   (int32 const        p_index)
  *
  * @return              The reference of the element corresponding to the indexes [p_rowIndex, p_columnIndex] given.
  */
-FORCEINLINE float&      Matrix4x4::operator()   (int32 const        p_index)
+CONSTEXPR FORCEINLINE float&      Matrix4x4::operator()   (int32 const        p_index)
 {
     if (p_index < 0 || 15 < p_index)
         throw std::out_of_range("p_index is out of Matrix4x4's index range : [0,15]");
@@ -1488,7 +1610,7 @@ FORCEINLINE float&      Matrix4x4::operator()   (int32 const        p_index)
  *
  * @return              The result of addition.
  */
-FORCEINLINE Matrix4x4 	Matrix4x4::operator+	(Matrix4x4 const&   p_matrix4x4)    const
+CONSTEXPR FORCEINLINE Matrix4x4 	Matrix4x4::operator+	(Matrix4x4 const&   p_matrix4x4)    const
 {
     return Matrix4x4
     (
@@ -1506,7 +1628,7 @@ FORCEINLINE Matrix4x4 	Matrix4x4::operator+	(Matrix4x4 const&   p_matrix4x4)
  *
  * @return              The reference to this after addition.
  */
-FORCEINLINE Matrix4x4& 	Matrix4x4::operator+=	(Matrix4x4 const&   p_matrix4x4)
+CONSTEXPR FORCEINLINE Matrix4x4& 	Matrix4x4::operator+=	(Matrix4x4 const&   p_matrix4x4)
 {
     m_values[0]  += p_matrix4x4.m_values[0];  
     m_values[1]  += p_matrix4x4.m_values[1];  
@@ -1535,7 +1657,7 @@ FORCEINLINE Matrix4x4& 	Matrix4x4::operator+=	(Matrix4x4 const&   p_matrix4x4)
  *
  * @return              The result of subtraction.
  */
-FORCEINLINE Matrix4x4 	Matrix4x4::operator-	(Matrix4x4 const&   p_matrix4x4)    const
+CONSTEXPR FORCEINLINE Matrix4x4 	Matrix4x4::operator-	(Matrix4x4 const&   p_matrix4x4)    const
 {
     return Matrix4x4
     (
@@ -1553,7 +1675,7 @@ FORCEINLINE Matrix4x4 	Matrix4x4::operator-	(Matrix4x4 const&   p_matrix4x4)
  *
  * @return              The reference to this after subtraction.
  */
-FORCEINLINE Matrix4x4& 	Matrix4x4::operator-=	(Matrix4x4 const&   p_matrix4x4)
+CONSTEXPR FORCEINLINE Matrix4x4& 	Matrix4x4::operator-=	(Matrix4x4 const&   p_matrix4x4)
 {
     m_values[0]  -= p_matrix4x4.m_values[0];  
     m_values[1]  -= p_matrix4x4.m_values[1];  
@@ -1584,6 +1706,62 @@ FORCEINLINE Matrix4x4& 	Matrix4x4::operator-=	(Matrix4x4 const&   p_matrix4x4)
  */
 FORCEINLINE Matrix4x4   Matrix4x4::operator*    (Matrix4x4 const&   p_matrix4x4)    const
 {
+#if defined(MATH_SIMD_AVX2)
+
+    /* Two columns of the result per iteration, the columns of this matrix are duplicated in both 128-bit lanes. */
+    Matrix4x4       result;
+
+    __m256 const    column0 {_mm256_broadcast_ps(reinterpret_cast<__m128 const*>(&m_values[0]))};
+    __m256 const    column1 {_mm256_broadcast_ps(reinterpret_cast<__m128 const*>(&m_values[4]))};
+    __m256 const    column2 {_mm256_broadcast_ps(reinterpret_cast<__m128 const*>(&m_values[8]))};
+    __m256 const    column3 {_mm256_broadcast_ps(reinterpret_cast<__m128 const*>(&m_values[12]))};
+
+    for (int32 index {0}; index < 16; index += 8)
+    {
+        __m256 const    right   {_mm256_loadu_ps(&p_matrix4x4.m_values[index])};
+        __m256          value   {_mm256_mul_ps(column0, _mm256_permute_ps(right, MATH_SIMD_SHUFFLE(0, 0, 0, 0)))};
+
+    #if defined(MATH_SIMD_FMA)
+        value                   = _mm256_fmadd_ps(column1, _mm256_permute_ps(right, MATH_SIMD_SHUFFLE(1, 1, 1, 1)), value);
+        value                   = _mm256_fmadd_ps(column2, _mm256_permute_ps(right, MATH_SIMD_SHUFFLE(2, 2, 2, 2)), value);
+        value                   = _mm256_fmadd_ps(column3, _mm256_permute_ps(right, MATH_SIMD_SHUFFLE(3, 3, 3, 3)), value);
+    #else
+        value                   = _mm256_add_ps(value, _mm256_mul_ps(column1, _mm256_permute_ps(right, MATH_SIMD_SHUFFLE(1, 1, 1, 1))));
+        value                   = _mm256_add_ps(value, _mm256_mul_ps(column2, _mm256_permute_ps(right, MATH_SIMD_SHUFFLE(2, 2, 2, 2))));
+        value                   = _mm256_add_ps(value, _mm256_mul_ps(column3, _mm256_permute_ps(right, MATH_SIMD_SHUFFLE(3, 3, 3, 3))));
+    #endif
+
+        _mm256_storeu_ps(&result.m_values[index], value);
+    }
+
+    return result;
+
+#elif defined(MATH_SIMD_SSE4)
+
+    /* Each column of the result is the combination of the columns of this matrix weighted by a column of p_matrix4x4. */
+    Matrix4x4       result;
+
+    __m128 const    column0 {_mm_loadu_ps(&m_values[0])};
+    __m128 const    column1 {_mm_loadu_ps(&m_values[4])};
+    __m128 const    column2 {_mm_loadu_ps(&m_values[8])};
+    __m128 const    column3 {_mm_loadu_ps(&m_values[12])};
+
+    for (int32 index {0}; index < 16; index += 4)
+    {
+        __m128 const    right   {_mm_loadu_ps(&p_matrix4x4.m_values[index])};
+        __m128          value   {_mm_mul_ps(column0, _mm_shuffle_ps(right, right, MATH_SIMD_SHUFFLE(0, 0, 0, 0)))};
+
+        value                   = _mm_add_ps(value, _mm_mul_ps(column1, _mm_shuffle_ps(right, right, MATH_SIMD_SHUFFLE(1, 1, 1, 1))));
+        value                   = _mm_add_ps(value, _mm_mul_ps(column2, _mm_shuffle_ps(right, right, MATH_SIMD_SHUFFLE(2, 2, 2, 2))));
+        value                   = _mm_add_ps(value, _mm_mul_ps(column3, _mm_shuffle_ps(right, right, MATH_SIMD_SHUFFLE(3, 3, 3, 3))));
+
+        _mm_storeu_ps(&result.m_values[index], value);
+    }
+
+    return result;
+
+#else
+
     return Matrix4x4
     (
        // First Row //
@@ -1610,6 +1788,8 @@ FORCEINLINE Matrix4x4   Matrix4x4::operator*    (Matrix4x4 const&   p_matrix4x4)
         m_values[3] * p_matrix4x4.m_values[8]  + m_values[7] * p_matrix4x4.m_values[9]  + m_values[11] * p_matrix4x4.m_values[10] + m_values[15] * p_matrix4x4.m_values[11],
         m_values[3] * p_matrix4x4.m_values[12] + m_values[7] * p_matrix4x4.m_values[13] + m_values[11] * p_matrix4x4.m_values[14] + m_values[15] * p_matrix4x4.m_values[15]
     );
+
+#endif
 }
 
 /**
@@ -1619,7 +1799,7 @@ FORCEINLINE Matrix4x4   Matrix4x4::operator*    (Matrix4x4 const&   p_matrix4x4)
  *
  * @return          The result of the multiplication
  */
-FORCEINLINE Matrix4x4 	Matrix4x4::operator*	(float const        p_value)        const
+CONSTEXPR FORCEINLINE Matrix4x4 	Matrix4x4::operator*	(float const        p_value)        const
 {
     return Matrix4x4
     (
@@ -1652,6 +1832,22 @@ FORCEINLINE Vector3     Matrix4x4::operator*    (Vector3 const&     p_position)
  */
 FORCEINLINE Vector4     Matrix4x4::operator*    (Vector4 const&     p_vector4)      const
 {
+#if defined(MATH_SIMD_SSE4)
+
+    __m128          value   {_mm_mul_ps(_mm_loadu_ps(&m_values[0]), _mm_set1_ps(p_vector4.m_x))};
+
+    value                   = _mm_add_ps(value, _mm_mul_ps(_mm_loadu_ps(&m_values[4]), _mm_set1_ps(p_vector4.m_y)));
+    value                   = _mm_add_ps(value, _mm_mul_ps(_mm_loadu_ps(&m_values[8]), _mm_set1_ps(p_vector4.m_z)));
+    value                   = _mm_add_ps(value, _mm_mul_ps(_mm_loadu_ps(&m_values[12]), _mm_set1_ps(p_vector4.m_w)));
+
+    alignas(16) float result[4];
+
+    _mm_store_ps(result, value);
+
+    return Vector4(result[0], result[1], result[2], result[3]);
+
+#else
+
     return Vector4
     (
         m_values[0] * p_vector4.m_x + m_values[4] * p_vector4.m_y + m_values[8]  * p_vector4.m_z + p_vector4.m_w  * m_values[12],
@@ -1659,6 +1855,8 @@ FORCEINLINE Vector4     Matrix4x4::operator*    (Vector4 const&     p_vector4)
         m_values[2] * p_vector4.m_x + m_values[6] * p_vector4.m_y + m_values[10] * p_vector4.m_z + p_vector4.m_w  * m_values[14],
         m_values[3] * p_vector4.m_x + m_values[7] * p_vector4.m_y + m_values[11] * p_vector4.m_z + p_vector4.m_w  * m_values[15]
     );
+
+#endif
 }
 
 /**
@@ -1681,7 +1879,7 @@ FORCEINLINE Matrix4x4&  Matrix4x4::operator*=   (Matrix4x4 const&   p_matrix4x4)
  *
  * @return          The reference to this after multiplication.
  */
-FORCEINLINE Matrix4x4&  Matrix4x4::operator*=	(float const        p_value)
+CONSTEXPR FORCEINLINE Matrix4x4&  Matrix4x4::operator*=	(float const        p_value)
 {
     m_values[0]  *= p_value; 
     m_values[1]  *= p_value; 
@@ -1713,8 +1911,8 @@ FORCEINLINE Matrix4x4&  Matrix4x4::operator*=	(float const        p_value)
  *
  * @return              The result of the multiplication
  */
-FORCEINLINE Matrix4x4   operator*   (float const        p_scale,
-                                     Matrix4x4 const&   p_matrix4x4)
+CONSTEXPR FORCEINLINE Matrix4x4   operator*   (float const        p_scale,
+                                               Matrix4x4 const&   p_matrix4x4)
 {
     return Matrix4x4
     (
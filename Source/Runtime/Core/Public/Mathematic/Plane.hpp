@@ -88,6 +88,8 @@ struct ENGINE_API Plane
 }; // !struct Plane
 
 #include "Plane.inl"
-#include "Plane.generated.hpp"
+#if __has_include("Plane.generated.hpp")
+    #include "Plane.generated.hpp"
+#endif
 
 #endif // !__PLANE_HPP__
@@ -1,6 +1,7 @@
 #ifndef __QUATERNION_HPP__
 #define __QUATERNION_HPP__
 
+#include "SIMD.hpp"
 #include "Vector3.hpp"
 
 // ==============================[Forward Declaration] ============================== //
@@ -124,133 +125,135 @@ struct ENGINE_API Quaternion
 
     //=========================[Constructor + Destructor]=========================//
        
-        FORCEINLINE Quaternion  ();
+        CONSTEXPR FORCEINLINE Quaternion  ();
 
-        FORCEINLINE Quaternion  (float const        p_x,
-                                 float const        p_y,
-                                 float const        p_z,
-                                 float const        p_w);
+        CONSTEXPR FORCEINLINE Quaternion  (float const        p_x,
+                                           float const        p_y,
+                                           float const        p_z,
+                                           float const        p_w);
         
-        FORCEINLINE Quaternion  (Vector3 const&     p_axis,
-                                 float const        p_angle);
+                  FORCEINLINE Quaternion  (Vector3 const&     p_axis,
+                                           float const        p_angle);
 
-        FORCEINLINE Quaternion  (Matrix4x4 const&   p_matrix);
+                  FORCEINLINE Quaternion  (Matrix4x4 const&   p_matrix);
 
-        FORCEINLINE Quaternion  (const Quaternion&  p_copy);
+        CONSTEXPR FORCEINLINE Quaternion  (const Quaternion&  p_copy);
 
-        FORCEINLINE Quaternion  (Quaternion&&       p_move);
+        CONSTEXPR FORCEINLINE Quaternion  (Quaternion&&       p_move);
 
 
-                    ~Quaternion () = default;
+                              ~Quaternion () = default;
 
     //=========================[Public Local Methods]=========================//
         
-        FORCEINLINE void        Conjugate           ();
+                  FORCEINLINE void        Conjugate           ();
 
-        FORCEINLINE float       GetAngleDeg         ()                                              const;
+                  FORCEINLINE float       GetAngleDeg         ()                                              const;
         
-        FORCEINLINE float       GetAngleRad         ()                                              const;
+                  FORCEINLINE float       GetAngleRad         ()                                              const;
 
-        FORCEINLINE Vector3     GetAxisX            ()                                              const;
+                  FORCEINLINE Vector3     GetAxisX            ()                                              const;
 
-        FORCEINLINE Vector3     GetAxisY            ()                                              const;
+                  FORCEINLINE Vector3     GetAxisY            ()                                              const;
 
-        FORCEINLINE Vector3     GetAxisZ            ()                                              const;
+                  FORCEINLINE Vector3     GetAxisZ            ()                                              const;
 
-        FORCEINLINE Vector3     GetBackward         ()                                              const;
+                  FORCEINLINE Vector3     GetBackward         ()                                              const;
 
-        FORCEINLINE Quaternion  GetConjugate        ()                                              const;
+        CONSTEXPR FORCEINLINE Quaternion  GetConjugate        ()                                              const;
 
-        FORCEINLINE Vector3     GetDown             ()                                              const;
+                  FORCEINLINE Vector3     GetDown             ()                                              const;
 
-        FORCEINLINE Vector3     GetEulerDeg         ()                                              const;
+                  FORCEINLINE Vector3     GetEulerDeg         ()                                              const;
         
-        FORCEINLINE Vector3     GetEulerRad         ()                                              const;
+                  FORCEINLINE Vector3     GetEulerRad         ()                                              const;
 
-        FORCEINLINE Vector3     GetForward          ()                                              const;
+                  FORCEINLINE Vector3     GetForward          ()                                              const;
 
-        FORCEINLINE Quaternion  GetInverse          ()                                              const;
+                  FORCEINLINE Quaternion  GetInverse          ()                                              const;
 
-        FORCEINLINE Vector3     GetLeft             ()                                              const;
+                  FORCEINLINE Vector3     GetLeft             ()                                              const;
 
-        FORCEINLINE float       GetMagnitude        ()                                              const;
+                  FORCEINLINE float       GetMagnitude        ()                                              const;
 
-        FORCEINLINE float       GetMagnitudeSquared ()                                              const;
+                  FORCEINLINE float       GetMagnitudeSquared ()                                              const;
 
-        FORCEINLINE Vector3     GetRight            ()                                              const;
+                  FORCEINLINE Vector3     GetRight            ()                                              const;
 
-        FORCEINLINE Vector3     GetRotationAxis     ()                                              const;
+                  FORCEINLINE Vector3     GetRotationAxis     ()                                              const;
         
-        FORCEINLINE Quaternion  GetSafeNormalized   (float const    p_tolerance = MATH_EPSILON_F)   const;    
+                  FORCEINLINE Quaternion  GetSafeNormalized   (float const    p_tolerance = MATH_EPSILON_F)   const;    
 
-        FORCEINLINE Quaternion  GetUnsafeNormalized ()                                              const;
+                  FORCEINLINE Quaternion  GetUnsafeNormalized ()                                              const;
 
-        FORCEINLINE Vector3     GetUp               ()                                              const;
+                  FORCEINLINE Vector3     GetUp               ()                                              const;
 
-        FORCEINLINE void        Inverse             ();
+                  FORCEINLINE void        Inverse             ();
 
-        FORCEINLINE bool        IsIdentity          (float const    p_tolerance = MATH_EPSILON_F)   const;
+                  FORCEINLINE bool        IsIdentity          (float const    p_tolerance = MATH_EPSILON_F)   const;
 
-        FORCEINLINE bool        IsNormalized        ()                                              const;
+                  FORCEINLINE bool        IsNormalized        ()                                              const;
 
-        FORCEINLINE bool        IsNearlyZero        (float const    p_tolerance = MATH_EPSILON_F)   const;
+                  FORCEINLINE bool        IsNearlyZero        (float const    p_tolerance = MATH_EPSILON_F)   const;
 
-        FORCEINLINE bool        IsZero              ()                                              const;
+                  FORCEINLINE bool        IsZero              ()                                              const;
 
-        FORCEINLINE bool        Normalize           (float const    p_tolerance = MATH_EPSILON_F);
+                  FORCEINLINE bool        Normalize           (float const    p_tolerance = MATH_EPSILON_F);
         
-        FORCEINLINE Vector3     RotateVector        (Vector3 const& p_vector)                       const;
+                  FORCEINLINE Vector3     RotateVector        (Vector3 const& p_vector)                       const;
 
-        FORCEINLINE void        Set                 (float const    p_x,
-                                                     float const    p_y,
-                                                     float const    p_z,
-                                                     float const    p_w);
+                  FORCEINLINE void        Set                 (float const    p_x,
+                                                               float const    p_y,
+                                                               float const    p_z,
+                                                               float const    p_w);
 
-        FORCEINLINE void        ToAxisAndAngleDeg   (Vector3&       p_outAxis,
-                                                     float&         p_outAngleDeg)                  const;
+                  FORCEINLINE void        ToAxisAndAngleDeg   (Vector3&       p_outAxis,
+                                                               float&         p_outAngleDeg)                  const;
 
-        FORCEINLINE void        ToAxisAndAngleRad   (Vector3&       p_outAxis,
-                                                     float&         p_outAngleRad)                  const;
+                  FORCEINLINE void        ToAxisAndAngleRad   (Vector3&       p_outAxis,
+                                                               float&         p_outAngleRad)                  const;
 
-        FORCEINLINE Vector3     UnrotateVector      (Vector3 const& p_vector)                       const;
+                  FORCEINLINE Vector3     UnrotateVector      (Vector3 const& p_vector)                       const;
         
     //=========================[Public Local Operators]=========================//
 
-        FORCEINLINE bool        operator==  (const Quaternion&  p_quaternion)   const;
-        FORCEINLINE bool        operator!=  (const Quaternion&  p_quaternion)   const;
+        CONSTEXPR FORCEINLINE bool        operator==  (const Quaternion&  p_quaternion)   const;
+        CONSTEXPR FORCEINLINE bool        operator!=  (const Quaternion&  p_quaternion)   const;
 
-        FORCEINLINE Quaternion& operator=   (const Quaternion&  p_other);
-        FORCEINLINE Quaternion& operator=   (Quaternion&&       p_other);
+        CONSTEXPR FORCEINLINE Quaternion& operator=   (const Quaternion&  p_other);
+        CONSTEXPR FORCEINLINE Quaternion& operator=   (Quaternion&&       p_other);
 
-        FORCEINLINE float       operator[]  (int32 const        p_index)        const;
-        FORCEINLINE float&      operator[]  (int32 const        p_index);
+                  FORCEINLINE float       operator[]  (int32 const        p_index)        const;
+                  FORCEINLINE float&      operator[]  (int32 const        p_index);
 
-        FORCEINLINE Quaternion  operator+   (const Quaternion&  p_quaternion)   const;
-        FORCEINLINE Quaternion& operator+=  (const Quaternion&  p_quaternion);
+        CONSTEXPR FORCEINLINE Quaternion  operator+   (const Quaternion&  p_quaternion)   const;
+        CONSTEXPR FORCEINLINE Quaternion& operator+=  (const Quaternion&  p_quaternion);
 
-        FORCEINLINE Quaternion  operator-   ()                                  const;
-        FORCEINLINE Quaternion  operator-   (const Quaternion&  p_quaternion)   const;
-        FORCEINLINE Quaternion& operator-=  (const Quaternion&  p_quaternion);
+        CONSTEXPR FORCEINLINE Quaternion  operator-   ()                                  const;
+        CONSTEXPR FORCEINLINE Quaternion  operator-   (const Quaternion&  p_quaternion)   const;
+        CONSTEXPR FORCEINLINE Quaternion& operator-=  (const Quaternion&  p_quaternion);
 
-        FORCEINLINE Quaternion  operator*   (const Quaternion&  p_quaternion)   const;
-        FORCEINLINE Quaternion  operator*   (float const        p_scale)        const;
-        FORCEINLINE Vector3     operator*   (Vector3 const&     p_vector)       const;
-        FORCEINLINE Quaternion& operator*=  (const Quaternion&  p_quaternion);
-        FORCEINLINE Quaternion& operator*=  (float const        p_scale);
+                  FORCEINLINE Quaternion  operator*   (const Quaternion&  p_quaternion)   const;
+        CONSTEXPR FORCEINLINE Quaternion  operator*   (float const        p_scale)        const;
+                  FORCEINLINE Vector3     operator*   (Vector3 const&     p_vector)       const;
+                  FORCEINLINE Quaternion& operator*=  (const Quaternion&  p_quaternion);
+        CONSTEXPR FORCEINLINE Quaternion& operator*=  (float const        p_scale);
 
-        FORCEINLINE Quaternion  operator/   (float const        p_scale)        const;  
-        FORCEINLINE Quaternion& operator/=  (float const        p_scale);                   
+        CONSTEXPR FORCEINLINE Quaternion  operator/   (float const        p_scale)        const;  
+        CONSTEXPR FORCEINLINE Quaternion& operator/=  (float const        p_scale);                   
 
-        FORCEINLINE float       operator|   (const Quaternion&  p_quaternion)   const;
+                  FORCEINLINE float       operator|   (const Quaternion&  p_quaternion)   const;
 
 }; // !struct Quaternion
 
 /*==============================[Public Globale Operators]==============================*/
     
-    FORCEINLINE Quaternion  operator*   (float const        p_scale,
-                                         const Quaternion&  p_quaternion);
+    CONSTEXPR FORCEINLINE Quaternion  operator*   (float const        p_scale,
+                                                   const Quaternion&  p_quaternion);
 
 #include "Quaternion.inl"
-#include "Quaternion.generated.hpp"
+#if __has_include("Quaternion.generated.hpp")
+    #include "Quaternion.generated.hpp"
+#endif
 
 #endif // !__QUATERNION_HPP__
\ No newline at end of file
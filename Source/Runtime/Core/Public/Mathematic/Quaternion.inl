@@ -452,13 +452,28 @@ FORCEINLINE Quaternion  Quaternion::Slerp               (Quaternion const& p_a,
     // In keeping with our flipped Cosom:
     scale1 = Math::FloatSelect(rawCosTheta, scale1, -scale1);
 
+#if defined(MATH_SIMD_SSE4)
+
+    __m128 const result {_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&p_a.m_x), _mm_set1_ps(scale0)),
+                                    _mm_mul_ps(_mm_loadu_ps(&p_b.m_x), _mm_set1_ps(scale1)))};
+
+    Quaternion slerp;
+
+    _mm_storeu_ps(&slerp.m_x, result);
+
+    return slerp;
+
+#else
+
     return  p_a * scale0 + p_b * scale1;
+
+#endif
 } 
 
 /*==============================[Constructors + Destructor]==============================*/
 
 /** Default constructor, all components are initialized to 0.0f */
-FORCEINLINE Quaternion::Quaternion  ()
+CONSTEXPR FORCEINLINE Quaternion::Quaternion  ()
 :   m_x {0.0f},
     m_y {0.0f},
     m_z {0.0f},
@@ -473,10 +488,10 @@ FORCEINLINE Quaternion::Quaternion  ()
  * @param p_z   Z component of the quaternion
  * @param p_w   W component of the quaternion
  */
-FORCEINLINE Quaternion::Quaternion  (float const        p_x,
-                                     float const        p_y,
-                                     float const        p_z,
-                                     float const        p_w)
+CONSTEXPR FORCEINLINE Quaternion::Quaternion  (float const        p_x,
+                                               float const        p_y,
+                                               float const        p_z,
+                                               float const        p_w)
 :   m_x {p_x},
     m_y {p_y},
     m_z {p_z},
@@ -506,7 +521,7 @@ FORCEINLINE Quaternion::Quaternion  (Vector3 const&     p_axis,
  *
  * @param p_copy    A Quaternion object to use to create new quaternion from.
  */
-FORCEINLINE Quaternion::Quaternion  (Quaternion const&  p_copy)
+CONSTEXPR FORCEINLINE Quaternion::Quaternion  (Quaternion const&  p_copy)
 :   m_x {p_copy.m_x},
     m_y {p_copy.m_y},
     m_z {p_copy.m_z},
@@ -518,7 +533,7 @@ FORCEINLINE Quaternion::Quaternion  (Quaternion const&  p_copy)
  *
  * @param p_copy    A Quaternion object to use to create new quaternion from.
  */
-FORCEINLINE Quaternion::Quaternion  (Quaternion&&       p_move)
+CONSTEXPR FORCEINLINE Quaternion::Quaternion  (Quaternion&&       p_move)
 :   m_x {std::move(p_move.m_x)},
     m_y {std::move(p_move.m_y)},
     m_z {std::move(p_move.m_z)},
@@ -598,7 +613,7 @@ FORCEINLINE Vector3     Quaternion::GetBackward         ()
  *
  * @return  The conjugate of this quaternion
  */
-FORCEINLINE Quaternion  Quaternion::GetConjugate        ()                              const
+CONSTEXPR FORCEINLINE Quaternion  Quaternion::GetConjugate        ()                              const
 {
     return Quaternion(-m_x, -m_y, -m_z, m_w);
 }
@@ -675,7 +690,17 @@ FORCEINLINE Vector3     Quaternion::GetLeft             ()
  */
 FORCEINLINE float       Quaternion::GetMagnitude        ()                              const
 {
+#if defined(MATH_SIMD_SSE4)
+
+    __m128 const values {_mm_loadu_ps(&m_x)};
+
+    return _mm_cvtss_f32(_mm_sqrt_ss(SIMD::Dot4(values, values)));
+
+#else
+
     return Math::Sqrt(m_x*m_x + m_y*m_y + m_z*m_z + m_w*m_w);
+
+#endif
 }
 
 /**
@@ -685,7 +710,17 @@ FORCEINLINE float       Quaternion::GetMagnitude        ()
  */
 FORCEINLINE float       Quaternion::GetMagnitudeSquared ()                              const
 {
+#if defined(MATH_SIMD_SSE4)
+
+    __m128 const values {_mm_loadu_ps(&m_x)};
+
+    return _mm_cvtss_f32(SIMD::Dot4(values, values));
+
+#else
+
     return m_x*m_x + m_y*m_y + m_z*m_z + m_w*m_w;
+
+#endif
 }
 
 /** Get the right direction (+X axis) after it has been rotated by this Quaternion. */
@@ -721,6 +756,23 @@ FORCEINLINE Vector3     Quaternion::GetRotationAxis     ()
  */
 FORCEINLINE Quaternion  Quaternion::GetSafeNormalized   (float const    p_tolerance)    const
 {
+#if defined(MATH_SIMD_SSE4)
+
+    __m128 const values             {_mm_loadu_ps(&m_x)};
+    float const  magnitudeSquared   {_mm_cvtss_f32(SIMD::Dot4(values, values))};
+
+    // Same test as the scalar path, a NaN magnitude falls back to identity.
+    if (!(magnitudeSquared >= p_tolerance))
+        return Quaternion(0,0,0,1);
+
+    Quaternion normalized;
+
+    _mm_storeu_ps(&normalized.m_x, _mm_mul_ps(values, _mm_set1_ps(Math::InvSqrt(magnitudeSquared))));
+
+    return normalized;
+
+#else
+
     float const magnitudeSquared {GetMagnitudeSquared()};
     
     if (magnitudeSquared >= p_tolerance)
@@ -731,6 +783,8 @@ FORCEINLINE Quaternion  Quaternion::GetSafeNormalized   (float const    p_tolera
 
     else
         return Quaternion(0,0,0,1);
+
+#endif
 }
 
 /**
@@ -829,6 +883,21 @@ FORCEINLINE bool        Quaternion::IsZero              ()
  */
 FORCEINLINE bool        Quaternion::Normalize           (float const    p_tolerance)
 {
+#if defined(MATH_SIMD_SSE4)
+
+    __m128 const values             {_mm_loadu_ps(&m_x)};
+    float const  magnitudeSquared   {_mm_cvtss_f32(SIMD::Dot4(values, values))};
+
+    // Same test as the scalar path, a NaN magnitude leaves the quaternion unchanged.
+    if (!(magnitudeSquared >= p_tolerance))
+        return false;
+
+    _mm_storeu_ps(&m_x, _mm_mul_ps(values, _mm_set1_ps(Math::InvSqrt(magnitudeSquared))));
+
+    return true;
+
+#else
+
     float const magnitudeSquared {GetMagnitudeSquared()};
     
     if (magnitudeSquared >= p_tolerance)
@@ -843,6 +912,8 @@ FORCEINLINE bool        Quaternion::Normalize           (float const    p_tolera
 
     else
         return false;
+
+#endif
 }
 
 /**
@@ -864,10 +935,26 @@ FORCEINLINE Vector3     Quaternion::RotateVector        (Vector3 const& p_vector
 	 *  T           = 2(axis x p_vector);
 	 *  p_vector    = p_vector + w*(T) + (axis x T)
      */
+#if defined(MATH_SIMD_SSE4)
+
+    __m128 const axis   {_mm_loadu_ps(&m_x)};
+    __m128 const vector {SIMD::Load3(&p_vector.m_x)};
+    __m128 const T      {_mm_mul_ps(_mm_set1_ps(2.0f), SIMD::Cross3(axis, vector))};
+
+    Vector3 result;
+
+    SIMD::Store3(&result.m_x, _mm_add_ps(_mm_add_ps(vector, _mm_mul_ps(_mm_set1_ps(m_w), T)), SIMD::Cross3(axis, T)));
+
+    return result;
+
+#else
+
     Vector3 const axis  {m_x, m_y, m_z};
 	Vector3 const T     {2.0f * (axis ^ p_vector)};
 
 	return p_vector + (m_w * T) + (axis ^ T);
+
+#endif
 }
 
 /**
@@ -924,10 +1011,26 @@ FORCEINLINE void        Quaternion::ToAxisAndAngleRad   (Vector3&       p_outAxi
  */
 FORCEINLINE Vector3     Quaternion::UnrotateVector      (Vector3 const& p_vector)       const
 {
+#if defined(MATH_SIMD_SSE4)
+
+    __m128 const axis   {_mm_xor_ps(_mm_loadu_ps(&m_x), _mm_set1_ps(-0.0f))};
+    __m128 const vector {SIMD::Load3(&p_vector.m_x)};
+    __m128 const T      {_mm_mul_ps(_mm_set1_ps(2.0f), SIMD::Cross3(axis, vector))};
+
+    Vector3 result;
+
+    SIMD::Store3(&result.m_x, _mm_add_ps(_mm_add_ps(vector, _mm_mul_ps(_mm_set1_ps(m_w), T)), SIMD::Cross3(axis, T)));
+
+    return result;
+
+#else
+
     Vector3 const axis  {-m_x, -m_y, -m_z};
 	Vector3 const T     {2.0f * (axis ^ p_vector)};
 
 	return p_vector + (m_w * T) + (axis ^ T);
+
+#endif
 }
 
 /*==============================[Public Local Operators]==============================*/
@@ -941,7 +1044,7 @@ FORCEINLINE Vector3     Quaternion::UnrotateVector      (Vector3 const& p_vector
  *
  * @return             True if two quaternion are identical, otherwise false.
  */
-FORCEINLINE bool        Quaternion::operator==  (Quaternion const&  p_quaternion)   const
+CONSTEXPR FORCEINLINE bool        Quaternion::operator==  (Quaternion const&  p_quaternion)   const
 {
     return  m_x == p_quaternion.m_x && 
             m_y == p_quaternion.m_y && 
@@ -956,7 +1059,7 @@ FORCEINLINE bool        Quaternion::operator==  (Quaternion const&  p_quaternion
  *
  * @return             True if two quaternion are not identical, otherwise false.
  */
-FORCEINLINE bool        Quaternion::operator!=  (Quaternion const&  p_quaternion)   const
+CONSTEXPR FORCEINLINE bool        Quaternion::operator!=  (Quaternion const&  p_quaternion)   const
 {
     return  m_x != p_quaternion.m_x || 
             m_y != p_quaternion.m_y || 
@@ -969,7 +1072,7 @@ FORCEINLINE bool        Quaternion::operator!=  (Quaternion const&  p_quaternion
  *
  * @return  reference to this Quaternion after move.
  */
-FORCEINLINE Quaternion& Quaternion::operator=   (Quaternion const&  p_other)
+CONSTEXPR FORCEINLINE Quaternion& Quaternion::operator=   (Quaternion const&  p_other)
 {
     m_x = p_other.m_x;
     m_y = p_other.m_y;
@@ -984,7 +1087,7 @@ FORCEINLINE Quaternion& Quaternion::operator=   (Quaternion const&  p_other)
  *
  * @return  reference to this Quaternion after move.
  */
-FORCEINLINE Quaternion& Quaternion::operator=   (Quaternion&&       p_other)
+CONSTEXPR FORCEINLINE Quaternion& Quaternion::operator=   (Quaternion&&       p_other)
 {
     m_x = std::move(p_other.m_x);
     m_y = std::move(p_other.m_y);
@@ -1046,7 +1149,7 @@ FORCEINLINE float&      Quaternion::operator[] (int32 const         p_index)
  *
  * @return              The result of addition.
  */
-FORCEINLINE Quaternion  Quaternion::operator+   (Quaternion const&  p_quaternion)   const
+CONSTEXPR FORCEINLINE Quaternion  Quaternion::operator+   (Quaternion const&  p_quaternion)   const
 {
     return Quaternion
     (
@@ -1065,7 +1168,7 @@ FORCEINLINE Quaternion  Quaternion::operator+   (Quaternion const&  p_quaternion
  *
  * @return              Result after addition.
  */
-FORCEINLINE Quaternion& Quaternion::operator+=  (Quaternion const&  p_quaternion)
+CONSTEXPR FORCEINLINE Quaternion& Quaternion::operator+=  (Quaternion const&  p_quaternion)
 {
     m_x += p_quaternion.m_x;
     m_y += p_quaternion.m_y;
@@ -1080,7 +1183,7 @@ FORCEINLINE Quaternion& Quaternion::operator+=  (Quaternion const&  p_quaternion
  *
  * @return          A negated copy of the quaternion.
  */
-FORCEINLINE Quaternion  Quaternion::operator-   ()                                  const
+CONSTEXPR FORCEINLINE Quaternion  Quaternion::operator-   ()                                  const
 {
     return Quaternion(-m_x, -m_y, -m_z, -m_w);
 }
@@ -1093,7 +1196,7 @@ FORCEINLINE Quaternion  Quaternion::operator-   ()
  *
  * @return              The result of subtraction.
  */
-FORCEINLINE Quaternion  Quaternion::operator-   (Quaternion const&  p_quaternion)   const
+CONSTEXPR FORCEINLINE Quaternion  Quaternion::operator-   (Quaternion const&  p_quaternion)   const
 {
     return Quaternion
     (
@@ -1112,7 +1215,7 @@ FORCEINLINE Quaternion  Quaternion::operator-   (Quaternion const&  p_quaternion
  *
  * @return              reference to this after subtraction.
  */
-FORCEINLINE Quaternion& Quaternion::operator-=  (Quaternion const&  p_quaternion)
+CONSTEXPR FORCEINLINE Quaternion& Quaternion::operator-=  (Quaternion const&  p_quaternion)
 {
     m_x -= p_quaternion.m_x;
     m_y -= p_quaternion.m_y;
@@ -1134,6 +1237,30 @@ FORCEINLINE Quaternion& Quaternion::operator-=  (Quaternion const&  p_quaternion
  */
 FORCEINLINE Quaternion  Quaternion::operator*   (Quaternion const&  p_quaternion)   const
 {
+#if defined(MATH_SIMD_SSE4)
+
+    // Same terms as the scalar path, the sign mask turns the two middle additions of W into subtractions.
+    __m128 const left   {_mm_loadu_ps(&m_x)};
+    __m128 const right  {_mm_loadu_ps(&p_quaternion.m_x)};
+    __m128 const sign   {_mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f)};
+
+    __m128 result       {_mm_mul_ps(_mm_shuffle_ps(left, left, MATH_SIMD_SHUFFLE(3, 3, 3, 3)), right)};
+
+    result              = _mm_add_ps(result, _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(left, left,   MATH_SIMD_SHUFFLE(0, 1, 2, 0)),
+                                                                   _mm_shuffle_ps(right, right, MATH_SIMD_SHUFFLE(3, 3, 3, 0))), sign));
+    result              = _mm_add_ps(result, _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(left, left,   MATH_SIMD_SHUFFLE(1, 2, 0, 1)),
+                                                                   _mm_shuffle_ps(right, right, MATH_SIMD_SHUFFLE(2, 0, 1, 1))), sign));
+    result              = _mm_sub_ps(result,            _mm_mul_ps(_mm_shuffle_ps(left, left,   MATH_SIMD_SHUFFLE(2, 0, 1, 2)),
+                                                                   _mm_shuffle_ps(right, right, MATH_SIMD_SHUFFLE(1, 2, 0, 2))));
+
+    Quaternion product;
+
+    _mm_storeu_ps(&product.m_x, result);
+
+    return product;
+
+#else
+
     return Quaternion
     (
         m_w*p_quaternion.m_x + m_x*p_quaternion.m_w + m_y*p_quaternion.m_z - m_z*p_quaternion.m_y,
@@ -1141,6 +1268,8 @@ FORCEINLINE Quaternion  Quaternion::operator*   (Quaternion const&  p_quaternion
         m_w*p_quaternion.m_z + m_z*p_quaternion.m_w + m_x*p_quaternion.m_y - m_y*p_quaternion.m_x,
         m_w*p_quaternion.m_w - m_x*p_quaternion.m_x - m_y*p_quaternion.m_y - m_z*p_quaternion.m_z
     );
+
+#endif
 }
 
 /**
@@ -1150,7 +1279,7 @@ FORCEINLINE Quaternion  Quaternion::operator*   (Quaternion const&  p_quaternion
  *
  * @return          The result of scaling.
  */
-FORCEINLINE Quaternion  Quaternion::operator*   (float const        p_scale)        const
+CONSTEXPR FORCEINLINE Quaternion  Quaternion::operator*   (float const        p_scale)        const
 {
     return Quaternion
     (
@@ -1198,7 +1327,7 @@ FORCEINLINE Quaternion& Quaternion::operator*=  (Quaternion const&  p_quaternion
  *
  * @return          A reference to this after scaling.
  */
-FORCEINLINE Quaternion& Quaternion::operator*=  (float const        p_scale)
+CONSTEXPR FORCEINLINE Quaternion& Quaternion::operator*=  (float const        p_scale)
 {
     m_x *= p_scale;
     m_y *= p_scale;
@@ -1215,7 +1344,7 @@ FORCEINLINE Quaternion& Quaternion::operator*=  (float const        p_scale)
  *
  * @return          New Quaternion of this after division by scale.
  */
-FORCEINLINE Quaternion  Quaternion::operator/   (float const        p_scale)        const
+CONSTEXPR FORCEINLINE Quaternion  Quaternion::operator/   (float const        p_scale)        const
 {
     return Quaternion
     (
@@ -1233,7 +1362,7 @@ FORCEINLINE Quaternion  Quaternion::operator/   (float const        p_scale)
  *
  * @return          A reference to this after scaling.
  */
-FORCEINLINE Quaternion& Quaternion::operator/=  (float const        p_scale)
+CONSTEXPR FORCEINLINE Quaternion& Quaternion::operator/=  (float const        p_scale)
 {
     m_x /= p_scale;
     m_y /= p_scale;
@@ -1252,7 +1381,15 @@ FORCEINLINE Quaternion& Quaternion::operator/=  (float const        p_scale)
  */
 FORCEINLINE float       Quaternion::operator|   (Quaternion const&  p_quaternion)   const
 {
+#if defined(MATH_SIMD_SSE4)
+
+    return _mm_cvtss_f32(SIMD::Dot4(_mm_loadu_ps(&m_x), _mm_loadu_ps(&p_quaternion.m_x)));
+
+#else
+
     return m_x * p_quaternion.m_x + m_y * p_quaternion.m_y + m_z * p_quaternion.m_z + m_w * p_quaternion.m_w;
+
+#endif
 }
 
 /*==============================[Public Globale Operators]==============================*/
@@ -1265,8 +1402,8 @@ FORCEINLINE float       Quaternion::operator|   (Quaternion const&  p_quaternion
  *
  * @return              The result of scaling.
  */
-FORCEINLINE Quaternion  operator*   (float const        p_scale,
-                                     Quaternion const&  p_quaternion)
+CONSTEXPR FORCEINLINE Quaternion  operator*   (float const        p_scale,
+                                               Quaternion const&  p_quaternion)
 {
     return Quaternion
     (
@@ -0,0 +1,84 @@
+#ifndef __MATH_SIMD_HPP__
+#define __MATH_SIMD_HPP__
+
+/*****************************************************************
+ *  Compile time selection of the vector instruction set used by *
+ *  the mathematic types. Define MATH_SIMD_DISABLED to force the *
+ *  scalar fallback.                                             *
+ *****************************************************************/
+
+#if !defined(MATH_SIMD_DISABLED)
+
+    /*  256-bit paths: /arch:AVX2 (MSVC) or -mavx2 (GCC, Clang)  */
+    #if defined(__AVX2__)
+        #define MATH_SIMD_AVX2
+    #endif
+
+    /*  128-bit paths: SSE4.1 is implied by /arch:AVX and above on MSVC, which has no dedicated switch  */
+    #if defined(__SSE4_1__) || defined(__AVX__) || defined(__AVX2__)
+        #define MATH_SIMD_SSE4
+    #endif
+
+    /*  Fused multiply-add: /arch:AVX2 always emits it on MSVC, GCC and Clang need -mfma  */
+    #if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+        #define MATH_SIMD_FMA
+    #endif
+
+#endif
+
+#if defined(MATH_SIMD_SSE4)
+    #include <immintrin.h>
+#endif
+
+/*  Shuffle mask selecting the lanes (p_x, p_y, p_z, p_w), in memory order  */
+#define MATH_SIMD_SHUFFLE(p_x, p_y, p_z, p_w)   (((p_w) << 6) | ((p_z) << 4) | ((p_y) << 2) | (p_x))
+
+/*
+Accuracy of the vector paths against the scalar fallback.
+
+Products and transforms evaluate the same operations in the same order as the scalar code, so they are bit exact
+unless MATH_SIMD_FMA is defined, where every fused multiply-add skips one rounding (at most 4 ulp on a 4 terms dot product).
+Matrix4x4::GetInverse uses a block-wise formulation and stays within MATH_SIMD_TOLERANCE_F of the scalar result,
+relatively to the largest coefficient of the inverse, for matrices whose condition number is below 1e2.
+The batch forms of the Math::Fast* approximations follow the scalar ones exactly, with the same FMA caveat.
+
+Normalizations compute their scale with Math::InvSqrt or Math::Sqrt, like the scalar code, and fall back on the same
+comparisons, so a NaN or a too small magnitude is handled the same way. Their results are only bit exact when the compiler
+does not contract the scalar multiply-adds either (/fp:precise on MSVC, -ffp-contract=off on GCC and Clang, which default to
+contracting with -mfma): otherwise they stay within MATH_SIMD_TOLERANCE_F of the scalar result.
+*/
+
+#define MATH_SIMD_TOLERANCE_F   (1e-5F)
+
+#if defined(MATH_SIMD_SSE4)
+
+/**
+ * Building blocks shared by the vector paths of the mathematic types, working on a register of four floats.
+ *
+ * The reductions add the lanes in memory order, like the scalar code, so they don't change the results.
+ */
+struct SIMD
+{
+    //=========================[Public Static Methods]=========================//
+
+        static  FORCEINLINE __m128  Cross3  (__m128 const   p_a,
+                                             __m128 const   p_b);
+
+        static  FORCEINLINE __m128  Dot3    (__m128 const   p_a,
+                                             __m128 const   p_b);
+
+        static  FORCEINLINE __m128  Dot4    (__m128 const   p_a,
+                                             __m128 const   p_b);
+
+        static  FORCEINLINE __m128  Load3   (float const*   p_values);
+
+        static  FORCEINLINE void    Store3  (float*         p_values,
+                                             __m128 const   p_register);
+
+}; // !struct SIMD
+
+#include "SIMD.inl"
+
+#endif
+
+#endif // !__MATH_SIMD_HPP__
\ No newline at end of file
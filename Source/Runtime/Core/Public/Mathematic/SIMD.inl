@@ -0,0 +1,84 @@
+#ifndef __MATH_SIMD_INL__
+#define __MATH_SIMD_INL__
+
+/*==============================[Public Static Methods]==============================*/
+
+/**
+ * Computes the cross product of the first three lanes.
+ *
+ * @param p_a   The left operand (X, Y, Z, -).
+ * @param p_b   The right operand (X, Y, Z, -).
+ *
+ * @return      (a.Y * b.Z - a.Z * b.Y, a.Z * b.X - a.X * b.Z, a.X * b.Y - a.Y * b.X, 0).
+ */
+FORCEINLINE __m128  SIMD::Cross3    (__m128 const   p_a,
+                                     __m128 const   p_b)
+{
+    __m128 const result {_mm_sub_ps(_mm_mul_ps(p_a, _mm_shuffle_ps(p_b, p_b, MATH_SIMD_SHUFFLE(1, 2, 0, 3))),
+                                    _mm_mul_ps(_mm_shuffle_ps(p_a, p_a, MATH_SIMD_SHUFFLE(1, 2, 0, 3)), p_b))};
+
+    return _mm_shuffle_ps(result, result, MATH_SIMD_SHUFFLE(1, 2, 0, 3));
+}
+
+/**
+ * Computes the dot product of the first three lanes.
+ *
+ * @param p_a   The left operand (X, Y, Z, -).
+ * @param p_b   The right operand (X, Y, Z, -).
+ *
+ * @return      The dot product, broadcast to every lane.
+ */
+FORCEINLINE __m128  SIMD::Dot3      (__m128 const   p_a,
+                                     __m128 const   p_b)
+{
+    __m128 const product    {_mm_mul_ps(p_a, p_b)};
+    __m128       result     {_mm_add_ps(_mm_shuffle_ps(product, product, MATH_SIMD_SHUFFLE(0, 0, 0, 0)),
+                                        _mm_shuffle_ps(product, product, MATH_SIMD_SHUFFLE(1, 1, 1, 1)))};
+
+    return _mm_add_ps(result, _mm_shuffle_ps(product, product, MATH_SIMD_SHUFFLE(2, 2, 2, 2)));
+}
+
+/**
+ * Computes the dot product of the four lanes.
+ *
+ * @param p_a   The left operand.
+ * @param p_b   The right operand.
+ *
+ * @return      The dot product, broadcast to every lane.
+ */
+FORCEINLINE __m128  SIMD::Dot4      (__m128 const   p_a,
+                                     __m128 const   p_b)
+{
+    __m128 const product    {_mm_mul_ps(p_a, p_b)};
+
+    return _mm_add_ps(Dot3(p_a, p_b), _mm_shuffle_ps(product, product, MATH_SIMD_SHUFFLE(3, 3, 3, 3)));
+}
+
+/**
+ * Loads three consecutive floats without reading past them, the last lane is set to 0.
+ *
+ * @param p_values  The address of the first float, doesn't need to be aligned.
+ *
+ * @return          (p_values[0], p_values[1], p_values[2], 0).
+ */
+FORCEINLINE __m128  SIMD::Load3     (float const*   p_values)
+{
+    __m128 const xy {_mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const*>(p_values)))};
+
+    return _mm_movelh_ps(xy, _mm_load_ss(p_values + 2));
+}
+
+/**
+ * Stores the first three lanes without writing past them.
+ *
+ * @param p_values      The address of the first float, doesn't need to be aligned.
+ * @param p_register    The lanes to store.
+ */
+FORCEINLINE void    SIMD::Store3    (float*         p_values,
+                                     __m128 const   p_register)
+{
+    _mm_store_sd(reinterpret_cast<double*>(p_values), _mm_castps_pd(p_register));
+    _mm_store_ss(p_values + 2, _mm_movehl_ps(p_register, p_register));
+}
+
+#endif // !__MATH_SIMD_INL__
\ No newline at end of file
@@ -0,0 +1,277 @@
+#ifndef __MATH_SIMD_LANES_HPP__
+#define __MATH_SIMD_LANES_HPP__
+
+#include "SIMD.hpp"
+#include "Utility.hpp"
+
+/**
+ * Registers of 1, 4 or 8 floats sharing the same interface, so the batched kernels (TransformBatch, Frustum)
+ * are written once as templates and instantiated for each width.
+ *
+ * WideLanes is the widest register of the enabled instruction set, Lanes1 processes the remaining elements.
+ *
+ * The comparisons return masks with every bit of a lane set when the condition holds, Select only reads the sign bit
+ * of the mask. The bitwise operators and shifts work on the raw bits of the floats.
+ */
+struct Lanes1
+{
+    //=========================[Public Static Properties]=========================//
+
+        /** Number of floats in the register. */
+        static constexpr size_t Width = 1u;
+
+    //=========================[Public Static Methods]=========================//
+
+        static  FORCEINLINE Lanes1  FromBits    (uint32 const   p_bits);
+
+        static  FORCEINLINE Lanes1  IsGreater   (Lanes1 const   p_a,
+                                                 Lanes1 const   p_b);
+
+        static  FORCEINLINE Lanes1  IsLess      (Lanes1 const   p_a,
+                                                 Lanes1 const   p_b);
+
+        static  FORCEINLINE Lanes1  Load        (float const*   p_values);
+
+        static  FORCEINLINE Lanes1  Max         (Lanes1 const   p_a,
+                                                 Lanes1 const   p_b);
+
+        static  FORCEINLINE Lanes1  Min         (Lanes1 const   p_a,
+                                                 Lanes1 const   p_b);
+
+        static  FORCEINLINE Lanes1  Select      (Lanes1 const   p_mask,
+                                                 Lanes1 const   p_a,
+                                                 Lanes1 const   p_b);
+
+        static  FORCEINLINE Lanes1  Set         (float const    p_value);
+
+        static  FORCEINLINE void    Store       (float*         p_values,
+                                                 Lanes1 const   p_lanes);
+
+    //=========================[Public Local Properties]=========================//
+
+        /** The floats of the lanes. */
+        float   m_value;
+
+    //=========================[Public Local Methods]=========================//
+
+        FORCEINLINE Lanes1  Abs             ()                                              const;
+
+        FORCEINLINE uint32  GetBits         ()                                              const;
+
+        FORCEINLINE Lanes1  InvSqrtEstimate ()                                              const;
+
+        FORCEINLINE int32   NegativeMask    ()                                              const;
+
+        FORCEINLINE Lanes1  SafeReciprocal  (float const    p_tolerance = MATH_EPSILON_F)   const;
+
+        FORCEINLINE Lanes1  ShiftBitsLeft   (uint32 const   p_count)                        const;
+
+        FORCEINLINE Lanes1  ShiftBitsRight  (uint32 const   p_count)                        const;
+
+}; // !struct Lanes1
+
+/*==============================[Public Globale Operators]==============================*/
+
+    FORCEINLINE Lanes1  operator+   (Lanes1 const   p_a,
+                                     Lanes1 const   p_b);
+
+    FORCEINLINE Lanes1  operator-   (Lanes1 const   p_a,
+                                     Lanes1 const   p_b);
+
+    FORCEINLINE Lanes1  operator*   (Lanes1 const   p_a,
+                                     Lanes1 const   p_b);
+
+    FORCEINLINE Lanes1  operator/   (Lanes1 const   p_a,
+                                     Lanes1 const   p_b);
+
+    FORCEINLINE Lanes1  operator-   (Lanes1 const   p_lanes);
+
+    FORCEINLINE Lanes1  operator&   (Lanes1 const   p_a,
+                                     Lanes1 const   p_b);
+
+    FORCEINLINE Lanes1  operator|   (Lanes1 const   p_a,
+                                     Lanes1 const   p_b);
+
+    FORCEINLINE Lanes1  operator^   (Lanes1 const   p_a,
+                                     Lanes1 const   p_b);
+
+#if defined(MATH_SIMD_SSE4)
+
+struct Lanes4
+{
+    //=========================[Public Static Properties]=========================//
+
+        /** Number of floats in the register. */
+        static constexpr size_t Width = 4u;
+
+    //=========================[Public Static Methods]=========================//
+
+        static  FORCEINLINE Lanes4  FromBits    (uint32 const   p_bits);
+
+        static  FORCEINLINE Lanes4  IsGreater   (Lanes4 const   p_a,
+                                                 Lanes4 const   p_b);
+
+        static  FORCEINLINE Lanes4  IsLess      (Lanes4 const   p_a,
+                                                 Lanes4 const   p_b);
+
+        static  FORCEINLINE Lanes4  Load        (float const*   p_values);
+
+        static  FORCEINLINE Lanes4  Max         (Lanes4 const   p_a,
+                                                 Lanes4 const   p_b);
+
+        static  FORCEINLINE Lanes4  Min         (Lanes4 const   p_a,
+                                                 Lanes4 const   p_b);
+
+        static  FORCEINLINE Lanes4  Select      (Lanes4 const   p_mask,
+                                                 Lanes4 const   p_a,
+                                                 Lanes4 const   p_b);
+
+        static  FORCEINLINE Lanes4  Set         (float const    p_value);
+
+        static  FORCEINLINE void    Store       (float*         p_values,
+                                                 Lanes4 const   p_lanes);
+
+    //=========================[Public Local Properties]=========================//
+
+        /** The floats of the lanes. */
+        __m128  m_value;
+
+    //=========================[Public Local Methods]=========================//
+
+        FORCEINLINE Lanes4  Abs             ()                                              const;
+
+        FORCEINLINE Lanes4  InvSqrtEstimate ()                                              const;
+
+        FORCEINLINE int32   NegativeMask    ()                                              const;
+
+        FORCEINLINE Lanes4  SafeReciprocal  (float const    p_tolerance = MATH_EPSILON_F)   const;
+
+        FORCEINLINE Lanes4  ShiftBitsLeft   (uint32 const   p_count)                        const;
+
+        FORCEINLINE Lanes4  ShiftBitsRight  (uint32 const   p_count)                        const;
+
+}; // !struct Lanes4
+
+/*==============================[Public Globale Operators]==============================*/
+
+    FORCEINLINE Lanes4  operator+   (Lanes4 const   p_a,
+                                     Lanes4 const   p_b);
+
+    FORCEINLINE Lanes4  operator-   (Lanes4 const   p_a,
+                                     Lanes4 const   p_b);
+
+    FORCEINLINE Lanes4  operator*   (Lanes4 const   p_a,
+                                     Lanes4 const   p_b);
+
+    FORCEINLINE Lanes4  operator/   (Lanes4 const   p_a,
+                                     Lanes4 const   p_b);
+
+    FORCEINLINE Lanes4  operator-   (Lanes4 const   p_lanes);
+
+    FORCEINLINE Lanes4  operator&   (Lanes4 const   p_a,
+                                     Lanes4 const   p_b);
+
+    FORCEINLINE Lanes4  operator|   (Lanes4 const   p_a,
+                                     Lanes4 const   p_b);
+
+    FORCEINLINE Lanes4  operator^   (Lanes4 const   p_a,
+                                     Lanes4 const   p_b);
+
+#endif
+
+#if defined(MATH_SIMD_AVX2)
+
+struct Lanes8
+{
+    //=========================[Public Static Properties]=========================//
+
+        /** Number of floats in the register. */
+        static constexpr size_t Width = 8u;
+
+    //=========================[Public Static Methods]=========================//
+
+        static  FORCEINLINE Lanes8  FromBits    (uint32 const   p_bits);
+
+        static  FORCEINLINE Lanes8  IsGreater   (Lanes8 const   p_a,
+                                                 Lanes8 const   p_b);
+
+        static  FORCEINLINE Lanes8  IsLess      (Lanes8 const   p_a,
+                                                 Lanes8 const   p_b);
+
+        static  FORCEINLINE Lanes8  Load        (float const*   p_values);
+
+        static  FORCEINLINE Lanes8  Max         (Lanes8 const   p_a,
+                                                 Lanes8 const   p_b);
+
+        static  FORCEINLINE Lanes8  Min         (Lanes8 const   p_a,
+                                                 Lanes8 const   p_b);
+
+        static  FORCEINLINE Lanes8  Select      (Lanes8 const   p_mask,
+                                                 Lanes8 const   p_a,
+                                                 Lanes8 const   p_b);
+
+        static  FORCEINLINE Lanes8  Set         (float const    p_value);
+
+        static  FORCEINLINE void    Store       (float*         p_values,
+                                                 Lanes8 const   p_lanes);
+
+    //=========================[Public Local Properties]=========================//
+
+        /** The floats of the lanes. */
+        __m256  m_value;
+
+    //=========================[Public Local Methods]=========================//
+
+        FORCEINLINE Lanes8  Abs             ()                                              const;
+
+        FORCEINLINE Lanes8  InvSqrtEstimate ()                                              const;
+
+        FORCEINLINE int32   NegativeMask    ()                                              const;
+
+        FORCEINLINE Lanes8  SafeReciprocal  (float const    p_tolerance = MATH_EPSILON_F)   const;
+
+        FORCEINLINE Lanes8  ShiftBitsLeft   (uint32 const   p_count)                        const;
+
+        FORCEINLINE Lanes8  ShiftBitsRight  (uint32 const   p_count)                        const;
+
+}; // !struct Lanes8
+
+/*==============================[Public Globale Operators]==============================*/
+
+    FORCEINLINE Lanes8  operator+   (Lanes8 const   p_a,
+                                     Lanes8 const   p_b);
+
+    FORCEINLINE Lanes8  operator-   (Lanes8 const   p_a,
+                                     Lanes8 const   p_b);
+
+    FORCEINLINE Lanes8  operator*   (Lanes8 const   p_a,
+                                     Lanes8 const   p_b);
+
+    FORCEINLINE Lanes8  operator/   (Lanes8 const   p_a,
+                                     Lanes8 const   p_b);
+
+    FORCEINLINE Lanes8  operator-   (Lanes8 const   p_lanes);
+
+    FORCEINLINE Lanes8  operator&   (Lanes8 const   p_a,
+                                     Lanes8 const   p_b);
+
+    FORCEINLINE Lanes8  operator|   (Lanes8 const   p_a,
+                                     Lanes8 const   p_b);
+
+    FORCEINLINE Lanes8  operator^   (Lanes8 const   p_a,
+                                     Lanes8 const   p_b);
+
+#endif
+
+/** The widest lanes available. */
+#if defined(MATH_SIMD_AVX2)
+    using WideLanes = Lanes8;
+#elif defined(MATH_SIMD_SSE4)
+    using WideLanes = Lanes4;
+#else
+    using WideLanes = Lanes1;
+#endif
+
+#include "SIMDLanes.inl"
+
+#endif // !__MATH_SIMD_LANES_HPP__
\ No newline at end of file
@@ -0,0 +1,770 @@
+#ifndef __MATH_SIMD_LANES_INL__
+#define __MATH_SIMD_LANES_INL__
+
+/*==============================[Lanes1]==============================*/
+
+/**
+ * Broadcasts a bit pattern to every lane.
+ *
+ * @param p_bits    The bits of the float.
+ *
+ * @return          The lanes.
+ */
+FORCEINLINE Lanes1  Lanes1::FromBits           (uint32 const   p_bits)
+{
+    Lanes1 lanes;
+
+    std::memcpy(&lanes.m_value, &p_bits, sizeof(p_bits));
+
+    return lanes;
+}
+
+/**
+ * Compares the lanes.
+ *
+ * @param p_a   The left operand.
+ * @param p_b   The right operand.
+ *
+ * @return      A mask where a lane is set when p_a is greater than p_b.
+ */
+FORCEINLINE Lanes1  Lanes1::IsGreater          (Lanes1 const   p_a,
+                                                Lanes1 const   p_b)
+{
+    return FromBits(p_a.m_value > p_b.m_value ? ~0u : 0u);
+}
+
+/**
+ * Compares the lanes.
+ *
+ * @param p_a   The left operand.
+ * @param p_b   The right operand.
+ *
+ * @return      A mask where a lane is set when p_a is lower than p_b.
+ */
+FORCEINLINE Lanes1  Lanes1::IsLess             (Lanes1 const   p_a,
+                                                Lanes1 const   p_b)
+{
+    return FromBits(p_a.m_value < p_b.m_value ? ~0u : 0u);
+}
+
+/**
+ * Loads a float.
+ *
+ * @param p_values  The address of the first float, doesn't need to be aligned.
+ *
+ * @return          The lanes.
+ */
+FORCEINLINE Lanes1  Lanes1::Load               (float const*   p_values)
+{
+    return {*p_values};
+}
+
+/**
+ * Computes the maximum of each lane, returning p_b when one of them is NaN.
+ *
+ * @param p_a   The first lanes.
+ * @param p_b   The second lanes.
+ *
+ * @return      The maximums.
+ */
+FORCEINLINE Lanes1  Lanes1::Max                (Lanes1 const   p_a,
+                                                Lanes1 const   p_b)
+{
+    return {p_a.m_value > p_b.m_value ? p_a.m_value : p_b.m_value};
+}
+
+/**
+ * Computes the minimum of each lane, returning p_b when one of them is NaN.
+ *
+ * @param p_a   The first lanes.
+ * @param p_b   The second lanes.
+ *
+ * @return      The minimums.
+ */
+FORCEINLINE Lanes1  Lanes1::Min                (Lanes1 const   p_a,
+                                                Lanes1 const   p_b)
+{
+    return {p_a.m_value < p_b.m_value ? p_a.m_value : p_b.m_value};
+}
+
+/**
+ * Picks each lane from p_a or p_b.
+ *
+ * @param p_mask    The mask, only the sign bit of each lane is read.
+ * @param p_a       The lanes picked where the mask is set.
+ * @param p_b       The lanes picked where the mask is clear.
+ *
+ * @return          The selected lanes.
+ */
+FORCEINLINE Lanes1  Lanes1::Select             (Lanes1 const   p_mask,
+                                                Lanes1 const   p_a,
+                                                Lanes1 const   p_b)
+{
+    return (p_mask.GetBits() & 0x80000000u) ? p_a : p_b;
+}
+
+/**
+ * Broadcasts a float to every lane.
+ *
+ * @param p_value   The float to broadcast.
+ *
+ * @return          The lanes.
+ */
+FORCEINLINE Lanes1  Lanes1::Set                (float const    p_value)
+{
+    return {p_value};
+}
+
+/**
+ * Stores the lanes to consecutive floats.
+ *
+ * @param p_values  The address of the first float, doesn't need to be aligned.
+ * @param p_lanes   The lanes to store.
+ */
+FORCEINLINE void    Lanes1::Store              (float*         p_values,
+                                                Lanes1 const   p_lanes)
+{
+    *p_values = p_lanes.m_value;
+}
+
+/**
+ * Computes the absolute value of each lane.
+ *
+ * @return  The absolute values.
+ */
+FORCEINLINE Lanes1  Lanes1::Abs                ()                              const
+{
+    return FromBits(GetBits() & 0x7fffffffu);
+}
+
+/**
+ * Gets the raw bits of the float.
+ *
+ * @return  The bits.
+ */
+FORCEINLINE uint32  Lanes1::GetBits            ()                              const
+{
+    uint32 bits;
+
+    std::memcpy(&bits, &m_value, sizeof(bits));
+
+    return bits;
+}
+
+/**
+ * Estimates the inverse square root of each lane, with a relative error below 1.5 * 2^-12.
+ *
+ * @return  The estimates.
+ */
+FORCEINLINE Lanes1  Lanes1::InvSqrtEstimate    ()                              const
+{
+#if defined(MATH_SIMD_SSE4)
+    return {_mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(m_value)))};
+#else
+    // Bit-level first guess refined by one Newton-Raphson step, as precise as the hardware estimate.
+    Lanes1 const    guess   {FromBits(0x5f375a86u - (GetBits() >> 1u))};
+
+    return {guess.m_value * (1.5f - 0.5f * m_value * guess.m_value * guess.m_value)};
+#endif
+}
+
+/**
+ * Gets which lanes are negative.
+ *
+ * @return  A mask where the bit i is set when the lane i is lower than 0.
+ */
+FORCEINLINE int32   Lanes1::NegativeMask       ()                              const
+{
+    return m_value < 0.0f ? 1 : 0;
+}
+
+/**
+ * Computes the reciprocal of each lane, or 0 when the lane is nearly zero (Same as Vector3::SafeScaleReciprocal).
+ *
+ * @param p_tolerance   The tolerance below which a lane is considered as zero.
+ *
+ * @return              The reciprocals.
+ */
+FORCEINLINE Lanes1  Lanes1::SafeReciprocal     (float const    p_tolerance)    const
+{
+    return {(Math::Abs(m_value) <= p_tolerance) ? 0.0f : 1.0f / m_value};
+}
+
+/**
+ * Shifts the raw bits of each lane to the left, filling with zeros.
+ *
+ * @param p_count   The number of bits to shift.
+ *
+ * @return          The shifted lanes.
+ */
+FORCEINLINE Lanes1  Lanes1::ShiftBitsLeft      (uint32 const   p_count)        const
+{
+    return FromBits(GetBits() << p_count);
+}
+
+/**
+ * Shifts the raw bits of each lane to the right, filling with zeros.
+ *
+ * @param p_count   The number of bits to shift.
+ *
+ * @return          The shifted lanes.
+ */
+FORCEINLINE Lanes1  Lanes1::ShiftBitsRight     (uint32 const   p_count)        const
+{
+    return FromBits(GetBits() >> p_count);
+}
+
+/** Lane-wise addition. */
+FORCEINLINE Lanes1  operator+   (Lanes1 const   p_a,
+                                 Lanes1 const   p_b)
+{
+    return {p_a.m_value + p_b.m_value};
+}
+
+/** Lane-wise subtraction. */
+FORCEINLINE Lanes1  operator-   (Lanes1 const   p_a,
+                                 Lanes1 const   p_b)
+{
+    return {p_a.m_value - p_b.m_value};
+}
+
+/** Lane-wise multiplication. */
+FORCEINLINE Lanes1  operator*   (Lanes1 const   p_a,
+                                 Lanes1 const   p_b)
+{
+    return {p_a.m_value * p_b.m_value};
+}
+
+/** Lane-wise division. */
+FORCEINLINE Lanes1  operator/   (Lanes1 const   p_a,
+                                 Lanes1 const   p_b)
+{
+    return {p_a.m_value / p_b.m_value};
+}
+
+/** Lane-wise negation. */
+FORCEINLINE Lanes1  operator-   (Lanes1 const   p_lanes)
+{
+    return {-p_lanes.m_value};
+}
+
+/** Bitwise and of the lanes. */
+FORCEINLINE Lanes1  operator&   (Lanes1 const   p_a,
+                                 Lanes1 const   p_b)
+{
+    return Lanes1::FromBits(p_a.GetBits() & p_b.GetBits());
+}
+
+/** Bitwise or of the lanes. */
+FORCEINLINE Lanes1  operator|   (Lanes1 const   p_a,
+                                 Lanes1 const   p_b)
+{
+    return Lanes1::FromBits(p_a.GetBits() | p_b.GetBits());
+}
+
+/** Bitwise exclusive or of the lanes. */
+FORCEINLINE Lanes1  operator^   (Lanes1 const   p_a,
+                                 Lanes1 const   p_b)
+{
+    return Lanes1::FromBits(p_a.GetBits() ^ p_b.GetBits());
+}
+
+#if defined(MATH_SIMD_SSE4)
+
+/*==============================[Lanes4]==============================*/
+
+/**
+ * Broadcasts a bit pattern to every lane.
+ *
+ * @param p_bits    The bits of the float.
+ *
+ * @return          The lanes.
+ */
+FORCEINLINE Lanes4  Lanes4::FromBits           (uint32 const   p_bits)
+{
+    return {_mm_castsi128_ps(_mm_set1_epi32(static_cast<int32>(p_bits)))};
+}
+
+/**
+ * Compares the lanes.
+ *
+ * @param p_a   The left operand.
+ * @param p_b   The right operand.
+ *
+ * @return      A mask where a lane is set when p_a is greater than p_b.
+ */
+FORCEINLINE Lanes4  Lanes4::IsGreater          (Lanes4 const   p_a,
+                                                Lanes4 const   p_b)
+{
+    return {_mm_cmpgt_ps(p_a.m_value, p_b.m_value)};
+}
+
+/**
+ * Compares the lanes.
+ *
+ * @param p_a   The left operand.
+ * @param p_b   The right operand.
+ *
+ * @return      A mask where a lane is set when p_a is lower than p_b.
+ */
+FORCEINLINE Lanes4  Lanes4::IsLess             (Lanes4 const   p_a,
+                                                Lanes4 const   p_b)
+{
+    return {_mm_cmplt_ps(p_a.m_value, p_b.m_value)};
+}
+
+/**
+ * Loads 4 consecutive floats.
+ *
+ * @param p_values  The address of the first float, doesn't need to be aligned.
+ *
+ * @return          The lanes.
+ */
+FORCEINLINE Lanes4  Lanes4::Load               (float const*   p_values)
+{
+    return {_mm_loadu_ps(p_values)};
+}
+
+/**
+ * Computes the maximum of each lane, returning p_b when one of them is NaN.
+ *
+ * @param p_a   The first lanes.
+ * @param p_b   The second lanes.
+ *
+ * @return      The maximums.
+ */
+FORCEINLINE Lanes4  Lanes4::Max                (Lanes4 const   p_a,
+                                                Lanes4 const   p_b)
+{
+    return {_mm_max_ps(p_a.m_value, p_b.m_value)};
+}
+
+/**
+ * Computes the minimum of each lane, returning p_b when one of them is NaN.
+ *
+ * @param p_a   The first lanes.
+ * @param p_b   The second lanes.
+ *
+ * @return      The minimums.
+ */
+FORCEINLINE Lanes4  Lanes4::Min                (Lanes4 const   p_a,
+                                                Lanes4 const   p_b)
+{
+    return {_mm_min_ps(p_a.m_value, p_b.m_value)};
+}
+
+/**
+ * Picks each lane from p_a or p_b.
+ *
+ * @param p_mask    The mask, only the sign bit of each lane is read.
+ * @param p_a       The lanes picked where the mask is set.
+ * @param p_b       The lanes picked where the mask is clear.
+ *
+ * @return          The selected lanes.
+ */
+FORCEINLINE Lanes4  Lanes4::Select             (Lanes4 const   p_mask,
+                                                Lanes4 const   p_a,
+                                                Lanes4 const   p_b)
+{
+    return {_mm_blendv_ps(p_b.m_value, p_a.m_value, p_mask.m_value)};
+}
+
+/**
+ * Broadcasts a float to every lane.
+ *
+ * @param p_value   The float to broadcast.
+ *
+ * @return          The lanes.
+ */
+FORCEINLINE Lanes4  Lanes4::Set                (float const    p_value)
+{
+    return {_mm_set1_ps(p_value)};
+}
+
+/**
+ * Stores the lanes to consecutive floats.
+ *
+ * @param p_values  The address of the first float, doesn't need to be aligned.
+ * @param p_lanes   The lanes to store.
+ */
+FORCEINLINE void    Lanes4::Store              (float*         p_values,
+                                                Lanes4 const   p_lanes)
+{
+    _mm_storeu_ps(p_values, p_lanes.m_value);
+}
+
+/**
+ * Computes the absolute value of each lane.
+ *
+ * @return  The absolute values.
+ */
+FORCEINLINE Lanes4  Lanes4::Abs                ()                              const
+{
+    return {_mm_andnot_ps(_mm_set1_ps(-0.0f), m_value)};
+}
+
+/**
+ * Estimates the inverse square root of each lane, with a relative error below 1.5 * 2^-12.
+ *
+ * @return  The estimates.
+ */
+FORCEINLINE Lanes4  Lanes4::InvSqrtEstimate    ()                              const
+{
+    return {_mm_rsqrt_ps(m_value)};
+}
+
+/**
+ * Gets which lanes are negative.
+ *
+ * @return  A mask where the bit i is set when the lane i is lower than 0.
+ */
+FORCEINLINE int32   Lanes4::NegativeMask       ()                              const
+{
+    return _mm_movemask_ps(_mm_cmplt_ps(m_value, _mm_setzero_ps()));
+}
+
+/**
+ * Computes the reciprocal of each lane, or 0 when the lane is nearly zero (Same as Vector3::SafeScaleReciprocal).
+ *
+ * @param p_tolerance   The tolerance below which a lane is considered as zero.
+ *
+ * @return              The reciprocals.
+ */
+FORCEINLINE Lanes4  Lanes4::SafeReciprocal     (float const    p_tolerance)    const
+{
+    __m128 const isZero {_mm_cmple_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), m_value), _mm_set1_ps(p_tolerance))};
+
+    return {_mm_andnot_ps(isZero, _mm_div_ps(_mm_set1_ps(1.0f), m_value))};
+}
+
+/**
+ * Shifts the raw bits of each lane to the left, filling with zeros.
+ *
+ * @param p_count   The number of bits to shift.
+ *
+ * @return          The shifted lanes.
+ */
+FORCEINLINE Lanes4  Lanes4::ShiftBitsLeft      (uint32 const   p_count)        const
+{
+    return {_mm_castsi128_ps(_mm_sll_epi32(_mm_castps_si128(m_value), _mm_cvtsi32_si128(static_cast<int32>(p_count))))};
+}
+
+/**
+ * Shifts the raw bits of each lane to the right, filling with zeros.
+ *
+ * @param p_count   The number of bits to shift.
+ *
+ * @return          The shifted lanes.
+ */
+FORCEINLINE Lanes4  Lanes4::ShiftBitsRight     (uint32 const   p_count)        const
+{
+    return {_mm_castsi128_ps(_mm_srl_epi32(_mm_castps_si128(m_value), _mm_cvtsi32_si128(static_cast<int32>(p_count))))};
+}
+
+/** Lane-wise addition. */
+FORCEINLINE Lanes4  operator+   (Lanes4 const   p_a,
+                                 Lanes4 const   p_b)
+{
+    return {_mm_add_ps(p_a.m_value, p_b.m_value)};
+}
+
+/** Lane-wise subtraction. */
+FORCEINLINE Lanes4  operator-   (Lanes4 const   p_a,
+                                 Lanes4 const   p_b)
+{
+    return {_mm_sub_ps(p_a.m_value, p_b.m_value)};
+}
+
+/** Lane-wise multiplication. */
+FORCEINLINE Lanes4  operator*   (Lanes4 const   p_a,
+                                 Lanes4 const   p_b)
+{
+    return {_mm_mul_ps(p_a.m_value, p_b.m_value)};
+}
+
+/** Lane-wise division. */
+FORCEINLINE Lanes4  operator/   (Lanes4 const   p_a,
+                                 Lanes4 const   p_b)
+{
+    return {_mm_div_ps(p_a.m_value, p_b.m_value)};
+}
+
+/** Lane-wise negation. */
+FORCEINLINE Lanes4  operator-   (Lanes4 const   p_lanes)
+{
+    return {_mm_xor_ps(p_lanes.m_value, _mm_set1_ps(-0.0f))};
+}
+
+/** Bitwise and of the lanes. */
+FORCEINLINE Lanes4  operator&   (Lanes4 const   p_a,
+                                 Lanes4 const   p_b)
+{
+    return {_mm_and_ps(p_a.m_value, p_b.m_value)};
+}
+
+/** Bitwise or of the lanes. */
+FORCEINLINE Lanes4  operator|   (Lanes4 const   p_a,
+                                 Lanes4 const   p_b)
+{
+    return {_mm_or_ps(p_a.m_value, p_b.m_value)};
+}
+
+/** Bitwise exclusive or of the lanes. */
+FORCEINLINE Lanes4  operator^   (Lanes4 const   p_a,
+                                 Lanes4 const   p_b)
+{
+    return {_mm_xor_ps(p_a.m_value, p_b.m_value)};
+}
+
+#endif
+
+#if defined(MATH_SIMD_AVX2)
+
+/*==============================[Lanes8]==============================*/
+
+/**
+ * Broadcasts a bit pattern to every lane.
+ *
+ * @param p_bits    The bits of the float.
+ *
+ * @return          The lanes.
+ */
+FORCEINLINE Lanes8  Lanes8::FromBits           (uint32 const   p_bits)
+{
+    return {_mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int32>(p_bits)))};
+}
+
+/**
+ * Compares the lanes.
+ *
+ * @param p_a   The left operand.
+ * @param p_b   The right operand.
+ *
+ * @return      A mask where a lane is set when p_a is greater than p_b.
+ */
+FORCEINLINE Lanes8  Lanes8::IsGreater          (Lanes8 const   p_a,
+                                                Lanes8 const   p_b)
+{
+    return {_mm256_cmp_ps(p_a.m_value, p_b.m_value, _CMP_GT_OQ)};
+}
+
+/**
+ * Compares the lanes.
+ *
+ * @param p_a   The left operand.
+ * @param p_b   The right operand.
+ *
+ * @return      A mask where a lane is set when p_a is lower than p_b.
+ */
+FORCEINLINE Lanes8  Lanes8::IsLess             (Lanes8 const   p_a,
+                                                Lanes8 const   p_b)
+{
+    return {_mm256_cmp_ps(p_a.m_value, p_b.m_value, _CMP_LT_OQ)};
+}
+
+/**
+ * Loads 8 consecutive floats.
+ *
+ * @param p_values  The address of the first float, doesn't need to be aligned.
+ *
+ * @return          The lanes.
+ */
+FORCEINLINE Lanes8  Lanes8::Load               (float const*   p_values)
+{
+    return {_mm256_loadu_ps(p_values)};
+}
+
+/**
+ * Computes the maximum of each lane, returning p_b when one of them is NaN.
+ *
+ * @param p_a   The first lanes.
+ * @param p_b   The second lanes.
+ *
+ * @return      The maximums.
+ */
+FORCEINLINE Lanes8  Lanes8::Max                (Lanes8 const   p_a,
+                                                Lanes8 const   p_b)
+{
+    return {_mm256_max_ps(p_a.m_value, p_b.m_value)};
+}
+
+/**
+ * Computes the minimum of each lane, returning p_b when one of them is NaN.
+ *
+ * @param p_a   The first lanes.
+ * @param p_b   The second lanes.
+ *
+ * @return      The minimums.
+ */
+FORCEINLINE Lanes8  Lanes8::Min                (Lanes8 const   p_a,
+                                                Lanes8 const   p_b)
+{
+    return {_mm256_min_ps(p_a.m_value, p_b.m_value)};
+}
+
+/**
+ * Picks each lane from p_a or p_b.
+ *
+ * @param p_mask    The mask, only the sign bit of each lane is read.
+ * @param p_a       The lanes picked where the mask is set.
+ * @param p_b       The lanes picked where the mask is clear.
+ *
+ * @return          The selected lanes.
+ */
+FORCEINLINE Lanes8  Lanes8::Select             (Lanes8 const   p_mask,
+                                                Lanes8 const   p_a,
+                                                Lanes8 const   p_b)
+{
+    return {_mm256_blendv_ps(p_b.m_value, p_a.m_value, p_mask.m_value)};
+}
+
+/**
+ * Broadcasts a float to every lane.
+ *
+ * @param p_value   The float to broadcast.
+ *
+ * @return          The lanes.
+ */
+FORCEINLINE Lanes8  Lanes8::Set                (float const    p_value)
+{
+    return {_mm256_set1_ps(p_value)};
+}
+
+/**
+ * Stores the lanes to consecutive floats.
+ *
+ * @param p_values  The address of the first float, doesn't need to be aligned.
+ * @param p_lanes   The lanes to store.
+ */
+FORCEINLINE void    Lanes8::Store              (float*         p_values,
+                                                Lanes8 const   p_lanes)
+{
+    _mm256_storeu_ps(p_values, p_lanes.m_value);
+}
+
+/**
+ * Computes the absolute value of each lane.
+ *
+ * @return  The absolute values.
+ */
+FORCEINLINE Lanes8  Lanes8::Abs                ()                              const
+{
+    return {_mm256_andnot_ps(_mm256_set1_ps(-0.0f), m_value)};
+}
+
+/**
+ * Estimates the inverse square root of each lane, with a relative error below 1.5 * 2^-12.
+ *
+ * @return  The estimates.
+ */
+FORCEINLINE Lanes8  Lanes8::InvSqrtEstimate    ()                              const
+{
+    return {_mm256_rsqrt_ps(m_value)};
+}
+
+/**
+ * Gets which lanes are negative.
+ *
+ * @return  A mask where the bit i is set when the lane i is lower than 0.
+ */
+FORCEINLINE int32   Lanes8::NegativeMask       ()                              const
+{
+    return _mm256_movemask_ps(_mm256_cmp_ps(m_value, _mm256_setzero_ps(), _CMP_LT_OQ));
+}
+
+/**
+ * Computes the reciprocal of each lane, or 0 when the lane is nearly zero (Same as Vector3::SafeScaleReciprocal).
+ *
+ * @param p_tolerance   The tolerance below which a lane is considered as zero.
+ *
+ * @return              The reciprocals.
+ */
+FORCEINLINE Lanes8  Lanes8::SafeReciprocal     (float const    p_tolerance)    const
+{
+    __m256 const isZero {_mm256_cmp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), m_value), _mm256_set1_ps(p_tolerance), _CMP_LE_OQ)};
+
+    return {_mm256_andnot_ps(isZero, _mm256_div_ps(_mm256_set1_ps(1.0f), m_value))};
+}
+
+/**
+ * Shifts the raw bits of each lane to the left, filling with zeros.
+ *
+ * @param p_count   The number of bits to shift.
+ *
+ * @return          The shifted lanes.
+ */
+FORCEINLINE Lanes8  Lanes8::ShiftBitsLeft      (uint32 const   p_count)        const
+{
+    return {_mm256_castsi256_ps(_mm256_sll_epi32(_mm256_castps_si256(m_value), _mm_cvtsi32_si128(static_cast<int32>(p_count))))};
+}
+
+/**
+ * Shifts the raw bits of each lane to the right, filling with zeros.
+ *
+ * @param p_count   The number of bits to shift.
+ *
+ * @return          The shifted lanes.
+ */
+FORCEINLINE Lanes8  Lanes8::ShiftBitsRight     (uint32 const   p_count)        const
+{
+    return {_mm256_castsi256_ps(_mm256_srl_epi32(_mm256_castps_si256(m_value), _mm_cvtsi32_si128(static_cast<int32>(p_count))))};
+}
+
+/** Lane-wise addition. */
+FORCEINLINE Lanes8  operator+   (Lanes8 const   p_a,
+                                 Lanes8 const   p_b)
+{
+    return {_mm256_add_ps(p_a.m_value, p_b.m_value)};
+}
+
+/** Lane-wise subtraction. */
+FORCEINLINE Lanes8  operator-   (Lanes8 const   p_a,
+                                 Lanes8 const   p_b)
+{
+    return {_mm256_sub_ps(p_a.m_value, p_b.m_value)};
+}
+
+/** Lane-wise multiplication. */
+FORCEINLINE Lanes8  operator*   (Lanes8 const   p_a,
+                                 Lanes8 const   p_b)
+{
+    return {_mm256_mul_ps(p_a.m_value, p_b.m_value)};
+}
+
+/** Lane-wise division. */
+FORCEINLINE Lanes8  operator/   (Lanes8 const   p_a,
+                                 Lanes8 const   p_b)
+{
+    return {_mm256_div_ps(p_a.m_value, p_b.m_value)};
+}
+
+/** Lane-wise negation. */
+FORCEINLINE Lanes8  operator-   (Lanes8 const   p_lanes)
+{
+    return {_mm256_xor_ps(p_lanes.m_value, _mm256_set1_ps(-0.0f))};
+}
+
+/** Bitwise and of the lanes. */
+FORCEINLINE Lanes8  operator&   (Lanes8 const   p_a,
+                                 Lanes8 const   p_b)
+{
+    return {_mm256_and_ps(p_a.m_value, p_b.m_value)};
+}
+
+/** Bitwise or of the lanes. */
+FORCEINLINE Lanes8  operator|   (Lanes8 const   p_a,
+                                 Lanes8 const   p_b)
+{
+    return {_mm256_or_ps(p_a.m_value, p_b.m_value)};
+}
+
+/** Bitwise exclusive or of the lanes. */
+FORCEINLINE Lanes8  operator^   (Lanes8 const   p_a,
+                                 Lanes8 const   p_b)
+{
+    return {_mm256_xor_ps(p_a.m_value, p_b.m_value)};
+}
+
+#endif
+
+#endif // !__MATH_SIMD_LANES_INL__
\ No newline at end of file
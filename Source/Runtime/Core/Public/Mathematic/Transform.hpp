@@ -190,6 +190,8 @@ class ENGINE_API Transform
 }; // !class Transform
 
 #include "Transform.inl"
-#include "Transform.generated.hpp"
+#if __has_include("Transform.generated.hpp")
+    #include "Transform.generated.hpp"
+#endif
 
 #endif // !__TRANSFORM_HPP__
\ No newline at end of file
@@ -86,9 +86,10 @@ FORCEINLINE bool        Transform::IsNearlySame     (Transform const&   p_a,
 FORCEINLINE bool        Transform::IsSame           (Transform const&   p_a,
                                                      Transform const&   p_b)
 {
+    // Exact comparisons first, the rotation needs a dot product.
     return  (p_a.m_translation == p_b.m_translation)                    &&
-            Quaternion::IsNearlySame(p_a.m_rotation, p_b.m_rotation)    &&
-            (p_a.m_scale == p_b.m_scale);   
+            (p_a.m_scale == p_b.m_scale)                                &&
+            Quaternion::IsNearlySame(p_a.m_rotation, p_b.m_rotation);
 }
 
 /*==============================[Constructors + Destructor]==============================*/
@@ -0,0 +1,104 @@
+#ifndef __TRANSFORM_BATCH_HPP__
+#define __TRANSFORM_BATCH_HPP__
+
+#include "SIMDLanes.hpp"
+#include "Transform.hpp"
+
+/**
+ * Structure of arrays holding many transforms, one array per component.
+ *
+ * The kernels below process LaneCount transforms per instruction, which is what you want to compute
+ * the world matrices of a whole scene in one loop instead of one Transform at a time.
+ * They give the same results as the matching Transform operations, as long as the compiler does not contract
+ * the scalar multiply-adds (see SIMD.hpp).
+ */
+class ENGINE_API TransformBatch
+{
+    public:
+
+    // ==============================[Public Static Properties]============================== //
+
+        /** Number of transforms processed together by the kernels (8 with AVX2, 4 with SSE4.1, 1 otherwise). */
+        static constexpr size_t LaneCount = WideLanes::Width;
+
+    // ==============================[Public Static Methods]============================== //
+
+        static  void    Compose (TransformBatch const&  p_parents,
+                                 TransformBatch const&  p_locals,
+                                 TransformBatch&        p_result);
+
+        static  void    Inverse (TransformBatch const&  p_transforms,
+                                 TransformBatch&        p_result);
+
+    // ==============================[Constructor + Destructor]============================== //
+
+                    TransformBatch  ()                                  = default;
+
+        explicit    TransformBatch  (size_t                 p_count);
+
+                    TransformBatch  (TransformBatch const&  p_copy)     = default;
+
+                    TransformBatch  (TransformBatch&&       p_move)     = default;
+
+                    ~TransformBatch ()                                  = default;
+
+    // ==============================[Public Local Methods]============================== //
+
+        FORCEINLINE void        Clear       ();
+
+        FORCEINLINE Transform   Get         (size_t const       p_index)        const;
+
+        FORCEINLINE void        PushBack    (Transform const&   p_transform);
+
+        FORCEINLINE void        Reserve     (size_t const       p_count);
+
+        FORCEINLINE void        Resize      (size_t const       p_count);
+
+        FORCEINLINE void        Set         (size_t const       p_index,
+                                             Transform const&   p_transform);
+
+        FORCEINLINE size_t      Size        ()                                  const;
+
+                    void        ToMatrices  (Matrix4x4*         p_matrices)     const;
+
+    // ==============================[Public Local Operators]============================== //
+
+        TransformBatch& operator=   (TransformBatch const&  p_copy) = default;
+
+        TransformBatch& operator=   (TransformBatch&&       p_move) = default;
+
+    private:
+
+    // ==============================[Private Enum]============================== //
+
+        enum EComponent : uint8
+        {
+            TranslationX,
+            TranslationY,
+            TranslationZ,
+            RotationX,
+            RotationY,
+            RotationZ,
+            RotationW,
+            ScaleX,
+            ScaleY,
+            ScaleZ,
+            ComponentCount
+        };
+
+    // ==============================[Private Local Properties]============================== //
+
+        /** One array per component, all of them have the same size. */
+        std::array<std::vector<float>, ComponentCount> m_components;
+
+    // ==============================[Private Local Methods]============================== //
+
+        FORCEINLINE std::array<float const*, ComponentCount>    GetComponents   ()  const;
+
+        FORCEINLINE std::array<float*, ComponentCount>          GetComponents   ();
+
+}; // !class TransformBatch
+
+#include "TransformBatch.inl"
+
+#endif // !__TRANSFORM_BATCH_HPP__
\ No newline at end of file
@@ -0,0 +1,130 @@
+#ifndef __TRANSFORM_BATCH_INL__
+#define __TRANSFORM_BATCH_INL__
+
+// ==============================[Public Local Methods]============================== //
+
+/** Removes all the transforms. */
+FORCEINLINE void        TransformBatch::Clear       ()
+{
+    for (std::vector<float>& component : m_components)
+        component.clear();
+}
+
+/**
+ * Gathers a transform from the arrays.
+ *
+ * @param p_index   The index of the transform, must be lower than Size().
+ *
+ * @return          The transform at p_index.
+ */
+FORCEINLINE Transform   TransformBatch::Get         (size_t const       p_index)        const
+{
+    return Transform
+    (
+        Vector3     (m_components[TranslationX][p_index], m_components[TranslationY][p_index], m_components[TranslationZ][p_index]),
+        Quaternion  (m_components[RotationX][p_index], m_components[RotationY][p_index], m_components[RotationZ][p_index], m_components[RotationW][p_index]),
+        Vector3     (m_components[ScaleX][p_index], m_components[ScaleY][p_index], m_components[ScaleZ][p_index])
+    );
+}
+
+/**
+ * Appends a transform at the end of the arrays.
+ *
+ * @param p_transform   The transform to append.
+ */
+FORCEINLINE void        TransformBatch::PushBack    (Transform const&   p_transform)
+{
+    Resize(Size() + 1u);
+    Set(Size() - 1u, p_transform);
+}
+
+/**
+ * Reserves the memory for a number of transforms.
+ *
+ * @param p_count   The number of transforms to reserve.
+ */
+FORCEINLINE void        TransformBatch::Reserve     (size_t const       p_count)
+{
+    for (std::vector<float>& component : m_components)
+        component.reserve(p_count);
+}
+
+/**
+ * Changes the number of transforms, new transforms are identities.
+ *
+ * @param p_count   The new number of transforms.
+ */
+FORCEINLINE void        TransformBatch::Resize      (size_t const       p_count)
+{
+    for (uint8 component = 0u; component < ComponentCount; ++component)
+    {
+        bool const isOne {component == RotationW || component >= ScaleX};
+
+        m_components[component].resize(p_count, isOne ? 1.0f : 0.0f);
+    }
+}
+
+/**
+ * Scatters a transform into the arrays.
+ *
+ * @param p_index       The index of the transform, must be lower than Size().
+ * @param p_transform   The new transform.
+ */
+FORCEINLINE void        TransformBatch::Set         (size_t const       p_index,
+                                                     Transform const&   p_transform)
+{
+    m_components[TranslationX][p_index] = p_transform.m_translation.m_x;
+    m_components[TranslationY][p_index] = p_transform.m_translation.m_y;
+    m_components[TranslationZ][p_index] = p_transform.m_translation.m_z;
+    m_components[RotationX]   [p_index] = p_transform.m_rotation.m_x;
+    m_components[RotationY]   [p_index] = p_transform.m_rotation.m_y;
+    m_components[RotationZ]   [p_index] = p_transform.m_rotation.m_z;
+    m_components[RotationW]   [p_index] = p_transform.m_rotation.m_w;
+    m_components[ScaleX]      [p_index] = p_transform.m_scale.m_x;
+    m_components[ScaleY]      [p_index] = p_transform.m_scale.m_y;
+    m_components[ScaleZ]      [p_index] = p_transform.m_scale.m_z;
+}
+
+/**
+ * Gets the number of transforms.
+ *
+ * @return The number of transforms.
+ */
+FORCEINLINE size_t      TransformBatch::Size        ()                                  const
+{
+    return m_components[TranslationX].size();
+}
+
+// ==============================[Private Local Methods]============================== //
+
+/**
+ * Gets the address of each array, the kernels read them once instead of going through the vectors at each lane.
+ *
+ * @return The address of each array.
+ */
+FORCEINLINE std::array<float const*, TransformBatch::ComponentCount>    TransformBatch::GetComponents   ()  const
+{
+    std::array<float const*, ComponentCount> components;
+
+    for (uint8 component = 0u; component < ComponentCount; ++component)
+        components[component] = m_components[component].data();
+
+    return components;
+}
+
+/**
+ * Gets the address of each array, the kernels read them once instead of going through the vectors at each lane.
+ *
+ * @return The address of each array.
+ */
+FORCEINLINE std::array<float*, TransformBatch::ComponentCount>          TransformBatch::GetComponents   ()
+{
+    std::array<float*, ComponentCount> components;
+
+    for (uint8 component = 0u; component < ComponentCount; ++component)
+        components[component] = m_components[component].data();
+
+    return components;
+}
+
+#endif // !__TRANSFORM_BATCH_INL__
\ No newline at end of file
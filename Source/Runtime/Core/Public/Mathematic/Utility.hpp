@@ -1,13 +1,15 @@
 #ifndef __MATH_UTILITY_HPP__
 #define __MATH_UTILITY_HPP__
 
-#include <corecrt_math.h>
+#include <cmath>
+#include <cstring>
 #include <type_traits>
 
 #include "Reflection/Reflection.hpp"
 
 #include "MathMacro.hpp"
 #include "NumericLimits.hpp"
+#include "SIMD.hpp"
 
 struct ENGINE_API Math
 {
@@ -161,6 +163,46 @@ struct ENGINE_API Math
     static  FORCEINLINE float       Exp2                (float const        p_value);
     static  FORCEINLINE long double Exp2                (long double const  p_value);
     
+    static  FORCEINLINE float       FastAtan2           (float const        p_y,
+                                                         float const        p_x);
+    static              void        FastAtan2           (float const*       p_y,
+                                                         float const*       p_x,
+                                                         float*             p_results,
+                                                         size_t const       p_count);
+
+    static  FORCEINLINE float       FastCos             (float const        p_radAngle);
+    static              void        FastCos             (float const*       p_radAngles,
+                                                         float*             p_results,
+                                                         size_t const       p_count);
+
+    static  FORCEINLINE float       FastExp             (float const        p_value);
+    static              void        FastExp             (float const*       p_values,
+                                                         float*             p_results,
+                                                         size_t const       p_count);
+
+    static  FORCEINLINE float       FastInvSqrt         (float const        p_value);
+    static              void        FastInvSqrt         (float const*       p_values,
+                                                         float*             p_results,
+                                                         size_t const       p_count);
+
+    static  FORCEINLINE float       FastLog             (float const        p_value);
+    static              void        FastLog             (float const*       p_values,
+                                                         float*             p_results,
+                                                         size_t const       p_count);
+
+    static  FORCEINLINE float       FastSin             (float const        p_radAngle);
+    static              void        FastSin             (float const*       p_radAngles,
+                                                         float*             p_results,
+                                                         size_t const       p_count);
+
+    static  FORCEINLINE void        FastSinCos          (float const        p_radAngle,
+                                                         float&             p_sine,
+                                                         float&             p_cosine);
+    static              void        FastSinCos          (float const*       p_radAngles,
+                                                         float*             p_sines,
+                                                         float*             p_cosines,
+                                                         size_t const       p_count);
+
     static  CONSTEXPR   double      FloatSelect         (double const       p_comparand,
                                                          double const       p_valueGEZero,
                                                          double const       p_valueLTZero);
@@ -198,6 +240,9 @@ struct ENGINE_API Math
     static  FORCEINLINE float       Fractional          (float const        p_value);
     static  FORCEINLINE long double Fractional          (long double const  p_value);
 
+    static  FORCEINLINE void        HashCombine         (size_t&            p_seed,
+                                                         size_t const       p_hash);
+
     template <typename ReturnType = double, typename Type>
     static  FORCEINLINE ReturnType  InverseLerp         (Type const         p_a,
                                                          Type const         p_b,
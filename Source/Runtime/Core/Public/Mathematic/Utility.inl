@@ -1054,6 +1054,220 @@ FORCEINLINE long double Math::Exp2                  (long double const  p_value)
     return exp2l(p_value);
 }
 
+/**
+ * Approximates the angle of the point (p_x, p_y) from the X axis with a degree 11 polynomial on [0, 1].
+ *
+ * Max absolute error: 2e-6 radians. Returns 0 for (0, 0).
+ *
+ * @param p_y       The Y coordinate.
+ * @param p_x       The X coordinate.
+ *
+ * @return          The angle in radians, in [-π, π].
+ */
+FORCEINLINE float       Math::FastAtan2             (float const        p_y,
+                                                     float const        p_x)
+{
+    float const absY        {Abs(p_y)};
+    float const absX        {Abs(p_x)};
+    float const numerator   {absX < absY ? absX : absY};
+    float const denominator {absX > absY ? absX : absY};
+    float const ratio       {numerator / (denominator > MIN_FLOAT ? denominator : MIN_FLOAT)};
+    float const square      {ratio * ratio};
+
+    float angle {(((((-1.172120e-2f * square + 5.265332e-2f) * square - 1.1643287e-1f) * square + 1.9354346e-1f) * square - 3.3262347e-1f) * square + 9.9997726e-1f) * ratio};
+
+    if (absY > absX)
+        angle = MATH_PI_2_F - angle;
+
+    if (p_x < 0.0f)
+        angle = MATH_PI_F - angle;
+
+    if (p_y < 0.0f)
+        angle = -angle;
+
+    return angle;
+}
+
+/**
+ * Approximates the cosine of an angle, see FastSinCos.
+ *
+ * @param p_radAngle    The angle in radians, in [-8192, 8192].
+ *
+ * @return              The cosine of p_radAngle.
+ */
+FORCEINLINE float       Math::FastCos               (float const        p_radAngle)
+{
+    float sine;
+    float cosine;
+
+    FastSinCos(p_radAngle, sine, cosine);
+
+    return cosine;
+}
+
+/**
+ * Approximates e raised to the given power with a degree 7 polynomial on [-ln(2)/2, ln(2)/2].
+ *
+ * Max relative error: 1e-7. The value is clamped to [-87, 88] so the result stays a normal float.
+ *
+ * @param p_value   The exponent.
+ *
+ * @return          e^p_value.
+ */
+FORCEINLINE float       Math::FastExp               (float const        p_value)
+{
+    float const clamped     {p_value < 88.0f ? p_value : 88.0f};
+    float const value       {clamped > -87.0f ? clamped : -87.0f};
+
+    // Adding 1.5 * 2^23 rounds to the nearest integer, which lands in the low bits of the float (biased by 127 here).
+    float const shifted     {value * MATH_LOG2E_F + 12583039.0f};
+    float const exponent    {shifted - 12583039.0f};
+    float const reduced     {(value - exponent * 6.93359375e-1f) - exponent * -2.12194440e-4f};
+    float const square      {reduced * reduced};
+    float const polynomial  {(((((1.9875691500e-4f * reduced + 1.3981999507e-3f) * reduced + 8.3334519073e-3f) * reduced + 4.1665795894e-2f) * reduced + 1.6666665459e-1f) * reduced + 5.0000001201e-1f) * square + reduced + 1.0f};
+
+    uint32 bits;
+    float  scale;
+
+    std::memcpy(&bits, &shifted, sizeof(bits));
+
+    bits <<= 23u;
+
+    std::memcpy(&scale, &bits, sizeof(scale));
+
+    return polynomial * scale;
+}
+
+/**
+ * Approximates the inverse square root with the hardware estimate (A bit-level guess refined once when MATH_SIMD_DISABLED is defined)
+ * followed by one Newton-Raphson step.
+ *
+ * Max relative error: 3e-7 (5e-6 without SSE4.1, or when MATH_SIMD_DISABLED is defined).
+ *
+ * @param p_value   A strictly positive value.
+ *
+ * @return          1 / sqrt(p_value).
+ */
+FORCEINLINE float       Math::FastInvSqrt           (float const        p_value)
+{
+#if defined(MATH_SIMD_SSE4)
+    float const estimate    {_mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(p_value)))};
+#else
+    uint32 bits;
+    float  guess;
+
+    std::memcpy(&bits, &p_value, sizeof(bits));
+
+    bits = 0x5f375a86u - (bits >> 1u);
+
+    std::memcpy(&guess, &bits, sizeof(guess));
+
+    float const estimate    {guess * (1.5f - 0.5f * p_value * guess * guess)};
+#endif
+
+    return estimate * (1.5f - 0.5f * p_value * estimate * estimate);
+}
+
+/**
+ * Approximates the natural logarithm with a degree 10 polynomial on [sqrt(2)/2 - 1, sqrt(2) - 1].
+ *
+ * Max error: 1 ulp of the result, which is 3e-7 absolute on [2^-10, 2^10] and grows with the magnitude of the logarithm.
+ * Only defined for positive normal floats, NaN, infinity, zero and denormals aren't handled.
+ *
+ * @param p_value   A strictly positive value.
+ *
+ * @return          ln(p_value).
+ */
+FORCEINLINE float       Math::FastLog               (float const        p_value)
+{
+    uint32 bits;
+    uint32 exponentBits;
+    uint32 mantissaBits;
+    float  exponent;
+    float  mantissa;
+
+    std::memcpy(&bits, &p_value, sizeof(bits));
+
+    // Or-ing the biased exponent in the mantissa of 2^23 converts it to a float without a conversion instruction.
+    exponentBits = (bits >> 23u) | 0x4b000000u;
+    mantissaBits = (bits & 0x007fffffu) | 0x3f800000u;
+
+    std::memcpy(&exponent, &exponentBits, sizeof(exponent));
+    std::memcpy(&mantissa, &mantissaBits, sizeof(mantissa));
+
+    exponent = exponent - 8388735.0f;
+
+    if (mantissa > MATH_SQRT_2_F)
+    {
+        mantissa = mantissa * 0.5f;
+        exponent = exponent + 1.0f;
+    }
+
+    float const reduced     {mantissa - 1.0f};
+    float const square      {reduced * reduced};
+    float const polynomial  {((((((((7.0376836292e-2f * reduced - 1.1514610310e-1f) * reduced + 1.1676998740e-1f) * reduced - 1.2420140846e-1f) * reduced + 1.4249322787e-1f) * reduced - 1.6668057665e-1f) * reduced + 2.0000714765e-1f) * reduced - 2.4999993993e-1f) * reduced + 3.3333331174e-1f) * reduced * square};
+
+    return (reduced + ((polynomial + exponent * -2.12194440e-4f) - 0.5f * square)) + exponent * 6.93359375e-1f;
+}
+
+/**
+ * Approximates the sine of an angle, see FastSinCos.
+ *
+ * @param p_radAngle    The angle in radians, in [-8192, 8192].
+ *
+ * @return              The sine of p_radAngle.
+ */
+FORCEINLINE float       Math::FastSin               (float const        p_radAngle)
+{
+    float sine;
+    float cosine;
+
+    FastSinCos(p_radAngle, sine, cosine);
+
+    return sine;
+}
+
+/**
+ * Approximates the sine and the cosine of an angle at once.
+ * The angle is reduced to [-π/4, π/4], where a degree 7 (sine) and a degree 8 (cosine) polynomial are evaluated.
+ *
+ * Max absolute error: 1e-7 on [-8192, 8192], beyond which the reduction loses precision.
+ *
+ * @param p_radAngle    The angle in radians, in [-8192, 8192].
+ * @param p_sine        The sine of p_radAngle.
+ * @param p_cosine      The cosine of p_radAngle.
+ */
+FORCEINLINE void        Math::FastSinCos            (float const        p_radAngle,
+                                                     float&             p_sine,
+                                                     float&             p_cosine)
+{
+    // Adding 1.5 * 2^23 rounds to the nearest quadrant, which lands in the low bits of the float.
+    float const shifted     {p_radAngle * MATH_2_PI_F + 12582912.0f};
+    float const quadrant    {shifted - 12582912.0f};
+    float const angle       {((p_radAngle - quadrant * 1.5703125f) - quadrant * 4.837512969970703125e-4f) - quadrant * 7.54978995489188216e-8f};
+    float const square      {angle * angle};
+    float const sine        {((-1.9515295891e-4f * square + 8.3321608736e-3f) * square - 1.6666654611e-1f) * square * angle + angle};
+    float const cosine      {((2.443315711809948e-5f * square - 1.388731625493765e-3f) * square + 4.166664568298827e-2f) * square * square - 0.5f * square + 1.0f};
+
+    uint32 quadrantBits;
+    uint32 sineBits;
+    uint32 cosineBits;
+
+    std::memcpy(&quadrantBits,  &shifted,   sizeof(quadrantBits));
+    std::memcpy(&sineBits,      &sine,      sizeof(sineBits));
+    std::memcpy(&cosineBits,    &cosine,    sizeof(cosineBits));
+
+    // Quadrants 1 and 3 swap the sine and the cosine, the sine is negated in quadrants 2 and 3, the cosine in 1 and 2.
+    // Done on the bits, the quadrant is random in a loop and branches would be mispredicted.
+    uint32 const swap   {(sineBits ^ cosineBits) & (0u - (quadrantBits & 1u))};
+
+    sineBits    = (sineBits   ^ swap) ^ ((quadrantBits        & 2u) << 30u);
+    cosineBits  = (cosineBits ^ swap) ^ (((quadrantBits + 1u) & 2u) << 30u);
+
+    std::memcpy(&p_sine,    &sineBits,      sizeof(p_sine));
+    std::memcpy(&p_cosine,  &cosineBits,    sizeof(p_cosine));
+}
+
 /**
  * Returns value based on comparand. The main purpose of this function is to avoid
  * branching based on floating point comparison which can be avoided via compiler
@@ -1310,6 +1524,19 @@ FORCEINLINE long double Math::Fractional            (long double const  p_value)
     return p_value - Math::Trunc(p_value);
 }
 
+/**
+ * Mixes p_hash into p_seed, the order of the calls matters.
+ *
+ * @param p_seed    Hash accumulated so far, updated in place.
+ * @param p_hash    Hash of the next element.
+ */
+FORCEINLINE void        Math::HashCombine           (size_t&            p_seed,
+                                                     size_t const       p_hash)
+{
+    p_seed += 0x9e3779b9 + (p_seed << 6) + (p_seed >> 2);
+    p_seed ^= p_hash;
+}
+
 /**
  *  Compute the percentage along a line from a min value to a max that value wtih a value given.
  *
@@ -1429,7 +1656,7 @@ FORCEINLINE long double Math::InvSqrt               (long double const  p_value)
  */
 FORCEINLINE double      Math::IsFinite              (double const       p_value)
 {
-    return isfinite(p_value);
+    return std::isfinite(p_value);
 }
 
 /**
@@ -1443,7 +1670,7 @@ FORCEINLINE double      Math::IsFinite              (double const       p_value)
  */
 FORCEINLINE float       Math::IsFinite              (float const        p_value)
 {
-    return isfinite(p_value);
+    return std::isfinite(p_value);
 }
 
 /**
@@ -1457,7 +1684,7 @@ FORCEINLINE float       Math::IsFinite              (float const        p_value)
  */
 FORCEINLINE long double Math::IsFinite              (long double const  p_value)
 {
-    return isfinite(p_value);
+    return std::isfinite(p_value);
 }
 
 /**
@@ -1470,7 +1697,7 @@ FORCEINLINE long double Math::IsFinite              (long double const  p_value)
  */
 FORCEINLINE double      Math::IsInfinite            (double const       p_value)
 {
-    return isinf(p_value);
+    return std::isinf(p_value);
 }
 
 /**
@@ -1483,7 +1710,7 @@ FORCEINLINE double      Math::IsInfinite            (double const       p_value)
  */
 FORCEINLINE float       Math::IsInfinite            (float const        p_value)
 {
-    return isinf(p_value);
+    return std::isinf(p_value);
 }
 
 /**
@@ -1496,7 +1723,7 @@ FORCEINLINE float       Math::IsInfinite            (float const        p_value)
  */
 FORCEINLINE long double Math::IsInfinite            (long double const  p_value)
 {
-    return isinf(p_value);
+    return std::isinf(p_value);
 }
 
 /**
@@ -1509,7 +1736,7 @@ FORCEINLINE long double Math::IsInfinite            (long double const  p_value)
  */
 FORCEINLINE double      Math::IsNaN                 (double const       p_value)
 {
-    return isnan(p_value);
+    return std::isnan(p_value);
 }
 
 /**
@@ -1522,7 +1749,7 @@ FORCEINLINE double      Math::IsNaN                 (double const       p_value)
  */
 FORCEINLINE float       Math::IsNaN                 (float const        p_value)
 {
-    return isnan(p_value);
+    return std::isnan(p_value);
 }
 
 /**
@@ -1535,7 +1762,7 @@ FORCEINLINE float       Math::IsNaN                 (float const        p_value)
  */
 FORCEINLINE long double Math::IsNaN                 (long double const  p_value)
 {
-    return isnan(p_value);
+    return std::isnan(p_value);
 }
 
 /**
@@ -2059,7 +2286,7 @@ FORCEINLINE ReturnType  Math::LerpAngleRad          (Type const         p_a,
     static_assert(std::is_arithmetic<ReturnType>::value, "ReturnType must be an arithmetic type !");
     static_assert(std::is_arithmetic<Type>::value, "Type must be an arithmetic type !");
     
-    float delta   {Repeat((double)(p_b-p_a), MATH_TAU_F)};
+    float delta   {Repeat((float)(p_b-p_a), MATH_TAU_F)};
     
     if (delta > MATH_PI_F)
         delta -= MATH_TAU_F;
@@ -2085,7 +2312,7 @@ FORCEINLINE ReturnType  Math::LerpAngleRad          (Type const         p_a,
     static_assert(std::is_arithmetic<ReturnType>::value, "ReturnType must be an arithmetic type !");
     static_assert(std::is_arithmetic<Type>::value, "Type must be an arithmetic type !");
     
-    float delta   {Repeat((double)(p_b-p_a), MATH_TAU_L)};
+    float delta   {Repeat((long double)(p_b-p_a), MATH_TAU_L)};
     
     if (delta > MATH_PI_L)
         delta -= MATH_TAU_L;
@@ -125,8 +125,8 @@ FORCEINLINE Vector2 Vector2::ClampMinMagnitude  (Vector2 const& p_vector,
  *
  * @return      The result of cross product.
  */
-FORCEINLINE float   Vector2::Cross              (Vector2 const& p_a, 
-                                                 Vector2 const& p_b)
+CONSTEXPR FORCEINLINE float   Vector2::Cross              (Vector2 const& p_a, 
+                                                           Vector2 const& p_b)
 {
     return p_a.m_x * p_b.m_y - p_a.m_y * p_b.m_x;
 }
@@ -167,8 +167,8 @@ FORCEINLINE float   Vector2::DistanceSquared    (Vector2 const& p_a,
  *
  * @return      The result of dot product.
  */
-FORCEINLINE float   Vector2::Dot                (Vector2 const& p_a,
-                                                 Vector2 const& p_b)
+CONSTEXPR FORCEINLINE float   Vector2::Dot                (Vector2 const& p_a,
+                                                           Vector2 const& p_b)
 {
     return p_a.m_x*p_b.m_x + p_a.m_y*p_b.m_y;
 
@@ -417,7 +417,7 @@ FORCEINLINE float   Vector2::SignedAngleRad     (Vector2 const& p_from,
 /*==============================[Constructors + Destructor]==============================*/
 
 /** Default constructor, all components are initialized to 0.0f */
-FORCEINLINE Vector2::Vector2    ()
+CONSTEXPR FORCEINLINE Vector2::Vector2    ()
 :   m_x {0.0f},
     m_y {0.0f}
 {}
@@ -427,7 +427,7 @@ FORCEINLINE Vector2::Vector2    ()
  *
  * @param p_value   The value to set all components to.
  */
-FORCEINLINE Vector2::Vector2    (float const    p_value)
+CONSTEXPR FORCEINLINE Vector2::Vector2    (float const    p_value)
 :   m_x {p_value},
     m_y {p_value}
 {}
@@ -438,8 +438,8 @@ FORCEINLINE Vector2::Vector2    (float const    p_value)
  * @param p_x   The X coordinate.
  * @param p_y   The Y coordinate.
  */
-FORCEINLINE Vector2::Vector2    (float const    p_x,
-                                 float const    p_y)
+CONSTEXPR FORCEINLINE Vector2::Vector2    (float const    p_x,
+                                           float const    p_y)
 :   m_x {p_x},
     m_y {p_y}
 {}
@@ -451,8 +451,8 @@ FORCEINLINE Vector2::Vector2    (float const    p_x,
  * @param p_to      The start vector.
  * @param p_from    The end vector.
  */
-FORCEINLINE Vector2::Vector2    (Vector2 const& p_from,
-                                 Vector2 const& p_to)
+CONSTEXPR FORCEINLINE Vector2::Vector2    (Vector2 const& p_from,
+                                           Vector2 const& p_to)
 :   m_x {p_to.m_x - p_from.m_x},
     m_y {p_to.m_y - p_from.m_y}
 {}
@@ -462,7 +462,7 @@ FORCEINLINE Vector2::Vector2    (Vector2 const& p_from,
  *
  * @param p_copy    The initial vector to copy.
  */
-FORCEINLINE Vector2::Vector2    (Vector2 const& p_copy)
+CONSTEXPR FORCEINLINE Vector2::Vector2    (Vector2 const& p_copy)
 :   m_x {p_copy.m_x},
     m_y {p_copy.m_y}
 {}
@@ -472,7 +472,7 @@ FORCEINLINE Vector2::Vector2    (Vector2 const& p_copy)
  *
  * @param p_copy    The initial vector to copy.
  */
-FORCEINLINE Vector2::Vector2    (Vector2&&      p_move)
+CONSTEXPR FORCEINLINE Vector2::Vector2    (Vector2&&      p_move)
 :   m_x {std::move(p_move.m_x)},
     m_y {std::move(p_move.m_y)}
 {}
@@ -568,7 +568,7 @@ FORCEINLINE float       Vector2::GetMagnitude           ()
  *
  * @return The squared magnitude of this vector.
  */
-FORCEINLINE float       Vector2::GetMagnitudeSquared    ()                                          const
+CONSTEXPR FORCEINLINE float       Vector2::GetMagnitudeSquared    ()                                          const
 {
     return  m_x*m_x + m_y*m_y;
 }
@@ -788,7 +788,7 @@ FORCEINLINE void        Vector2::ToDirectionAndLength   (Vector2&       p_outDir
  * @return          True    if the vectors are equal.
  * @return          False   if the vectors are different.
  */
-FORCEINLINE bool        Vector2::operator== (Vector2 const& p_vector)   const
+CONSTEXPR FORCEINLINE bool        Vector2::operator== (Vector2 const& p_vector)   const
 {
     return m_x == p_vector.m_x && m_y == p_vector.m_y;
 }
@@ -801,7 +801,7 @@ FORCEINLINE bool        Vector2::operator== (Vector2 const& p_vector)   const
   * @return          True    if the vectors are different.
   * @return          False   if the vectors are equal.
   */
-FORCEINLINE bool        Vector2::operator!= (Vector2 const& p_vector)   const
+CONSTEXPR FORCEINLINE bool        Vector2::operator!= (Vector2 const& p_vector)   const
 {
     return m_x != p_vector.m_x || m_y != p_vector.m_y;
 }
@@ -813,7 +813,7 @@ FORCEINLINE bool        Vector2::operator!= (Vector2 const& p_vector)   const
  *
  * @return          The reference to vector after copy.
  */
-FORCEINLINE Vector2&    Vector2::operator=  (Vector2 const& p_vector)
+CONSTEXPR FORCEINLINE Vector2&    Vector2::operator=  (Vector2 const& p_vector)
 {
     m_x = p_vector.m_x;
     m_y = p_vector.m_y;
@@ -828,7 +828,7 @@ FORCEINLINE Vector2&    Vector2::operator=  (Vector2 const& p_vector)
  *
  * @return          The reference to vector after move.
  */
-FORCEINLINE Vector2&    Vector2::operator=  (Vector2&&      p_move)
+CONSTEXPR FORCEINLINE Vector2&    Vector2::operator=  (Vector2&&      p_move)
 {
     m_x = std::move(p_move.m_x);
     m_y = std::move(p_move.m_y);
@@ -873,7 +873,7 @@ FORCEINLINE float&      Vector2::operator[] (int32 const    p_index)
  *
  * @return          The result of vector addition.
  */
-FORCEINLINE Vector2     Vector2::operator+  (Vector2 const& p_vector)   const
+CONSTEXPR FORCEINLINE Vector2     Vector2::operator+  (Vector2 const& p_vector)   const
 {
     return Vector2
     (
@@ -889,7 +889,7 @@ FORCEINLINE Vector2     Vector2::operator+  (Vector2 const& p_vector)   const
  *
  * @return          The result of addition.
  */
-FORCEINLINE Vector2     Vector2::operator+  (float const    p_value)    const
+CONSTEXPR FORCEINLINE Vector2     Vector2::operator+  (float const    p_value)    const
 {
     return Vector2
     (
@@ -906,7 +906,7 @@ FORCEINLINE Vector2     Vector2::operator+  (float const    p_value)    const
  *
  * @return          Copy of the vector after addition.
  */
-FORCEINLINE Vector2&    Vector2::operator+= (Vector2 const& p_vector)
+CONSTEXPR FORCEINLINE Vector2&    Vector2::operator+= (Vector2 const& p_vector)
 {
     m_x += p_vector.m_x;
     m_y += p_vector.m_y;
@@ -921,7 +921,7 @@ FORCEINLINE Vector2&    Vector2::operator+= (Vector2 const& p_vector)
   *
   * @return          The reference of the vector after addition.
   */
-FORCEINLINE Vector2&    Vector2::operator+= (float const    p_value)
+CONSTEXPR FORCEINLINE Vector2&    Vector2::operator+= (float const    p_value)
 {
     m_x += p_value;
     m_y += p_value;
@@ -934,7 +934,7 @@ FORCEINLINE Vector2&    Vector2::operator+= (float const    p_value)
  *
  * @return          A negated copy of the vector.
  */
-FORCEINLINE Vector2     Vector2::operator-  ()                          const
+CONSTEXPR FORCEINLINE Vector2     Vector2::operator-  ()                          const
 {
     return Vector2(-m_x, -m_y);
 }
@@ -946,7 +946,7 @@ FORCEINLINE Vector2     Vector2::operator-  ()                          const
  *
  * @return          The result of vector subtraction.
  */
-FORCEINLINE Vector2     Vector2::operator-  (Vector2 const& p_vector)   const
+CONSTEXPR FORCEINLINE Vector2     Vector2::operator-  (Vector2 const& p_vector)   const
 {
     return Vector2
     (
@@ -962,7 +962,7 @@ FORCEINLINE Vector2     Vector2::operator-  (Vector2 const& p_vector)   const
  *
  * @return          The result of subtraction.
  */
-FORCEINLINE Vector2     Vector2::operator-  (float const    p_value)    const
+CONSTEXPR FORCEINLINE Vector2     Vector2::operator-  (float const    p_value)    const
 {
     return Vector2
     (
@@ -979,7 +979,7 @@ FORCEINLINE Vector2     Vector2::operator-  (float const    p_value)    const
  *
  * @return          The reference of the vector after subtraction.
  */
-FORCEINLINE Vector2&    Vector2::operator-= (Vector2 const& p_vector)
+CONSTEXPR FORCEINLINE Vector2&    Vector2::operator-= (Vector2 const& p_vector)
 {
     m_x -= p_vector.m_x;
     m_y -= p_vector.m_y;
@@ -994,7 +994,7 @@ FORCEINLINE Vector2&    Vector2::operator-= (Vector2 const& p_vector)
  *
  * @return          The reference of the vector after subtraction.
  */
-FORCEINLINE Vector2&    Vector2::operator-= (float const    p_value)
+CONSTEXPR FORCEINLINE Vector2&    Vector2::operator-= (float const    p_value)
 {
     m_x -= p_value;
     m_y -= p_value;
@@ -1009,7 +1009,7 @@ FORCEINLINE Vector2&    Vector2::operator-= (float const    p_value)
  *
  * @return          The result of multiplication.
  */
-FORCEINLINE Vector2     Vector2::operator*  (Vector2 const& p_vector)   const
+CONSTEXPR FORCEINLINE Vector2     Vector2::operator*  (Vector2 const& p_vector)   const
 {
     return Vector2
     (
@@ -1025,7 +1025,7 @@ FORCEINLINE Vector2     Vector2::operator*  (Vector2 const& p_vector)   const
  *
  * @return          The result of multiplication.
  */
-FORCEINLINE Vector2     Vector2::operator*  (float const    p_scale)    const
+CONSTEXPR FORCEINLINE Vector2     Vector2::operator*  (float const    p_scale)    const
 {
     return Vector2
     (
@@ -1041,7 +1041,7 @@ FORCEINLINE Vector2     Vector2::operator*  (float const    p_scale)    const
  *
  * @return          The reference of the vector after multiplication.
  */
-FORCEINLINE Vector2&    Vector2::operator*= (Vector2 const& p_vector)
+CONSTEXPR FORCEINLINE Vector2&    Vector2::operator*= (Vector2 const& p_vector)
 {
     m_x *= p_vector.m_x;
     m_y *= p_vector.m_y;
@@ -1057,7 +1057,7 @@ FORCEINLINE Vector2&    Vector2::operator*= (Vector2 const& p_vector)
  *
  * @return          The reference of the vector after multiplication.
  */
-FORCEINLINE Vector2&    Vector2::operator*= (float const    p_scale)
+CONSTEXPR FORCEINLINE Vector2&    Vector2::operator*= (float const    p_scale)
 {
     m_x *= p_scale;
     m_y *= p_scale;
@@ -1072,7 +1072,7 @@ FORCEINLINE Vector2&    Vector2::operator*= (float const    p_scale)
  *
  * @return          The result of division.
  */
-FORCEINLINE Vector2     Vector2::operator/  (Vector2 const& p_vector)   const
+CONSTEXPR FORCEINLINE Vector2     Vector2::operator/  (Vector2 const& p_vector)   const
 {
     return Vector2
     (   
@@ -1088,7 +1088,7 @@ FORCEINLINE Vector2     Vector2::operator/  (Vector2 const& p_vector)   const
  *
  * @return          The result of division.
  */
-FORCEINLINE Vector2     Vector2::operator/  (float const    p_scale)    const
+CONSTEXPR FORCEINLINE Vector2     Vector2::operator/  (float const    p_scale)    const
 {
     return Vector2
     (
@@ -1104,7 +1104,7 @@ FORCEINLINE Vector2     Vector2::operator/  (float const    p_scale)    const
  *
  * @return          The reference of the vector after division.
  */
-FORCEINLINE Vector2&    Vector2::operator/= (Vector2 const& p_vector)
+CONSTEXPR FORCEINLINE Vector2&    Vector2::operator/= (Vector2 const& p_vector)
 {
     m_x /= p_vector.m_x;
     m_y /= p_vector.m_y;
@@ -1120,7 +1120,7 @@ FORCEINLINE Vector2&    Vector2::operator/= (Vector2 const& p_vector)
  *
  * @return          The reference of the vector after division.
  */
-FORCEINLINE Vector2&    Vector2::operator/= (float const    p_scale)
+CONSTEXPR FORCEINLINE Vector2&    Vector2::operator/= (float const    p_scale)
 {
     m_x /= p_scale;
     m_y /= p_scale;
@@ -1135,7 +1135,7 @@ FORCEINLINE Vector2&    Vector2::operator/= (float const    p_scale)
  *
  * @return          The result of determinant.
  */
-FORCEINLINE float       Vector2::operator^  (Vector2 const& p_vector)   const
+CONSTEXPR FORCEINLINE float       Vector2::operator^  (Vector2 const& p_vector)   const
 {
     return m_x * p_vector.m_y - m_y * p_vector.m_x;
 }
@@ -1147,7 +1147,7 @@ FORCEINLINE float       Vector2::operator^  (Vector2 const& p_vector)   const
  *
  * @return          The result of dot product.
  */
-FORCEINLINE float       Vector2::operator|  (Vector2 const& p_vector)   const
+CONSTEXPR FORCEINLINE float       Vector2::operator|  (Vector2 const& p_vector)   const
 {
     return m_x*p_vector.m_x + m_y*p_vector.m_y;
 }
@@ -1162,8 +1162,8 @@ FORCEINLINE float       Vector2::operator|  (Vector2 const& p_vector)   const
  *
  * @return          The result of addition.
  */
-FORCEINLINE Vector2 operator+   (float const    p_value,
-                                 Vector2 const& p_vector)
+CONSTEXPR FORCEINLINE Vector2 operator+   (float const    p_value,
+                                           Vector2 const& p_vector)
 {
     return Vector2
     (
@@ -1180,8 +1180,8 @@ FORCEINLINE Vector2 operator+   (float const    p_value,
  *
  * @return          The result of multiplication.
  */
-FORCEINLINE Vector2 operator*   (float const    p_scale,
-                                 Vector2 const& p_vector)
+CONSTEXPR FORCEINLINE Vector2 operator*   (float const    p_scale,
+                                           Vector2 const& p_vector)
 {
     return Vector2
     (
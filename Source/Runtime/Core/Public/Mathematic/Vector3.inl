@@ -126,8 +126,8 @@ FORCEINLINE Vector3 Vector3::ClampMinMagnitude      (Vector3 const& p_vector,
  *
  * @return      The result of cross product.
  */
-FORCEINLINE Vector3 Vector3::Cross                  (Vector3 const& p_a, 
-                                                     Vector3 const& p_b)
+CONSTEXPR FORCEINLINE Vector3 Vector3::Cross                  (Vector3 const& p_a, 
+                                                               Vector3 const& p_b)
 {
     return Vector3
     (
@@ -211,8 +211,8 @@ FORCEINLINE float   Vector3::DistanceSquared2D      (Vector3 const& p_a,
  *
  * @return      The result of dot product.
  */
-FORCEINLINE float   Vector3::Dot                    (Vector3 const& p_a,
-                                                     Vector3 const& p_b)
+CONSTEXPR FORCEINLINE float   Vector3::Dot                    (Vector3 const& p_a,
+                                                               Vector3 const& p_b)
 {
     return p_a.m_x*p_b.m_x + p_a.m_y*p_b.m_y + p_a.m_z*p_b.m_z;
 
@@ -559,7 +559,7 @@ FORCEINLINE Vector3 Vector3::SignedEulerAngleRad    (Vector3 const& p_a,
 /*==============================[Constructors + Destructor]==============================*/
 
 /** Default constructor, all components are initialized to 0.0f */
-FORCEINLINE Vector3::Vector3    ()
+CONSTEXPR FORCEINLINE Vector3::Vector3    ()
 :   m_x {0.0f},
     m_y {0.0f},
     m_z {0.0f}
@@ -570,7 +570,7 @@ FORCEINLINE Vector3::Vector3    ()
  *
  * @param p_value   The value to set all components to.
  */
-FORCEINLINE Vector3::Vector3    (float const    p_value)
+CONSTEXPR FORCEINLINE Vector3::Vector3    (float const    p_value)
 :   m_x {p_value},
     m_y {p_value},
     m_z {p_value}
@@ -583,9 +583,9 @@ FORCEINLINE Vector3::Vector3    (float const    p_value)
  * @param p_y   The Y coordinate.
  * @param p_z   The Z coordinate.
  */
-FORCEINLINE Vector3::Vector3    (float const    p_x,
-                                 float const    p_y,
-                                 float const    p_z)
+CONSTEXPR FORCEINLINE Vector3::Vector3    (float const    p_x,
+                                           float const    p_y,
+                                           float const    p_z)
 :   m_x {p_x},
     m_y {p_y},
     m_z {p_z}
@@ -598,8 +598,8 @@ FORCEINLINE Vector3::Vector3    (float const    p_x,
  * @param p_to      The start vector.
  * @param p_from    The end vector.
  */
-FORCEINLINE Vector3::Vector3    (Vector3 const& p_from,
-                                 Vector3 const& p_to)
+CONSTEXPR FORCEINLINE Vector3::Vector3    (Vector3 const& p_from,
+                                           Vector3 const& p_to)
 :   m_x {p_to.m_x - p_from.m_x},
     m_y {p_to.m_y - p_from.m_y},    
     m_z {p_to.m_z - p_from.m_z}
@@ -611,8 +611,8 @@ FORCEINLINE Vector3::Vector3    (Vector3 const& p_from,
  * @param p_vector2 The 2D vector to set first two components.
  * @param p_z       Z coordinate (p_w = 0.0f by default).
  */
-FORCEINLINE Vector3::Vector3    (Vector2 const& p_vector2,
-                                 float const    p_z)
+CONSTEXPR FORCEINLINE Vector3::Vector3    (Vector2 const& p_vector2,
+                                           float const    p_z)
 :   m_x {p_vector2.m_x},
     m_y {p_vector2.m_y},
     m_z {p_z}
@@ -623,7 +623,7 @@ FORCEINLINE Vector3::Vector3    (Vector2 const& p_vector2,
  *
  * @param p_copy    The initial vector to copy.
  */
-FORCEINLINE Vector3::Vector3    (Vector3 const& p_copy)
+CONSTEXPR FORCEINLINE Vector3::Vector3    (Vector3 const& p_copy)
 :   m_x {p_copy.m_x},
     m_y {p_copy.m_y},
     m_z {p_copy.m_z}
@@ -634,7 +634,7 @@ FORCEINLINE Vector3::Vector3    (Vector3 const& p_copy)
  *
  * @param p_move    The initial vector to move.
  */
-FORCEINLINE Vector3::Vector3    (Vector3&&      p_move)
+CONSTEXPR FORCEINLINE Vector3::Vector3    (Vector3&&      p_move)
 :   m_x {std::move(p_move.m_x)},
     m_y {std::move(p_move.m_y)},
     m_z {std::move(p_move.m_z)}
@@ -728,6 +728,28 @@ FORCEINLINE float   Vector3::GetAbsMin              ()
 
 }
 
+/**
+ * Gets a normalized copy of the vector like GetSafeNormalized, using Math::FastInvSqrt.
+ * Its magnitude is only as close to 1 as the error of FastInvSqrt allows, for callers that can tolerate it.
+ *
+ * @param p_tolerance   Minimum squared vector length.
+
+ * @return              A normalized copy if safe, (0,0,0) otherwise.
+ */
+FORCEINLINE Vector3 Vector3::GetFastSafeNormalized  (float const    p_tolerance)                const
+{
+    float const magnitudeSquared    {m_x*m_x + m_y*m_y + m_z*m_z};
+
+    if      (magnitudeSquared == 1.0f)
+        return *this;
+
+    else if (magnitudeSquared < p_tolerance)
+        return Vector3::Zero;
+
+    float const invMagnitude        {Math::FastInvSqrt(magnitudeSquared)};
+    return Vector3(m_x * invMagnitude, m_y * invMagnitude, m_z * invMagnitude);
+}
+
 /**
  * Get the magnitude (length) of this vector.
  *
@@ -753,7 +775,7 @@ FORCEINLINE float   Vector3::GetMagnitude2D         ()
  *
  * @return The squared magnitude of this vector.
  */
-FORCEINLINE float   Vector3::GetMagnitudeSquared    ()                                          const
+CONSTEXPR FORCEINLINE float   Vector3::GetMagnitudeSquared    ()                                          const
 {
     return  m_x*m_x + m_y*m_y + m_z*m_z;
 }
@@ -812,7 +834,7 @@ FORCEINLINE Vector3 Vector3::GetSign                ()
 
  * @return              A normalized copy if safe, (0,0,0) otherwise.
  */
-FORCEINLINE Vector3 Vector3::GetSafeNormalized      (float const    p_tolerance)                const
+CONSTEXPR FORCEINLINE Vector3 Vector3::GetSafeNormalized      (float const    p_tolerance)                const
 {
     float const magnitudeSquared    {m_x*m_x + m_y*m_y + m_z*m_z};
 
@@ -1009,7 +1031,7 @@ FORCEINLINE void    Vector3::ToDirectionAndLength   (Vector3&       p_outDirecti
  * @return          True    if the vectors are equal.
  * @return          False   if the vectors are different.
  */
-FORCEINLINE bool        Vector3::operator== (Vector3 const& p_vector)   const
+CONSTEXPR FORCEINLINE bool        Vector3::operator== (Vector3 const& p_vector)   const
 {
     return m_x == p_vector.m_x && m_y == p_vector.m_y && m_z == p_vector.m_z;
 }
@@ -1022,7 +1044,7 @@ FORCEINLINE bool        Vector3::operator== (Vector3 const& p_vector)   const
   * @return          True    if the vectors are different.
   * @return          False   if the vectors are equal.
   */
-FORCEINLINE bool        Vector3::operator!= (Vector3 const& p_vector)   const
+CONSTEXPR FORCEINLINE bool        Vector3::operator!= (Vector3 const& p_vector)   const
 {
     return m_x != p_vector.m_x || m_y != p_vector.m_y || m_z != p_vector.m_z;
 }
@@ -1034,7 +1056,7 @@ FORCEINLINE bool        Vector3::operator!= (Vector3 const& p_vector)   const
  *
  * @return          The reference to vector after copy.
  */
-FORCEINLINE Vector3&    Vector3::operator=  (Vector3 const& p_copy)
+CONSTEXPR FORCEINLINE Vector3&    Vector3::operator=  (Vector3 const& p_copy)
 {
     m_x = p_copy.m_x;
     m_y = p_copy.m_y;
@@ -1050,7 +1072,7 @@ FORCEINLINE Vector3&    Vector3::operator=  (Vector3 const& p_copy)
  *
  * @return          The reference to vector after move.
  */
-FORCEINLINE Vector3&    Vector3::operator=  (Vector3&&      p_move)
+CONSTEXPR FORCEINLINE Vector3&    Vector3::operator=  (Vector3&&      p_move)
 {
     m_x = std::move(p_move.m_x);
     m_y = std::move(p_move.m_y);
@@ -1106,7 +1128,7 @@ FORCEINLINE float&      Vector3::operator[] (int32 const    p_index)
  *
  * @return          The result of vector addition.
  */
-FORCEINLINE Vector3     Vector3::operator+  (Vector3 const& p_vector)   const
+CONSTEXPR FORCEINLINE Vector3     Vector3::operator+  (Vector3 const& p_vector)   const
 {
     return Vector3
     (
@@ -1123,7 +1145,7 @@ FORCEINLINE Vector3     Vector3::operator+  (Vector3 const& p_vector)   const
  *
  * @return          The result of addition.
  */
-FORCEINLINE Vector3     Vector3::operator+  (float const    p_value)    const
+CONSTEXPR FORCEINLINE Vector3     Vector3::operator+  (float const    p_value)    const
 {
     return Vector3
     (
@@ -1141,7 +1163,7 @@ FORCEINLINE Vector3     Vector3::operator+  (float const    p_value)    const
  *
  * @return          Copy of the vector after addition.
  */
-FORCEINLINE Vector3&    Vector3::operator+= (Vector3 const& p_vector)
+CONSTEXPR FORCEINLINE Vector3&    Vector3::operator+= (Vector3 const& p_vector)
 {
     m_x += p_vector.m_x;
     m_y += p_vector.m_y;
@@ -1157,7 +1179,7 @@ FORCEINLINE Vector3&    Vector3::operator+= (Vector3 const& p_vector)
   *
   * @return          The reference of the vector after addition.
   */
-FORCEINLINE Vector3&    Vector3::operator+= (float const    p_value)
+CONSTEXPR FORCEINLINE Vector3&    Vector3::operator+= (float const    p_value)
 {
     m_x += p_value;
     m_y += p_value;
@@ -1171,7 +1193,7 @@ FORCEINLINE Vector3&    Vector3::operator+= (float const    p_value)
  *
  * @return          A negated copy of the vector.
  */
-FORCEINLINE Vector3     Vector3::operator-  ()                          const
+CONSTEXPR FORCEINLINE Vector3     Vector3::operator-  ()                          const
 {
     return Vector3(-m_x, -m_y, -m_z);
 }
@@ -1183,7 +1205,7 @@ FORCEINLINE Vector3     Vector3::operator-  ()                          const
  *
  * @return          The result of vector subtraction.
  */
-FORCEINLINE Vector3     Vector3::operator-  (Vector3 const& p_vector)   const
+CONSTEXPR FORCEINLINE Vector3     Vector3::operator-  (Vector3 const& p_vector)   const
 {
     return Vector3
     (
@@ -1200,7 +1222,7 @@ FORCEINLINE Vector3     Vector3::operator-  (Vector3 const& p_vector)   const
  *
  * @return          The result of subtraction.
  */
-FORCEINLINE Vector3     Vector3::operator-  (float const    p_value)    const
+CONSTEXPR FORCEINLINE Vector3     Vector3::operator-  (float const    p_value)    const
 {
     return Vector3
     (
@@ -1218,7 +1240,7 @@ FORCEINLINE Vector3     Vector3::operator-  (float const    p_value)    const
  *
  * @return          The reference of the vector after subtraction.
  */
-FORCEINLINE Vector3&    Vector3::operator-= (Vector3 const& p_vector)
+CONSTEXPR FORCEINLINE Vector3&    Vector3::operator-= (Vector3 const& p_vector)
 {
     m_x -= p_vector.m_x;
     m_y -= p_vector.m_y;
@@ -1234,7 +1256,7 @@ FORCEINLINE Vector3&    Vector3::operator-= (Vector3 const& p_vector)
  *
  * @return          The reference of the vector after subtraction.
  */
-FORCEINLINE Vector3&    Vector3::operator-= (float const    p_value)
+CONSTEXPR FORCEINLINE Vector3&    Vector3::operator-= (float const    p_value)
 {
     m_x -= p_value;
     m_y -= p_value;
@@ -1250,7 +1272,7 @@ FORCEINLINE Vector3&    Vector3::operator-= (float const    p_value)
  *
  * @return          The result of multiplication.
  */
-FORCEINLINE Vector3     Vector3::operator*  (Vector3 const& p_vector)   const
+CONSTEXPR FORCEINLINE Vector3     Vector3::operator*  (Vector3 const& p_vector)   const
 {
     return Vector3
     (
@@ -1267,7 +1289,7 @@ FORCEINLINE Vector3     Vector3::operator*  (Vector3 const& p_vector)   const
  *
  * @return          The result of multiplication.
  */
-FORCEINLINE Vector3     Vector3::operator*  (float const    p_scale)    const
+CONSTEXPR FORCEINLINE Vector3     Vector3::operator*  (float const    p_scale)    const
 {
     return Vector3
     (
@@ -1284,7 +1306,7 @@ FORCEINLINE Vector3     Vector3::operator*  (float const    p_scale)    const
  *
  * @return          The reference of the vector after multiplication.
  */
-FORCEINLINE Vector3&    Vector3::operator*= (Vector3 const& p_vector)
+CONSTEXPR FORCEINLINE Vector3&    Vector3::operator*= (Vector3 const& p_vector)
 {
     m_x *= p_vector.m_x;
     m_y *= p_vector.m_y;
@@ -1301,7 +1323,7 @@ FORCEINLINE Vector3&    Vector3::operator*= (Vector3 const& p_vector)
  *
  * @return          The reference of the vector after multiplication.
  */
-FORCEINLINE Vector3&    Vector3::operator*= (float const    p_scale)
+CONSTEXPR FORCEINLINE Vector3&    Vector3::operator*= (float const    p_scale)
 {
     m_x *= p_scale;
     m_y *= p_scale;
@@ -1317,7 +1339,7 @@ FORCEINLINE Vector3&    Vector3::operator*= (float const    p_scale)
  *
  * @return          The result of division.
  */
-FORCEINLINE Vector3     Vector3::operator/  (Vector3 const& p_vector)   const
+CONSTEXPR FORCEINLINE Vector3     Vector3::operator/  (Vector3 const& p_vector)   const
 {
     return Vector3
     (   
@@ -1334,7 +1356,7 @@ FORCEINLINE Vector3     Vector3::operator/  (Vector3 const& p_vector)   const
  *
  * @return          The result of division.
  */
-FORCEINLINE Vector3     Vector3::operator/  (float const    p_scale)    const
+CONSTEXPR FORCEINLINE Vector3     Vector3::operator/  (float const    p_scale)    const
 {
     return Vector3
     (
@@ -1351,7 +1373,7 @@ FORCEINLINE Vector3     Vector3::operator/  (float const    p_scale)    const
  *
  * @return          The reference of the vector after division.
  */
-FORCEINLINE Vector3&    Vector3::operator/= (Vector3 const& p_vector)
+CONSTEXPR FORCEINLINE Vector3&    Vector3::operator/= (Vector3 const& p_vector)
 {
     m_x /= p_vector.m_x;
     m_y /= p_vector.m_y;
@@ -1368,7 +1390,7 @@ FORCEINLINE Vector3&    Vector3::operator/= (Vector3 const& p_vector)
  *
  * @return          The reference of the vector after division.
  */
-FORCEINLINE Vector3&    Vector3::operator/= (float const    p_scale)
+CONSTEXPR FORCEINLINE Vector3&    Vector3::operator/= (float const    p_scale)
 {
     m_x /= p_scale;
     m_y /= p_scale;
@@ -1384,7 +1406,7 @@ FORCEINLINE Vector3&    Vector3::operator/= (float const    p_scale)
  *
  * @return          The result of cross product.
  */
-FORCEINLINE Vector3     Vector3::operator^  (Vector3 const& p_vector)   const
+CONSTEXPR FORCEINLINE Vector3     Vector3::operator^  (Vector3 const& p_vector)   const
 {
     return Vector3
     (   
@@ -1401,7 +1423,7 @@ FORCEINLINE Vector3     Vector3::operator^  (Vector3 const& p_vector)   const
  *
  * @return          The result of dot product.
  */
-FORCEINLINE float       Vector3::operator|  (Vector3 const& p_vector)   const
+CONSTEXPR FORCEINLINE float       Vector3::operator|  (Vector3 const& p_vector)   const
 {
     return m_x*p_vector.m_x + m_y*p_vector.m_y + m_z*p_vector.m_z;
 }
@@ -1416,8 +1438,8 @@ FORCEINLINE float       Vector3::operator|  (Vector3 const& p_vector)   const
  *
  * @return          The result of addition.
  */
-FORCEINLINE Vector3 operator+   (float const    p_value,
-                                 Vector3 const& p_vector)
+CONSTEXPR FORCEINLINE Vector3 operator+   (float const    p_value,
+                                           Vector3 const& p_vector)
 {
     return Vector3
     (
@@ -1435,8 +1457,8 @@ FORCEINLINE Vector3 operator+   (float const    p_value,
  *
  * @return          The result of multiplication.
  */
-FORCEINLINE Vector3 operator*   (float const    p_scale,
-                                 Vector3 const& p_vector)
+CONSTEXPR FORCEINLINE Vector3 operator*   (float const    p_scale,
+                                           Vector3 const& p_vector)
 {
     return Vector3
     (
@@ -0,0 +1,120 @@
+#ifndef __MATH_VECTOR_3A_HPP__
+#define __MATH_VECTOR_3A_HPP__
+
+#include "SIMD.hpp"
+#include "Vector3.hpp"
+
+/**
+ * A 16-byte aligned vector in 3-D space composed of components (X, Y, Z) with floating point precision.
+ *
+ * Vector3 stays 12 bytes because it is serialized and packed in vertex data, which makes its SIMD loads slower than the scalar code.
+ * Vector3A trades 4 bytes of padding for full aligned loads, prefer it for hot containers (Positions to sort, bounds to cull, ...)
+ * and convert back to Vector3 at the boundaries. The padding lane (W) is unspecified and ignored by every operation.
+ */
+struct alignas(16) Vector3A
+{
+    //=========================[Public Static Methods]=========================//
+
+        static  FORCEINLINE Vector3A    Cross           (Vector3A const&    p_a,
+                                                         Vector3A const&    p_b);
+
+        static  FORCEINLINE float       Distance        (Vector3A const&    p_a,
+                                                         Vector3A const&    p_b);
+
+        static  FORCEINLINE float       DistanceSquared (Vector3A const&    p_a,
+                                                         Vector3A const&    p_b);
+
+        static  FORCEINLINE float       Dot             (Vector3A const&    p_a,
+                                                         Vector3A const&    p_b);
+
+        static  FORCEINLINE Vector3A    Lerp            (Vector3A const&    p_a,
+                                                         Vector3A const&    p_b,
+                                                         float const        p_alpha);
+
+        static  FORCEINLINE Vector3A    Max             (Vector3A const&    p_a,
+                                                         Vector3A const&    p_b);
+
+        static  FORCEINLINE Vector3A    Min             (Vector3A const&    p_a,
+                                                         Vector3A const&    p_b);
+
+    //=========================[Public Local Properties]=========================//
+
+        /** Vector's X component. */
+        float   m_x;
+
+        /** Vector's Y component. */
+        float   m_y;
+
+        /** Vector's Z component. */
+        float   m_z;
+
+        /** Padding, only there to fill the register. */
+        float   m_w;
+
+    //=========================[Constructor + Destructor]=========================//
+
+        FORCEINLINE             Vector3A    ();
+
+        FORCEINLINE             Vector3A    (float const        p_value);
+
+        FORCEINLINE             Vector3A    (float const        p_x,
+                                             float const        p_y,
+                                             float const        p_z);
+
+        FORCEINLINE explicit    Vector3A    (Vector3 const&     p_vector);
+
+                                Vector3A    (Vector3A const&    p_copy) = default;
+
+                                ~Vector3A   ()                          = default;
+
+    //=========================[Public Local Methods]=========================//
+
+        FORCEINLINE float       GetMagnitude        ()                                              const;
+
+        FORCEINLINE float       GetMagnitudeSquared ()                                              const;
+
+        FORCEINLINE Vector3A    GetSafeNormalized   (float const    p_tolerance = MATH_EPSILON_F)   const;
+
+        FORCEINLINE Vector3A    GetUnsafeNormalized ()                                              const;
+
+        FORCEINLINE bool        Normalize           (float const    p_tolerance = MATH_EPSILON_F);
+
+        FORCEINLINE Vector3     ToVector3           ()                                              const;
+
+    //===========================[Public Local Operators]=========================//
+
+        FORCEINLINE bool        operator==  (Vector3A const&    p_vector)   const;
+        FORCEINLINE bool        operator!=  (Vector3A const&    p_vector)   const;
+
+                    Vector3A&   operator=   (Vector3A const&    p_copy)     = default;
+
+        FORCEINLINE Vector3A    operator+   (Vector3A const&    p_vector)   const;
+        FORCEINLINE Vector3A&   operator+=  (Vector3A const&    p_vector);
+
+        FORCEINLINE Vector3A    operator-   ()                              const;
+        FORCEINLINE Vector3A    operator-   (Vector3A const&    p_vector)   const;
+        FORCEINLINE Vector3A&   operator-=  (Vector3A const&    p_vector);
+
+        FORCEINLINE Vector3A    operator*   (Vector3A const&    p_vector)   const;
+        FORCEINLINE Vector3A    operator*   (float const        p_scale)    const;
+        FORCEINLINE Vector3A&   operator*=  (Vector3A const&    p_vector);
+        FORCEINLINE Vector3A&   operator*=  (float const        p_scale);
+
+        FORCEINLINE Vector3A    operator/   (Vector3A const&    p_vector)   const;
+        FORCEINLINE Vector3A    operator/   (float const        p_scale)    const;
+        FORCEINLINE Vector3A&   operator/=  (Vector3A const&    p_vector);
+        FORCEINLINE Vector3A&   operator/=  (float const        p_scale);
+
+        FORCEINLINE Vector3A    operator^   (Vector3A const&    p_vector)   const;
+        FORCEINLINE float       operator|   (Vector3A const&    p_vector)   const;
+
+}; // !struct Vector3A
+
+/*==============================[Public Globale Operators]==============================*/
+
+    FORCEINLINE Vector3A operator*  (float const        p_scale,
+                                     Vector3A const&    p_vector);
+
+#include "Vector3A.inl"
+
+#endif // !__MATH_VECTOR_3A_HPP__
\ No newline at end of file
@@ -0,0 +1,622 @@
+#ifndef __MATH_VECTOR_3A_INL__
+#define __MATH_VECTOR_3A_INL__
+
+/*==============================[Public Static Methods]==============================*/
+
+/**
+ * Computes the cross product of two vectors.
+ *
+ * @param p_a   The first vector.
+ * @param p_b   The second vector.
+ *
+ * @return      The result of cross product.
+ */
+FORCEINLINE Vector3A    Vector3A::Cross             (Vector3A const&    p_a,
+                                                     Vector3A const&    p_b)
+{
+#if defined(MATH_SIMD_SSE4)
+
+    Vector3A result;
+
+    _mm_store_ps(&result.m_x, SIMD::Cross3(_mm_load_ps(&p_a.m_x), _mm_load_ps(&p_b.m_x)));
+
+    return result;
+
+#else
+
+    return Vector3A
+    (
+        p_a.m_y * p_b.m_z - p_a.m_z * p_b.m_y,
+        p_a.m_z * p_b.m_x - p_a.m_x * p_b.m_z,
+        p_a.m_x * p_b.m_y - p_a.m_y * p_b.m_x
+    );
+
+#endif
+}
+
+/**
+ * Computes the distance between two points.
+ *
+ * @param p_a   The first point.
+ * @param p_b   The second point.
+ *
+ * @return      The distance between two points.
+ */
+FORCEINLINE float       Vector3A::Distance          (Vector3A const&    p_a,
+                                                     Vector3A const&    p_b)
+{
+    return Math::Sqrt(Vector3A::DistanceSquared(p_a, p_b));
+}
+
+/**
+ * Computes the squared distance between two points, cheaper than Distance and enough to compare distances.
+ *
+ * @param p_a   The first point.
+ * @param p_b   The second point.
+ *
+ * @return      The squared distance between two points.
+ */
+FORCEINLINE float       Vector3A::DistanceSquared   (Vector3A const&    p_a,
+                                                     Vector3A const&    p_b)
+{
+#if defined(MATH_SIMD_SSE4)
+
+    __m128 const difference {_mm_sub_ps(_mm_load_ps(&p_a.m_x), _mm_load_ps(&p_b.m_x))};
+
+    return _mm_cvtss_f32(SIMD::Dot3(difference, difference));
+
+#else
+
+    return Math::Square(p_a.m_x-p_b.m_x) + Math::Square(p_a.m_y-p_b.m_y) + Math::Square(p_a.m_z-p_b.m_z);
+
+#endif
+}
+
+/**
+ * Computes the dot product of two vectors.
+ *
+ * @param p_a   The first vector.
+ * @param p_b   The second vector.
+ *
+ * @return      The result of dot product.
+ */
+FORCEINLINE float       Vector3A::Dot               (Vector3A const&    p_a,
+                                                     Vector3A const&    p_b)
+{
+    return p_a | p_b;
+}
+
+/**
+ * Linearly interpolates between two vectors.
+ *
+ * @param p_a       The start vector, returned when p_alpha is 0.
+ * @param p_b       The end vector, returned when p_alpha is 1.
+ * @param p_alpha   The interpolation value.
+ *
+ * @return          The interpolated vector.
+ */
+FORCEINLINE Vector3A    Vector3A::Lerp              (Vector3A const&    p_a,
+                                                     Vector3A const&    p_b,
+                                                     float const        p_alpha)
+{
+    return p_a + p_alpha * (p_b - p_a);
+}
+
+/**
+ * Computes a vector made from the largest components of two vectors.
+ *
+ * @param p_a   The first vector.
+ * @param p_b   The second vector.
+ *
+ * @return      The component-wise maximum.
+ */
+FORCEINLINE Vector3A    Vector3A::Max               (Vector3A const&    p_a,
+                                                     Vector3A const&    p_b)
+{
+#if defined(MATH_SIMD_SSE4)
+
+    Vector3A result;
+
+    _mm_store_ps(&result.m_x, _mm_max_ps(_mm_load_ps(&p_a.m_x), _mm_load_ps(&p_b.m_x)));
+
+    return result;
+
+#else
+
+    return Vector3A(Math::Max(p_a.m_x, p_b.m_x), Math::Max(p_a.m_y, p_b.m_y), Math::Max(p_a.m_z, p_b.m_z));
+
+#endif
+}
+
+/**
+ * Computes a vector made from the smallest components of two vectors.
+ *
+ * @param p_a   The first vector.
+ * @param p_b   The second vector.
+ *
+ * @return      The component-wise minimum.
+ */
+FORCEINLINE Vector3A    Vector3A::Min               (Vector3A const&    p_a,
+                                                     Vector3A const&    p_b)
+{
+#if defined(MATH_SIMD_SSE4)
+
+    Vector3A result;
+
+    _mm_store_ps(&result.m_x, _mm_min_ps(_mm_load_ps(&p_a.m_x), _mm_load_ps(&p_b.m_x)));
+
+    return result;
+
+#else
+
+    return Vector3A(Math::Min(p_a.m_x, p_b.m_x), Math::Min(p_a.m_y, p_b.m_y), Math::Min(p_a.m_z, p_b.m_z));
+
+#endif
+}
+
+/*==============================[Constructors + Destructor]==============================*/
+
+/** Default constructor, all components are initialized to 0.0f */
+FORCEINLINE Vector3A::Vector3A  ()
+:   m_x {0.0f},
+    m_y {0.0f},
+    m_z {0.0f},
+    m_w {0.0f}
+{}
+
+/**
+ * Constructor initializing all components to a single float value.
+ *
+ * @param p_value   Value to set all components to.
+ */
+FORCEINLINE Vector3A::Vector3A  (float const        p_value)
+:   m_x {p_value},
+    m_y {p_value},
+    m_z {p_value},
+    m_w {0.0f}
+{}
+
+/**
+ * Constructor using initial values for each component.
+ *
+ * @param p_x   X coordinate.
+ * @param p_y   Y coordinate.
+ * @param p_z   Z coordinate.
+ */
+FORCEINLINE Vector3A::Vector3A  (float const        p_x,
+                                 float const        p_y,
+                                 float const        p_z)
+:   m_x {p_x},
+    m_y {p_y},
+    m_z {p_z},
+    m_w {0.0f}
+{}
+
+/**
+ * Constructor copying a packed vector.
+ *
+ * @param p_vector  The vector to copy.
+ */
+FORCEINLINE Vector3A::Vector3A  (Vector3 const&     p_vector)
+:   m_x {p_vector.m_x},
+    m_y {p_vector.m_y},
+    m_z {p_vector.m_z},
+    m_w {0.0f}
+{}
+
+/*==============================[Public Local Methods]==============================*/
+
+/**
+ * Get the magnitude of this vector.
+ *
+ * @return The magnitude of this vector.
+ */
+FORCEINLINE float       Vector3A::GetMagnitude          ()                              const
+{
+    return Math::Sqrt(GetMagnitudeSquared());
+}
+
+/**
+ * Get the squared magnitude of this vector.
+ *
+ * @return The squared magnitude of this vector.
+ */
+FORCEINLINE float       Vector3A::GetMagnitudeSquared   ()                              const
+{
+    return *this | *this;
+}
+
+/**
+ * Gets a normalized copy of the vector, checking it is safe to do so based on the length.
+ * Returns zero vector if vector length is too small to safely normalize.
+ *
+ * @param p_tolerance   Minimum squared vector length.
+ *
+ * @return              A normalized copy if safe, (0,0,0) otherwise.
+ */
+FORCEINLINE Vector3A    Vector3A::GetSafeNormalized     (float const    p_tolerance)    const
+{
+    float const magnitudeSquared {GetMagnitudeSquared()};
+
+    if      (magnitudeSquared == 1.0f)
+        return *this;
+
+    else if (magnitudeSquared < p_tolerance)
+        return Vector3A();
+
+    return *this / Math::Sqrt(magnitudeSquared);
+}
+
+/**
+ * Calculates normalized version of vector without checking for zero length.
+ *
+ * @return Normalized version of vector.
+ */
+FORCEINLINE Vector3A    Vector3A::GetUnsafeNormalized   ()                              const
+{
+    return *this / GetMagnitude();
+}
+
+/**
+ * Normalize this vector in-place if it is larger than a given tolerance. Leaves it unchanged if not.
+ *
+ * @param p_tolerance   The minimum squared length of vector for normalization.
+ *
+ * @return              True if the vector was normalized correctly, false otherwise.
+ */
+FORCEINLINE bool        Vector3A::Normalize             (float const    p_tolerance)
+{
+    float const magnitudeSquared {GetMagnitudeSquared()};
+
+    // Same test as Vector3, a NaN magnitude leaves the vector unchanged.
+    if (!(magnitudeSquared > p_tolerance))
+        return false;
+
+    *this *= Math::InvSqrt(magnitudeSquared);
+
+    return true;
+}
+
+/**
+ * Converts this vector to a packed vector.
+ *
+ * @return The packed copy of this vector.
+ */
+FORCEINLINE Vector3     Vector3A::ToVector3             ()                              const
+{
+    return Vector3(m_x, m_y, m_z);
+}
+
+/*==============================[Public Local Operators]==============================*/
+
+/**
+ * Check against another vector for equality, the padding lane is ignored.
+ *
+ * @param p_vector  The vector to check against.
+ *
+ * @return          True if the vectors are equal, false otherwise.
+ */
+FORCEINLINE bool        Vector3A::operator==    (Vector3A const&    p_vector)   const
+{
+#if defined(MATH_SIMD_SSE4)
+
+    return (_mm_movemask_ps(_mm_cmpeq_ps(_mm_load_ps(&m_x), _mm_load_ps(&p_vector.m_x))) & 0b0111) == 0b0111;
+
+#else
+
+    return m_x == p_vector.m_x && m_y == p_vector.m_y && m_z == p_vector.m_z;
+
+#endif
+}
+
+/**
+ * Check against another vector for inequality, the padding lane is ignored.
+ *
+ * @param p_vector  The vector to check against.
+ *
+ * @return          True if the vectors are different, false otherwise.
+ */
+FORCEINLINE bool        Vector3A::operator!=    (Vector3A const&    p_vector)   const
+{
+    return !(*this == p_vector);
+}
+
+/**
+ * Gets the result of component-wise addition of this and another vector.
+ *
+ * @param p_vector  The other vector.
+ *
+ * @return          The result of addition.
+ */
+FORCEINLINE Vector3A    Vector3A::operator+     (Vector3A const&    p_vector)   const
+{
+#if defined(MATH_SIMD_SSE4)
+
+    Vector3A result;
+
+    _mm_store_ps(&result.m_x, _mm_add_ps(_mm_load_ps(&m_x), _mm_load_ps(&p_vector.m_x)));
+
+    return result;
+
+#else
+
+    return Vector3A(m_x + p_vector.m_x, m_y + p_vector.m_y, m_z + p_vector.m_z);
+
+#endif
+}
+
+/**
+ * Adds this vector by another, component-wise.
+ *
+ * @param p_vector  The other vector.
+ *
+ * @return          A reference to this after the operation.
+ */
+FORCEINLINE Vector3A&   Vector3A::operator+=    (Vector3A const&    p_vector)
+{
+    *this = *this + p_vector;
+
+    return *this;
+}
+
+/**
+ * Gets a negated copy of this vector.
+ *
+ * @return  A negated copy of this vector.
+ */
+FORCEINLINE Vector3A    Vector3A::operator-     ()                              const
+{
+#if defined(MATH_SIMD_SSE4)
+
+    Vector3A result;
+
+    _mm_store_ps(&result.m_x, _mm_xor_ps(_mm_load_ps(&m_x), _mm_set1_ps(-0.0f)));
+
+    return result;
+
+#else
+
+    return Vector3A(-m_x, -m_y, -m_z);
+
+#endif
+}
+
+/**
+ * Gets the result of component-wise subtraction of this by another vector.
+ *
+ * @param p_vector  The other vector.
+ *
+ * @return          The result of subtraction.
+ */
+FORCEINLINE Vector3A    Vector3A::operator-     (Vector3A const&    p_vector)   const
+{
+#if defined(MATH_SIMD_SSE4)
+
+    Vector3A result;
+
+    _mm_store_ps(&result.m_x, _mm_sub_ps(_mm_load_ps(&m_x), _mm_load_ps(&p_vector.m_x)));
+
+    return result;
+
+#else
+
+    return Vector3A(m_x - p_vector.m_x, m_y - p_vector.m_y, m_z - p_vector.m_z);
+
+#endif
+}
+
+/**
+ * Subtracts this vector by another, component-wise.
+ *
+ * @param p_vector  The other vector.
+ *
+ * @return          A reference to this after the operation.
+ */
+FORCEINLINE Vector3A&   Vector3A::operator-=    (Vector3A const&    p_vector)
+{
+    *this = *this - p_vector;
+
+    return *this;
+}
+
+/**
+ * Gets the result of component-wise multiplication of this vector by another.
+ *
+ * @param p_vector  The other vector.
+ *
+ * @return          The result of multiplication.
+ */
+FORCEINLINE Vector3A    Vector3A::operator*     (Vector3A const&    p_vector)   const
+{
+#if defined(MATH_SIMD_SSE4)
+
+    Vector3A result;
+
+    _mm_store_ps(&result.m_x, _mm_mul_ps(_mm_load_ps(&m_x), _mm_load_ps(&p_vector.m_x)));
+
+    return result;
+
+#else
+
+    return Vector3A(m_x * p_vector.m_x, m_y * p_vector.m_y, m_z * p_vector.m_z);
+
+#endif
+}
+
+/**
+ * Gets the result of scaling this vector.
+ *
+ * @param p_scale   The scaling factor.
+ *
+ * @return          The result of scaling.
+ */
+FORCEINLINE Vector3A    Vector3A::operator*     (float const        p_scale)    const
+{
+#if defined(MATH_SIMD_SSE4)
+
+    Vector3A result;
+
+    _mm_store_ps(&result.m_x, _mm_mul_ps(_mm_load_ps(&m_x), _mm_set1_ps(p_scale)));
+
+    return result;
+
+#else
+
+    return Vector3A(m_x * p_scale, m_y * p_scale, m_z * p_scale);
+
+#endif
+}
+
+/**
+ * Multiplies this vector by another, component-wise.
+ *
+ * @param p_vector  The other vector.
+ *
+ * @return          A reference to this after the operation.
+ */
+FORCEINLINE Vector3A&   Vector3A::operator*=    (Vector3A const&    p_vector)
+{
+    *this = *this * p_vector;
+
+    return *this;
+}
+
+/**
+ * Scales this vector by a scaling factor.
+ *
+ * @param p_scale   The scaling factor.
+ *
+ * @return          A reference to this after the operation.
+ */
+FORCEINLINE Vector3A&   Vector3A::operator*=    (float const        p_scale)
+{
+    *this = *this * p_scale;
+
+    return *this;
+}
+
+/**
+ * Gets the result of component-wise division of this vector by another.
+ *
+ * @param p_vector  The other vector.
+ *
+ * @return          The result of division.
+ */
+FORCEINLINE Vector3A    Vector3A::operator/     (Vector3A const&    p_vector)   const
+{
+#if defined(MATH_SIMD_SSE4)
+
+    Vector3A result;
+
+    _mm_store_ps(&result.m_x, _mm_div_ps(_mm_load_ps(&m_x), _mm_load_ps(&p_vector.m_x)));
+
+    return result;
+
+#else
+
+    return Vector3A(m_x / p_vector.m_x, m_y / p_vector.m_y, m_z / p_vector.m_z);
+
+#endif
+}
+
+/**
+ * Gets the result of dividing this vector by a scaling factor.
+ *
+ * @param p_scale   The scaling factor.
+ *
+ * @return          The result of division.
+ */
+FORCEINLINE Vector3A    Vector3A::operator/     (float const        p_scale)    const
+{
+#if defined(MATH_SIMD_SSE4)
+
+    Vector3A result;
+
+    _mm_store_ps(&result.m_x, _mm_div_ps(_mm_load_ps(&m_x), _mm_set1_ps(p_scale)));
+
+    return result;
+
+#else
+
+    return Vector3A(m_x / p_scale, m_y / p_scale, m_z / p_scale);
+
+#endif
+}
+
+/**
+ * Divides this vector by another, component-wise.
+ *
+ * @param p_vector  The other vector.
+ *
+ * @return          A reference to this after the operation.
+ */
+FORCEINLINE Vector3A&   Vector3A::operator/=    (Vector3A const&    p_vector)
+{
+    *this = *this / p_vector;
+
+    return *this;
+}
+
+/**
+ * Divides this vector by a scaling factor.
+ *
+ * @param p_scale   The scaling factor.
+ *
+ * @return          A reference to this after the operation.
+ */
+FORCEINLINE Vector3A&   Vector3A::operator/=    (float const        p_scale)
+{
+    *this = *this / p_scale;
+
+    return *this;
+}
+
+/**
+ * Computes the cross product of this and another vector.
+ *
+ * @param p_vector  The other vector.
+ *
+ * @return          The result of cross product.
+ */
+FORCEINLINE Vector3A    Vector3A::operator^     (Vector3A const&    p_vector)   const
+{
+    return Vector3A::Cross(*this, p_vector);
+}
+
+/**
+ * Computes the dot product of this and another vector.
+ *
+ * @param p_vector  The other vector.
+ *
+ * @return          The result of dot product.
+ */
+FORCEINLINE float       Vector3A::operator|     (Vector3A const&    p_vector)   const
+{
+#if defined(MATH_SIMD_SSE4)
+
+    return _mm_cvtss_f32(SIMD::Dot3(_mm_load_ps(&m_x), _mm_load_ps(&p_vector.m_x)));
+
+#else
+
+    return m_x*p_vector.m_x + m_y*p_vector.m_y + m_z*p_vector.m_z;
+
+#endif
+}
+
+/*==============================[Public Globale Operators]==============================*/
+
+/**
+ * Gets the result of scaling a vector.
+ *
+ * @param p_scale   The scaling factor.
+ * @param p_vector  The vector to scale.
+ *
+ * @return          The result of scaling.
+ */
+FORCEINLINE Vector3A    operator*   (float const        p_scale,
+                                     Vector3A const&    p_vector)
+{
+    return p_vector * p_scale;
+}
+
+#endif // !__MATH_VECTOR_3A_INL__
\ No newline at end of file
@@ -1,6 +1,7 @@
 #ifndef __MATH_VECTOR_4_HPP__
 #define __MATH_VECTOR_4_HPP__
 
+#include "SIMD.hpp"
 #include "Vector3.hpp"
 
 /**
@@ -79,33 +80,33 @@ struct ENGINE_API Vector4
 
     //=========================[Constructor + Destructor]=========================//
        
-        FORCEINLINE Vector4     ();
+        CONSTEXPR FORCEINLINE Vector4     ();
 
-        FORCEINLINE Vector4     (float const    p_value);
+        CONSTEXPR FORCEINLINE Vector4     (float const    p_value);
 
-        FORCEINLINE Vector4     (float const    p_x,
-                                 float const    p_y, 
-                                 float const    p_z = 0.0f,
-                                 float const    m_w = 0.0f);
+        CONSTEXPR FORCEINLINE Vector4     (float const    p_x,
+                                           float const    p_y, 
+                                           float const    p_z = 0.0f,
+                                           float const    m_w = 0.0f);
 
-        FORCEINLINE Vector4     (Vector2 const& p_vector2,
-                                 float const    p_z = 0.0f,
-                                 float const    p_w = 0.0f);
+        CONSTEXPR FORCEINLINE Vector4     (Vector2 const& p_vector2,
+                                           float const    p_z = 0.0f,
+                                           float const    p_w = 0.0f);
 
-        FORCEINLINE Vector4     (Vector3 const& p_vector3, 
-                                 float const    p_w = 0.0f);
+        CONSTEXPR FORCEINLINE Vector4     (Vector3 const& p_vector3, 
+                                           float const    p_w = 0.0f);
 
-        FORCEINLINE Vector4     (Vector4 const& p_from, 
-                                 Vector4 const& p_to);
+        CONSTEXPR FORCEINLINE Vector4     (Vector4 const& p_from, 
+                                           Vector4 const& p_to);
 
-        FORCEINLINE Vector4     (Vector2 const& p_xy,
-                                 Vector2 const& p_zw);
+        CONSTEXPR FORCEINLINE Vector4     (Vector2 const& p_xy,
+                                           Vector2 const& p_zw);
 
-        FORCEINLINE Vector4     (Vector4 const& p_copy);
+        CONSTEXPR FORCEINLINE Vector4     (Vector4 const& p_copy);
 
-        FORCEINLINE Vector4     (Vector4&&      p_move);
+        CONSTEXPR FORCEINLINE Vector4     (Vector4&&      p_move);
 
-                    ~Vector4    ()   = default;
+                              ~Vector4    ()   = default;
 
     //=========================[Public Local Methods]=========================//
         
@@ -155,52 +156,54 @@ struct ENGINE_API Vector4
 
     //=========================[Public Local Operators]=========================//
         
-        FORCEINLINE bool        operator==  (Vector4 const& p_vector)   const;
-        FORCEINLINE bool        operator!=  (Vector4 const& p_vector)   const;
+        CONSTEXPR FORCEINLINE bool        operator==  (Vector4 const& p_vector)   const;
+        CONSTEXPR FORCEINLINE bool        operator!=  (Vector4 const& p_vector)   const;
 
-        FORCEINLINE Vector4&    operator=   (Vector4 const& p_copy);
-        FORCEINLINE Vector4&    operator=   (Vector3 const& p_copy);
-        FORCEINLINE Vector4&    operator=   (Vector2 const& p_copy);
+        CONSTEXPR FORCEINLINE Vector4&    operator=   (Vector4 const& p_copy);
+        CONSTEXPR FORCEINLINE Vector4&    operator=   (Vector3 const& p_copy);
+        CONSTEXPR FORCEINLINE Vector4&    operator=   (Vector2 const& p_copy);
 
-        FORCEINLINE Vector4&    operator=   (Vector4&&      p_move);
+        CONSTEXPR FORCEINLINE Vector4&    operator=   (Vector4&&      p_move);
 
-        FORCEINLINE float       operator[]  (int32 const    p_index)    const;
-        FORCEINLINE float&      operator[]  (int32 const    p_index);
+                  FORCEINLINE float       operator[]  (int32 const    p_index)    const;
+                  FORCEINLINE float&      operator[]  (int32 const    p_index);
 
-        FORCEINLINE Vector4     operator+   (Vector4 const& p_vector)   const;
-        FORCEINLINE Vector4     operator+   (float const    p_value)    const;
-        FORCEINLINE Vector4&    operator+=  (Vector4 const& p_vector);
-        FORCEINLINE Vector4&    operator+=  (float const    p_value);
+        CONSTEXPR FORCEINLINE Vector4     operator+   (Vector4 const& p_vector)   const;
+        CONSTEXPR FORCEINLINE Vector4     operator+   (float const    p_value)    const;
+        CONSTEXPR FORCEINLINE Vector4&    operator+=  (Vector4 const& p_vector);
+        CONSTEXPR FORCEINLINE Vector4&    operator+=  (float const    p_value);
 
-        FORCEINLINE Vector4     operator-   ()                          const;
-        FORCEINLINE Vector4     operator-   (Vector4 const& p_vector)   const;
-        FORCEINLINE Vector4     operator-   (float const    p_value)    const;
-        FORCEINLINE Vector4&    operator-=  (Vector4 const& p_vector);
-        FORCEINLINE Vector4&    operator-=  (float const    p_value);
+        CONSTEXPR FORCEINLINE Vector4     operator-   ()                          const;
+        CONSTEXPR FORCEINLINE Vector4     operator-   (Vector4 const& p_vector)   const;
+        CONSTEXPR FORCEINLINE Vector4     operator-   (float const    p_value)    const;
+        CONSTEXPR FORCEINLINE Vector4&    operator-=  (Vector4 const& p_vector);
+        CONSTEXPR FORCEINLINE Vector4&    operator-=  (float const    p_value);
 
-        FORCEINLINE Vector4     operator*   (Vector4 const& p_vector)   const;
-        FORCEINLINE Vector4     operator*   (float const    p_scale)    const;
-        FORCEINLINE Vector4&    operator*=  (Vector4 const& p_vector);
-        FORCEINLINE Vector4&    operator*=  (float const    p_scale);
+        CONSTEXPR FORCEINLINE Vector4     operator*   (Vector4 const& p_vector)   const;
+        CONSTEXPR FORCEINLINE Vector4     operator*   (float const    p_scale)    const;
+        CONSTEXPR FORCEINLINE Vector4&    operator*=  (Vector4 const& p_vector);
+        CONSTEXPR FORCEINLINE Vector4&    operator*=  (float const    p_scale);
 
-        FORCEINLINE Vector4     operator/   (Vector4 const& p_vector)   const;
-        FORCEINLINE Vector4     operator/   (float const    p_scale)    const;
-        FORCEINLINE Vector4&    operator/=  (Vector4 const& p_vector);
-        FORCEINLINE Vector4&    operator/=  (float const    p_scale);
+        CONSTEXPR FORCEINLINE Vector4     operator/   (Vector4 const& p_vector)   const;
+        CONSTEXPR FORCEINLINE Vector4     operator/   (float const    p_scale)    const;
+        CONSTEXPR FORCEINLINE Vector4&    operator/=  (Vector4 const& p_vector);
+        CONSTEXPR FORCEINLINE Vector4&    operator/=  (float const    p_scale);
 
-        FORCEINLINE float       operator|   (Vector4 const& p_vector)   const;
+                  FORCEINLINE float       operator|   (Vector4 const& p_vector)   const;
 
 }; // !struct Vector4
 
 /*==============================[Public Globale Operators]==============================*/
 
-    FORCEINLINE Vector4 operator+   (float const    p_value, 
-                                     Vector4 const& p_vector);
+    CONSTEXPR FORCEINLINE Vector4 operator+   (float const    p_value, 
+                                               Vector4 const& p_vector);
     
-    FORCEINLINE Vector4 operator*   (float const    p_scale,
-                                     Vector4 const& p_vector);
+    CONSTEXPR FORCEINLINE Vector4 operator*   (float const    p_scale,
+                                               Vector4 const& p_vector);
 
 #include "Vector4.inl"
-#include "Vector4.generated.hpp"
+#if __has_include("Vector4.generated.hpp")
+    #include "Vector4.generated.hpp"
+#endif
 
 #endif // !__MATH_VECTOR_4_HPP__
\ No newline at end of file
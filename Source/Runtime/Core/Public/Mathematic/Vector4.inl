@@ -14,7 +14,17 @@
 FORCEINLINE float   Vector4::Distance           (Vector4 const& p_a, 
                                                  Vector4 const& p_b)
 {
+#if defined(MATH_SIMD_SSE4)
+
+    __m128 const difference {_mm_sub_ps(_mm_loadu_ps(&p_a.m_x), _mm_loadu_ps(&p_b.m_x))};
+
+    return _mm_cvtss_f32(_mm_sqrt_ss(SIMD::Dot4(difference, difference)));
+
+#else
+
     return Math::Sqrt(Math::Square(p_a.m_x-p_b.m_x) + Math::Square(p_a.m_y-p_b.m_y) + Math::Square(p_a.m_z-p_b.m_z) + Math::Square(p_a.m_w-p_b.m_w));
+
+#endif
 }
 
 /**
@@ -28,7 +38,17 @@ FORCEINLINE float   Vector4::Distance           (Vector4 const& p_a,
 FORCEINLINE float   Vector4::DistanceSquared    (Vector4 const& p_a,
                                                  Vector4 const& p_b)
 {
+#if defined(MATH_SIMD_SSE4)
+
+    __m128 const difference {_mm_sub_ps(_mm_loadu_ps(&p_a.m_x), _mm_loadu_ps(&p_b.m_x))};
+
+    return _mm_cvtss_f32(SIMD::Dot4(difference, difference));
+
+#else
+
     return Math::Square(p_a.m_x-p_b.m_x) + Math::Square(p_a.m_y-p_b.m_y) + Math::Square(p_a.m_z-p_b.m_z) + Math::Square(p_a.m_w-p_b.m_w);
+
+#endif
 }
 
 /**
@@ -42,8 +62,15 @@ FORCEINLINE float   Vector4::DistanceSquared    (Vector4 const& p_a,
 FORCEINLINE float   Vector4::Dot                (Vector4 const& p_a,
                                                  Vector4 const& p_b)
 {
+#if defined(MATH_SIMD_SSE4)
+
+    return _mm_cvtss_f32(SIMD::Dot4(_mm_loadu_ps(&p_a.m_x), _mm_loadu_ps(&p_b.m_x)));
+
+#else
+
     return p_a.m_x*p_b.m_x + p_a.m_y*p_b.m_y + p_a.m_z*p_b.m_z + p_a.m_w*p_b.m_w;
 
+#endif
 }
 
 /**
@@ -166,7 +193,7 @@ FORCEINLINE Vector4 Vector4::ProjectOnNormal    (Vector4 const& p_vector,
 /*==============================[Constructors + Destructor]==============================*/
 
 /** Default constructor, all components are initialized to 0.0f */
-FORCEINLINE Vector4::Vector4    ()
+CONSTEXPR FORCEINLINE Vector4::Vector4    ()
 :   m_x {0.0f},
     m_y {0.0f},
     m_z {0.0f},
@@ -178,7 +205,7 @@ FORCEINLINE Vector4::Vector4    ()
  *
  * @param p_value   The value to set all components to.
  */
-FORCEINLINE Vector4::Vector4    (float const    p_value)
+CONSTEXPR FORCEINLINE Vector4::Vector4    (float const    p_value)
 :   m_x {p_value},
     m_y {p_value},
     m_z {p_value},
@@ -193,10 +220,10 @@ FORCEINLINE Vector4::Vector4    (float const    p_value)
  * @param p_z   The Z coordinate.
  * @param p_z   The W coordinate.
  */
-FORCEINLINE Vector4::Vector4    (float const    p_x,
-                                 float const    p_y,
-                                 float const    p_z,
-                                 float const    p_w)
+CONSTEXPR FORCEINLINE Vector4::Vector4    (float const    p_x,
+                                           float const    p_y,
+                                           float const    p_z,
+                                           float const    p_w)
 :   m_x {p_x},
     m_y {p_y},
     m_z {p_z},
@@ -210,9 +237,9 @@ FORCEINLINE Vector4::Vector4    (float const    p_x,
  * @param p_y       Y coordinate (p_y = 0.0f by default).
  * @param p_w       W coordinate (p_w = 0.0f by default).
  */
-FORCEINLINE Vector4::Vector4    (Vector2 const& p_vector2,
-                                 float const    p_z,
-                                 float const    p_w)
+CONSTEXPR FORCEINLINE Vector4::Vector4    (Vector2 const& p_vector2,
+                                           float const    p_z,
+                                           float const    p_w)
 :   m_x {p_vector2.m_x},
     m_y {p_vector2.m_y},
     m_z {p_z},
@@ -225,8 +252,8 @@ FORCEINLINE Vector4::Vector4    (Vector2 const& p_vector2,
  * @param p_vector3 The 3D vector to set first three components.
  * @param p_w       W coordinate (p_w = 0.0f by default).
  */
-FORCEINLINE Vector4::Vector4    (Vector3 const& p_vector3,
-                                 float const    p_w)
+CONSTEXPR FORCEINLINE Vector4::Vector4    (Vector3 const& p_vector3,
+                                           float const    p_w)
 :   m_x {p_vector3.m_x},
     m_y {p_vector3.m_y},
     m_z {p_vector3.m_z},
@@ -240,11 +267,12 @@ FORCEINLINE Vector4::Vector4    (Vector3 const& p_vector3,
  * @param p_to      The start vector.
  * @param p_from    The end vector.
  */
-FORCEINLINE Vector4::Vector4    (Vector4 const& p_from,
-                                 Vector4 const& p_to)
+CONSTEXPR FORCEINLINE Vector4::Vector4    (Vector4 const& p_from,
+                                           Vector4 const& p_to)
 :   m_x {p_to.m_x - p_from.m_x},
     m_y {p_to.m_y - p_from.m_y},    
-    m_z {p_to.m_z - p_from.m_z}
+    m_z {p_to.m_z - p_from.m_z},
+    m_w {p_to.m_w - p_from.m_w}
 {}
 
 /**
@@ -253,8 +281,8 @@ FORCEINLINE Vector4::Vector4    (Vector4 const& p_from,
  * @param p_xy  A 2D vector holding the X and Y components.
  * @param p_zw  A 2D vector holding the Z and W components.
  */
-FORCEINLINE Vector4::Vector4    (Vector2 const& p_xy,
-                                 Vector2 const& p_zw)
+CONSTEXPR FORCEINLINE Vector4::Vector4    (Vector2 const& p_xy,
+                                           Vector2 const& p_zw)
 :   m_x {p_xy.m_x},
     m_y {p_xy.m_y},    
     m_z {p_zw.m_x},
@@ -266,7 +294,7 @@ FORCEINLINE Vector4::Vector4    (Vector2 const& p_xy,
  *
  * @param p_copy    The initial vector to copy.
  */
-FORCEINLINE Vector4::Vector4    (Vector4 const& p_copy)
+CONSTEXPR FORCEINLINE Vector4::Vector4    (Vector4 const& p_copy)
 :   m_x {p_copy.m_x},
     m_y {p_copy.m_y},
     m_z {p_copy.m_z},
@@ -278,7 +306,7 @@ FORCEINLINE Vector4::Vector4    (Vector4 const& p_copy)
  *
  * @param p_copy    The initial vector to copy.
  */
-FORCEINLINE Vector4::Vector4    (Vector4&&      p_move)
+CONSTEXPR FORCEINLINE Vector4::Vector4    (Vector4&&      p_move)
 :   m_x {std::move(p_move.m_x)},
     m_y {std::move(p_move.m_y)},
     m_z {std::move(p_move.m_z)},
@@ -386,7 +414,17 @@ FORCEINLINE Vector3 Vector4::GetHomogenized3D       ()
  */
 FORCEINLINE float   Vector4::GetMagnitude           ()                                          const
 {
+#if defined(MATH_SIMD_SSE4)
+
+    __m128 const values {_mm_loadu_ps(&m_x)};
+
+    return _mm_cvtss_f32(_mm_sqrt_ss(SIMD::Dot4(values, values)));
+
+#else
+
     return  Math::Sqrt(m_x*m_x + m_y*m_y + m_z*m_z + m_w * m_w);
+
+#endif
 }
 
 /**
@@ -396,7 +434,17 @@ FORCEINLINE float   Vector4::GetMagnitude           ()
  */
 FORCEINLINE float   Vector4::GetMagnitudeSquared    ()                                          const
 {
+#if defined(MATH_SIMD_SSE4)
+
+    __m128 const values {_mm_loadu_ps(&m_x)};
+
+    return _mm_cvtss_f32(SIMD::Dot4(values, values));
+
+#else
+
     return  m_x*m_x + m_y*m_y + m_z*m_z + m_w * m_w;
+
+#endif
 }
 
 /**
@@ -409,6 +457,25 @@ FORCEINLINE float   Vector4::GetMagnitudeSquared    ()
  */
 FORCEINLINE Vector4 Vector4::GetSafeNormalized      (float const    p_tolerance)                const
 {
+#if defined(MATH_SIMD_SSE4)
+
+    __m128 const values             {_mm_loadu_ps(&m_x)};
+    __m128 const magnitudeSquared   {SIMD::Dot4(values, values)};
+
+    if      (_mm_cvtss_f32(magnitudeSquared) == 1.0f)
+        return *this;
+
+    else if (_mm_cvtss_f32(magnitudeSquared) < p_tolerance)
+        return Vector4::Zero;
+
+    Vector4 normalized;
+
+    _mm_storeu_ps(&normalized.m_x, _mm_div_ps(values, _mm_sqrt_ps(magnitudeSquared)));
+
+    return normalized;
+
+#else
+
     float const magnitudeSquared    {m_x*m_x + m_y*m_y + m_z*m_z + m_w*m_w};
 
     if      (magnitudeSquared == 1.0f)
@@ -419,6 +486,8 @@ FORCEINLINE Vector4 Vector4::GetSafeNormalized      (float const    p_tolerance)
 
     float const magnitude           {Math::Sqrt(magnitudeSquared)};
     return Vector4(m_x/ magnitude, m_y / magnitude, m_z/ magnitude, m_w/magnitude);
+
+#endif
 } 
 
 /**
@@ -428,9 +497,23 @@ FORCEINLINE Vector4 Vector4::GetSafeNormalized      (float const    p_tolerance)
  */
 FORCEINLINE Vector4 Vector4::GetUnsafeNormalized    ()                                          const
 {
+#if defined(MATH_SIMD_SSE4)
+
+    __m128 const values {_mm_loadu_ps(&m_x)};
+
+    Vector4 normalized;
+
+    _mm_storeu_ps(&normalized.m_x, _mm_div_ps(values, _mm_sqrt_ps(SIMD::Dot4(values, values))));
+
+    return normalized;
+
+#else
+
     float const magnitude   {Math::Sqrt(m_x*m_x + m_y*m_y + m_z*m_z + m_w*m_w)};
    
     return Vector4(m_x / magnitude, m_y / magnitude, m_z / magnitude, m_w / magnitude);
+
+#endif
 }
 
 /** Homogenize this vector (The three first components are divided by w) */
@@ -501,6 +584,21 @@ FORCEINLINE bool    Vector4::IsZero                 ()
  */
 FORCEINLINE bool    Vector4::Normalize              (float const    p_tolerance)
 {
+#if defined(MATH_SIMD_SSE4)
+
+    __m128 const values             {_mm_loadu_ps(&m_x)};
+    float const  magnitudeSquared   {_mm_cvtss_f32(SIMD::Dot4(values, values))};
+
+    // Same test as the scalar path, a NaN magnitude leaves the vector unchanged.
+    if (!(magnitudeSquared > p_tolerance))
+        return false;
+
+    _mm_storeu_ps(&m_x, _mm_mul_ps(values, _mm_set1_ps(Math::InvSqrt(magnitudeSquared))));
+
+    return true;
+
+#else
+
     float const magnitudeSquared    {m_x*m_x + m_y*m_y + m_z*m_z + m_w*m_w};
 
     if (magnitudeSquared > p_tolerance)
@@ -513,6 +611,8 @@ FORCEINLINE bool    Vector4::Normalize              (float const    p_tolerance)
         return true;
     }
     return false;
+
+#endif
 }
 
 /**
@@ -590,7 +690,7 @@ FORCEINLINE void    Vector4::Set                    (float const    p_value)
  * @return          True    if the vectors are equal.
  * @return          False   if the vectors are different.
  */
-FORCEINLINE bool        Vector4::operator== (Vector4 const& p_vector)   const
+CONSTEXPR FORCEINLINE bool        Vector4::operator== (Vector4 const& p_vector)   const
 {
     return m_x == p_vector.m_x && m_y == p_vector.m_y && m_z == p_vector.m_z && m_w == p_vector.m_w;
 }
@@ -603,7 +703,7 @@ FORCEINLINE bool        Vector4::operator== (Vector4 const& p_vector)   const
   * @return          True    if the vectors are different.
   * @return          False   if the vectors are equal.
   */
-FORCEINLINE bool        Vector4::operator!= (Vector4 const& p_vector)   const
+CONSTEXPR FORCEINLINE bool        Vector4::operator!= (Vector4 const& p_vector)   const
 {
     return m_x != p_vector.m_x || m_y != p_vector.m_y || m_z != p_vector.m_z || m_w != p_vector.m_w;
 }
@@ -615,7 +715,7 @@ FORCEINLINE bool        Vector4::operator!= (Vector4 const& p_vector)   const
  *
  * @return          The reference to vector after copy.
  */
-FORCEINLINE Vector4&    Vector4::operator=  (Vector4 const& p_copy)
+CONSTEXPR FORCEINLINE Vector4&    Vector4::operator=  (Vector4 const& p_copy)
 {
     m_x = p_copy.m_x;
     m_y = p_copy.m_y;
@@ -632,7 +732,7 @@ FORCEINLINE Vector4&    Vector4::operator=  (Vector4 const& p_copy)
  *
  * @return          The reference to vector after copy.
  */
-FORCEINLINE Vector4&    Vector4::operator=  (Vector3 const& p_copy)
+CONSTEXPR FORCEINLINE Vector4&    Vector4::operator=  (Vector3 const& p_copy)
 {
     m_x = p_copy.m_x;
     m_y = p_copy.m_y;
@@ -649,7 +749,7 @@ FORCEINLINE Vector4&    Vector4::operator=  (Vector3 const& p_copy)
  *
  * @return          The reference to vector after copy.
  */
-FORCEINLINE Vector4&    Vector4::operator=  (Vector2 const& p_copy)
+CONSTEXPR FORCEINLINE Vector4&    Vector4::operator=  (Vector2 const& p_copy)
 {
     m_x = p_copy.m_x;
     m_y = p_copy.m_y;
@@ -666,7 +766,7 @@ FORCEINLINE Vector4&    Vector4::operator=  (Vector2 const& p_copy)
  *
  * @return          The reference to vector after move.
  */
-FORCEINLINE Vector4&    Vector4::operator=  (Vector4&&      p_move)
+CONSTEXPR FORCEINLINE Vector4&    Vector4::operator=  (Vector4&&      p_move)
 {
     m_x = std::move(p_move.m_x);
     m_y = std::move(p_move.m_y);
@@ -727,7 +827,7 @@ FORCEINLINE float&      Vector4::operator[] (int32 const    p_index)
  *
  * @return          The result of vector addition.
  */
-FORCEINLINE Vector4     Vector4::operator+  (Vector4 const& p_vector)   const
+CONSTEXPR FORCEINLINE Vector4     Vector4::operator+  (Vector4 const& p_vector)   const
 {
     return Vector4
     (
@@ -745,7 +845,7 @@ FORCEINLINE Vector4     Vector4::operator+  (Vector4 const& p_vector)   const
  *
  * @return          The result of addition.
  */
-FORCEINLINE Vector4     Vector4::operator+  (float const    p_value)    const
+CONSTEXPR FORCEINLINE Vector4     Vector4::operator+  (float const    p_value)    const
 {
     return Vector4
     (
@@ -764,7 +864,7 @@ FORCEINLINE Vector4     Vector4::operator+  (float const    p_value)    const
  *
  * @return          Copy of the vector after addition.
  */
-FORCEINLINE Vector4&    Vector4::operator+= (Vector4 const& p_vector)
+CONSTEXPR FORCEINLINE Vector4&    Vector4::operator+= (Vector4 const& p_vector)
 {
     m_x += p_vector.m_x;
     m_y += p_vector.m_y;
@@ -781,7 +881,7 @@ FORCEINLINE Vector4&    Vector4::operator+= (Vector4 const& p_vector)
   *
   * @return          The reference of the vector after addition.
   */
-FORCEINLINE Vector4&    Vector4::operator+= (float const    p_value)
+CONSTEXPR FORCEINLINE Vector4&    Vector4::operator+= (float const    p_value)
 {
     m_x += p_value;
     m_y += p_value;
@@ -796,7 +896,7 @@ FORCEINLINE Vector4&    Vector4::operator+= (float const    p_value)
  *
  * @return          A negated copy of the vector.
  */
-FORCEINLINE Vector4     Vector4::operator-  ()                          const
+CONSTEXPR FORCEINLINE Vector4     Vector4::operator-  ()                          const
 {
     return Vector4(-m_x, -m_y, -m_z, -m_w);
 }
@@ -808,7 +908,7 @@ FORCEINLINE Vector4     Vector4::operator-  ()                          const
  *
  * @return          The result of vector subtraction.
  */
-FORCEINLINE Vector4     Vector4::operator-  (Vector4 const& p_vector)   const
+CONSTEXPR FORCEINLINE Vector4     Vector4::operator-  (Vector4 const& p_vector)   const
 {
     return Vector4
     (
@@ -826,7 +926,7 @@ FORCEINLINE Vector4     Vector4::operator-  (Vector4 const& p_vector)   const
  *
  * @return          The result of subtraction.
  */
-FORCEINLINE Vector4     Vector4::operator-  (float const    p_value)    const
+CONSTEXPR FORCEINLINE Vector4     Vector4::operator-  (float const    p_value)    const
 {
     return Vector4
     (
@@ -845,7 +945,7 @@ FORCEINLINE Vector4     Vector4::operator-  (float const    p_value)    const
  *
  * @return          The reference of the vector after subtraction.
  */
-FORCEINLINE Vector4&    Vector4::operator-= (Vector4 const& p_vector)
+CONSTEXPR FORCEINLINE Vector4&    Vector4::operator-= (Vector4 const& p_vector)
 {
     m_x -= p_vector.m_x;
     m_y -= p_vector.m_y;
@@ -862,7 +962,7 @@ FORCEINLINE Vector4&    Vector4::operator-= (Vector4 const& p_vector)
  *
  * @return          The reference of the vector after subtraction.
  */
-FORCEINLINE Vector4&    Vector4::operator-= (float const    p_value)
+CONSTEXPR FORCEINLINE Vector4&    Vector4::operator-= (float const    p_value)
 {
     m_x -= p_value;
     m_y -= p_value;
@@ -879,7 +979,7 @@ FORCEINLINE Vector4&    Vector4::operator-= (float const    p_value)
  *
  * @return          The result of multiplication.
  */
-FORCEINLINE Vector4     Vector4::operator*  (Vector4 const& p_vector)   const
+CONSTEXPR FORCEINLINE Vector4     Vector4::operator*  (Vector4 const& p_vector)   const
 {
     return Vector4
     (
@@ -897,7 +997,7 @@ FORCEINLINE Vector4     Vector4::operator*  (Vector4 const& p_vector)   const
  *
  * @return          The result of multiplication.
  */
-FORCEINLINE Vector4     Vector4::operator*  (float const    p_scale)    const
+CONSTEXPR FORCEINLINE Vector4     Vector4::operator*  (float const    p_scale)    const
 {
     return Vector4
     (
@@ -915,7 +1015,7 @@ FORCEINLINE Vector4     Vector4::operator*  (float const    p_scale)    const
  *
  * @return          The reference of the vector after multiplication.
  */
-FORCEINLINE Vector4&    Vector4::operator*= (Vector4 const& p_vector)
+CONSTEXPR FORCEINLINE Vector4&    Vector4::operator*= (Vector4 const& p_vector)
 {
     m_x *= p_vector.m_x;
     m_y *= p_vector.m_y;
@@ -933,7 +1033,7 @@ FORCEINLINE Vector4&    Vector4::operator*= (Vector4 const& p_vector)
  *
  * @return          The reference of the vector after multiplication.
  */
-FORCEINLINE Vector4&    Vector4::operator*= (float const    p_scale)
+CONSTEXPR FORCEINLINE Vector4&    Vector4::operator*= (float const    p_scale)
 {
     m_x *= p_scale;
     m_y *= p_scale;
@@ -950,7 +1050,7 @@ FORCEINLINE Vector4&    Vector4::operator*= (float const    p_scale)
  *
  * @return          The result of division.
  */
-FORCEINLINE Vector4     Vector4::operator/  (Vector4 const& p_vector)   const
+CONSTEXPR FORCEINLINE Vector4     Vector4::operator/  (Vector4 const& p_vector)   const
 {
     return Vector4
     (   
@@ -968,7 +1068,7 @@ FORCEINLINE Vector4     Vector4::operator/  (Vector4 const& p_vector)   const
  *
  * @return          The result of division.
  */
-FORCEINLINE Vector4     Vector4::operator/  (float const    p_scale)    const
+CONSTEXPR FORCEINLINE Vector4     Vector4::operator/  (float const    p_scale)    const
 {
     return Vector4
     (
@@ -986,7 +1086,7 @@ FORCEINLINE Vector4     Vector4::operator/  (float const    p_scale)    const
  *
  * @return          The reference of the vector after division.
  */
-FORCEINLINE Vector4&    Vector4::operator/= (Vector4 const& p_vector)
+CONSTEXPR FORCEINLINE Vector4&    Vector4::operator/= (Vector4 const& p_vector)
 {
     m_x /= p_vector.m_x;
     m_y /= p_vector.m_y;
@@ -1004,7 +1104,7 @@ FORCEINLINE Vector4&    Vector4::operator/= (Vector4 const& p_vector)
  *
  * @return          The reference of the vector after division.
  */
-FORCEINLINE Vector4&    Vector4::operator/= (float const    p_scale)
+CONSTEXPR FORCEINLINE Vector4&    Vector4::operator/= (float const    p_scale)
 {
     m_x /= p_scale;
     m_y /= p_scale;
@@ -1023,7 +1123,15 @@ FORCEINLINE Vector4&    Vector4::operator/= (float const    p_scale)
  */
 FORCEINLINE float       Vector4::operator|  (Vector4 const& p_vector)   const
 {
+#if defined(MATH_SIMD_SSE4)
+
+    return _mm_cvtss_f32(SIMD::Dot4(_mm_loadu_ps(&m_x), _mm_loadu_ps(&p_vector.m_x)));
+
+#else
+
     return m_x*p_vector.m_x + m_y*p_vector.m_y + m_z*p_vector.m_z + m_w * p_vector.m_w;
+
+#endif
 }
 
 /*==============================[Public Globale Operators]==============================*/
@@ -1036,8 +1144,8 @@ FORCEINLINE float       Vector4::operator|  (Vector4 const& p_vector)   const
  *
  * @return          The result of addition.
  */
-FORCEINLINE Vector4 operator+   (float const    p_value,
-                                 Vector4 const& p_vector)
+CONSTEXPR FORCEINLINE Vector4 operator+   (float const    p_value,
+                                           Vector4 const& p_vector)
 {
     return Vector4
     (
@@ -1056,8 +1164,8 @@ FORCEINLINE Vector4 operator+   (float const    p_value,
  *
  * @return          The result of multiplication.
  */
-FORCEINLINE Vector4 operator*   (float const    p_scale,
-                                 Vector4 const& p_vector)
+CONSTEXPR FORCEINLINE Vector4 operator*   (float const    p_scale,
+                                           Vector4 const& p_vector)
 {
     return Vector4
     (
@@ -5,44 +5,208 @@
 
 #include "Log/Log.hpp"
 #include "ProfilerData.hpp"
+#include "ProfilerEvent.hpp"
 
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+    #include <x86intrin.h>
+#elif defined(__linux__)
+    #include <time.h>
+#endif
+
+/** Events recorded by one thread, defined in Profiler.cpp. */
+struct ProfilerThreadBuffer;
+
+/**
+ * Frame-based CPU profiler.
+ *
+ * Every thread records the scopes of its ProfilerMarkers in a buffer of its own without taking any lock.
+ * At each call to NextFrame, the buffers are drained into a ProfilerFrame, and while a capture is running
+ * the last frames are kept so they can be inspected or exported.
+ *
+ * The captured frames can be exported as a Chrome trace, see ExportChromeTrace.
+ *
+ * Timestamps come from rdtsc on x86 (which is invariant across cores on every supported CPU),
+ * from CLOCK_MONOTONIC_RAW on other Linux targets and from std::chrono::steady_clock otherwise.
+ */
 class ENGINE_API Profiler
 {
     typedef std::map<ProfilerData, ProfilerData, ProfilerDataLineComparator> ProfilerDataSet;
-    
-    typedef std::stack<ProfilerData*> ProfilerDataStack;
 
     public:
-        
+
     // ============================== [Public Static Properties] ============================== //
 
-        static Profiler*    Get ()	noexcept;
+        /** Number of frames kept by a capture when none is given. */
+        static constexpr uint32 DefaultCapturedFrameCount   = 120u;
+
+        /** Number of events a thread can record between two frames, later events are dropped. */
+        static constexpr uint32 ThreadBufferCapacity        = 16384u;
+
+        /** Number of counter samples a thread can record between two frames, later samples are dropped. */
+        static constexpr uint32 ThreadCounterCapacity       = 1024u;
+
+    // ============================== [Public Static Methods] ============================== //
+
+        /**
+         * @return The singleton instance, created on first use.
+         */
+        static Profiler*            Get             ()  noexcept;
+
+        /**
+         * @return The current timestamp, in ticks.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        static FORCEINLINE uint64   GetTimestamp    ()  noexcept;
+
+        /**
+         * Names the calling thread in the captured data.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        static void                SetThreadName   (char const* p_name)    noexcept;
 
     // ============================== [Public Local Methods] ============================== //
 
-        void    StartProfiling  (char const*    p_fileName,
-                                 char const*    p_functionName,
-                                 int const      p_linenumber)	noexcept;
+        /**
+         * Starts recording, discarding the previous capture.
+         *
+         * @param p_frameCount  Number of frames to keep, older frames are dropped.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        void    StartCapture        (uint32 p_frameCount = DefaultCapturedFrameCount)    noexcept;
+
+        /**
+         * Stops recording, the frames captured so far are kept until the next capture
+         * and exported if the capture was started by RequestTrace.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        void    StopCapture         ()  noexcept;
+
+        /**
+         * @thread_safety This function may be called from any thread.
+         */
+        INLINE bool IsCapturing     ()  const noexcept;
+
+        /**
+         * Starts a capture of "p_frameCount" frames, exported to "p_path" once they are all captured
+         * or when the capture is stopped.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        void    RequestTrace        (std::string    p_path,
+                                     uint32         p_frameCount = DefaultCapturedFrameCount)    noexcept;
+
+        /**
+         * Writes the captured frames in the Chrome trace event format,
+         * which can be opened in chrome://tracing or https://ui.perfetto.dev.
+         *
+         * @return Whether or not the file was written.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        bool    ExportChromeTrace   (std::string const& p_path)  const;
+
+        /**
+         * Closes the current frame, collecting the events of every thread.
+         *
+         * @thread_safety This function must only be called from the main thread, once per frame.
+         */
+        void    NextFrame           ()  noexcept;
 
-        void    EndProfiling    ()	noexcept;
+        /**
+         * Opens a scope on the calling thread, used by ProfilerMarker.
+         *
+         * @return The timestamp of the beginning of the scope.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        uint64  BeginEvent          ()  noexcept;
 
-        void    LogProfiling    ()	noexcept;
+        /**
+         * Closes the last scope opened on the calling thread and records it, used by ProfilerMarker.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        void    EndEvent            (char const*    p_fileName,
+                                     char const*    p_functionName,
+                                     int32          p_lineNumber,
+                                     uint64         p_begin)    noexcept;
+
+        /**
+         * Samples a value displayed as a counter track in the exported traces.
+         *
+         * @param p_name    Name of the counter, which must outlive the Profiler (a string literal).
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        void    SetCounter          (char const*    p_name,
+                                     double         p_value)    noexcept;
+
+        /**
+         * @return A copy of the captured frames, from the oldest to the newest.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        std::deque<ProfilerFrame>   GetCapturedFrames   ()  const;
+
+        /**
+         * @return Every thread that recorded an event.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        std::vector<ProfilerThread> GetThreads          ()  const;
+
+        /**
+         * @return The number of ticks per second, measured against std::chrono::steady_clock.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        double  GetTicksPerSecond   ()  const noexcept;
+
+        /**
+         * Logs the time spent in each marker over the captured frames.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        void    LogProfiling        ()  noexcept;
 
     private:
 
-    // ============================== [Public Local Properties] ============================== //
+    // ============================== [Private Local Properties] ============================== //
+
+        /** Whether or not the markers are recording. */
+        std::atomic_bool                                    m_isCapturing;
+
+        /** Guards everything below. */
+        mutable std::mutex                                  m_mutex;
 
-        /** Set of ProfilerData used later for logging. */
-        ProfilerDataSet     m_profilerDataSet;
+        /** Buffer of every thread that recorded an event, never released before the Profiler. */
+        std::vector<std::unique_ptr<ProfilerThreadBuffer>>  m_threadBuffers;
 
-        /** Stack of ProfilerData. */    
-        ProfilerDataStack   m_profilerDataStack;
+        /** Last frames of the current or previous capture. */
+        std::deque<ProfilerFrame>                           m_frames;
 
-        /** Last CPU count recorded. */
-        __int64             m_lastCPUCount;
+        /** File the current capture is exported to when it ends, empty if it is not a trace. */
+        std::string                                         m_tracePath;
 
-        /** Total CPU count recorded. */
-        __int64             m_totalCPUCount;
+        /** Maximum number of frames kept in m_frames. */
+        uint32                                              m_capturedFrameCount;
+
+        /** Index of the current frame. */
+        uint64                                              m_frameIndex;
+
+        /** Timestamp of the start of the current frame. */
+        uint64                                              m_frameBegin;
+
+        /** Timestamp and time at which the Profiler was created, used to measure the tick frequency. */
+        uint64                                              m_startTimestamp;
+
+        std::chrono::steady_clock::time_point               m_startTime;
 
     // ============================== [Private Constructors and Destructor] ============================== //
 
@@ -56,7 +220,27 @@ class ENGINE_API Profiler
 
     // ============================== [Private Local Methods] ============================== //
 
-        [[nodiscard]] __int64	GetCPUCount ()  const noexcept;
+        ProfilerThreadBuffer&   GetThreadBuffer ()  noexcept;
+
+        /**
+         * Moves the events of every thread into "p_frame", or discards them if it is null.
+         * m_mutex must be locked.
+         */
+        void                    Collect         (ProfilerFrame* p_frame)    noexcept;
+
+        /**
+         * Ends the current frame at "p_timestamp", keeping it if a capture is running.
+         * m_mutex must be locked.
+         *
+         * @return The file to export the capture to if a requested trace is complete, an empty string otherwise.
+         */
+        std::string             CloseFrame      (uint64 p_timestamp)        noexcept;
+
+        /**
+         * Discards the previous capture and starts a new one.
+         * m_mutex must be locked.
+         */
+        void                    BeginCapture    (uint32 p_frameCount)       noexcept;
 
     // ============================== [Private Local Operators] ============================== //
 
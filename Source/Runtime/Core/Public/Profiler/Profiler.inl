@@ -6,53 +6,31 @@
 // ============================== [Public Static Methods] ============================== //
 
 /**
- * Return the singleton instance and create it if it was not.
+ * Return the current timestamp.
  */
-INLINE Profiler*    Profiler::Get   ()	noexcept
+FORCEINLINE uint64  Profiler::GetTimestamp  ()  noexcept
 {
-    static Profiler profilerInstance;
+    #if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+        return __rdtsc();
+    #elif defined(__linux__)
+        timespec time;
 
-    return &profilerInstance;
-}
-
-// ============================== [Private Constructors and Destructor] ============================== //
-
-/**
- * Default constructor.
- */
-INLINE Profiler::Profiler   ()  noexcept    :
-    m_profilerDataSet   { std::map<ProfilerData, ProfilerData, ProfilerDataLineComparator>() },
-    m_profilerDataStack { std::stack<ProfilerData*>() },
-    m_lastCPUCount      { 0 },
-    m_totalCPUCount     { 0 }
-{
-    m_profilerDataSet.insert(std::make_pair(ProfilerData(__FILE__, "Root", 0), ProfilerData(__FILE__, "Root", 0)));
-
-    m_profilerDataStack.push(&m_profilerDataSet.begin()->second);
-
-    m_lastCPUCount = GetCPUCount();
-}
+        clock_gettime(CLOCK_MONOTONIC_RAW, &time);
 
-/**
- * Default destructor.
- */
-INLINE Profiler::~Profiler  ()  noexcept
-{
-    LogProfiling();
+        return static_cast<uint64>(time.tv_sec) * 1000000000u + static_cast<uint64>(time.tv_nsec);
+    #else
+        return static_cast<uint64>(std::chrono::steady_clock::now().time_since_epoch().count());
+    #endif
 }
 
-// ============================== [Private Local Methods] ============================== //
+// ============================== [Public Local Methods] ============================== //
 
 /**
- * Return the current CPU count.
+ * Return whether or not the markers are recording.
  */
-INLINE __int64  Profiler::GetCPUCount   ()  const noexcept
+INLINE bool Profiler::IsCapturing   ()  const noexcept
 {
-    #if defined(_M_IX86)
-        _asm rdtsc
-    #else
-        return clock();
-    #endif
+    return m_isCapturing.load(std::memory_order_relaxed);
 }
 
 #endif // !__PROFILER_INL__
\ No newline at end of file
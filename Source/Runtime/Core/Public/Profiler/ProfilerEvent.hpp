@@ -0,0 +1,96 @@
+#ifndef __PROFILER_EVENT_HPP__
+#define __PROFILER_EVENT_HPP__
+
+/**
+ * Scope recorded by a ProfilerMarker, timestamps are in Profiler ticks.
+ */
+struct ProfilerEvent
+{
+    // ============================== [Public Local Properties] ============================== //
+
+        /** File name containing the marker. */
+        char const* m_fileName;
+
+        /** Name of the marker, the function name for PROFILER_MARKER. */
+        char const* m_functionName;
+
+        /** Line number of the marker in the file. */
+        int32       m_lineNumber;
+
+        /** Identifier of the thread the scope ran on, see Profiler::GetThreads. */
+        uint32      m_threadId;
+
+        /** Number of enclosing scopes on the same thread. */
+        uint32      m_depth;
+
+        /** Timestamp at which the scope was entered. */
+        uint64      m_begin;
+
+        /** Timestamp at which the scope was left. */
+        uint64      m_end;
+
+}; // !struct ProfilerEvent
+
+/**
+ * Value sampled with Profiler::SetCounter.
+ */
+struct ProfilerCounter
+{
+    // ============================== [Public Local Properties] ============================== //
+
+        /** Name of the counter track. */
+        char const* m_name;
+
+        /** Identifier of the thread that sampled the value. */
+        uint32      m_threadId;
+
+        /** Timestamp of the sample. */
+        uint64      m_timestamp;
+
+        double      m_value;
+
+}; // !struct ProfilerCounter
+
+/**
+ * Every event recorded between two calls to Profiler::NextFrame.
+ */
+struct ProfilerFrame
+{
+    // ============================== [Public Local Properties] ============================== //
+
+        /** Index of the frame since the Profiler was created. */
+        uint64                          m_index         = 0u;
+
+        /** Timestamp of the start of the frame. */
+        uint64                          m_begin         = 0u;
+
+        /** Timestamp of the end of the frame. */
+        uint64                          m_end           = 0u;
+
+        /** Number of events lost because a thread buffer was full. */
+        uint64                          m_droppedEvents = 0u;
+
+        /** Events of every thread, sorted by begin timestamp then depth. */
+        std::vector<ProfilerEvent>      m_events;
+
+        /** Counter samples of every thread, sorted by timestamp. */
+        std::vector<ProfilerCounter>    m_counters;
+
+}; // !struct ProfilerFrame
+
+/**
+ * Thread that recorded at least one event.
+ */
+struct ProfilerThread
+{
+    // ============================== [Public Local Properties] ============================== //
+
+        /** Identifier referenced by ProfilerEvent::m_threadId. */
+        uint32      m_id;
+
+        /** Name given with Profiler::SetThreadName, empty otherwise. */
+        std::string m_name;
+
+}; // !struct ProfilerThread
+
+#endif // !__PROFILER_EVENT_HPP__
\ No newline at end of file
@@ -11,6 +11,7 @@
 
 /**
  * Used to mark a function or a code block, enabling profiling for it.
+ * The marker costs a single relaxed load while the Profiler is not capturing.
  */
 class ProfilerMarker
 {
@@ -44,7 +45,14 @@ class ProfilerMarker
 
     // ============================== [Private Local Properties] ============================== //
         
-        bool    m_onStack;
+        char const* m_fileName;
+
+        char const* m_functionName;
+
+        int32       m_lineNumber;
+
+        /** Timestamp of the beginning of the scope, 0 if it is not recorded. */
+        uint64      m_begin;
 
 }; // !class ProfilerMarker
 
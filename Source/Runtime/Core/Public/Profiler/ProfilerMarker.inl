@@ -10,7 +10,10 @@
  * Default constructor.
  */
 INLINE ProfilerMarker::ProfilerMarker   ()  noexcept    :
-    m_onStack   { true }
+    m_fileName      { "" },
+    m_functionName  { "" },
+    m_lineNumber    { 0 },
+    m_begin         { 0u }
 {
 
 }
@@ -21,9 +24,15 @@ INLINE ProfilerMarker::ProfilerMarker   ()  noexcept    :
 INLINE ProfilerMarker::ProfilerMarker   (char const*    p_fileName,
                                          char const*    p_functionName,
                                          int const      p_lineNumber)  noexcept    :
-    m_onStack   { true }
+    m_fileName      { p_fileName },
+    m_functionName  { p_functionName },
+    m_lineNumber    { p_lineNumber },
+    m_begin         { 0u }
 {
-    Profiler::Get()->StartProfiling(p_fileName, p_functionName, p_lineNumber);
+    Profiler* profiler = Profiler::Get();
+
+    if (profiler->IsCapturing())
+        m_begin = profiler->BeginEvent();
 }
 
 /**
@@ -37,15 +46,15 @@ INLINE ProfilerMarker::~ProfilerMarker  ()	noexcept
 // ============================== [Public Local Methods] ============================== //
 
 /**
- * Notify the Profiler to stop the profiling process.
+ * Notify the Profiler that the scope is over.
  */
 INLINE void ProfilerMarker::EndMarker   ()	noexcept
 {
-    if (m_onStack)
+    if (m_begin)
     {
-        Profiler::Get()->EndProfiling();
+        Profiler::Get()->EndEvent(m_fileName, m_functionName, m_lineNumber, m_begin);
 
-        m_onStack = false;
+        m_begin = 0u;
     }
 }
 
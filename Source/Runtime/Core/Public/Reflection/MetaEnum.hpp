@@ -45,10 +45,17 @@ namespace Reflect
         {
             static_assert(std::is_enum_v<E>, "Reflect::Detail::NameImpl require enum type.");
 
+#if defined(_MSC_VER)
             std::string_view name{ __FUNCSIG__ };
             constexpr auto suffix = sizeof(">(void) noexcept") - 1;
 
             name.remove_suffix(suffix);
+#else
+            // "... [with E = Type; E V = Type::Value; ...]" on GCC, "... [E = Type, V = Type::Value]" on Clang.
+            std::string_view name{ __PRETTY_FUNCTION__ };
+
+            name = name.substr(0, name.find_first_of(";]", name.find(" V = ")));
+#endif
 
             for (std::size_t i = name.size(); i > 0; --i)
                 if (!IsNameChar(name[i - 1], false)) 
@@ -132,17 +139,18 @@ namespace Reflect
 		[[nodiscard]] constexpr bool				IsEnum		(T					p_enum, 
 																 U					p_value) noexcept
 		{
-			if constexpr (std::is_enum_v<decltype(value)>)
+			if constexpr (std::is_enum_v<U>)
 			{
 				return std::is_same_v<T, U>;
 			}
-			else if constexpr (std::is_same_v<std::string, decltype(value) ||
-				std::is_same_v<char const*, decltype(value)> ||
-				std::is_same_v<int, decltype(value)>)
+			else if constexpr (std::is_same_v<std::string, U> ||
+				std::is_same_v<char const*, U>)
 			{
-				auto check = Reflect::EnumCast<T>(value);
-
-				return check.has_value();
+				return EnumCastImpl<T>(p_value).has_value();
+			}
+			else if constexpr (std::is_same_v<int, U>)
+			{
+				return !NameImpl<T>(p_value).empty();
 			}
 
 			return false;
@@ -168,7 +168,7 @@ namespace Reflect
 	{
 		for (auto it = p_object.begin(); it != p_object.end(); ++it) 
 		{
-			p_obj.emplace(FromString<K>(it.key()), it.value());
+			p_obj.emplace(Detail::FromString<K>(it.key()), it.value());
 		}
 	}
 
@@ -3,6 +3,7 @@
 //#include "Components/SceneComponent.hpp"
 
 #include "GameFramework/Entity.hpp"
+#include "RenderScene.hpp"
 
 // =================================[Public Constructor + Destructor]================================= //
 
@@ -17,6 +18,9 @@ SceneComponent::SceneComponent  ()
     m_isVisibleInGame           = true;
     m_attachParent              = nullptr;
     m_wantsOnUpdateTransform    = false;
+    m_renderScene               = nullptr;
+    m_renderSceneIndex          = -1;
+    m_isRenderStateDirty        = false;
 }
 
 
@@ -570,6 +574,15 @@ bool                                SceneComponent::IsAttachedTo
     return false;
 }
 
+/**
+ * Queues this component for the Renderer to update it, if it is registered in a render scene.
+ */
+void                                SceneComponent::MarkRenderStateDirty            ()
+{
+    if (m_renderScene)
+        m_renderScene->MarkDirty(*this);
+}
+
 /** 
  * Reset the transform of the component relative to its parent. 
  * Sets relative location to zero, relative rotation to no rotation, and Scale to 1. 
@@ -829,6 +842,17 @@ bool    SceneComponent::MoveComponentImpl           (Vector3 const&
     return true;
 }
 
+/**
+ * Unregisters this component from its render scene before it is destroyed.
+ */
+void    SceneComponent::OnDestroy                   ()
+{
+    if (m_renderScene)
+        m_renderScene->RemoveComponent(this);
+
+    Super::OnDestroy();
+}
+
 /**
  * Overridable internal method executed when p_isVisible has changed.
  */
@@ -836,6 +860,14 @@ void    SceneComponent::OnVisibilityInGameChanged   ()
 {
 }
 
+/**
+ * Overridable internal method executed each time the world transform of this component has changed,
+ * unlike OnUpdateTransform whether or not it has a physics state.
+ */
+void    SceneComponent::OnWorldTransformChanged     ()
+{
+}
+
 void    SceneComponent::UpdateOverlapsImpl          (std::vector<OverlapInfo> const*    p_pendingOverlaps /** = nullptr */,
                                                      bool const                         p_doNotifies /** = true */,
                                                      std::vector<OverlapInfo> const*    p_overlapAtEndLocation /** = nullptr */)
@@ -905,6 +937,7 @@ void    SceneComponent::PropagateTransformUpdate        (bool const
     
     if (p_transformChanged)
     {
+        OnWorldTransformChanged();
 
         if (m_physicsStateCreated)
         {
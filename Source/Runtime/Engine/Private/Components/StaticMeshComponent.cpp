@@ -21,6 +21,8 @@ void    StaticMeshComponent::SetModel               (ANSICHAR const* p_name) noe
         if (!materialInstance)
             materialInstance = assetManager.Get<MaterialInstance>("Default/MaterialInstances/default", ELoadingMode::ASYNCHRONOUS);
     }
+
+    MarkRenderStateDirty();
 }
 
 void    StaticMeshComponent::SetModel               (std::shared_ptr<Model> const& p_model) noexcept
@@ -40,6 +42,8 @@ void    StaticMeshComponent::SetModel               (std::shared_ptr<Model> cons
 
     else
         m_materialInstances.clear();
+
+    MarkRenderStateDirty();
 }
 
 void    StaticMeshComponent::SetMaterialInstance    (uint32          p_index,
@@ -51,6 +55,8 @@ void    StaticMeshComponent::SetMaterialInstance    (uint32          p_index,
 
         if (!m_materialInstances[p_index])
             m_materialInstances[p_index] = AssetManager::Get().Get<MaterialInstance>("Default/MaterialInstances/default", ELoadingMode::ASYNCHRONOUS);
+
+        MarkRenderStateDirty();
     }
 }
 
@@ -60,9 +66,53 @@ void    StaticMeshComponent::SetMaterialInstance    (uint32
     if (p_index < m_materialInstances.size())
     {
         m_materialInstances[p_index] = p_materialInstance;
+
+        MarkRenderStateDirty();
     }
 }
 
+std::vector<Bounds> const&  StaticMeshComponent::GetMeshWorldBounds () noexcept
+{
+    if (!m_model)
+    {
+        m_meshWorldBounds.clear();
+        m_boundsModel = nullptr;
+
+        return m_meshWorldBounds;
+    }
+
+    auto const& meshes = m_model->GetMeshes();
+
+    if (!m_areBoundsDirty && m_boundsModel == m_model.get() && m_meshWorldBounds.size() == meshes.size())
+        return m_meshWorldBounds;
+
+    Matrix4x4 const modelMatrix = GetRenderMatrix();
+
+    m_meshWorldBounds.resize(meshes.size());
+
+    for (size_t i = 0; i < meshes.size(); ++i)
+        m_meshWorldBounds[i] = meshes[i].bounds.GetTransformed(modelMatrix);
+
+    m_worldBounds = m_meshWorldBounds.empty() ? Bounds(modelMatrix.GetOrigin(), modelMatrix.GetOrigin()) : m_meshWorldBounds.front();
+
+    for (Bounds const& bounds : m_meshWorldBounds)
+        m_worldBounds = Bounds::Overlap(m_worldBounds, bounds);
+
+    m_boundsModel    = m_model.get();
+    m_areBoundsDirty = false;
+
+    ++m_boundsRevision;
+
+    return m_meshWorldBounds;
+}
+
+Bounds const&               StaticMeshComponent::GetWorldBounds     () noexcept
+{
+    GetMeshWorldBounds();
+
+    return m_worldBounds;
+}
+
 void    StaticMeshComponent::Serialize  (Json&  p_serialize)    const
 {
     PrimitiveComponent::Serialize(p_serialize);
@@ -95,4 +145,13 @@ void    StaticMeshComponent::Deserialize  (Json const&  p_deserialize,
             count++;
         }
     }
+}
+
+// ============================== [Virtual Protected Local Methods] ============================== //
+
+void    StaticMeshComponent::OnWorldTransformChanged    ()
+{
+    m_areBoundsDirty = true;
+
+    MarkRenderStateDirty();
 }
\ No newline at end of file
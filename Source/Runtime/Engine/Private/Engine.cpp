@@ -2,6 +2,8 @@
 #include "World.hpp"
 #include "Engine.hpp"
 #include "Renderer.hpp"
+#include "TaskGraph.hpp"
+#include "ThreadPool.hpp"
 #include "Application.hpp"
 #include "AssetManager.hpp"
 #include "GameUserSettings.hpp"
@@ -19,6 +21,12 @@
 
 Engine* GEngine = nullptr;
 
+/** Environment variable holding the file to write a Chrome trace of the first frames to. */
+#define TRACE_PATH_VARIABLE     "MERCURE_TRACE"
+
+/** Environment variable holding the number of frames traced, Profiler::DefaultCapturedFrameCount if not set. */
+#define TRACE_FRAMES_VARIABLE   "MERCURE_TRACE_FRAMES"
+
 // ============================== [Public Constructor and Destructor] ============================== //
 
 Entity*                 e1;
@@ -34,6 +42,14 @@ Engine::Engine  () :
 
     // Loads the settings.
     m_gameUserSettings->Load(m_passkey);
+
+    // Traces the first frames when requested by the environment, for runs without any input.
+    if (char const* tracePath = std::getenv(TRACE_PATH_VARIABLE))
+    {
+        char const* frameCount = std::getenv(TRACE_FRAMES_VARIABLE);
+
+        Profiler::Get()->RequestTrace(tracePath, frameCount ? static_cast<uint32>(std::strtoul(frameCount, nullptr, 10)) : Profiler::DefaultCapturedFrameCount);
+    }
     
     // Initializes the Engine's modules.
     m_moduleManager->Initialize(m_passkey);
@@ -46,46 +62,79 @@ Engine::Engine  () :
 
 Engine::~Engine ()
 {
+    // Exports the trace in progress, if any.
+    Profiler::Get()->StopCapture();
+
     // Shutdowns the world.
     m_world.reset();
 
-    // Shutdowns the Engine's modules. 
+    // Shutdowns the Engine's modules, the Renderer stops the render thread.
     m_moduleManager->Shutdown(m_passkey);
 
+    if (m_renderThread.joinable())
+        m_renderThread.join();
+
     // Saves the settings.
     m_gameUserSettings->Save(m_passkey);
 
     // Invalidates the global variable storing this instance.
     GEngine = nullptr;
+
+    // Writes the pending messages, later messages are written synchronously.
+    Logger::Get().Shutdown();
 }
 
 // ============================== [Public Local Methods] ============================== //
 
 void    Engine::Run             ()
 {
-    // Launches the renderer on a standalone thread.
-    m_moduleManager->Get<ThreadPool>().SubmitTask([&] () { m_moduleManager->Get<Renderer>().Update(m_passkey); });
-
     Application& application = m_moduleManager->Get<Application>();
     Renderer&    renderer    = m_moduleManager->Get<Renderer>   ();
 
+    Profiler::SetThreadName("Main Thread");
+
+    if (application.GetMainWindow())
+        application.GetMainWindow()->BindKeyCallback<Engine, &Engine::KeyboardInputHandler>(this);
+
+    // Launches the renderer on a thread of its own, its loop would otherwise hold a worker, or a helping join, forever.
+    m_renderThread = std::thread([this, &renderer] () { renderer.Update(m_passkey); });
+
     auto  lastTime    = std::chrono::high_resolution_clock::now();
     auto  currentTime = std::chrono::high_resolution_clock::now();
     float deltaTime   = 0.0f;
 
+    // Frame built once, the render list reads the transforms produced by gameplay and physics.
+    // Each stage reads what the previous one wrote, so the frame is a chain: the parallelism is inside the nodes,
+    // the render list being built by ParallelFors. Systems which do not depend on the tick are to be added as nodes of their own.
+    TaskGraph frame(ThreadPool::Get());
+
+    frame.AddNode([&] () { m_world->Tick(deltaTime); }, "World Tick")
+         .Then   ([&] ()
+         {
+             if (m_world->GetCurrentLevel())
+                 renderer.Render(m_passkey, *m_world->GetCurrentLevel());
+         }, "Render List");
+
     while (m_running.load(std::memory_order_acquire))
     {
         currentTime = std::chrono::high_resolution_clock::now();
         deltaTime   = std::chrono::duration<float>(currentTime - lastTime).count();
         lastTime    = currentTime;
         
+        // Window events must be polled on the main thread.
         application.Update(m_passkey);
-        
-        m_world->Tick(deltaTime);
 
-        if (m_world->GetCurrentLevel())
-            renderer.Render(m_passkey, *m_world->GetCurrentLevel());
+        if (!frame.Execute())
+        {
+            LOG(LogEngine, Fatal, "The frame graph has a cycle or an edge to another graph");
+            m_running.store(false, std::memory_order_release);
+        }
+
+        Profiler::Get()->NextFrame();
     }
+
+    if (application.GetMainWindow())
+        application.GetMainWindow()->RemoveKeyCallback<Engine, &Engine::KeyboardInputHandler>(this);
 }
 
 float g_TestTime = 0;
@@ -115,4 +164,20 @@ void    Engine::RequestShutdown () noexcept
 World*  Engine::GetWorld        () noexcept
 {
     return m_world.get();
+}
+
+// ============================== [Private Local Methods] ============================== //
+
+void    Engine::KeyboardInputHandler    (EKey   p_key,
+                                         EState p_state)
+{
+    if (p_key != EKey::F11 || p_state != EState::PRESSED || Profiler::Get()->IsCapturing())
+        return;
+
+    char        path[64];
+    std::time_t now = std::time(nullptr);
+
+    std::strftime(path, sizeof(path), "Saved/Profiling/Trace-%Y%m%d-%H%M%S.json", std::localtime(&now));
+
+    Profiler::Get()->RequestTrace(path);
 }
\ No newline at end of file
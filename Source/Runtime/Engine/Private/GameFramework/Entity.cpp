@@ -14,7 +14,8 @@ Entity::Entity  ()
 	m_ownedComponents		{ std::vector<EntityComponent*>() },
 	m_hasBegunPlay			{ false },
     m_enableCollision       { false },
-    m_world                 { GEngine->GetWorld() }
+    m_world                 { GEngine->GetWorld() },
+    m_renderScene           { nullptr }
 {}
 
 // =================================[Public Local Methods]================================= //
@@ -30,6 +31,9 @@ bool    Entity::AddComponent                (EntityComponent*               p_co
     {
         m_ownedComponents.push_back(p_component);
 
+        if (m_renderScene)
+            m_renderScene->AddComponent(p_component);
+
         return true;
     }
     else
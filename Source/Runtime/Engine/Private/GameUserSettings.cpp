@@ -21,6 +21,8 @@ void    GameUserSettings::Save  (EngineKey const& p_passkey)
         m_json["ResolutionHeight"] = m_resolutionHeight;
         m_json["MultisampleCount"] = m_multisampleCount;
         m_json["Anisotropy"]       = m_anisotropy;
+        m_json["FrameSpinCount"]   = m_frameSpinCount;
+        m_json["FrameYieldCount"]  = m_frameYieldCount;
 
         file << m_json.dump(4);
     }
@@ -44,6 +46,8 @@ void    GameUserSettings::Load  (EngineKey const& p_passkey)
         m_resolutionHeight = m_json.value("ResolutionHeight", m_resolutionHeight);
         m_multisampleCount = m_json.value("MultisampleCount", m_multisampleCount);
         m_anisotropy       = m_json.value("Anisotropy",       m_anisotropy);
+        m_frameSpinCount   = m_json.value("FrameSpinCount",   m_frameSpinCount);
+        m_frameYieldCount  = m_json.value("FrameYieldCount",  m_frameYieldCount);
     }
 
     else
@@ -55,6 +55,12 @@ Level*  Level::Load                     (std::string const& p_name)
     if (CheckContentDirectory() == false)
         return this;
 
+    for (Entity* entity : m_entities)
+    {
+        if (entity != nullptr)
+            m_renderScene.RemoveEntity(*entity);
+    }
+
     m_entities.clear();
 
     std::fstream file;
@@ -70,7 +76,14 @@ Level*  Level::Load                     (std::string const& p_name)
         if (loader.contains("Entities"))
         {
             for (auto const& node : loader["Entities"])
-                m_entities.push_back(ObjectFactory::CreateEntityFromTypeID(node, loader["Components"]));
+            {
+                Entity* entity = ObjectFactory::CreateEntityFromTypeID(node, loader["Components"]);
+
+                m_entities.push_back(entity);
+
+                if (entity != nullptr)
+                    m_renderScene.AddEntity(*entity);
+            }
         }
     }
 
@@ -2,6 +2,25 @@
 
 #include "Light/PointLightComponent.hpp"
 
+// ============================== [Private Static Properties] ============================== //
+
+namespace
+{
+    /**
+     * View matrices of the six cube faces for a light sitting at the origin (right, left, top, down, forward and backward).
+     * A light somewhere else only changes the translation of these matrices.
+     */
+    CONSTEXPR Matrix4x4 CubeFaceViews[6]
+    {
+        Matrix4x4::View(Vector3(), Vector3( 1.0f,  0.0f,  0.0f), Vector3(0.0f, 1.0f,  0.0f)),
+        Matrix4x4::View(Vector3(), Vector3(-1.0f,  0.0f,  0.0f), Vector3(0.0f, 1.0f,  0.0f)),
+        Matrix4x4::View(Vector3(), Vector3( 0.0f,  1.0f,  0.0f), Vector3(0.0f, 0.0f, -1.0f)),
+        Matrix4x4::View(Vector3(), Vector3( 0.0f, -1.0f,  0.0f), Vector3(0.0f, 0.0f,  1.0f)),
+        Matrix4x4::View(Vector3(), Vector3( 0.0f,  0.0f,  1.0f), Vector3(0.0f, 1.0f,  0.0f)),
+        Matrix4x4::View(Vector3(), Vector3( 0.0f,  0.0f, -1.0f), Vector3(0.0f, 1.0f,  0.0f))
+    };
+}
+
 // ============================== [Public Constructor] ============================== //
 
 PointLightComponent::PointLightComponent    () : LightComponent()
@@ -30,17 +49,24 @@ void    PointLightComponent::Serialize      (Json& p_serialize) const
 
 PointLightData  PointLightComponent::GetRenderData  () const noexcept
 {
-    return PointLightData
+    Vector3 const   location {GetWorldLocation()};
+
+    PointLightData  data
     {
-        Matrix4x4::View(GetWorldLocation(), GetWorldLocation() + Vector3::Right,    Vector3::Up),       // Light's right    view matrix
-        Matrix4x4::View(GetWorldLocation(), GetWorldLocation() + Vector3::Left,     Vector3::Up),       // Light's left     view matrix
-        Matrix4x4::View(GetWorldLocation(), GetWorldLocation() + Vector3::Up,       Vector3::Backward), // Light's top      view matrix
-        Matrix4x4::View(GetWorldLocation(), GetWorldLocation() + Vector3::Down,     Vector3::Forward),  // Light's down     view matrix
-        Matrix4x4::View(GetWorldLocation(), GetWorldLocation() + Vector3::Forward,  Vector3::Up),       // Light's forward  view matrix
-        Matrix4x4::View(GetWorldLocation(), GetWorldLocation() + Vector3::Backward, Vector3::Up),       // Light's backward view matrix
-        Matrix4x4::Perspective(Math::DegToRad(90.0f), 1.0f, 0.1f, m_intensity),                         // Light's projection matrix
-        m_color,                                                                                        // Light's color
-        GetWorldLocation(),                                                                             // Light's direction
-        m_intensity                                                                                     // Light's intensity
+        CubeFaceViews[0],                                                       // Light's right    view matrix
+        CubeFaceViews[1],                                                       // Light's left     view matrix
+        CubeFaceViews[2],                                                       // Light's top      view matrix
+        CubeFaceViews[3],                                                       // Light's down     view matrix
+        CubeFaceViews[4],                                                       // Light's forward  view matrix
+        CubeFaceViews[5],                                                       // Light's backward view matrix
+        Matrix4x4::Perspective(Math::DegToRad(90.0f), 1.0f, 0.1f, m_intensity), // Light's projection matrix
+        m_color,                                                                // Light's color
+        location,                                                               // Light's direction
+        m_intensity                                                             // Light's intensity
     };
+
+    for (Matrix4x4& view : data.views)
+        view.SetOrigin(-view.MultiplyVector(location));
+
+    return data;
 }
\ No newline at end of file
@@ -48,6 +48,8 @@ void                World::SetPhysicsScene                  (PhysicsSceneHandle*
 
 void	            World::Tick		                        (float const	        p_deltaTime)
 {
+    PROFILER_MARKER
+
 	if (m_currentLevel != nullptr && m_hasBegunPlay)
 	{
 		m_currentLevel->Tick(p_deltaTime);
@@ -6,6 +6,8 @@
 #include "PhysicsEngine/CollisionResponseContainer.hpp"
 #include "PhysicsEngine/OverlapInfo.hpp"
 
+class RenderScene;
+
 class ENGINE_API SceneComponent : public EntityComponent
 {
     REFLECT(SceneComponent)
@@ -183,6 +185,8 @@ class ENGINE_API SceneComponent : public EntityComponent
 
         FORCEINLINE bool                    IsPhysicsCollisionEnabled       ()                                                      const;
 
+        void                                MarkRenderStateDirty            ();
+
         FORCEINLINE bool                    MoveComponent                   (Vector3 const&                     p_deltaWorldOffset,
                                                                              Quaternion const&                  p_newWorldRotation,
                                                                              bool const                         p_sweep, 
@@ -271,8 +275,12 @@ class ENGINE_API SceneComponent : public EntityComponent
                                                      bool const                         p_sweep, 
                                                      HitResult*                         p_outHitResult = nullptr);
 
+        virtual void    OnDestroy                   ()  override;
+
         virtual void    OnVisibilityInGameChanged   ();
 
+        virtual void    OnWorldTransformChanged     ();
+
         virtual void    UpdateOverlapsImpl          (std::vector<OverlapInfo> const*    p_pendingOverlaps = nullptr,
                                                      bool const                         p_doNotifies = true,
                                                      std::vector<OverlapInfo> const*    p_overlapAtEndLocation = nullptr);
@@ -316,6 +324,15 @@ class ENGINE_API SceneComponent : public EntityComponent
         PROPERTY()
         Transform                       m_relativeTransform;
 
+        /** The render scene this component is registered in, nullptr if none. */
+        RenderScene*                    m_renderScene;
+
+        /** The index of this component in the render scene's components of its type. */
+        int32                           m_renderSceneIndex;
+
+        /** Is this component queued in its render scene for the Renderer to update it. */
+        bool                            m_isRenderStateDirty;
+
     // =================================[Private Local Methods]================================= //
     
         void    GetChildrenWithDescendant       (std::vector<SceneComponent*>&  p_childrenWithDescendant);
@@ -328,6 +345,10 @@ class ENGINE_API SceneComponent : public EntityComponent
                                                  EUpdateTransformFlags const    p_updateTransformFlags,
                                                  ETeleportType const            p_teleport = ETeleportType::None);
 
+    // =================================[Friend Classes]================================= //
+
+        friend class RenderScene;
+
 }; // !class SceneComponent
 
 #include "SceneComponent.inl"
@@ -34,6 +34,19 @@ class ENGINE_API StaticMeshComponent : public PrimitiveComponent
         void    SetMaterialInstance (uint32                                     p_index,
                                      std::shared_ptr<MaterialInstance> const&   p_materialInstance) noexcept;
 
+        /**
+         * Transforms the model-space bounds of each mesh by the render matrix.
+         * The result is cached and only recomputed once the component moved or its model changed.
+         *
+         * @return The world bounds of each mesh, in the order of the model's meshes.
+         */
+        std::vector<Bounds> const&  GetMeshWorldBounds  ()  noexcept;
+
+        /**
+         * @return The union of the world bounds of the meshes.
+         */
+        Bounds const&               GetWorldBounds      ()  noexcept;
+
     // ==================================================================================== //
 
         INLINE std::shared_ptr<Model>                         const&    GetModel                ()                      const noexcept  { return m_model; }
@@ -41,6 +54,19 @@ class ENGINE_API StaticMeshComponent : public PrimitiveComponent
         INLINE std::shared_ptr<MaterialInstance>&                       GetMaterialInstance     (size_t p_index = 0)    noexcept        { return m_materialInstances[p_index]; }
 
         INLINE std::vector<std::shared_ptr<MaterialInstance>> const&    GetMaterialInstances    ()                      const noexcept  { return m_materialInstances; }
+
+        /**
+         * @return A number incremented each time the world bounds are recomputed.
+         */
+        INLINE uint32                                                   GetWorldBoundsRevision  ()                      const noexcept  { return m_boundsRevision; }
+
+        /**
+         * @return The proxy of this component in the Renderer's bounding volume hierarchy, -1 if it has none.
+         *         Reset when the component enters or leaves a render scene.
+         */
+        INLINE int32                                                    GetRenderProxy          ()                      const noexcept  { return m_renderProxy; }
+
+        INLINE void                                                     SetRenderProxy          (int32 p_proxy)         noexcept        { m_renderProxy = p_proxy; }
         
     // ==================================================================================== //
 
@@ -55,6 +81,12 @@ class ENGINE_API StaticMeshComponent : public PrimitiveComponent
 
         StaticMeshComponent&    operator=   (StaticMeshComponent&&      p_move) = default;
 
+    protected:
+
+    // ============================== [Virtual Protected Local Methods] ============================== //
+
+        virtual void    OnWorldTransformChanged ()  override;
+
     private:
 
     // ============================== [Private Local Properties] ============================== //
@@ -65,6 +97,20 @@ class ENGINE_API StaticMeshComponent : public PrimitiveComponent
         PROPERTY()
         std::vector<std::shared_ptr<MaterialInstance>>  m_materialInstances;
 
+        std::vector<Bounds>                             m_meshWorldBounds;
+
+        Bounds                                          m_worldBounds;
+
+        /** Model the world bounds were computed for. */
+        Model const*                                    m_boundsModel       = nullptr;
+
+        uint32                                          m_boundsRevision    = 0u;
+
+        /** Set when the component moved since the world bounds were computed. */
+        bool                                            m_areBoundsDirty    = true;
+
+        int32                                           m_renderProxy       = -1;
+
 };  // !class StaticMeshComponent
 
 #include "StaticMeshComponent.generated.hpp"
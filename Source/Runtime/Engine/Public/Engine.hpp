@@ -12,6 +12,9 @@ class World;
 class GameUserSettings;
 class EngineModuleManager;
 
+enum class EKey     : int32;
+enum class EState   : int32;
+
 // ==================================================================================== //
 
 class ENGINE_API Engine : public UniqueObject
@@ -82,6 +85,17 @@ class ENGINE_API Engine : public UniqueObject
 
         std::unique_ptr<World>                  m_world;
 
+        /** Runs Renderer::Update, which only returns once the Renderer is shut down, so it never takes a ThreadPool worker. */
+        std::thread                             m_renderThread;
+
+    // ============================== [Private Local Methods] ============================== //
+
+        /**
+         * Handles the engine-wide shortcuts, F11 captures a Chrome trace of the next frames.
+         */
+        void    KeyboardInputHandler    (EKey   p_key,
+                                         EState p_state);
+
 };  // !class Engine
 
 extern ENGINE_API Engine* GEngine;
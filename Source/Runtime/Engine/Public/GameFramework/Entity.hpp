@@ -5,6 +5,7 @@
 #include "ObjectManager.hpp"
 
 #include "Components/SceneComponent.hpp"
+#include "RenderScene.hpp"
 
 // ==============================[Forward Declaration]============================== //
 
@@ -41,6 +42,9 @@ class ENGINE_API Entity : public Object
             {
                 component->SetOwner(this);
 
+                if (m_renderScene)
+                    m_renderScene->AddComponent(component);
+
                 if (m_hasBegunPlay)
                 {
                     component->PreInitialize();
@@ -128,6 +132,8 @@ class ENGINE_API Entity : public Object
 
         FORCEINLINE Vector3                                 GetRight                    ()                                                      const;
 
+        FORCEINLINE RenderScene*                            GetRenderScene              ()                                                      const;
+
         FORCEINLINE SceneComponent*                         GetRootComponent            ()                                                      const;
 
         FORCEINLINE Vector3                                 GetUp                       ()                                                      const;                                 
@@ -191,6 +197,8 @@ class ENGINE_API Entity : public Object
                                                                                          bool const                     p_sweep = false, 
                                                                                          HitResult*                     p_outHitResult = nullptr);
         
+        FORCEINLINE void                                    SetRenderScene              (RenderScene*                   p_renderScene);
+
         bool                                                SetRootComponent            (SceneComponent*                p_newRootComponent);
 
         void                                                SetWorldLocation            (Vector3 const&                 p_newLocation,
@@ -264,6 +272,9 @@ class ENGINE_API Entity : public Object
 
         World*                          m_world;
 
+        /** The render scene of the level this entity is in, its components are registered in it. */
+        RenderScene*                    m_renderScene;
+
     // =================================[Private Local Methods]================================= //
 
         void    InternalDispatchBlockingHit (PrimitiveComponent* const      p_myComponent,
@@ -199,6 +199,16 @@ FORCEINLINE Vector3                                 Entity::GetRight
     return (m_rootComponent ? m_rootComponent->GetRight() : Vector3::Right);
 }
 
+/**
+ * Gets the render scene of the level this Entity is in.
+ *
+ * @return The render scene, nullptr if this Entity is in no level.
+ */
+FORCEINLINE RenderScene*                            Entity::GetRenderScene       ()  const
+{
+    return m_renderScene;
+}
+
 /**
  * Gets the root component of this Entity. If the root component is nullptr,
  * this Entity is not spacialized.
@@ -371,6 +381,16 @@ FORCEINLINE bool                                    Entity::RemoveComponent
     return p_entityComponent->Destroy();
 }
 
+/**
+ * Sets the render scene the components added to this Entity are registered in, set by the level this Entity enters.
+ *
+ * @param p_renderScene The render scene, nullptr once this Entity leaves its level.
+ */
+FORCEINLINE void                                    Entity::SetRenderScene       (RenderScene*          p_renderScene)
+{
+    m_renderScene = p_renderScene;
+}
+
 INLINE void                                         Entity::Tick                 (float const           p_deltaTime)
 {
     if (!m_canEverTick || !m_hasBegunPlay || IsPendingKill())
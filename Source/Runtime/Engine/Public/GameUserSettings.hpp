@@ -52,6 +52,20 @@ class ENGINE_API GameUserSettings : public UniqueObject
          */
         INLINE float    GetAnisotropy       ()  const noexcept  { return m_anisotropy; }
 
+        /**
+         * @return The number of busy-wait iterations before a thread waiting for a frame yields.
+         *
+         * @thread_safety   This function must only be called from the main thread.
+         */
+        INLINE uint32   GetFrameSpinCount   ()  const noexcept  { return m_frameSpinCount; }
+
+        /**
+         * @return The number of yields before a thread waiting for a frame is put to sleep.
+         *
+         * @thread_safety   This function must only be called from the main thread.
+         */
+        INLINE uint32   GetFrameYieldCount  ()  const noexcept  { return m_frameYieldCount; }
+
     private:
 
     // ============================== [Private Local Properties] ============================== //
@@ -70,6 +84,10 @@ class ENGINE_API GameUserSettings : public UniqueObject
 
         float   m_anisotropy        = 1.0f;
 
+        uint32  m_frameSpinCount    = 256u;
+
+        uint32  m_frameYieldCount   = 16u;
+
 };  // !class GameUserSettings
 
 #endif // !__GAME_USER_SETTINGS_HPP__
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "CoreMinimal.hpp"
 #include "GameWorldSettings.hpp"
 #include "ObjectManager.hpp"
+#include "RenderScene.hpp"
 
 // ==============================[Forward Declaration]============================== //
 
@@ -21,9 +22,9 @@ class ENGINE_API Level : public Object
 
 		Level	()      				= default;
 
-		Level	(Level const&   p_copy)	= default;
+		Level	(Level const&   p_copy)	= delete;
 
-		Level	(Level&&        p_move)	= default;
+		Level	(Level&&        p_move)	= delete;
 
 		~Level  ()						= default;
 
@@ -53,6 +54,7 @@ class ENGINE_API Level : public Object
 				{
                     entity->SetWorld(GetWorld());
                     m_entities.push_back(entity);
+                    m_renderScene.AddEntity(*entity);
 				}
 
 				return entity;
@@ -73,6 +75,7 @@ class ENGINE_API Level : public Object
 				{
                     entity->SetWorld(GetWorld());
                     m_entities.push_back(entity);
+                    m_renderScene.AddEntity(*entity);
 				}
 
 				return entity;
@@ -94,6 +97,7 @@ class ENGINE_API Level : public Object
 				{
                     entity->SetWorld(GetWorld());
                     m_entities.push_back(entity);
+                    m_renderScene.AddEntity(*entity);
 				}
 
 				return entity;
@@ -178,6 +182,8 @@ class ENGINE_API Level : public Object
 
 		size_t								GetEntityCount		    ()								const;
 
+		RenderScene&						GetRenderScene		    ();
+
         void                                InitializeEntities      ();
 
         Level*                              Load                    (std::string const& p_name);
@@ -188,7 +194,7 @@ class ENGINE_API Level : public Object
 
     // ==============================[Private Local Properties]============================== //
 
-        Level&  operator=   (Level const&   p_copy) = default;
+        Level&  operator=   (Level const&   p_copy) = delete;
 
 	private:
 
@@ -200,6 +206,9 @@ class ENGINE_API Level : public Object
 
 		std::vector<Entity*>	m_entities;
 
+		/** The render components of the entities, registered as they are spawned and unregistered as they are destroyed. */
+		RenderScene				m_renderScene;
+
 }; // !class Level
 
 #include "Level.inl"
@@ -32,6 +32,8 @@ INLINE bool							Level::DestroyEntity		(Entity*		p_entity)
 	if (check != m_entities.end())
 		m_entities.erase(check);
 
+    m_renderScene.RemoveEntity(*p_entity);
+
     p_entity->Destroy();
 
     return ObjectManager::Get().DestroyObject(p_entity);
@@ -47,6 +49,11 @@ INLINE size_t						Level::GetEntityCount		()	const
 	return m_entities.size();
 }
 
+INLINE RenderScene&					Level::GetRenderScene		()
+{
+	return m_renderScene;
+}
+
 INLINE void                         Level::InitializeEntities   ()
 {
     for (auto entity : m_entities)
@@ -1,9 +1,22 @@
 #include "PCH.hpp"
 #include "RHI.hpp"
 #include "AssetManager.hpp"
+#include "AssetAwaitable.hpp"
 
 #include "Vulkan/Asset/Material/Material.hpp"
 
+// ============================== [Internal Functions] ============================== //
+
+static char const*  GetVertexShaderName     (bool p_isOpaque) noexcept
+{
+    return p_isOpaque ? "Default/Shaders/gbuffer.vert" : "Default/Shaders/transparent.vert";
+}
+
+static char const*  GetFragmentShaderName   (bool p_isOpaque) noexcept
+{
+    return p_isOpaque ? "Default/Shaders/gbuffer.frag" : "Default/Shaders/transparent.frag";
+}
+
 // ============================== [Public Constructor] ============================== //
 
 Material::Material  (std::string const&     p_name,
@@ -26,15 +39,18 @@ Material::Material  (std::string const&     p_name,
 
     for (auto& texture : m_textures)
     {
-        if (!texture)
+        if (!texture || !texture->IsValid())
             texture = assetManager.Get<Texture>("Default/Textures/default", ELoadingMode::BLOCKING);
     }
 
+    std::shared_ptr<Shader> vertexShader   = assetManager.Get<Shader>(GetVertexShaderName  (IsOpaque()), ELoadingMode::BLOCKING);
+    std::shared_ptr<Shader> fragmentShader = assetManager.Get<Shader>(GetFragmentShaderName(IsOpaque()), ELoadingMode::BLOCKING);
+
     SetupDescriptorPool     ();
     SetupDescriptorSetLayout();
     SetupDescriptorSet      ();
     SetupPipelineLayout     ();
-    SetupPipeline           ();
+    SetupPipeline           (*vertexShader, *fragmentShader);
 
     m_isLoaded .store(true,  std::memory_order_release);
     m_isPending.store(false, std::memory_order_release);
@@ -44,50 +60,8 @@ Material::Material  (std::string const&     p_name,
 
 void    Material::Deserialize   (std::string const& p_path) noexcept
 {
-    std::ifstream asset(p_path, std::ios::in);
-
-    if (asset.is_open())
-    {
-        // Checks file header.
-        std::string header;
-
-        std::getline(asset, header);
-
-        if (header == Reflect::GetEnumName(EAssetType::MATERIAL))
-        {
-            // Parses the json file.
-            Json json = Json::parse(asset);
-
-            AssetManager& assetManager = AssetManager::Get();
-
-            m_data.albedo    = json.value<Color>("Albedo",    Color::White);
-            m_data.metallic  = json.value<float>("Metallic",  0.0f);
-            m_data.roughness = json.value<float>("Roughness", 0.0f);
-            m_data.ao        = json.value<float>("AO",        0.0f);
-
-            m_textures[0] = assetManager.Get<Texture>(json.value("AlbedoMap",    "Default/Textures/default").c_str(), ELoadingMode::BLOCKING);
-            m_textures[1] = assetManager.Get<Texture>(json.value("NormalMap",    "Default/Textures/default").c_str(), ELoadingMode::BLOCKING);
-            m_textures[2] = assetManager.Get<Texture>(json.value("MetallicMap",  "Default/Textures/default").c_str(), ELoadingMode::BLOCKING);
-            m_textures[3] = assetManager.Get<Texture>(json.value("RoughnessMap", "Default/Textures/default").c_str(), ELoadingMode::BLOCKING);
-            m_textures[4] = assetManager.Get<Texture>(json.value("AOMap",        "Default/Textures/default").c_str(), ELoadingMode::BLOCKING);
-
-            SetupDescriptorPool     ();
-            SetupDescriptorSetLayout();
-            SetupDescriptorSet      ();
-            SetupPipelineLayout     ();
-            SetupPipeline           ();
-
-            m_isLoaded.store(true, std::memory_order_release);
-        }
-
-        else
-            LOG(LogAssetManager, Error, "Material file corrupted : %s", p_path.c_str());
-    }
-
-    else
-        LOG(LogAssetManager, Error, "Failed to open \"%s\" for deserialization", p_path.c_str());
-
-    m_isPending.store(false, std::memory_order_release);
+    // Stays pending until the coroutine completes.
+    Load(p_path).Start();
 }
 
 void    Material::Serialize     (std::string const& p_path) noexcept
@@ -124,7 +98,11 @@ void    Material::Serialize     (std::string const& p_path) noexcept
     vkDestroyDescriptorPool     (device, m_renderData.descriptorPool,      nullptr);
     vkDestroyDescriptorSetLayout(device, m_renderData.descriptorSetLayout, nullptr);
     vkDestroyPipelineLayout     (device, m_renderData.pipelineLayout,      nullptr);
-    vkDestroyPipeline           (device, m_renderData.pipeline,            nullptr);
+
+    for (VkPipeline pipeline : m_renderData.pipelines)
+    {
+        vkDestroyPipeline(device, pipeline, nullptr);
+    }
 
     for (auto& texture : m_textures)
     {
@@ -137,6 +115,99 @@ void    Material::Serialize     (std::string const& p_path) noexcept
 
 // ============================== [Private Local Methods] ============================== //
 
+Task<void>  Material::Load                      (std::string p_path) noexcept
+{
+    AssetManager&           assetManager = AssetManager::Get();
+    bool                    isParsed     = false;
+    std::shared_ptr<Shader> vertexShader;
+    std::shared_ptr<Shader> fragmentShader;
+
+    {
+        std::ifstream asset(p_path, std::ios::in);
+
+        if (asset.is_open())
+        {
+            // Checks file header.
+            std::string header;
+
+            std::getline(asset, header);
+
+            if (header == Reflect::GetEnumName(EAssetType::MATERIAL))
+            {
+                // Parses the json file.
+                Json json = Json::parse(asset);
+
+                m_data.albedo    = json.value<Color>("Albedo",    Color::White);
+                m_data.metallic  = json.value<float>("Metallic",  0.0f);
+                m_data.roughness = json.value<float>("Roughness", 0.0f);
+                m_data.ao        = json.value<float>("AO",        0.0f);
+
+                // Every texture is requested before awaiting any of them, so they load in parallel.
+                m_textures[0] = assetManager.Get<Texture>(json.value("AlbedoMap",    "Default/Textures/default").c_str());
+                m_textures[1] = assetManager.Get<Texture>(json.value("NormalMap",    "Default/Textures/default").c_str());
+                m_textures[2] = assetManager.Get<Texture>(json.value("MetallicMap",  "Default/Textures/default").c_str());
+                m_textures[3] = assetManager.Get<Texture>(json.value("RoughnessMap", "Default/Textures/default").c_str());
+                m_textures[4] = assetManager.Get<Texture>(json.value("AOMap",        "Default/Textures/default").c_str());
+
+                // The shaders depend on the albedo's opacity, they load along with the textures.
+                vertexShader   = assetManager.Get<Shader>(GetVertexShaderName  (IsOpaque()));
+                fragmentShader = assetManager.Get<Shader>(GetFragmentShaderName(IsOpaque()));
+
+                isParsed = true;
+            }
+
+            else
+                LOG(LogAssetManager, Error, "Material file corrupted : %s", p_path.c_str());
+        }
+
+        else
+            LOG(LogAssetManager, Error, "Failed to open \"%s\" for deserialization", p_path.c_str());
+    }
+
+    if (isParsed)
+    {
+        bool areTexturesValid = true;
+
+        for (auto& texture : m_textures)
+        {
+            if (texture)
+                texture = co_await AssetAwaitable(std::move(texture));
+
+            if (!texture || !texture->IsValid())
+                texture = co_await AssetAwaitable(assetManager.Get<Texture>("Default/Textures/default"));
+
+            areTexturesValid &= texture && texture->IsValid();
+        }
+
+        if (vertexShader)
+            vertexShader   = co_await AssetAwaitable(std::move(vertexShader));
+
+        if (fragmentShader)
+            fragmentShader = co_await AssetAwaitable(std::move(fragmentShader));
+
+        if (!areTexturesValid)
+            LOG(LogAssetManager, Error, "Failed to load the textures of material %s", m_name.c_str());
+
+        else if (vertexShader && vertexShader->IsValid() && fragmentShader && fragmentShader->IsValid())
+        {
+            SetupDescriptorPool     ();
+            SetupDescriptorSetLayout();
+            SetupDescriptorSet      ();
+            SetupPipelineLayout     ();
+            SetupPipeline           (*vertexShader, *fragmentShader);
+
+            m_isLoaded.store(true, std::memory_order_release);
+        }
+
+        else
+            LOG(LogAssetManager, Error, "Failed to load the shaders of material %s", m_name.c_str());
+    }
+
+    m_isPending.store(false, std::memory_order_release);
+
+    ResumeWaiters();
+}
+
 void    Material::SetupDescriptorPool       () noexcept
 {
     VkDevice const device = RHI::Get().GetDevice()->GetLogicalDevice();
@@ -195,9 +266,10 @@ void    Material::SetupDescriptorSet        () noexcept
 
     Debug::SetDescriptorSetName(device, m_renderData.descriptorSet, (m_name + "_DescriptorSet").c_str());
 
+    // Load awaits the textures and the constructor gets them BLOCKING, so they are all loaded by now.
     for (uint32 i = 0u; i < static_cast<uint32>(m_textures.size()); ++i)
     {
-        while (!m_textures.at(i)->IsValid());
+        assert(m_textures[i] && m_textures[i]->IsValid());
 
         VkDescriptorImageInfo imageInfo = {};
 
@@ -221,60 +293,55 @@ void    Material::SetupPipelineLayout       () noexcept
 {
     VkDevice const device = RHI::Get().GetDevice()->GetLogicalDevice();
 
-    std::array<VkDescriptorSetLayout, 3> descriptorSetLayouts = {
-        RHI::Get().GetCameraLayout(),
-        RHI::Get().GetLightLayout (),
-        m_renderData.descriptorSetLayout
+    // The transform and material of each instance are read from the frame's instance buffer.
+    std::array<VkDescriptorSetLayout, 4> descriptorSetLayouts = {
+        RHI::Get().GetCameraLayout  (),
+        RHI::Get().GetLightLayout   (),
+        m_renderData.descriptorSetLayout,
+        RHI::Get().GetInstanceLayout()
     };
 
-    std::array<VkPushConstantRange, 2> pushConstants = {};
-
-    pushConstants[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
-    pushConstants[0].offset     = 0u;
-    pushConstants[0].size       = sizeof(Matrix4x4);
-
-    pushConstants[1].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
-    pushConstants[1].offset     = sizeof(Matrix4x4);
-    pushConstants[1].size       = sizeof(MaterialData);
-
     VkPipelineLayoutCreateInfo pipelineLayoutCI = { VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
 
-    pipelineLayoutCI.setLayoutCount         = static_cast<uint32>(descriptorSetLayouts.size());
-    pipelineLayoutCI.pSetLayouts            = descriptorSetLayouts.data();
-    pipelineLayoutCI.pushConstantRangeCount = static_cast<uint32>(pushConstants.size());
-    pipelineLayoutCI.pPushConstantRanges    = pushConstants.data();
+    pipelineLayoutCI.setLayoutCount = static_cast<uint32>(descriptorSetLayouts.size());
+    pipelineLayoutCI.pSetLayouts    = descriptorSetLayouts.data();
 
     VK_CHECK_RESULT(vkCreatePipelineLayout(device, &pipelineLayoutCI, nullptr, &m_renderData.pipelineLayout));
 
     Debug::SetPipelineLayoutName(device, m_renderData.pipelineLayout, (m_name + "_PipelineLayout").c_str());
 }
 
-void    Material::SetupPipeline             () noexcept
+void    Material::SetupPipeline             (Shader const&  p_vertexShader,
+                                             Shader const&  p_fragmentShader) noexcept
 {
     auto const& device = RHI::Get().GetDevice       ();
     auto const& cache  = RHI::Get().GetPipelineCache();
 
-    std::array<VkSpecializationMapEntry, 5> entries = {};
+    std::array<VkSpecializationMapEntry, 6> entries = {};
 
     entries[0].constantID = 0u;
     entries[1].constantID = 1u;
     entries[2].constantID = 2u;
     entries[3].constantID = 3u;
     entries[4].constantID = 4u;
+    entries[5].constantID = 5u;
 
     entries[0].offset = 0u * sizeof(uint32);
     entries[1].offset = 1u * sizeof(uint32);
     entries[2].offset = 2u * sizeof(uint32);
     entries[3].offset = 3u * sizeof(uint32);
     entries[4].offset = 4u * sizeof(uint32);
+    entries[5].offset = 5u * sizeof(uint32);
 
     entries[0].size = sizeof(uint32);
     entries[1].size = sizeof(uint32);
     entries[2].size = sizeof(uint32);
     entries[3].size = sizeof(uint32);
     entries[4].size = sizeof(uint32);
+    entries[5].size = sizeof(uint32);
 
-    std::vector<uint32> layout(m_textures.size());
+    // The last constant tells the vertex shader whether normals and tangents are octahedral-encoded.
+    std::vector<uint32> layout(entries.size());
 
     for (size_t i = 0; i < m_textures.size(); ++i)
     {
@@ -300,20 +367,11 @@ void    Material::SetupPipeline             () noexcept
     shaderStages[1].pName               = "main";
     shaderStages[1].pSpecializationInfo = &info;
 
-    if (IsOpaque())
-    {
-        shaderStages[0].module = AssetManager::Get().Get<Shader>("Default/Shaders/gbuffer.vert", ELoadingMode::BLOCKING)->GetModule();
-        shaderStages[1].module = AssetManager::Get().Get<Shader>("Default/Shaders/gbuffer.frag", ELoadingMode::BLOCKING)->GetModule();
-    }
+    shaderStages[0].module = p_vertexShader  .GetModule();
+    shaderStages[1].module = p_fragmentShader.GetModule();
 
-    else
-    {
-        shaderStages[0].module = AssetManager::Get().Get<Shader>("Default/Shaders/transparent.vert", ELoadingMode::BLOCKING)->GetModule();
-        shaderStages[1].module = AssetManager::Get().Get<Shader>("Default/Shaders/transparent.frag", ELoadingMode::BLOCKING)->GetModule();
-    }
-
-    VkVertexInputBindingDescription                  vertexInputBinding    = Vertex::GetBindingDescription   ();
-    std::array<VkVertexInputAttributeDescription, 4> vertexInputAttributes = Vertex::GetAttributeDescriptions();
+    VkVertexInputBindingDescription                  vertexInputBinding    = {};
+    std::array<VkVertexInputAttributeDescription, 4> vertexInputAttributes = {};
 
     VkPipelineVertexInputStateCreateInfo vertexInputStateCI = { VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO };
 
@@ -405,12 +463,22 @@ void    Material::SetupPipeline             () noexcept
     pipelineCI.renderPass          = RHI::Get().GetRenderPass(ERenderStage::LIGHTING)->GetHandle();
     pipelineCI.subpass             = IsOpaque() ? 0u : 2u;
 
-    VK_CHECK_RESULT(vkCreateGraphicsPipelines(device->GetLogicalDevice(),
-                                              cache ->GetHandle       (),
-                                              1u,
-                                              &pipelineCI,
-                                              nullptr,
-                                              &m_renderData.pipeline));
+    // Only the vertex input and the decoding of normals differ between formats.
+    for (size_t i = 0; i < m_renderData.pipelines.size(); ++i)
+    {
+        EVertexFormat const format = static_cast<EVertexFormat>(i);
+
+        vertexInputBinding    = Vertex::GetBindingDescription   (format);
+        vertexInputAttributes = Vertex::GetAttributeDescriptions(format);
+        layout.back()         = format != EVertexFormat::FULL;
 
-    Debug::SetPipelineName(device->GetLogicalDevice(), m_renderData.pipeline, (m_name + "_Pipeline").c_str());
+        VK_CHECK_RESULT(vkCreateGraphicsPipelines(device->GetLogicalDevice(),
+                                                  cache ->GetHandle       (),
+                                                  1u,
+                                                  &pipelineCI,
+                                                  nullptr,
+                                                  &m_renderData.pipelines[i]));
+
+        Debug::SetPipelineName(device->GetLogicalDevice(), m_renderData.pipelines[i], (m_name + "_Pipeline_" + std::to_string(i)).c_str());
+    }
 }
\ No newline at end of file
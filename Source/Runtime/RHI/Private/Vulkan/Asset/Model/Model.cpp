@@ -6,6 +6,141 @@
 
 #include "Vulkan/Asset/Model/Model.hpp"
 
+// ============================== [Private Static Methods] ============================== //
+
+namespace
+{
+    Bounds              ComputeBounds   (std::vector<Vertex> const& p_vertices)
+    {
+        Vector3 min(p_vertices.front().position);
+        Vector3 max(p_vertices.front().position);
+
+        for (Vertex const& vertex : p_vertices)
+        {
+            min = Vector3::Min(min, vertex.position);
+            max = Vector3::Max(max, vertex.position);
+        }
+
+        return Bounds(min, max);
+    }
+
+    /**
+     * Bounds of vertices already encoded, for the models serialized before their bounds were.
+     * FULL and PACKED vertices start with their position, a QUANTIZED mesh is bounded by its dequantization cube.
+     */
+    Bounds              ComputeBounds   (ANSICHAR const*            p_data,
+                                         uint32                     p_vertexCount,
+                                         Mesh const&                p_mesh)
+    {
+        if (p_mesh.vertexFormat == EVertexFormat::QUANTIZED)
+            return Bounds(Vector3::Zero, Vector3::One).GetTransformed(p_mesh.dequantization);
+
+        uint32 const stride = Vertex::GetBindingDescription(p_mesh.vertexFormat).stride;
+        Vector3      position;
+
+        memcpy(&position, p_data, sizeof(Vector3));
+
+        Bounds bounds(position, position);
+
+        for (uint32 i = 1u; i < p_vertexCount; ++i)
+        {
+            memcpy(&position, p_data + static_cast<size_t>(i) * stride, sizeof(Vector3));
+
+            bounds.m_min = Vector3::Min(bounds.m_min, position);
+            bounds.m_max = Vector3::Max(bounds.m_max, position);
+        }
+
+        return bounds;
+    }
+
+    /**
+     * Packs the vertices of a mesh in the layout of its format, p_outMesh's bounds must already be computed.
+     * A QUANTIZED mesh is fit in a cube rather than its bounds, the uniform scale keeps its normals valid under the dequantization.
+     */
+    std::vector<uint8>  EncodeVertices  (MeshCreateInfo const&  p_mesh,
+                                         Mesh&                  p_outMesh)
+    {
+        std::vector<uint8> data;
+
+        switch (p_mesh.format)
+        {
+            case EVertexFormat::PACKED:
+            {
+                data.resize(sizeof(PackedVertex) * p_mesh.vertices.size());
+
+                PackedVertex* vertices = reinterpret_cast<PackedVertex*>(data.data());
+
+                for (size_t i = 0; i < p_mesh.vertices.size(); ++i)
+                    vertices[i] = Vertex::Pack(p_mesh.vertices[i]);
+
+                break;
+            }
+
+            case EVertexFormat::QUANTIZED:
+            {
+                Vector3 const min(p_outMesh.bounds.m_min);
+                float   const extent = Math::Max(p_outMesh.bounds.GetSize().GetMax(), MATH_EPSILON_F);
+
+                data.resize(sizeof(QuantizedVertex) * p_mesh.vertices.size());
+
+                QuantizedVertex* vertices = reinterpret_cast<QuantizedVertex*>(data.data());
+
+                for (size_t i = 0; i < p_mesh.vertices.size(); ++i)
+                    vertices[i] = Vertex::Quantize(p_mesh.vertices[i], min, extent);
+
+                p_outMesh.dequantization = Matrix4x4::Translate(min) * Matrix4x4::Scale(Vector3(extent));
+
+                break;
+            }
+
+            default:
+            {
+                data.resize(sizeof(Vertex) * p_mesh.vertices.size());
+
+                memcpy(data.data(), p_mesh.vertices.data(), data.size());
+
+                break;
+            }
+        }
+
+        p_outMesh.vertexFormat = p_mesh.format;
+
+        return data;
+    }
+
+    /**
+     * Narrows the indices of a mesh to 16 bits when all its vertices can be addressed with them.
+     */
+    std::vector<uint8>  EncodeIndices   (MeshCreateInfo const&  p_mesh,
+                                         Mesh&                  p_outMesh)
+    {
+        std::vector<uint8> data;
+
+        if (p_mesh.vertices.size() < 65536u)
+        {
+            data.resize(sizeof(uint16) * p_mesh.indices.size());
+
+            uint16* indices = reinterpret_cast<uint16*>(data.data());
+
+            for (size_t i = 0; i < p_mesh.indices.size(); ++i)
+                indices[i] = static_cast<uint16>(p_mesh.indices[i]);
+
+            p_outMesh.indexType = VK_INDEX_TYPE_UINT16;
+        }
+
+        else
+        {
+            data.resize(sizeof(uint32) * p_mesh.indices.size());
+
+            memcpy(data.data(), p_mesh.indices.data(), data.size());
+
+            p_outMesh.indexType = VK_INDEX_TYPE_UINT32;
+        }
+
+        return data;
+    }
+}
+
 // ============================== [Public Constructor] ============================== //
 
 Model::Model    (std::string                 const& p_name,
@@ -29,9 +164,14 @@ Model::Model    (std::string                 const& p_name,
         if (p_meshes[i].vertices.empty() || p_meshes[i].vertices.empty())
             continue;
 
-        Mesh   newMesh          = {};
-        size_t vertexBufferSize = sizeof(Vertex) * p_meshes[i].vertices.size();
-        size_t indexBufferSize  = sizeof(uint32) * p_meshes[i].indices .size();
+        Mesh               newMesh          = {};
+
+        newMesh.bounds = ComputeBounds(p_meshes[i].vertices);
+
+        std::vector<uint8> vertices         = EncodeVertices(p_meshes[i], newMesh);
+        std::vector<uint8> indices          = EncodeIndices (p_meshes[i], newMesh);
+        size_t             vertexBufferSize = vertices.size();
+        size_t             indexBufferSize  = indices .size();
 
         // Staging vertex buffer.
         Buffer             stagingVertexBuffer   = {};
@@ -42,7 +182,7 @@ Model::Model    (std::string                 const& p_name,
 
         allocator->CreateBuffer(stagingVertexBuffer, stagingVertexBufferCI, VMA_ALLOCATION_CREATE_MAPPED_BIT, VMA_MEMORY_USAGE_CPU_ONLY, 0u);
 
-        memcpy(stagingVertexBuffer.allocationInfo.pMappedData, p_meshes[i].vertices.data(), vertexBufferSize);
+        memcpy(stagingVertexBuffer.allocationInfo.pMappedData, vertices.data(), vertexBufferSize);
 
         // Actual vertex buffer.
         VkBufferCreateInfo vertexBufferCI = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
@@ -61,7 +201,7 @@ Model::Model    (std::string                 const& p_name,
 
         allocator->CreateBuffer(stagingIndexBuffer, stagingIndexBufferCI, VMA_ALLOCATION_CREATE_MAPPED_BIT, VMA_MEMORY_USAGE_CPU_ONLY, 0u);
 
-        memcpy(stagingIndexBuffer.allocationInfo.pMappedData, p_meshes[i].indices.data(), static_cast<size_t>(indexBufferSize));
+        memcpy(stagingIndexBuffer.allocationInfo.pMappedData, indices.data(), indexBufferSize);
 
         // Actual index buffer.
         VkBufferCreateInfo indexBufferCI = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
@@ -159,6 +299,9 @@ void    Model::Deserialize   (std::string const& p_path) noexcept
         std::vector<Buffer> stagingVertexBuffers(m_meshes.size());
         std::vector<Buffer> stagingIndexBuffers (m_meshes.size());
 
+        // Models serialized before the compact formats only hold full vertices and 32-bit indices.
+        bool const hasFormats = json.contains("Formats") && json.contains("IndexStrides") && json.contains("Bounds");
+
         Fence         fence;
         CommandBuffer cmdBuffer(device->GetTransferCommandPool()->AllocateCommandBuffer(VK_COMMAND_BUFFER_LEVEL_PRIMARY));
 
@@ -177,11 +320,45 @@ void    Model::Deserialize   (std::string const& p_path) noexcept
                 return;
             }
 
+            uint32 indexStride = sizeof(uint32);
+
+            if (hasFormats)
+            {
+                m_meshes[i].vertexFormat = Reflect::EnumCast<EVertexFormat>(json["Formats"].at(i).get<std::string>()).value_or(EVertexFormat::FULL);
+
+                indexStride = json["IndexStrides"].at(i).get<uint32>();
+
+                if (m_meshes[i].vertexFormat == EVertexFormat::QUANTIZED)
+                {
+                    Vector3 const origin(json["Bounds"].at(i * 4u + 0u).get<float>(),
+                                         json["Bounds"].at(i * 4u + 1u).get<float>(),
+                                         json["Bounds"].at(i * 4u + 2u).get<float>());
+                    float   const extent(json["Bounds"].at(i * 4u + 3u).get<float>());
+
+                    m_meshes[i].dequantization = Matrix4x4::Translate(origin) * Matrix4x4::Scale(Vector3(extent));
+                }
+            }
+
+            m_meshes[i].indexType = indexStride == sizeof(uint16) ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+
+            if (json.contains("AABBs"))
+            {
+                m_meshes[i].bounds = Bounds(Vector3(json["AABBs"].at(i * 6u + 0u).get<float>(),
+                                                    json["AABBs"].at(i * 6u + 1u).get<float>(),
+                                                    json["AABBs"].at(i * 6u + 2u).get<float>()),
+                                            Vector3(json["AABBs"].at(i * 6u + 3u).get<float>(),
+                                                    json["AABBs"].at(i * 6u + 4u).get<float>(),
+                                                    json["AABBs"].at(i * 6u + 5u).get<float>()));
+            }
+
+            else
+                m_meshes[i].bounds = ComputeBounds(buffer.data() + vertexOffset, vertexCount, m_meshes[i]);
+
             VkBufferCreateInfo bufferCI            = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
             Buffer             stagingVertexBuffer = {};
             Buffer             stagingIndexBuffer  = {};
-            VkDeviceSize       vertexBufferSize    = sizeof(Vertex) * vertexCount;
-            VkDeviceSize       indexBufferSize     = sizeof(uint32) * indexCount;
+            VkDeviceSize       vertexBufferSize    = static_cast<VkDeviceSize>(Vertex::GetBindingDescription(m_meshes[i].vertexFormat).stride) * vertexCount;
+            VkDeviceSize       indexBufferSize     = static_cast<VkDeviceSize>(indexStride) * indexCount;
 
             // Staging vertex buffer.
             bufferCI.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
@@ -307,6 +484,23 @@ void    Model::Serialize     (std::string const& p_path) noexcept
             json["Offsets"] += static_cast<uint32>(size);
             json["Offsets"] += static_cast<uint32>(size + vertexBuffer.size);
 
+            // Layout of the data, the bounds are only read back for QUANTIZED meshes.
+            Vector3 const origin(m_meshes[i].dequantization.GetOrigin());
+
+            json["Formats"]      += std::string(Reflect::GetEnumName(m_meshes[i].vertexFormat).value_or("FULL"));
+            json["IndexStrides"] += static_cast<uint32>(m_meshes[i].indexType == VK_INDEX_TYPE_UINT16 ? sizeof(uint16) : sizeof(uint32));
+            json["Bounds"]       += origin.m_x;
+            json["Bounds"]       += origin.m_y;
+            json["Bounds"]       += origin.m_z;
+            json["Bounds"]       += m_meshes[i].dequantization(0, 0);
+
+            json["AABBs"]        += m_meshes[i].bounds.m_min.m_x;
+            json["AABBs"]        += m_meshes[i].bounds.m_min.m_y;
+            json["AABBs"]        += m_meshes[i].bounds.m_min.m_z;
+            json["AABBs"]        += m_meshes[i].bounds.m_max.m_x;
+            json["AABBs"]        += m_meshes[i].bounds.m_max.m_y;
+            json["AABBs"]        += m_meshes[i].bounds.m_max.m_z;
+
             size += vertexBuffer.size;
             size += indexBuffer .size;
 
@@ -2,44 +2,230 @@
 
 #include "Vulkan/Asset/Model/Vertex.hpp"
 
-// ============================== [Public Static Methods] ============================== //
+// ============================== [Private Static Methods] ============================== //
 
-void                                                Vertex::HashCombine                 (size_t& p_seed, size_t p_hash)
+namespace
 {
-    p_seed += 0x9e3779b9 + (p_seed << 6) + (p_seed >> 2);
-    p_seed ^= p_hash;
+    /**
+     * Converts a float to an IEEE 754 half, rounding to nearest even.
+     */
+    uint16  ToHalf          (float p_value)
+    {
+        uint32 bits;
+
+        std::memcpy(&bits, &p_value, sizeof(bits));
+
+        uint32 const sign     = (bits >> 16u) & 0x8000u;
+        int32  const exponent = static_cast<int32>((bits >> 23u) & 0xffu) - 127 + 15;
+        uint32       mantissa = bits & 0x7fffffu;
+
+        // Infinity and NaN.
+        if (((bits >> 23u) & 0xffu) == 0xffu)
+            return static_cast<uint16>(sign | 0x7c00u | (mantissa ? 0x200u : 0u));
+
+        // Too big for a half.
+        if (exponent >= 31)
+            return static_cast<uint16>(sign | 0x7c00u);
+
+        // Too small for a normal half, the implicit bit is shifted in the mantissa.
+        if (exponent <= 0)
+        {
+            if (exponent < -10)
+                return static_cast<uint16>(sign);
+
+            mantissa |= 0x800000u;
+
+            uint32 const shift   = static_cast<uint32>(14 - exponent);
+            uint32 const rest    = mantissa & ((1u << shift) - 1u);
+            uint32 const halfway = 1u << (shift - 1u);
+            uint32       half    = mantissa >> shift;
+
+            if (rest > halfway || (rest == halfway && (half & 1u)))
+                ++half;
+
+            return static_cast<uint16>(sign | half);
+        }
+
+        uint32 const rest = mantissa & 0x1fffu;
+        uint32       half = (static_cast<uint32>(exponent) << 10u) | (mantissa >> 13u);
+
+        // A carry out of the mantissa correctly bumps the exponent.
+        if (rest > 0x1000u || (rest == 0x1000u && (half & 1u)))
+            ++half;
+
+        return static_cast<uint16>(sign | half);
+    }
+
+    /**
+     * Maps a direction on the octahedron then unfolds the lower half over the upper one, see gbuffer.vert for the decoding.
+     */
+    void    ToOctahedral    (Vector3 const& p_direction,
+                             int16          (&p_outEncoded)[2])
+    {
+        float const length = Math::Abs(p_direction.m_x) + Math::Abs(p_direction.m_y) + Math::Abs(p_direction.m_z);
+
+        if (length == 0.0f)
+        {
+            p_outEncoded[0] = 0;
+            p_outEncoded[1] = 0;
+            return;
+        }
+
+        float x = p_direction.m_x / length;
+        float y = p_direction.m_y / length;
+
+        if (p_direction.m_z < 0.0f)
+        {
+            float const foldedX = (1.0f - Math::Abs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+            float const foldedY = (1.0f - Math::Abs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+
+            x = foldedX;
+            y = foldedY;
+        }
+
+        p_outEncoded[0] = static_cast<int16>(Math::Round(Math::Clamp(x, -1.0f, 1.0f) * 32767.0f));
+        p_outEncoded[1] = static_cast<int16>(Math::Round(Math::Clamp(y, -1.0f, 1.0f) * 32767.0f));
+    }
+
+    uint16  ToUnorm16       (float p_value)
+    {
+        return static_cast<uint16>(Math::Round(Math::Clamp01(p_value) * 65535.0f));
+    }
 }
 
-VkVertexInputBindingDescription                     Vertex::GetBindingDescription       ()
+// ============================== [Public Static Methods] ============================== //
+
+VkVertexInputBindingDescription                     Vertex::GetBindingDescription       (EVertexFormat  p_format)
 {
+    uint32 stride = sizeof(Vertex);
+
+    switch (p_format)
+    {
+        case EVertexFormat::PACKED:
+            stride = sizeof(PackedVertex);
+            break;
+
+        case EVertexFormat::QUANTIZED:
+            stride = sizeof(QuantizedVertex);
+            break;
+
+        default:
+            break;
+    }
+
     return VkVertexInputBindingDescription {
         0u,
-        sizeof(Vertex),
+        stride,
         VK_VERTEX_INPUT_RATE_VERTEX
     };
 }
 
-std::array<VkVertexInputAttributeDescription, 4>    Vertex::GetAttributeDescriptions    ()
+std::array<VkVertexInputAttributeDescription, 4>    Vertex::GetAttributeDescriptions    (EVertexFormat  p_format)
 {
-    return std::array<VkVertexInputAttributeDescription, 4> {
-        0u,
-        0u,
-        VK_FORMAT_R32G32B32_SFLOAT,
-        offsetof(Vertex, position),
+    switch (p_format)
+    {
+        case EVertexFormat::PACKED:
+            return std::array<VkVertexInputAttributeDescription, 4> {
+                0u,
+                0u,
+                VK_FORMAT_R32G32B32_SFLOAT,
+                offsetof(PackedVertex, position),
 
-        1u,
-        0u,
-        VK_FORMAT_R32G32B32_SFLOAT,
-        offsetof(Vertex, normal),
+                1u,
+                0u,
+                VK_FORMAT_R16G16_SNORM,
+                offsetof(PackedVertex, normal),
 
-        2u,
-        0u,
-        VK_FORMAT_R32G32_SFLOAT,
-        offsetof(Vertex, uv),
+                2u,
+                0u,
+                VK_FORMAT_R16G16_SFLOAT,
+                offsetof(PackedVertex, uv),
 
-        3u,
-        0u,
-        VK_FORMAT_R32G32B32_SFLOAT,
-        offsetof(Vertex, tangent)
-    };
+                3u,
+                0u,
+                VK_FORMAT_R16G16_SNORM,
+                offsetof(PackedVertex, tangent)
+            };
+
+        case EVertexFormat::QUANTIZED:
+            return std::array<VkVertexInputAttributeDescription, 4> {
+                0u,
+                0u,
+                VK_FORMAT_R16G16B16A16_UNORM,
+                offsetof(QuantizedVertex, position),
+
+                1u,
+                0u,
+                VK_FORMAT_R16G16_SNORM,
+                offsetof(QuantizedVertex, normal),
+
+                2u,
+                0u,
+                VK_FORMAT_R16G16_SFLOAT,
+                offsetof(QuantizedVertex, uv),
+
+                3u,
+                0u,
+                VK_FORMAT_R16G16_SNORM,
+                offsetof(QuantizedVertex, tangent)
+            };
+
+        default:
+            return std::array<VkVertexInputAttributeDescription, 4> {
+                0u,
+                0u,
+                VK_FORMAT_R32G32B32_SFLOAT,
+                offsetof(Vertex, position),
+
+                1u,
+                0u,
+                VK_FORMAT_R32G32B32_SFLOAT,
+                offsetof(Vertex, normal),
+
+                2u,
+                0u,
+                VK_FORMAT_R32G32_SFLOAT,
+                offsetof(Vertex, uv),
+
+                3u,
+                0u,
+                VK_FORMAT_R32G32B32_SFLOAT,
+                offsetof(Vertex, tangent)
+            };
+    }
+}
+
+PackedVertex                                        Vertex::Pack                        (Vertex const&  p_vertex)
+{
+    PackedVertex packed;
+
+    packed.position = p_vertex.position;
+    packed.uv[0]    = ToHalf(p_vertex.uv.m_x);
+    packed.uv[1]    = ToHalf(p_vertex.uv.m_y);
+
+    ToOctahedral(p_vertex.normal,  packed.normal);
+    ToOctahedral(p_vertex.tangent, packed.tangent);
+
+    return packed;
+}
+
+QuantizedVertex                                     Vertex::Quantize                    (Vertex const&  p_vertex,
+                                                                                         Vector3 const& p_origin,
+                                                                                         float          p_extent)
+{
+    QuantizedVertex quantized;
+
+    Vector3 const position((p_vertex.position - p_origin) / p_extent);
+
+    quantized.position[0] = ToUnorm16(position.m_x);
+    quantized.position[1] = ToUnorm16(position.m_y);
+    quantized.position[2] = ToUnorm16(position.m_z);
+    quantized.position[3] = 0u;
+    quantized.uv[0]       = ToHalf(p_vertex.uv.m_x);
+    quantized.uv[1]       = ToHalf(p_vertex.uv.m_y);
+
+    ToOctahedral(p_vertex.normal,  quantized.normal);
+    ToOctahedral(p_vertex.tangent, quantized.tangent);
+
+    return quantized;
 }
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include "PCH.hpp"
+#include "RHI.hpp"
+
+#include "Vulkan/Object/SecondaryCommandBuffers.hpp"
+
+// ============================== [Public Constructor and Destructor] ============================== //
+
+SecondaryCommandBuffers::SecondaryCommandBuffers    () noexcept
+{
+    // Same threads as the command pools of the Device, the map is not modified once the recording starts.
+    for (auto const& thread : ThreadPool::Get().GetThreads())
+        m_threads.try_emplace(thread.get_id());
+
+    // The Device only looks a pool up for the thread asking, so this one is fetched now.
+    m_shared.pool = RHI::Get().GetDevice()->GetGraphicsCommandPool().get();
+}
+
+SecondaryCommandBuffers::~SecondaryCommandBuffers   ()
+{
+    for (auto const& it : m_threads)
+    {
+        for (CommandBuffer const& cmdBuffer : it.second.buffers)
+            it.second.pool->FreeCommandBuffer(cmdBuffer);
+    }
+
+    for (CommandBuffer const& cmdBuffer : m_shared.buffers)
+        m_shared.pool->FreeCommandBuffer(cmdBuffer);
+}
+
+// ============================== [Public Local Methods] ============================== //
+
+void    SecondaryCommandBuffers::Reset          () noexcept
+{
+    // The buffers are begun again as they are acquired, their pool resets them then.
+    for (auto& it : m_threads)
+        it.second.used = 0u;
+
+    m_shared.used = 0u;
+}
+
+uint32  SecondaryCommandBuffers::GetChunkCount  (size_t p_drawCount) const noexcept
+{
+    // The calling thread records chunks too while it waits.
+    size_t const maxChunkCount = std::min<size_t>(MaxChunkCount, (m_threads.size() + 1u) * ChunksPerThread);
+
+    return static_cast<uint32>(std::clamp<size_t>(p_drawCount / MinDrawsPerChunk, 1u, maxChunkCount));
+}
+
+// ============================== [Private Local Methods] ============================== //
+
+CommandBuffer   SecondaryCommandBuffers::Acquire    (std::unique_lock<std::mutex>& p_sharedLock) noexcept
+{
+    auto const it = m_threads.find(std::this_thread::get_id());
+
+    // A thread without a pool of its own, the Device would not find one for it either.
+    if (it == m_threads.end())
+        p_sharedLock = std::unique_lock<std::mutex>(m_sharedMutex);
+
+    ThreadCommandBuffers& thread = it != m_threads.end() ? it->second : m_shared;
+
+    if (thread.used == thread.buffers.size())
+    {
+        if (!thread.pool)
+            thread.pool = RHI::Get().GetDevice()->GetGraphicsCommandPool().get();
+
+        thread.buffers.push_back(thread.pool->AllocateCommandBuffer(VK_COMMAND_BUFFER_LEVEL_SECONDARY));
+    }
+
+    return thread.buffers[thread.used++];
+}
\ No newline at end of file
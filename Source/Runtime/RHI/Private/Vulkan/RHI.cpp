@@ -122,9 +122,12 @@ void    RHI::DrawFrame  (EngineKey const& p_passkey)
     VK_CHECK_RESULT(vkWaitForFences(m_device->GetLogicalDevice(), 1u, &frame.fence, VK_TRUE, MAX_UINT_64));
     VK_CHECK_RESULT(vkResetFences  (m_device->GetLogicalDevice(), 1u, &frame.fence));
 
+    frame.secondaryCommandBuffers->Reset();
+
     frame.commandBuffer.Begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
 
     UpdateUniformBuffers(frame);
+    UpdateStorageBuffers(frame);
 
     for (auto const& renderPass : m_renderPasses)
     {
@@ -146,9 +149,12 @@ void    RHI::DrawFrame  (EngineKey const& p_passkey)
         VK_CHECK_RESULT(vkWaitForFences(m_device->GetLogicalDevice(), 1u, &frame.fence, VK_TRUE, MAX_UINT_64));
         VK_CHECK_RESULT(vkResetFences  (m_device->GetLogicalDevice(), 1u, &frame.fence));
 
+        frame.secondaryCommandBuffers->Reset();
+
         frame.commandBuffer.Begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
 
         UpdateUniformBuffers(frame);
+        UpdateStorageBuffers(frame);
 
         for (auto const& renderPass : m_renderPasses)
         {
@@ -183,6 +189,7 @@ void    RHI::Cleanup                () noexcept
         if (frame.ubos.spotLight       .handle) m_allocator->DestroyBuffer(frame.ubos.spotLight);
         if (frame.ubos.pointLight      .handle) m_allocator->DestroyBuffer(frame.ubos.pointLight);
         if (frame.ubos.directionalLight.handle) m_allocator->DestroyBuffer(frame.ubos.directionalLight);
+        if (frame.ssbos.instance       .handle) m_allocator->DestroyBuffer(frame.ssbos.instance);
 
         vkDestroyImageView(m_device->GetLogicalDevice(), frame.result.imageView,        nullptr);
         vkDestroyFence    (m_device->GetLogicalDevice(), frame.fence,                   nullptr);
@@ -190,14 +197,17 @@ void    RHI::Cleanup                () noexcept
         vkDestroySemaphore(m_device->GetLogicalDevice(), frame.renderFinishedSemaphore, nullptr);
 
         m_device->GetGraphicsCommandPool()->FreeCommandBuffer(frame.commandBuffer);
+
+        frame.secondaryCommandBuffers.reset();
     }
 
-    vkDestroySampler            (m_device->GetLogicalDevice(), m_samplers.texture,            nullptr);
-    vkDestroySampler            (m_device->GetLogicalDevice(), m_samplers.scene,              nullptr);
-    vkDestroyDescriptorPool     (m_device->GetLogicalDevice(), m_descriptorPool,              nullptr);
-    vkDestroyDescriptorSetLayout(m_device->GetLogicalDevice(), m_descriptorSetLayouts.scene,  nullptr);
-    vkDestroyDescriptorSetLayout(m_device->GetLogicalDevice(), m_descriptorSetLayouts.camera, nullptr);
-    vkDestroyDescriptorSetLayout(m_device->GetLogicalDevice(), m_descriptorSetLayouts.light,  nullptr);
+    vkDestroySampler            (m_device->GetLogicalDevice(), m_samplers.texture,              nullptr);
+    vkDestroySampler            (m_device->GetLogicalDevice(), m_samplers.scene,                nullptr);
+    vkDestroyDescriptorPool     (m_device->GetLogicalDevice(), m_descriptorPool,                nullptr);
+    vkDestroyDescriptorSetLayout(m_device->GetLogicalDevice(), m_descriptorSetLayouts.scene,    nullptr);
+    vkDestroyDescriptorSetLayout(m_device->GetLogicalDevice(), m_descriptorSetLayouts.camera,   nullptr);
+    vkDestroyDescriptorSetLayout(m_device->GetLogicalDevice(), m_descriptorSetLayouts.light,    nullptr);
+    vkDestroyDescriptorSetLayout(m_device->GetLogicalDevice(), m_descriptorSetLayouts.instance, nullptr);
 }
 
 void    RHI::UpdateUniformBuffers   (Frame& p_frame) noexcept
@@ -272,6 +282,62 @@ void    RHI::UpdateUniformBuffers   (Frame& p_frame) noexcept
     m_allocator->Unmap(p_frame.ubos.directionalLight);
 }
 
+void    RHI::UpdateStorageBuffers   (Frame& p_frame) noexcept
+{
+    std::vector<InstanceData> const& instances = p_frame.renderList->instances;
+
+    if (instances.empty())
+        return;
+
+    // The buffer doubles so it stops growing once it fits the largest frames.
+    size_t capacity = static_cast<size_t>(p_frame.ssbos.instance.size / sizeof(InstanceData));
+
+    if (capacity < instances.size())
+    {
+        while (capacity < instances.size())
+            capacity *= 2u;
+
+        ResizeInstanceBuffer(p_frame, capacity);
+    }
+
+    m_allocator->Map(p_frame.ssbos.instance);
+
+    memcpy(p_frame.ssbos.instance.allocationInfo.pMappedData, instances.data(), instances.size() * sizeof(InstanceData));
+
+    m_allocator->Unmap(p_frame.ssbos.instance);
+}
+
+void    RHI::ResizeInstanceBuffer   (Frame&         p_frame,
+                                     size_t const   p_count) noexcept
+{
+    if (p_frame.ssbos.instance.handle)
+        m_allocator->DestroyBuffer(p_frame.ssbos.instance);
+
+    VkBufferCreateInfo bufferCI = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+
+    bufferCI.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    bufferCI.size  = p_count * sizeof(InstanceData);
+
+    m_allocator->CreateBuffer(p_frame.ssbos.instance, bufferCI, 0u, VMA_MEMORY_USAGE_CPU_TO_GPU, VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+    Debug::SetBufferName(m_device->GetLogicalDevice(), p_frame.ssbos.instance.handle, ("Instance_SSBO_" + std::to_string(p_frame.index)).c_str());
+
+    VkDescriptorBufferInfo instanceBufferInfo = {};
+
+    instanceBufferInfo.buffer = p_frame.ssbos.instance.handle;
+    instanceBufferInfo.range  = p_frame.ssbos.instance.size;
+
+    VkWriteDescriptorSet writeSet = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+
+    writeSet.dstSet          = p_frame.descriptorSets.instance;
+    writeSet.dstBinding      = 0u;
+    writeSet.descriptorCount = 1u;
+    writeSet.descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    writeSet.pBufferInfo     = &instanceBufferInfo;
+
+    vkUpdateDescriptorSets(m_device->GetLogicalDevice(), 1u, &writeSet, 0u, nullptr);
+}
+
 // ===================================================================================== //
 
 void    RHI::SetupSamplers              () noexcept
@@ -345,7 +411,8 @@ void    RHI::SetupFrames                () noexcept
 
         VK_CHECK_RESULT(vkCreateImageView(m_device->GetLogicalDevice(), &imageViewCI, nullptr, &m_frames[i].result.imageView));
 
-        m_frames[i].commandBuffer = m_device->GetGraphicsCommandPool()->AllocateCommandBuffer(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+        m_frames[i].commandBuffer           = m_device->GetGraphicsCommandPool()->AllocateCommandBuffer(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+        m_frames[i].secondaryCommandBuffers = std::make_unique<SecondaryCommandBuffers>();
 
         VK_CHECK_RESULT(vkCreateFence    (m_device->GetLogicalDevice(), &fenceCI,     nullptr, &m_frames[i].fence));
         VK_CHECK_RESULT(vkCreateSemaphore(m_device->GetLogicalDevice(), &semaphoreCI, nullptr, &m_frames[i].imageAvailableSemaphore));
@@ -402,16 +469,18 @@ void    RHI::SetupUniformBuffers        () noexcept
 
 void    RHI::SetupDescriptorPool        () noexcept
 {
-    std::array<VkDescriptorPoolSize, 2> descriptorPoolSizes = {};
+    std::array<VkDescriptorPoolSize, 3> descriptorPoolSizes = {};
 
     descriptorPoolSizes[0].type            = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
     descriptorPoolSizes[0].descriptorCount = static_cast<uint32>(1 * m_frames.size());
     descriptorPoolSizes[1].type            = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
     descriptorPoolSizes[1].descriptorCount = static_cast<uint32>(4 * m_frames.size());
+    descriptorPoolSizes[2].type            = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    descriptorPoolSizes[2].descriptorCount = static_cast<uint32>(1 * m_frames.size());
     
     VkDescriptorPoolCreateInfo descriptorPoolCI = { VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
 
-    descriptorPoolCI.maxSets       = static_cast<uint32>(3 * m_frames.size());
+    descriptorPoolCI.maxSets       = static_cast<uint32>(4 * m_frames.size());
     descriptorPoolCI.poolSizeCount = static_cast<uint32>(descriptorPoolSizes.size());
     descriptorPoolCI.pPoolSizes    = descriptorPoolSizes.data();
 
@@ -472,9 +541,23 @@ void    RHI::SetupDescriptorSetLayouts  () noexcept
     
     VK_CHECK_RESULT(vkCreateDescriptorSetLayout(m_device->GetLogicalDevice(), &descriptorSetLayoutCI, nullptr, &m_descriptorSetLayouts.light));
 
-    Debug::SetDescriptorSetLayoutName(m_device->GetLogicalDevice(), m_descriptorSetLayouts.scene,  "Scene_DescriptorSetLayout");
-    Debug::SetDescriptorSetLayoutName(m_device->GetLogicalDevice(), m_descriptorSetLayouts.camera, "Camera_DescriptorSetLayout");
-    Debug::SetDescriptorSetLayoutName(m_device->GetLogicalDevice(), m_descriptorSetLayouts.light,  "Light_DescriptorSetLayout");
+    // The geometry shaders of the shadows read the light masks of the instances, the fragment shaders their material.
+    descriptorSetLayoutBindings.resize(1);
+
+    descriptorSetLayoutBindings[0].binding         = 0u;
+    descriptorSetLayoutBindings[0].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    descriptorSetLayoutBindings[0].descriptorCount = 1u;
+    descriptorSetLayoutBindings[0].stageFlags      = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_GEOMETRY_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+
+    descriptorSetLayoutCI.bindingCount = static_cast<uint32>(descriptorSetLayoutBindings.size());
+    descriptorSetLayoutCI.pBindings    = descriptorSetLayoutBindings.data();
+
+    VK_CHECK_RESULT(vkCreateDescriptorSetLayout(m_device->GetLogicalDevice(), &descriptorSetLayoutCI, nullptr, &m_descriptorSetLayouts.instance));
+
+    Debug::SetDescriptorSetLayoutName(m_device->GetLogicalDevice(), m_descriptorSetLayouts.scene,    "Scene_DescriptorSetLayout");
+    Debug::SetDescriptorSetLayoutName(m_device->GetLogicalDevice(), m_descriptorSetLayouts.camera,   "Camera_DescriptorSetLayout");
+    Debug::SetDescriptorSetLayoutName(m_device->GetLogicalDevice(), m_descriptorSetLayouts.light,    "Light_DescriptorSetLayout");
+    Debug::SetDescriptorSetLayoutName(m_device->GetLogicalDevice(), m_descriptorSetLayouts.instance, "Instance_DescriptorSetLayout");
 }
 
 void    RHI::SetupDescriptorSets        () noexcept
@@ -501,9 +584,19 @@ void    RHI::SetupDescriptorSets        () noexcept
 
         VK_CHECK_RESULT(vkAllocateDescriptorSets(m_device->GetLogicalDevice(), &decriptorSetAI, &m_frames[i].descriptorSets.light));
 
-        Debug::SetDescriptorSetName(m_device->GetLogicalDevice(), m_frames[i].descriptorSets.scene,  "Scene_DescriptorSet");
-        Debug::SetDescriptorSetName(m_device->GetLogicalDevice(), m_frames[i].descriptorSets.camera, "Camera_DescriptorSet");
-        Debug::SetDescriptorSetName(m_device->GetLogicalDevice(), m_frames[i].descriptorSets.light,  "Light_DescriptorSet");
+        decriptorSetAI.descriptorPool     = m_descriptorPool;
+        decriptorSetAI.descriptorSetCount = 1u;
+        decriptorSetAI.pSetLayouts        = &m_descriptorSetLayouts.instance;
+
+        VK_CHECK_RESULT(vkAllocateDescriptorSets(m_device->GetLogicalDevice(), &decriptorSetAI, &m_frames[i].descriptorSets.instance));
+
+        Debug::SetDescriptorSetName(m_device->GetLogicalDevice(), m_frames[i].descriptorSets.scene,    "Scene_DescriptorSet");
+        Debug::SetDescriptorSetName(m_device->GetLogicalDevice(), m_frames[i].descriptorSets.camera,   "Camera_DescriptorSet");
+        Debug::SetDescriptorSetName(m_device->GetLogicalDevice(), m_frames[i].descriptorSets.light,    "Light_DescriptorSet");
+        Debug::SetDescriptorSetName(m_device->GetLogicalDevice(), m_frames[i].descriptorSets.instance, "Instance_DescriptorSet");
+
+        // Instance set.
+        ResizeInstanceBuffer(m_frames[i], InitialInstanceCount);
 
         std::array<VkWriteDescriptorSet, 5> writeSets = {};
 
@@ -66,25 +66,6 @@ void    LightingPass::Rebuild (std::vector<Frame> const& p_frames) noexcept
 
 void    LightingPass::Draw    (Frame const& p_frame) noexcept
 {
-    VkViewport viewport = {
-        0.0f,                                       // x
-        0.0f,                                       // y
-        static_cast<float>(p_frame.result.width),   // width
-        static_cast<float>(p_frame.result.height),  // height
-        0.0f,                                       // minDepth
-        1.0f                                        // maxDepth
-    };
-
-    VkRect2D scissor = {
-        0,                      // offset.x
-        0,                      // offset.y
-        p_frame.result.width,   // extent.width
-        p_frame.result.height   // extent.height
-    };
-
-    vkCmdSetViewport(p_frame.commandBuffer.GetHandle(), 0u, 1u, &viewport);
-    vkCmdSetScissor (p_frame.commandBuffer.GetHandle(), 0u, 1u, &scissor);
-
     std::array<VkClearValue, 5> const clearValues = {
         VkClearValue { 1.0f, 0u },
         VkClearValue { 0.0f, 0.0f, 0.0f, 0.0f },
@@ -102,30 +83,15 @@ void    LightingPass::Draw    (Frame const& p_frame) noexcept
     renderPassBI.clearValueCount          = static_cast<uint32>(clearValues.size());
     renderPassBI.pClearValues             = clearValues.data();
 
-    Debug::BeginCmdBufferLabelRegion(p_frame.commandBuffer.GetHandle(), "LightingPass", Color::Yellow);
-
-    vkCmdBeginRenderPass(p_frame.commandBuffer.GetHandle(), &renderPassBI, VK_SUBPASS_CONTENTS_INLINE);
+    uint32 const opaqueChunkCount = p_frame.secondaryCommandBuffers->GetChunkCount(p_frame.renderList->opaqueBatches.size());
 
-    vkCmdBindDescriptorSets(p_frame.commandBuffer.GetHandle(),
-                            VK_PIPELINE_BIND_POINT_GRAPHICS,
-                            m_pipelineLayout,
-                            0u,
-                            1u,
-                            &p_frame.descriptorSets.camera,
-                            0u,
-                            nullptr);
+    Debug::BeginCmdBufferLabelRegion(p_frame.commandBuffer.GetHandle(), "LightingPass", Color::Yellow);
 
+    vkCmdBeginRenderPass(p_frame.commandBuffer.GetHandle(),
+                         &renderPassBI,
+                         opaqueChunkCount > 1u ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE);
 
-    vkCmdBindDescriptorSets(p_frame.commandBuffer.GetHandle(),
-                            VK_PIPELINE_BIND_POINT_GRAPHICS,
-                            m_pipelineLayout,
-                            1u,
-                            1u,
-                            &p_frame.descriptorSets.light,
-                            0u,
-                            nullptr);
-
-    GBufferPass    (p_frame);
+    GBufferPass    (p_frame, opaqueChunkCount);
     CompositionPass(p_frame);
     TransparentPass(p_frame);
 
@@ -602,22 +568,10 @@ void    LightingPass::SetupCompositionPipelineLayout        (std::vector<Frame>
         m_descriptorSetLayout
     };
 
-    std::array<VkPushConstantRange, 2> pushConstants = {};
-
-    pushConstants[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
-    pushConstants[0].offset     = 0u;
-    pushConstants[0].size       = sizeof(Matrix4x4);
-
-    pushConstants[1].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
-    pushConstants[1].offset     = sizeof(Matrix4x4);
-    pushConstants[1].size       = sizeof(MaterialData);
-
     VkPipelineLayoutCreateInfo pipelineLayoutCI = { VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
 
-    pipelineLayoutCI.setLayoutCount         = static_cast<uint32>(descriptorSetLayouts.size());
-    pipelineLayoutCI.pSetLayouts            = descriptorSetLayouts.data();
-    pipelineLayoutCI.pushConstantRangeCount = static_cast<uint32>(pushConstants.size());
-    pipelineLayoutCI.pPushConstantRanges    = pushConstants.data();
+    pipelineLayoutCI.setLayoutCount = static_cast<uint32>(descriptorSetLayouts.size());
+    pipelineLayoutCI.pSetLayouts    = descriptorSetLayouts.data();
 
     VK_CHECK_RESULT(vkCreatePipelineLayout(device, &pipelineLayoutCI, nullptr, &m_pipelineLayout));
 
@@ -742,53 +696,22 @@ void    LightingPass::SetupCompositionPipeline              (std::vector<Frame>
 
 // ======================================================================================= //
 
-void    LightingPass::GBufferPass       (Frame const& p_frame) const noexcept
+void    LightingPass::GBufferPass       (Frame const&   p_frame,
+                                         uint32         p_chunkCount) const noexcept
 {
     Debug::BeginCmdBufferLabelRegion(p_frame.commandBuffer.GetHandle(), "GBuffer", Color::Red);
 
-    size_t       index  = MAX_UINT_32;
-    VkDeviceSize offset = 0;
-
-    for (auto const& mesh : p_frame.renderList->opaqueMeshes)
-    {
-        if (index != std::get<0>(mesh))
-        {
-            index = std::get<0>(mesh);
-
-            vkCmdBindPipeline(p_frame.commandBuffer.GetHandle(),
-                              VK_PIPELINE_BIND_POINT_GRAPHICS,
-                              p_frame.renderList->materials[index]->pipeline);
-
-            vkCmdBindDescriptorSets(p_frame.commandBuffer.GetHandle(),
-                                    VK_PIPELINE_BIND_POINT_GRAPHICS,
-                                    p_frame.renderList->materials[index]->pipelineLayout,
-                                    2u,
-                                    1u,
-                                    &p_frame.renderList->materials[index]->descriptorSet,
-                                    0u,
-                                    nullptr);
-        }
-
-        vkCmdPushConstants(p_frame.commandBuffer.GetHandle(),
-                           p_frame.renderList->materials[index]->pipelineLayout,
-                           VK_SHADER_STAGE_VERTEX_BIT,
-                           0u,
-                           sizeof(Matrix4x4),
-                           &std::get<1>(mesh));
+    VkCommandBufferInheritanceInfo inheritanceInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO };
 
-        vkCmdPushConstants(p_frame.commandBuffer.GetHandle(),
-                           p_frame.renderList->materials[index]->pipelineLayout,
-                           VK_SHADER_STAGE_FRAGMENT_BIT,
-                           sizeof(Matrix4x4),
-                           sizeof(MaterialData),
-                           std::get<2>(mesh));
+    inheritanceInfo.renderPass  = m_handle;
+    inheritanceInfo.subpass     = 0u;
+    inheritanceInfo.framebuffer = m_attachments[p_frame.index].framebuffer;
 
-        vkCmdBindVertexBuffers(p_frame.commandBuffer.GetHandle(), 0u, 1u, &std::get<3>(mesh)->vertexBuffer.handle, &offset);
-
-        vkCmdBindIndexBuffer(p_frame.commandBuffer.GetHandle(), std::get<3>(mesh)->indexBuffer.handle, 0u, VK_INDEX_TYPE_UINT32);
-
-        vkCmdDrawIndexed(p_frame.commandBuffer.GetHandle(), std::get<3>(mesh)->indexCount, 1u, 0u, 0u, 0u);
-    }
+    p_frame.secondaryCommandBuffers->Record(p_frame.commandBuffer, inheritanceInfo, p_frame.renderList->opaqueBatches.size(), p_chunkCount,
+                                            [this, &p_frame] (VkCommandBuffer p_cmdBuffer, size_t p_first, size_t p_last)
+    {
+        DrawBatches(p_cmdBuffer, p_frame, p_frame.renderList->opaqueBatches, p_first, p_last);
+    });
 
     Debug::EndCmdBufferLabelRegion(p_frame.commandBuffer.GetHandle());
 }
@@ -798,6 +721,9 @@ void    LightingPass::CompositionPass   (Frame const& p_frame) const noexcept
     Debug::BeginCmdBufferLabelRegion(p_frame.commandBuffer.GetHandle(), "Composition", Color::Green);
 
     vkCmdNextSubpass (p_frame.commandBuffer.GetHandle(), VK_SUBPASS_CONTENTS_INLINE);
+
+    // The state of the command buffer is undefined once it executed the G-Buffer's secondary command buffers.
+    BindFrameState   (p_frame.commandBuffer.GetHandle(), p_frame);
     vkCmdBindPipeline(p_frame.commandBuffer.GetHandle(), VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline);
 
     vkCmdBindDescriptorSets(p_frame.commandBuffer.GetHandle(),
@@ -818,51 +744,116 @@ void    LightingPass::TransparentPass   (Frame const& p_frame) const noexcept
 {
     Debug::BeginCmdBufferLabelRegion(p_frame.commandBuffer.GetHandle(), "Transparent", Color::Blue);
 
-    vkCmdNextSubpass(p_frame.commandBuffer.GetHandle(), VK_SUBPASS_CONTENTS_INLINE);
+    uint32 const chunkCount = p_frame.secondaryCommandBuffers->GetChunkCount(p_frame.renderList->transparentBatches.size());
+
+    vkCmdNextSubpass(p_frame.commandBuffer.GetHandle(),
+                     chunkCount > 1u ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE);
+
+    VkCommandBufferInheritanceInfo inheritanceInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO };
 
-    size_t       index  = MAX_UINT_32;
-    VkDeviceSize offset = 0;
+    inheritanceInfo.renderPass  = m_handle;
+    inheritanceInfo.subpass     = 2u;
+    inheritanceInfo.framebuffer = m_attachments[p_frame.index].framebuffer;
 
-    for (auto const& mesh : p_frame.renderList->transparentMeshes)
+    // The chunks are executed in order, the batches stay sorted back to front.
+    p_frame.secondaryCommandBuffers->Record(p_frame.commandBuffer, inheritanceInfo, p_frame.renderList->transparentBatches.size(), chunkCount,
+                                            [this, &p_frame] (VkCommandBuffer p_cmdBuffer, size_t p_first, size_t p_last)
     {
-        if (index != std::get<0>(mesh))
+        DrawBatches(p_cmdBuffer, p_frame, p_frame.renderList->transparentBatches, p_first, p_last);
+    });
+
+    Debug::EndCmdBufferLabelRegion(p_frame.commandBuffer.GetHandle());
+}
+
+// ======================================================================================= //
+
+void    LightingPass::BindFrameState    (VkCommandBuffer    p_cmdBuffer,
+                                         Frame const&       p_frame) const noexcept
+{
+    VkViewport viewport = {
+        0.0f,                                       // x
+        0.0f,                                       // y
+        static_cast<float>(p_frame.result.width),   // width
+        static_cast<float>(p_frame.result.height),  // height
+        0.0f,                                       // minDepth
+        1.0f                                        // maxDepth
+    };
+
+    VkRect2D scissor = {
+        0,                      // offset.x
+        0,                      // offset.y
+        p_frame.result.width,   // extent.width
+        p_frame.result.height   // extent.height
+    };
+
+    vkCmdSetViewport(p_cmdBuffer, 0u, 1u, &viewport);
+    vkCmdSetScissor (p_cmdBuffer, 0u, 1u, &scissor);
+
+    std::array<VkDescriptorSet, 2> const descriptorSets = {
+        p_frame.descriptorSets.camera,
+        p_frame.descriptorSets.light
+    };
+
+    vkCmdBindDescriptorSets(p_cmdBuffer,
+                            VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            m_pipelineLayout,
+                            0u,
+                            static_cast<uint32>(descriptorSets.size()),
+                            descriptorSets.data(),
+                            0u,
+                            nullptr);
+}
+
+void    LightingPass::DrawBatches       (VkCommandBuffer                p_cmdBuffer,
+                                         Frame                  const&  p_frame,
+                                         std::vector<DrawBatch> const&  p_batches,
+                                         size_t                         p_first,
+                                         size_t                         p_last) const noexcept
+{
+    BindFrameState(p_cmdBuffer, p_frame);
+
+    uint32        index  = MAX_UINT_32;
+    EVertexFormat format = EVertexFormat::COUNT;
+    VkDeviceSize  offset = 0;
+
+    for (size_t i = p_first; i < p_last; ++i)
+    {
+        DrawBatch const& batch = p_batches[i];
+
+        if (index != batch.material)
         {
-            index = std::get<0>(mesh);
+            index  = batch.material;
+            format = EVertexFormat::COUNT;
 
-            vkCmdBindPipeline(p_frame.commandBuffer.GetHandle(),
-                              VK_PIPELINE_BIND_POINT_GRAPHICS,
-                              p_frame.renderList->materials[index]->pipeline);
+            // The instance set follows the material's, the transforms and materials of the batches are read from it.
+            std::array<VkDescriptorSet, 2> const descriptorSets = {
+                p_frame.renderList->materials[index]->descriptorSet,
+                p_frame.descriptorSets.instance
+            };
 
-            vkCmdBindDescriptorSets(p_frame.commandBuffer.GetHandle(),
+            vkCmdBindDescriptorSets(p_cmdBuffer,
                                     VK_PIPELINE_BIND_POINT_GRAPHICS,
                                     p_frame.renderList->materials[index]->pipelineLayout,
                                     2u,
-                                    1u,
-                                    &p_frame.renderList->materials[index]->descriptorSet,
+                                    static_cast<uint32>(descriptorSets.size()),
+                                    descriptorSets.data(),
                                     0u,
                                     nullptr);
         }
 
-        vkCmdPushConstants(p_frame.commandBuffer.GetHandle(),
-                           p_frame.renderList->materials[index]->pipelineLayout,
-                           VK_SHADER_STAGE_VERTEX_BIT,
-                           0u,
-                           sizeof(Matrix4x4),
-                           &std::get<1>(mesh));
+        if (format != batch.mesh->vertexFormat)
+        {
+            format = batch.mesh->vertexFormat;
 
-        vkCmdPushConstants(p_frame.commandBuffer.GetHandle(),
-                           p_frame.renderList->materials[index]->pipelineLayout,
-                           VK_SHADER_STAGE_FRAGMENT_BIT,
-                           sizeof(Matrix4x4),
-                           sizeof(MaterialData),
-                           std::get<2>(mesh));
+            vkCmdBindPipeline(p_cmdBuffer,
+                              VK_PIPELINE_BIND_POINT_GRAPHICS,
+                              p_frame.renderList->materials[index]->pipelines[static_cast<size_t>(format)]);
+        }
 
-        vkCmdBindVertexBuffers(p_frame.commandBuffer.GetHandle(), 0u, 1u, &std::get<3>(mesh)->vertexBuffer.handle, &offset);
+        vkCmdBindVertexBuffers(p_cmdBuffer, 0u, 1u, &batch.mesh->vertexBuffer.handle, &offset);
 
-        vkCmdBindIndexBuffer(p_frame.commandBuffer.GetHandle(), std::get<3>(mesh)->indexBuffer.handle, 0u, VK_INDEX_TYPE_UINT32);
+        vkCmdBindIndexBuffer(p_cmdBuffer, batch.mesh->indexBuffer.handle, 0u, batch.mesh->indexType);
 
-        vkCmdDrawIndexed(p_frame.commandBuffer.GetHandle(), std::get<3>(mesh)->indexCount, 1u, 0u, 0u, 0u);
+        vkCmdDrawIndexed(p_cmdBuffer, batch.mesh->indexCount, batch.instanceCount, 0u, 0, batch.firstInstance);
     }
-
-    Debug::EndCmdBufferLabelRegion(p_frame.commandBuffer.GetHandle());
 }
\ No newline at end of file
@@ -48,8 +48,12 @@ ShadowPass::~ShadowPass ()
     vkDestroyDescriptorPool     (device->GetLogicalDevice(), m_descriptorPool,      nullptr);
     vkDestroyDescriptorSetLayout(device->GetLogicalDevice(), m_descriptorSetLayout, nullptr);
     vkDestroyPipelineLayout     (device->GetLogicalDevice(), m_pipelineLayout,      nullptr);
-    vkDestroyPipeline           (device->GetLogicalDevice(), m_shadow2DPipeline,    nullptr);
-    vkDestroyPipeline           (device->GetLogicalDevice(), m_shadowCubePipeline,  nullptr);
+
+    for (size_t i = 0; i < m_shadow2DPipelines.size(); ++i)
+    {
+        vkDestroyPipeline(device->GetLogicalDevice(), m_shadow2DPipelines  [i], nullptr);
+        vkDestroyPipeline(device->GetLogicalDevice(), m_shadowCubePipelines[i], nullptr);
+    }
 }
 
 // ============================== [Public Local Methods] ============================== //
@@ -61,34 +65,6 @@ void    ShadowPass::Rebuild (std::vector<Frame> const& p_frames) noexcept
 
 void    ShadowPass::Draw    (Frame const& p_frame) noexcept
 {
-    VkViewport viewport = {
-        0.0f,       // x
-        0.0f,       // y
-        1024.0f,    // width
-        1024.0f,    // height
-        0.0f,       // minDepth
-        1.0f        // maxDepth
-    };
-
-    VkRect2D scissor = {
-        0,      // offset.x
-        0,      // offset.y
-        1024u,  // extent.width
-        1024u   // extent.height
-    };
-
-    vkCmdSetViewport(p_frame.commandBuffer.GetHandle(), 0u, 1u, &viewport);
-    vkCmdSetScissor (p_frame.commandBuffer.GetHandle(), 0u, 1u, &scissor);
-
-    vkCmdBindDescriptorSets(p_frame.commandBuffer.GetHandle(),
-                            VK_PIPELINE_BIND_POINT_GRAPHICS,
-                            m_pipelineLayout,
-                            0u,
-                            1u,
-                            &m_attachments[p_frame.index].descriptorSet,
-                            0u,
-                            nullptr);
-
     VkClearValue const clearValue = { 1.0f, 0u };
 
     VkRenderPassBeginInfo renderPassBI = { VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO };
@@ -100,36 +76,30 @@ void    ShadowPass::Draw    (Frame const& p_frame) noexcept
     renderPassBI.clearValueCount          = 1u;
     renderPassBI.pClearValues             = &clearValue;
 
+    VkCommandBufferInheritanceInfo inheritanceInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO };
+
+    inheritanceInfo.renderPass  = m_handle;
+    inheritanceInfo.subpass     = 0u;
+    inheritanceInfo.framebuffer = renderPassBI.framebuffer;
+
     Debug::BeginCmdBufferLabelRegion(p_frame.commandBuffer.GetHandle(), "ShadowPass", Color::Grey);
 
     // 2D Shadows.
     Debug::BeginCmdBufferLabelRegion(p_frame.commandBuffer.GetHandle(), "2DShadows", Color::Red);
-    
-    vkCmdBeginRenderPass(p_frame.commandBuffer.GetHandle(), &renderPassBI, VK_SUBPASS_CONTENTS_INLINE);
-
-    if (!p_frame.renderList->spotLights       .empty() ||
-        !p_frame.renderList->directionalLights.empty() )
-    {
-        vkCmdBindPipeline(p_frame.commandBuffer.GetHandle(), VK_PIPELINE_BIND_POINT_GRAPHICS, m_shadow2DPipeline);
 
-        VkDeviceSize offset = 0;
+    size_t const shadow2DCount = p_frame.renderList->spotLights.empty() && p_frame.renderList->directionalLights.empty() ?
+                                 0u : p_frame.renderList->shadow2DBatches.size();
+    uint32 const chunkCount2D  = p_frame.secondaryCommandBuffers->GetChunkCount(shadow2DCount);
 
-        for (auto const& mesh : p_frame.renderList->opaqueMeshes)
-        {
-            vkCmdPushConstants(p_frame.commandBuffer.GetHandle(),
-                               m_pipelineLayout,
-                               VK_SHADER_STAGE_VERTEX_BIT,
-                               0u,
-                               sizeof(Matrix4x4),
-                               &std::get<1>(mesh));
-
-            vkCmdBindVertexBuffers(p_frame.commandBuffer.GetHandle(), 0u, 1u, &std::get<3>(mesh)->vertexBuffer.handle, &offset);
-
-            vkCmdBindIndexBuffer(p_frame.commandBuffer.GetHandle(), std::get<3>(mesh)->indexBuffer.handle, 0u, VK_INDEX_TYPE_UINT32);
+    vkCmdBeginRenderPass(p_frame.commandBuffer.GetHandle(),
+                         &renderPassBI,
+                         chunkCount2D > 1u ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE);
 
-            vkCmdDrawIndexed(p_frame.commandBuffer.GetHandle(), std::get<3>(mesh)->indexCount, 1u, 0u, 0u, 0u);
-        }
-    }
+    p_frame.secondaryCommandBuffers->Record(p_frame.commandBuffer, inheritanceInfo, shadow2DCount, chunkCount2D,
+                                            [this, &p_frame] (VkCommandBuffer p_cmdBuffer, size_t p_first, size_t p_last)
+    {
+        DrawBatches(p_cmdBuffer, p_frame, m_shadow2DPipelines, p_frame.renderList->shadow2DBatches, p_first, p_last);
+    });
 
     vkCmdEndRenderPass(p_frame.commandBuffer.GetHandle());
 
@@ -138,32 +108,21 @@ void    ShadowPass::Draw    (Frame const& p_frame) noexcept
     // Cube Shadows.
     Debug::BeginCmdBufferLabelRegion(p_frame.commandBuffer.GetHandle(), "CubeShadows", Color::Green);
 
-    renderPassBI.framebuffer = m_attachments[p_frame.index].shadowCubeFramebuffer;
+    renderPassBI   .framebuffer = m_attachments[p_frame.index].shadowCubeFramebuffer;
+    inheritanceInfo.framebuffer = renderPassBI.framebuffer;
 
-    vkCmdBeginRenderPass(p_frame.commandBuffer.GetHandle(), &renderPassBI, VK_SUBPASS_CONTENTS_INLINE);
+    size_t const shadowCubeCount = p_frame.renderList->pointLights.empty() ? 0u : p_frame.renderList->shadowCubeBatches.size();
+    uint32 const chunkCountCube  = p_frame.secondaryCommandBuffers->GetChunkCount(shadowCubeCount);
 
-    if (!p_frame.renderList->pointLights.empty())
-    {
-        vkCmdBindPipeline(p_frame.commandBuffer.GetHandle(), VK_PIPELINE_BIND_POINT_GRAPHICS, m_shadowCubePipeline);
-
-        VkDeviceSize offset = 0;
-
-        for (auto const& mesh : p_frame.renderList->opaqueMeshes)
-        {
-            vkCmdPushConstants(p_frame.commandBuffer.GetHandle(),
-                               m_pipelineLayout,
-                               VK_SHADER_STAGE_VERTEX_BIT,
-                               0u,
-                               sizeof(Matrix4x4),
-                               &std::get<1>(mesh));
-
-            vkCmdBindVertexBuffers(p_frame.commandBuffer.GetHandle(), 0u, 1u, &std::get<3>(mesh)->vertexBuffer.handle, &offset);
-
-            vkCmdBindIndexBuffer(p_frame.commandBuffer.GetHandle(), std::get<3>(mesh)->indexBuffer.handle, 0u, VK_INDEX_TYPE_UINT32);
+    vkCmdBeginRenderPass(p_frame.commandBuffer.GetHandle(),
+                         &renderPassBI,
+                         chunkCountCube > 1u ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE);
 
-            vkCmdDrawIndexed(p_frame.commandBuffer.GetHandle(), std::get<3>(mesh)->indexCount, 1u, 0u, 0u, 0u);
-        }
-    }
+    p_frame.secondaryCommandBuffers->Record(p_frame.commandBuffer, inheritanceInfo, shadowCubeCount, chunkCountCube,
+                                            [this, &p_frame] (VkCommandBuffer p_cmdBuffer, size_t p_first, size_t p_last)
+    {
+        DrawBatches(p_cmdBuffer, p_frame, m_shadowCubePipelines, p_frame.renderList->shadowCubeBatches, p_first, p_last);
+    });
 
     Debug::EndCmdBufferLabelRegion(p_frame.commandBuffer.GetHandle());
 
@@ -466,18 +425,16 @@ void    ShadowPass::SetupPipelineLayout                 (std::vector<Frame> cons
 {
     VkDevice const device = RHI::Get().GetDevice()->GetLogicalDevice();
 
-    VkPushConstantRange pushConstant = {};
-
-    pushConstant.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
-    pushConstant.offset     = 0u;
-    pushConstant.size       = sizeof(Matrix4x4);
+    // The geometry shaders read the caster's light masks from its instance.
+    std::array<VkDescriptorSetLayout, 2> descriptorSetLayouts = {
+        m_descriptorSetLayout,
+        RHI::Get().GetInstanceLayout()
+    };
 
     VkPipelineLayoutCreateInfo pipelineLayoutCI = { VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
 
-    pipelineLayoutCI.setLayoutCount         = 1u;
-    pipelineLayoutCI.pSetLayouts            = &m_descriptorSetLayout;
-    pipelineLayoutCI.pushConstantRangeCount = 1u;
-    pipelineLayoutCI.pPushConstantRanges    = &pushConstant;
+    pipelineLayoutCI.setLayoutCount = static_cast<uint32>(descriptorSetLayouts.size());
+    pipelineLayoutCI.pSetLayouts    = descriptorSetLayouts.data();
 
     VK_CHECK_RESULT(vkCreatePipelineLayout(device, &pipelineLayoutCI, nullptr, &m_pipelineLayout));
 
@@ -501,8 +458,8 @@ void    ShadowPass::Setup2DShadowPipeline               (std::vector<Frame> cons
     shaderStages[1].module = AssetManager::Get().Get<Shader>("Default/Shaders/shadow.geom", ELoadingMode::BLOCKING)->GetModule();
     shaderStages[1].pName  = "main";
 
-    VkVertexInputBindingDescription                  vertexInputBinding    = Vertex::GetBindingDescription   ();
-    std::array<VkVertexInputAttributeDescription, 4> vertexInputAttributes = Vertex::GetAttributeDescriptions();
+    VkVertexInputBindingDescription                  vertexInputBinding    = {};
+    std::array<VkVertexInputAttributeDescription, 4> vertexInputAttributes = {};
 
     VkPipelineVertexInputStateCreateInfo vertexInputStateCI = { VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO };
 
@@ -592,14 +549,21 @@ void    ShadowPass::Setup2DShadowPipeline               (std::vector<Frame> cons
 
     shaderStages[1].pSpecializationInfo = &info;
 
-    VK_CHECK_RESULT(vkCreateGraphicsPipelines(device->GetLogicalDevice(),
-                                              cache ->GetHandle       (),
-                                              1u,
-                                              &pipelineCI,
-                                              nullptr,
-                                              &m_shadow2DPipeline));
+    // Only the vertex input differs between formats, the dequantization is folded into the transform of each instance in the instance buffer.
+    for (size_t i = 0; i < m_shadow2DPipelines.size(); ++i)
+    {
+        vertexInputBinding    = Vertex::GetBindingDescription   (static_cast<EVertexFormat>(i));
+        vertexInputAttributes = Vertex::GetAttributeDescriptions(static_cast<EVertexFormat>(i));
+
+        VK_CHECK_RESULT(vkCreateGraphicsPipelines(device->GetLogicalDevice(),
+                                                  cache ->GetHandle       (),
+                                                  1u,
+                                                  &pipelineCI,
+                                                  nullptr,
+                                                  &m_shadow2DPipelines[i]));
 
-    Debug::SetPipelineName(device->GetLogicalDevice(), m_shadow2DPipeline, "Shadow2D_Pipeline");
+        Debug::SetPipelineName(device->GetLogicalDevice(), m_shadow2DPipelines[i], ("Shadow2D_Pipeline_" + std::to_string(i)).c_str());
+    }
 }
 
 void    ShadowPass::SetupCubeShadowPipeline            (std::vector<Frame> const& p_frames) noexcept
@@ -624,8 +588,8 @@ void    ShadowPass::SetupCubeShadowPipeline            (std::vector<Frame> const
     shaderStages[2].module = AssetManager::Get().Get<Shader>("Default/Shaders/shadowomni.frag", ELoadingMode::BLOCKING)->GetModule();
     shaderStages[2].pName  = "main";
 
-    VkVertexInputBindingDescription                  vertexInputBinding    = Vertex::GetBindingDescription   ();
-    std::array<VkVertexInputAttributeDescription, 4> vertexInputAttributes = Vertex::GetAttributeDescriptions();
+    VkVertexInputBindingDescription                  vertexInputBinding    = {};
+    std::array<VkVertexInputAttributeDescription, 4> vertexInputAttributes = {};
 
     VkPipelineVertexInputStateCreateInfo vertexInputStateCI = { VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO };
 
@@ -705,12 +669,85 @@ void    ShadowPass::SetupCubeShadowPipeline            (std::vector<Frame> const
 
     shaderStages[1].pSpecializationInfo = &info;
 
-    VK_CHECK_RESULT(vkCreateGraphicsPipelines(device->GetLogicalDevice(),
-                                              cache ->GetHandle       (),
-                                              1u,
-                                              &pipelineCI,
-                                              nullptr,
-                                              &m_shadowCubePipeline));
+    // Only the vertex input differs between formats, the dequantization is folded into the transform of each instance in the instance buffer.
+    for (size_t i = 0; i < m_shadowCubePipelines.size(); ++i)
+    {
+        vertexInputBinding    = Vertex::GetBindingDescription   (static_cast<EVertexFormat>(i));
+        vertexInputAttributes = Vertex::GetAttributeDescriptions(static_cast<EVertexFormat>(i));
+
+        VK_CHECK_RESULT(vkCreateGraphicsPipelines(device->GetLogicalDevice(),
+                                                  cache ->GetHandle       (),
+                                                  1u,
+                                                  &pipelineCI,
+                                                  nullptr,
+                                                  &m_shadowCubePipelines[i]));
+
+        Debug::SetPipelineName(device->GetLogicalDevice(), m_shadowCubePipelines[i], ("ShadowCube_Pipeline_" + std::to_string(i)).c_str());
+    }
+}
+
+// ======================================================================================= //
+
+void    ShadowPass::DrawBatches (VkCommandBuffer                    p_cmdBuffer,
+                                 Frame                      const&  p_frame,
+                                 ShadowPipelines            const&  p_pipelines,
+                                 std::vector<DrawBatch>     const&  p_batches,
+                                 size_t                             p_first,
+                                 size_t                             p_last) const noexcept
+{
+    VkViewport viewport = {
+        0.0f,       // x
+        0.0f,       // y
+        1024.0f,    // width
+        1024.0f,    // height
+        0.0f,       // minDepth
+        1.0f        // maxDepth
+    };
+
+    VkRect2D scissor = {
+        0,      // offset.x
+        0,      // offset.y
+        1024u,  // extent.width
+        1024u   // extent.height
+    };
+
+    vkCmdSetViewport(p_cmdBuffer, 0u, 1u, &viewport);
+    vkCmdSetScissor (p_cmdBuffer, 0u, 1u, &scissor);
+
+    // The transforms and light masks of the casters are read from the instance set.
+    std::array<VkDescriptorSet, 2> const descriptorSets = {
+        m_attachments[p_frame.index].descriptorSet,
+        p_frame.descriptorSets.instance
+    };
 
-    Debug::SetPipelineName(device->GetLogicalDevice(), m_shadowCubePipeline, "ShadowCube_Pipeline");
+    vkCmdBindDescriptorSets(p_cmdBuffer,
+                            VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            m_pipelineLayout,
+                            0u,
+                            static_cast<uint32>(descriptorSets.size()),
+                            descriptorSets.data(),
+                            0u,
+                            nullptr);
+
+    EVertexFormat format = EVertexFormat::COUNT;
+    VkDeviceSize  offset = 0;
+
+    // The Renderer already skipped the casters out of every light, the geometry shader masks the others per layer.
+    for (size_t i = p_first; i < p_last; ++i)
+    {
+        DrawBatch const& batch = p_batches[i];
+
+        if (format != batch.mesh->vertexFormat)
+        {
+            format = batch.mesh->vertexFormat;
+
+            vkCmdBindPipeline(p_cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, p_pipelines[static_cast<size_t>(format)]);
+        }
+
+        vkCmdBindVertexBuffers(p_cmdBuffer, 0u, 1u, &batch.mesh->vertexBuffer.handle, &offset);
+
+        vkCmdBindIndexBuffer(p_cmdBuffer, batch.mesh->indexBuffer.handle, 0u, batch.mesh->indexType);
+
+        vkCmdDrawIndexed(p_cmdBuffer, batch.mesh->indexCount, batch.instanceCount, 0u, 0, batch.firstInstance);
+    }
 }
\ No newline at end of file
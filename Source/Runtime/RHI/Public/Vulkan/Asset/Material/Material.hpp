@@ -3,10 +3,16 @@
 
 #include "Asset.hpp"
 
-// ============================== [Forward Declaration] ============================== //
+#include "Vulkan/Asset/Model/Vertex.hpp"
 
+// ============================== [Forward Declarations] ============================== //
+
+class Shader;
 class Texture;
 
+template<typename T>
+class Task;
+
 // ============================== [Data Structures] ============================== //
 
 struct MaterialCreateInfo
@@ -59,7 +65,11 @@ struct MaterialRenderData
     VkDescriptorSetLayout descriptorSetLayout = VK_NULL_HANDLE;
     VkDescriptorSet       descriptorSet       = VK_NULL_HANDLE;
     VkPipelineLayout      pipelineLayout      = VK_NULL_HANDLE;
-    VkPipeline            pipeline            = VK_NULL_HANDLE;
+
+    /**
+     * One pipeline per vertex format, indexed by EVertexFormat.
+     */
+    std::array<VkPipeline, static_cast<size_t>(EVertexFormat::COUNT)> pipelines = {};
 
     bool operator==(MaterialRenderData const& p_other) const
     {
@@ -67,7 +77,7 @@ struct MaterialRenderData
                descriptorSetLayout == p_other.descriptorSetLayout &&
                descriptorSet       == p_other.descriptorSet       &&
                pipelineLayout      == p_other.pipelineLayout      &&
-               pipeline            == p_other.pipeline;
+               pipelines           == p_other.pipelines;
     }
 
     bool operator!=(MaterialRenderData const& p_other) const
@@ -76,7 +86,7 @@ struct MaterialRenderData
                descriptorSetLayout != p_other.descriptorSetLayout ||
                descriptorSet       != p_other.descriptorSet       ||
                pipelineLayout      != p_other.pipelineLayout      ||
-               pipeline            != p_other.pipeline;
+               pipelines           != p_other.pipelines;
     }
 
 };  // !struct MaterialRenderData
@@ -138,15 +148,21 @@ class ENGINE_API Material : public Asset
 
     // ============================== [Private Local Methods] ============================== //
 
-        void    SetupDescriptorPool         () noexcept;
+        /**
+         * Loads the material, awaiting its textures and shaders without holding a thread.
+         */
+        Task<void>  Load                        (std::string p_path)    noexcept;
+
+        void        SetupDescriptorPool         ()                      noexcept;
 
-        void    SetupDescriptorSetLayout    () noexcept;
+        void        SetupDescriptorSetLayout    ()                      noexcept;
 
-        void    SetupDescriptorSet          () noexcept;
+        void        SetupDescriptorSet          ()                      noexcept;
 
-        void    SetupPipelineLayout         () noexcept;
+        void        SetupPipelineLayout         ()                      noexcept;
 
-        void    SetupPipeline               () noexcept;
+        void        SetupPipeline               (Shader const&  p_vertexShader,
+                                                 Shader const&  p_fragmentShader)   noexcept;
 
 };  // !class Material
 
@@ -13,14 +13,32 @@ struct MeshCreateInfo
     std::vector<Vertex> vertices;
     std::vector<uint32> indices;
 
+    /**
+     * Layout the vertices are packed in when uploaded.
+     * Indices are always narrowed to 16 bits when the mesh has less than 65536 vertices.
+     */
+    EVertexFormat       format = EVertexFormat::FULL;
+
 };  // !struct MeshCreateInfo
 
 struct Mesh
 {
-    uint32 vertexCount;
-    Buffer vertexBuffer;
-    uint32 indexCount;
-    Buffer indexBuffer;
+    uint32        vertexCount;
+    Buffer        vertexBuffer;
+    uint32        indexCount;
+    Buffer        indexBuffer;
+    EVertexFormat vertexFormat   = EVertexFormat::FULL;
+    VkIndexType   indexType      = VK_INDEX_TYPE_UINT32;
+
+    /**
+     * Maps the unit cube of a QUANTIZED mesh back to its bounds, to append to the mesh's transform.
+     */
+    Matrix4x4     dequantization = Matrix4x4::Identity;
+
+    /**
+     * Bounds of the vertices in model space, transformed by the mesh's owner to cull it.
+     */
+    Bounds        bounds;
 
 };  // !struct Mesh
 
@@ -3,15 +3,65 @@
 
 #include "Vulkan/Vulkan.hpp"
 
+// ============================== [Global Enum] ============================== //
+
+/**
+ * Layout of a mesh's vertices in its vertex buffer.
+ */
+enum class EVertexFormat : uint8
+{
+    FULL,       // Vertex          : full floats (44 bytes).
+    PACKED,     // PackedVertex    : float position, octahedral normal and tangent, half-float uv (24 bytes).
+    QUANTIZED,  // QuantizedVertex : PACKED with a 16-bit position relative to the mesh's bounds (20 bytes).
+    COUNT
+
+};  // !enum class EVertexFormat
+
+// ============================== [Data Structures] ============================== //
+
+/**
+ * Normal and tangent are octahedral-encoded in R16G16_SNORM, uv is R16G16_SFLOAT.
+ */
+struct PackedVertex
+{
+    Vector3 position;
+    int16   normal [2];
+    int16   tangent[2];
+    uint16  uv     [2];
+
+};  // !struct PackedVertex
+
+/**
+ * Position is R16G16B16A16_UNORM in the unit cube of the mesh's bounds, the rest is laid out as in PackedVertex.
+ */
+struct QuantizedVertex
+{
+    uint16  position[4];
+    int16   normal  [2];
+    int16   tangent [2];
+    uint16  uv      [2];
+
+};  // !struct QuantizedVertex
+
+// =============================================================================== //
+
 struct ENGINE_API Vertex
 {
     // ============================== [Public Static Methods] ============================== //
 
-        static void                                             HashCombine             (size_t& p_seed, size_t p_hash);
+        static VkVertexInputBindingDescription                  GetBindingDescription   (EVertexFormat      p_format = EVertexFormat::FULL);
 
-        static VkVertexInputBindingDescription                  GetBindingDescription   ();
+        static std::array<VkVertexInputAttributeDescription, 4> GetAttributeDescriptions(EVertexFormat      p_format = EVertexFormat::FULL);
 
-        static std::array<VkVertexInputAttributeDescription, 4> GetAttributeDescriptions();
+        static PackedVertex                                     Pack                    (Vertex const&      p_vertex);
+
+        /**
+         * Packs a vertex whose position is stored as (position - origin) / extent.
+         * The mesh is then drawn with Matrix4x4::Translate(origin) * Matrix4x4::Scale(Vector3(extent)) appended to its transform.
+         */
+        static QuantizedVertex                                  Quantize                (Vertex const&      p_vertex,
+                                                                                         Vector3 const&     p_origin,
+                                                                                         float              p_extent);
 
     // ============================== [Public Local Variables] ============================== //
 
@@ -57,37 +107,6 @@ struct ENGINE_API Vertex
 
 namespace std
 {
-    template<> struct hash<Vector2>
-    {
-        size_t operator()(Vector2 const& p_vector) const
-        {
-            size_t seed = 0;
-
-            hash<float> hasher;
-
-            Vertex::HashCombine(seed, hasher(p_vector.m_x));
-            Vertex::HashCombine(seed, hasher(p_vector.m_y));
-
-            return seed;
-        }
-    };
-
-    template<> struct hash<Vector3>
-    {
-        size_t operator()(Vector3 const& p_vector) const
-        {
-            size_t seed = 0;
-
-            hash<float> hasher;
-
-            Vertex::HashCombine(seed, hasher(p_vector.m_x));
-            Vertex::HashCombine(seed, hasher(p_vector.m_y));
-            Vertex::HashCombine(seed, hasher(p_vector.m_z));
-
-            return seed;
-        }
-    };
-
     template<> struct hash<Vertex>
     {
         size_t operator()(Vertex const& p_vertex) const
@@ -0,0 +1,121 @@
+#ifndef __VULKAN_SECONDARY_COMMAND_BUFFERS_HPP__
+#define __VULKAN_SECONDARY_COMMAND_BUFFERS_HPP__
+
+#include "ThreadPool.hpp"
+
+#include "CommandPool.hpp"
+
+/**
+ * Secondary command buffers of a frame, the render passes split their draws into chunks recorded on the ThreadPool
+ * and executed in order by the frame's command buffer.
+ *
+ * A command pool must not be used by two threads at once, so each worker of the ThreadPool records in buffers of its own
+ * graphics pool. Any other thread, such as the render thread executing chunks of its own Record, shares the pool of the thread
+ * which created the Device, one chunk at a time.
+ * The buffers are allocated the first time a thread needs them, then reused from frame to frame.
+ */
+class ENGINE_API SecondaryCommandBuffers : public UniqueObject
+{
+    public:
+
+    // ============================== [Public Static Properties] ============================== //
+
+        /** Draws a chunk records at least, a chunk binds its whole state again and costs an execution. */
+        static constexpr size_t MinDrawsPerChunk    = 128u;
+
+        /** Chunks per recording thread, a few balance the load, more only add executions. */
+        static constexpr size_t ChunksPerThread     = 2u;
+
+        /** Chunks of a subpass at most, their handles are gathered on the stack. */
+        static constexpr uint32 MaxChunkCount       = 32u;
+
+    // ============================== [Public Constructor and Destructor] ============================== //
+
+        /**
+         * Registers the ThreadPool's threads, and the calling thread's graphics pool for every other thread.
+         *
+         * @thread_safety This function must only be called from the thread which created the Device.
+         */
+        SecondaryCommandBuffers     () noexcept;
+
+        ~SecondaryCommandBuffers    ();
+
+    // ============================== [Public Local Methods] ============================== //
+
+        /**
+         * Makes every buffer available again. The frame's commands must have completed.
+         *
+         * @thread_safety This function must only be called from the render thread.
+         */
+        void    Reset           ()                                                          noexcept;
+
+        /**
+         * @return The number of chunks to split the draws into, 1 when they are too few to be worth recording in parallel.
+         *         The subpass recording them must begin with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS when it is more.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        uint32  GetChunkCount   (size_t                                 p_drawCount)        const noexcept;
+
+        /**
+         * Records draws with "p_function(cmdBuffer, first, last)" for [first, last) ranges covering [0, p_drawCount).
+         *
+         * With a single chunk, the draws are recorded in the primary command buffer itself.
+         * Otherwise, each chunk is recorded in a secondary command buffer by the ThreadPool, and the primary one executes them.
+         * A secondary command buffer inherits no state, "p_function" binds everything its draws use.
+         *
+         * @param p_primary         The command buffer of the frame, in the subpass of "p_inheritanceInfo".
+         * @param p_inheritanceInfo The render pass, subpass and framebuffer the chunks are recorded for.
+         * @param p_chunkCount      The number of chunks given by GetChunkCount.
+         *
+         * @thread_safety This function must only be called from the render thread.
+         */
+        template<typename Function>
+        void    Record          (CommandBuffer                  const&  p_primary,
+                                 VkCommandBufferInheritanceInfo const&  p_inheritanceInfo,
+                                 size_t                                 p_drawCount,
+                                 uint32                                 p_chunkCount,
+                                 Function&&                             p_function)         noexcept;
+
+    private:
+
+    // ============================== [Private Structure] ============================== //
+
+        struct ThreadCommandBuffers
+        {
+            /** The graphics pool of the thread, set with its first buffer. */
+            CommandPool const*          pool    = nullptr;
+
+            std::vector<CommandBuffer>  buffers;
+
+            /** Number of buffers recorded since the last Reset. */
+            size_t                      used    = 0u;
+        };
+
+    // ============================== [Private Local Properties] ============================== //
+
+        /** Buffers of the ThreadPool's threads, filled once and only read afterwards, so the threads look theirs up concurrently. */
+        std::unordered_map<std::thread::id, ThreadCommandBuffers>   m_threads;
+
+        /** Buffers of the graphics pool of the thread which created the Device, used by the threads outside the ThreadPool. */
+        ThreadCommandBuffers                                        m_shared;
+
+        /** Held while a buffer of m_shared is acquired and recorded. */
+        std::mutex                                                  m_sharedMutex;
+
+    // ============================== [Private Local Methods] ============================== //
+
+        /**
+         * @param p_sharedLock  Locked on m_sharedMutex when the buffer comes from the shared pool, it must stay so until the buffer is recorded.
+         *
+         * @return A buffer of the calling thread's pool not recorded since the last Reset.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        CommandBuffer   Acquire (std::unique_lock<std::mutex>&  p_sharedLock)   noexcept;
+
+};  // !class SecondaryCommandBuffers
+
+#include "SecondaryCommandBuffers.inl"
+
+#endif // !__VULKAN_SECONDARY_COMMAND_BUFFERS_HPP__
\ No newline at end of file
@@ -0,0 +1,39 @@
+#ifndef __VULKAN_SECONDARY_COMMAND_BUFFERS_INL__
+#define __VULKAN_SECONDARY_COMMAND_BUFFERS_INL__
+
+// ============================== [Public Local Methods] ============================== //
+
+template<typename Function>
+void    SecondaryCommandBuffers::Record (CommandBuffer                  const&  p_primary,
+                                         VkCommandBufferInheritanceInfo const&  p_inheritanceInfo,
+                                         size_t                                 p_drawCount,
+                                         uint32                                 p_chunkCount,
+                                         Function&&                             p_function) noexcept
+{
+    if (p_chunkCount <= 1u)
+    {
+        p_function(p_primary.GetHandle(), size_t(0u), p_drawCount);
+        return;
+    }
+
+    std::array<VkCommandBuffer, MaxChunkCount> handles;
+
+    ThreadPool::Get().ParallelFor(0u, p_chunkCount, 1u, [&] (size_t p_chunk)
+    {
+        std::unique_lock<std::mutex> sharedLock;
+        CommandBuffer const          cmdBuffer = Acquire(sharedLock);
+
+        cmdBuffer.Begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT, &p_inheritanceInfo);
+
+        // The chunks are contiguous ranges executed in order, so the draws keep the order of the list.
+        p_function(cmdBuffer.GetHandle(), p_chunk * p_drawCount / p_chunkCount, (p_chunk + 1u) * p_drawCount / p_chunkCount);
+
+        cmdBuffer.End();
+
+        handles[p_chunk] = cmdBuffer.GetHandle();
+    });
+
+    vkCmdExecuteCommands(p_primary.GetHandle(), p_chunkCount, handles.data());
+}
+
+#endif // !__VULKAN_SECONDARY_COMMAND_BUFFERS_INL__
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "Object/Instance.hpp"
 #include "Object/Swapchain.hpp"
 #include "Object/PipelineCache.hpp"
+#include "Object/SecondaryCommandBuffers.hpp"
 #include "Object/DeviceAllocator.hpp"
 
 #include "Vulkan/RenderPasses/RenderPass.hpp"
@@ -24,6 +25,9 @@ struct ENGINE_API Frame
         VkSemaphore   imageAvailableSemaphore;
         VkSemaphore   renderFinishedSemaphore;
 
+        /** Chunks of the render passes recorded in parallel, executed by the command buffer. */
+        std::unique_ptr<SecondaryCommandBuffers> secondaryCommandBuffers;
+
         struct
         {
             Buffer camera;
@@ -33,11 +37,19 @@ struct ENGINE_API Frame
 
         }   ubos;
 
+        struct
+        {
+            /** Instances of the render list, grown when they do not fit. */
+            Buffer instance;
+
+        }   ssbos;
+
         struct
         {
             VkDescriptorSet scene;
             VkDescriptorSet camera;
             VkDescriptorSet light;
+            VkDescriptorSet instance;
 
         }   descriptorSets;
 
@@ -117,8 +129,15 @@ class ENGINE_API RHI : public EngineModule
 
         INLINE VkDescriptorSetLayout            const   GetLightLayout      ()                      const noexcept  { return m_descriptorSetLayouts.light; }
 
+        INLINE VkDescriptorSetLayout            const   GetInstanceLayout   ()                      const noexcept  { return m_descriptorSetLayouts.instance; }
+
     private:
 
+    // ============================== [Private Static Properties] ============================== //
+
+        /** Instances the storage buffer of a frame holds before it first grows. */
+        static constexpr size_t InitialInstanceCount = 4096u;
+
     // ============================== [Private Local Properties] ============================== //
 
         uint32                              m_currentFrame;
@@ -151,6 +170,7 @@ class ENGINE_API RHI : public EngineModule
             VkDescriptorSetLayout scene;
             VkDescriptorSetLayout camera;
             VkDescriptorSetLayout light;
+            VkDescriptorSetLayout instance;
 
         }   m_descriptorSetLayouts;
 
@@ -160,6 +180,18 @@ class ENGINE_API RHI : public EngineModule
 
         void    UpdateUniformBuffers    (Frame& p_frame)    noexcept;
 
+        /**
+         * Copies the instances of the frame's render list to its storage buffer, growing it first if they do not fit.
+         */
+        void    UpdateStorageBuffers    (Frame& p_frame)    noexcept;
+
+        /**
+         * Creates the instance buffer of a frame, destroying the previous one, and writes it in the frame's instance set.
+         * The frame's commands must have completed.
+         */
+        void    ResizeInstanceBuffer    (Frame&         p_frame,
+                                         size_t const   p_count)    noexcept;
+
     // ===================================================================================== //
 
         void    SetupSamplers               () noexcept;
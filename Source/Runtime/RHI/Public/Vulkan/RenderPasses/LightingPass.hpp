@@ -3,6 +3,12 @@
 
 #include "RenderPass.hpp"
 
+// ============================== [Forward Declaration] ============================== //
+
+struct DrawBatch;
+
+// =================================================================================== //
+
 class ENGINE_API LightingPass : public RenderPass
 {
     public:
@@ -78,11 +84,32 @@ class ENGINE_API LightingPass : public RenderPass
 
     // ======================================================================================= //
         
-        void    GBufferPass     (Frame const& p_frame) const noexcept;
+        /**
+         * @param p_chunkCount  The number of chunks of the opaque batches, the render pass began for them.
+         */
+        void    GBufferPass     (Frame const&   p_frame,
+                                 uint32         p_chunkCount)   const noexcept;
 
-        void    CompositionPass (Frame const& p_frame) const noexcept;
+        void    CompositionPass (Frame const&   p_frame)        const noexcept;
+
+        void    TransparentPass (Frame const&   p_frame)        const noexcept;
+
+    // ======================================================================================= //
 
-        void    TransparentPass (Frame const& p_frame) const noexcept;
+        /**
+         * Sets the viewport and scissor and binds the camera and light sets, which a secondary command buffer does not inherit.
+         */
+        void    BindFrameState  (VkCommandBuffer                p_cmdBuffer,
+                                 Frame                  const&  p_frame)    const noexcept;
+
+        /**
+         * Records the batches [p_first, p_last) of a list, in the frame's command buffer or in a secondary one.
+         */
+        void    DrawBatches     (VkCommandBuffer                p_cmdBuffer,
+                                 Frame                  const&  p_frame,
+                                 std::vector<DrawBatch> const&  p_batches,
+                                 size_t                         p_first,
+                                 size_t                         p_last)     const noexcept;
 
 };  // !class RenderPass
 
@@ -3,6 +3,14 @@
 
 #include "RenderPass.hpp"
 
+#include "Vulkan/Asset/Model/Vertex.hpp"
+
+// ============================== [Forward Declaration] ============================== //
+
+struct DrawBatch;
+
+// =================================================================================== //
+
 class ENGINE_API ShadowPass : public RenderPass
 {
     public:
@@ -31,6 +39,11 @@ class ENGINE_API ShadowPass : public RenderPass
 
     protected:
 
+    // ============================== [Alias] ============================== //
+
+        /** One pipeline per vertex format, indexed by EVertexFormat. */
+        using ShadowPipelines = std::array<VkPipeline, static_cast<size_t>(EVertexFormat::COUNT)>;
+
     // ============================== [Data Structure] ============================== //
 
         struct Attachment
@@ -54,9 +67,9 @@ class ENGINE_API ShadowPass : public RenderPass
 
         VkPipelineLayout        m_pipelineLayout;
 
-        VkPipeline              m_shadow2DPipeline;
+        ShadowPipelines         m_shadow2DPipelines;
 
-        VkPipeline              m_shadowCubePipeline;
+        ShadowPipelines         m_shadowCubePipelines;
 
     // ============================== [Protected Local Methods] ============================== //
 
@@ -80,6 +93,19 @@ class ENGINE_API ShadowPass : public RenderPass
 
         void    SetupCubeShadowPipeline     (std::vector<Frame> const& p_frames) noexcept;
 
+    // ======================================================================================= //
+
+        /**
+         * Records the batches [p_first, p_last) of a shadow list, binding the whole state first
+         * as they may be recorded in a secondary command buffer.
+         */
+        void    DrawBatches (VkCommandBuffer                    p_cmdBuffer,
+                             Frame                      const&  p_frame,
+                             ShadowPipelines            const&  p_pipelines,
+                             std::vector<DrawBatch>     const&  p_batches,
+                             size_t                             p_first,
+                             size_t                             p_last)     const noexcept;
+
 };  // !class ShadowPass
 
 #endif // !__VULKAN_SHADOW_PASS_HPP__
\ No newline at end of file
@@ -0,0 +1,380 @@
+#include "PCH.hpp"
+
+#include "BoundingVolumeHierarchy.hpp"
+
+// ============================== [Internal Functions] ============================== //
+
+/**
+ * Half the surface area of a box, which the insertion minimizes: it is proportional to the chance a random ray or query hits the box.
+ */
+static float    GetCost (Bounds const& p_bounds) noexcept
+{
+    Vector3 const size {p_bounds.GetSize()};
+
+    return size.m_x * size.m_y + size.m_y * size.m_z + size.m_z * size.m_x;
+}
+
+// ============================== [Public Constructor] ============================== //
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy    (float const p_margin) noexcept :
+    m_margin { p_margin }
+{
+
+}
+
+// ============================== [Public Local Methods] ============================== //
+
+int32   BoundingVolumeHierarchy::CreateProxy    (Bounds const&  p_bounds,
+                                                 void*          p_userData) noexcept
+{
+    int32 const leaf = AllocateNode();
+    Node&       node = m_nodes[leaf];
+
+    node.bounds    = p_bounds;
+    node.fatBounds = GetFatBounds(p_bounds);
+    node.userData  = p_userData;
+    node.height    = 0;
+
+    InsertLeaf(leaf);
+
+    ++m_proxyCount;
+
+    return leaf;
+}
+
+void    BoundingVolumeHierarchy::DestroyProxy   (int32 const    p_proxy) noexcept
+{
+    Dequeue   (p_proxy);
+    RemoveLeaf(p_proxy);
+    FreeNode  (p_proxy);
+
+    --m_proxyCount;
+}
+
+bool    BoundingVolumeHierarchy::MoveProxy      (int32 const    p_proxy,
+                                                 Bounds const&  p_bounds) noexcept
+{
+    Node& node = m_nodes[p_proxy];
+
+    node.bounds = p_bounds;
+
+    if (node.queueIndex != NullProxy || (node.fatBounds.IsInsideOrOn(p_bounds.m_min) && node.fatBounds.IsInsideOrOn(p_bounds.m_max)))
+        return false;
+
+    Enqueue(p_proxy);
+
+    return true;
+}
+
+uint32  BoundingVolumeHierarchy::Update         (uint32 const   p_budget) noexcept
+{
+    // The queries test every queued leaf, a fixed budget would let them pay for a queue growing frame after frame.
+    size_t const budget      = std::max(static_cast<size_t>(p_budget), (m_queuedCount + QueueFrames - 1u) / QueueFrames);
+    size_t       reinserted  = 0u;
+
+    while (reinserted < budget && m_queueSize > 0u)
+    {
+        int32 const leaf = m_queue[m_queueHead];
+
+        m_queueHead = (m_queueHead + 1u) % m_queue.size();
+        --m_queueSize;
+
+        if (leaf == NullProxy)
+            continue;
+
+        RemoveLeaf(leaf);
+
+        m_nodes[leaf].queueIndex = NullProxy;
+        m_nodes[leaf].fatBounds  = GetFatBounds(m_nodes[leaf].bounds);
+
+        InsertLeaf(leaf);
+
+        --m_queuedCount;
+        ++reinserted;
+    }
+
+    return static_cast<uint32>(reinserted);
+}
+
+// ============================== [Private Local Methods] ============================== //
+
+int32   BoundingVolumeHierarchy::AllocateNode   () noexcept
+{
+    if (m_freeList == NullProxy)
+    {
+        m_nodes.emplace_back();
+
+        return static_cast<int32>(m_nodes.size() - 1u);
+    }
+
+    int32 const node = m_freeList;
+
+    m_freeList    = m_nodes[node].parent;
+    m_nodes[node] = Node();
+
+    return node;
+}
+
+void    BoundingVolumeHierarchy::FreeNode       (int32 const p_node) noexcept
+{
+    m_nodes[p_node]        = Node();
+    m_nodes[p_node].parent = m_freeList;
+
+    m_freeList = p_node;
+}
+
+void    BoundingVolumeHierarchy::InsertLeaf     (int32 const p_leaf) noexcept
+{
+    if (m_root == NullProxy)
+    {
+        m_root                 = p_leaf;
+        m_nodes[p_leaf].parent = NullProxy;
+
+        return;
+    }
+
+    Bounds const leafBounds = m_nodes[p_leaf].fatBounds;
+
+    // Walks down to the sibling which grows the tree's total cost the least.
+    int32 index = m_root;
+
+    while (!m_nodes[index].IsLeaf())
+    {
+        Node  const& node         = m_nodes[index];
+        float const  combinedCost = GetCost(Bounds::Overlap(node.fatBounds, leafBounds));
+
+        // Cost of pairing the leaf with this node, and the cost every ancestor pays if it goes further down.
+        float const  pairCost        = 2.0f * combinedCost;
+        float const  inheritanceCost = 2.0f * (combinedCost - GetCost(node.fatBounds));
+
+        auto const descendCost = [&] (int32 const p_child)
+        {
+            Node  const& child = m_nodes[p_child];
+            float const  cost  = GetCost(Bounds::Overlap(child.fatBounds, leafBounds)) + inheritanceCost;
+
+            return child.IsLeaf() ? cost : cost - GetCost(child.fatBounds);
+        };
+
+        float const cost1 = descendCost(node.child1);
+        float const cost2 = descendCost(node.child2);
+
+        if (pairCost < cost1 && pairCost < cost2)
+            break;
+
+        index = cost1 < cost2 ? node.child1 : node.child2;
+    }
+
+    int32 const sibling   = index;
+    int32 const oldParent = m_nodes[sibling].parent;
+    int32 const newParent = AllocateNode();
+
+    m_nodes[newParent].parent    = oldParent;
+    m_nodes[newParent].fatBounds = Bounds::Overlap(leafBounds, m_nodes[sibling].fatBounds);
+    m_nodes[newParent].height    = m_nodes[sibling].height + 1;
+    m_nodes[newParent].child1    = sibling;
+    m_nodes[newParent].child2    = p_leaf;
+
+    if (oldParent == NullProxy)
+        m_root = newParent;
+
+    else if (m_nodes[oldParent].child1 == sibling)
+        m_nodes[oldParent].child1 = newParent;
+
+    else
+        m_nodes[oldParent].child2 = newParent;
+
+    m_nodes[sibling].parent = newParent;
+    m_nodes[p_leaf] .parent = newParent;
+
+    Refit(newParent);
+}
+
+void    BoundingVolumeHierarchy::RemoveLeaf     (int32 const p_leaf) noexcept
+{
+    if (p_leaf == m_root)
+    {
+        m_root = NullProxy;
+
+        return;
+    }
+
+    int32 const parent      = m_nodes[p_leaf].parent;
+    int32 const grandParent = m_nodes[parent].parent;
+    int32 const sibling     = m_nodes[parent].child1 == p_leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+    // The sibling takes the place of the parent.
+    if (grandParent == NullProxy)
+        m_root = sibling;
+
+    else if (m_nodes[grandParent].child1 == parent)
+        m_nodes[grandParent].child1 = sibling;
+
+    else
+        m_nodes[grandParent].child2 = sibling;
+
+    m_nodes[sibling].parent = grandParent;
+    m_nodes[p_leaf] .parent = NullProxy;
+
+    FreeNode(parent);
+    Refit   (grandParent);
+}
+
+int32   BoundingVolumeHierarchy::Balance        (int32 const p_node) noexcept
+{
+    Node& a = m_nodes[p_node];
+
+    if (a.IsLeaf() || a.height < 2)
+        return p_node;
+
+    int32 const indexB  = a.child1;
+    int32 const indexC  = a.child2;
+    Node&       b       = m_nodes[indexB];
+    Node&       c       = m_nodes[indexC];
+    int32 const balance = c.height - b.height;
+
+    // Rotates C up: C takes A's place, A keeps B and C's shallower child, C keeps A and its deeper child.
+    if (balance > 1)
+    {
+        int32 const indexF = c.child1;
+        int32 const indexG = c.child2;
+        Node&       f      = m_nodes[indexF];
+        Node&       g      = m_nodes[indexG];
+
+        c.child1 = p_node;
+        c.parent = a.parent;
+        a.parent = indexC;
+
+        if (c.parent == NullProxy)
+            m_root = indexC;
+
+        else if (m_nodes[c.parent].child1 == p_node)
+            m_nodes[c.parent].child1 = indexC;
+
+        else
+            m_nodes[c.parent].child2 = indexC;
+
+        int32 const deeper    = f.height > g.height ? indexF : indexG;
+        int32 const shallower = f.height > g.height ? indexG : indexF;
+
+        c.child2                  = deeper;
+        a.child2                  = shallower;
+        m_nodes[shallower].parent = p_node;
+
+        a.fatBounds = Bounds::Overlap(b.fatBounds, m_nodes[shallower].fatBounds);
+        c.fatBounds = Bounds::Overlap(a.fatBounds, m_nodes[deeper]   .fatBounds);
+        a.height    = 1 + std::max(b.height, m_nodes[shallower].height);
+        c.height    = 1 + std::max(a.height, m_nodes[deeper]   .height);
+
+        return indexC;
+    }
+
+    // Rotates B up, symmetrically.
+    if (balance < -1)
+    {
+        int32 const indexD = b.child1;
+        int32 const indexE = b.child2;
+        Node&       d      = m_nodes[indexD];
+        Node&       e      = m_nodes[indexE];
+
+        b.child1 = p_node;
+        b.parent = a.parent;
+        a.parent = indexB;
+
+        if (b.parent == NullProxy)
+            m_root = indexB;
+
+        else if (m_nodes[b.parent].child1 == p_node)
+            m_nodes[b.parent].child1 = indexB;
+
+        else
+            m_nodes[b.parent].child2 = indexB;
+
+        int32 const deeper    = d.height > e.height ? indexD : indexE;
+        int32 const shallower = d.height > e.height ? indexE : indexD;
+
+        b.child2                  = deeper;
+        a.child1                  = shallower;
+        m_nodes[shallower].parent = p_node;
+
+        a.fatBounds = Bounds::Overlap(c.fatBounds, m_nodes[shallower].fatBounds);
+        b.fatBounds = Bounds::Overlap(a.fatBounds, m_nodes[deeper]   .fatBounds);
+        a.height    = 1 + std::max(c.height, m_nodes[shallower].height);
+        b.height    = 1 + std::max(a.height, m_nodes[deeper]   .height);
+
+        return indexB;
+    }
+
+    return p_node;
+}
+
+void    BoundingVolumeHierarchy::Refit          (int32 p_node) noexcept
+{
+    while (p_node != NullProxy)
+    {
+        p_node = Balance(p_node);
+
+        Node&       node   = m_nodes[p_node];
+        Node const& child1 = m_nodes[node.child1];
+        Node const& child2 = m_nodes[node.child2];
+
+        node.height    = 1 + std::max(child1.height, child2.height);
+        node.fatBounds = Bounds::Overlap(child1.fatBounds, child2.fatBounds);
+
+        p_node = node.parent;
+    }
+}
+
+void    BoundingVolumeHierarchy::Enqueue        (int32 const p_leaf) noexcept
+{
+    size_t capacity = m_queue.size();
+
+    // Unrolls the ring into a buffer with room for as many leaves again, dropping the holes.
+    if (m_queueSize == capacity)
+    {
+        std::vector<int32> queue(std::max({ capacity, 2u * m_queuedCount, MinQueueCapacity }), NullProxy);
+        size_t             count = 0u;
+
+        for (size_t i = 0u; i < m_queueSize; ++i)
+        {
+            int32 const leaf = m_queue[(m_queueHead + i) % capacity];
+
+            if (leaf == NullProxy)
+                continue;
+
+            m_nodes[leaf].queueIndex = static_cast<int32>(count);
+            queue[count++]           = leaf;
+        }
+
+        m_queue     = std::move(queue);
+        m_queueHead = 0u;
+        m_queueSize = count;
+        capacity    = m_queue.size();
+    }
+
+    size_t const slot = (m_queueHead + m_queueSize) % capacity;
+
+    m_queue[slot]              = p_leaf;
+    m_nodes[p_leaf].queueIndex = static_cast<int32>(slot);
+
+    ++m_queueSize;
+    ++m_queuedCount;
+}
+
+void    BoundingVolumeHierarchy::Dequeue        (int32 const p_leaf) noexcept
+{
+    int32 const queueIndex = m_nodes[p_leaf].queueIndex;
+
+    if (queueIndex == NullProxy)
+        return;
+
+    // Leaves a hole, Update and the queries skip it.
+    m_queue[queueIndex]        = NullProxy;
+    m_nodes[p_leaf].queueIndex = NullProxy;
+
+    --m_queuedCount;
+}
+
+Bounds  BoundingVolumeHierarchy::GetFatBounds   (Bounds const& p_bounds) const noexcept
+{
+    return p_bounds.GetExpanded(m_margin * p_bounds.GetSize().GetMax());
+}
\ No newline at end of file
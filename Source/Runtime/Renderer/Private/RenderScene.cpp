@@ -0,0 +1,188 @@
+#include "PCH.hpp"
+
+#include "RenderScene.hpp"
+#include "GameFramework/Entity.hpp"
+#include "Components/StaticMeshComponent.hpp"
+#include "Light/SpotLightComponent.hpp"
+#include "Light/PointLightComponent.hpp"
+#include "Light/DirectionalLightComponent.hpp"
+
+// ============================== [Public Constructor] ============================== //
+
+RenderScene::RenderScene    () noexcept
+{
+    // The address of a level is reused once it is destroyed, so the Renderer tells the scenes apart by their number.
+    static std::atomic<uint64> nextID { 1u };
+
+    m_id = nextID.fetch_add(1u, std::memory_order_relaxed);
+}
+
+// ============================== [Public Local Methods] ============================== //
+
+void    RenderScene::AddEntity          (Entity& p_entity) noexcept
+{
+    p_entity.SetRenderScene(this);
+
+    for (EntityComponent* component : p_entity.GetComponents())
+        AddComponent(component);
+}
+
+void    RenderScene::RemoveEntity       (Entity& p_entity) noexcept
+{
+    for (EntityComponent* component : p_entity.GetComponents())
+        RemoveComponent(component);
+
+    if (p_entity.GetRenderScene() == this)
+        p_entity.SetRenderScene(nullptr);
+}
+
+void    RenderScene::AddComponent       (EntityComponent* p_component) noexcept
+{
+    if (StaticMeshComponent* mesh = dynamic_cast<StaticMeshComponent*>(p_component))
+    {
+        if (IsRegistered(m_meshComponents, *mesh))
+            return;
+
+        // A copied component holds the proxy of its original, which only belongs to the original.
+        mesh->SetRenderProxy(-1);
+
+        Register (m_meshComponents, *mesh);
+        MarkDirty(*mesh);
+    }
+
+    else if (SpotLightComponent* light = dynamic_cast<SpotLightComponent*>(p_component))
+    {
+        if (!IsRegistered(m_spotLightComponents, *light))
+            Register(m_spotLightComponents, *light);
+    }
+
+    else if (PointLightComponent* light = dynamic_cast<PointLightComponent*>(p_component))
+    {
+        if (!IsRegistered(m_pointLightComponents, *light))
+            Register(m_pointLightComponents, *light);
+    }
+
+    else if (DirectionalLightComponent* light = dynamic_cast<DirectionalLightComponent*>(p_component))
+    {
+        if (!IsRegistered(m_directionalLightComponents, *light))
+            Register(m_directionalLightComponents, *light);
+    }
+}
+
+void    RenderScene::RemoveComponent    (EntityComponent* p_component) noexcept
+{
+    if (StaticMeshComponent* mesh = dynamic_cast<StaticMeshComponent*>(p_component))
+    {
+        if (!IsRegistered(m_meshComponents, *mesh))
+            return;
+
+        SceneComponent& component = *mesh;
+
+        if (component.m_isRenderStateDirty)
+        {
+            m_dirtyMeshes.erase(std::find(m_dirtyMeshes.begin(), m_dirtyMeshes.end(), mesh));
+
+            component.m_isRenderStateDirty = false;
+        }
+
+        if (mesh->GetRenderProxy() != -1)
+        {
+            m_removedProxies.push_back(mesh->GetRenderProxy());
+
+            mesh->SetRenderProxy(-1);
+        }
+
+        Unregister(m_meshComponents, *mesh);
+    }
+
+    else if (SpotLightComponent* light = dynamic_cast<SpotLightComponent*>(p_component))
+    {
+        if (IsRegistered(m_spotLightComponents, *light))
+            Unregister(m_spotLightComponents, *light);
+    }
+
+    else if (PointLightComponent* light = dynamic_cast<PointLightComponent*>(p_component))
+    {
+        if (IsRegistered(m_pointLightComponents, *light))
+            Unregister(m_pointLightComponents, *light);
+    }
+
+    else if (DirectionalLightComponent* light = dynamic_cast<DirectionalLightComponent*>(p_component))
+    {
+        if (IsRegistered(m_directionalLightComponents, *light))
+            Unregister(m_directionalLightComponents, *light);
+    }
+}
+
+void    RenderScene::MarkDirty          (SceneComponent& p_component) noexcept
+{
+    if (p_component.m_isRenderStateDirty || p_component.m_renderScene != this)
+        return;
+
+    size_t const index = static_cast<size_t>(p_component.m_renderSceneIndex);
+
+    // Only the mesh components have a proxy to update.
+    if (index >= m_meshComponents.size() || m_meshComponents[index] != &p_component)
+        return;
+
+    p_component.m_isRenderStateDirty = true;
+
+    m_dirtyMeshes.push_back(m_meshComponents[index]);
+}
+
+void    RenderScene::TakeChanges        (std::vector<int32>&                p_outRemovedProxies,
+                                         std::vector<StaticMeshComponent*>& p_outDirtyMeshes) noexcept
+{
+    p_outRemovedProxies.clear();
+    p_outDirtyMeshes   .clear();
+
+    // Swapped rather than copied, so the buffers of both sides are reused from frame to frame.
+    p_outRemovedProxies.swap(m_removedProxies);
+    p_outDirtyMeshes   .swap(m_dirtyMeshes);
+
+    for (SceneComponent* component : p_outDirtyMeshes)
+        component->m_isRenderStateDirty = false;
+}
+
+// ============================== [Private Local Methods] ============================== //
+
+template<typename T>
+bool    RenderScene::IsRegistered       (std::vector<T*> const& p_components,
+                                         T&                     p_component) const noexcept
+{
+    SceneComponent const& component = p_component;
+    size_t         const  index     = static_cast<size_t>(component.m_renderSceneIndex);
+
+    // A copied component holds the index of its original, so the index alone does not tell.
+    return component.m_renderScene == this && index < p_components.size() && p_components[index] == &p_component;
+}
+
+template<typename T>
+void    RenderScene::Register           (std::vector<T*>&       p_components,
+                                         T&                     p_component) noexcept
+{
+    SceneComponent& component = p_component;
+
+    component.m_renderScene        = this;
+    component.m_renderSceneIndex   = static_cast<int32>(p_components.size());
+    component.m_isRenderStateDirty = false;
+
+    p_components.push_back(&p_component);
+}
+
+template<typename T>
+void    RenderScene::Unregister         (std::vector<T*>&       p_components,
+                                         T&                     p_component) noexcept
+{
+    SceneComponent& component = p_component;
+    SceneComponent& last      = *p_components.back();
+    int32 const     index     = component.m_renderSceneIndex;
+
+    p_components[static_cast<size_t>(index)] = p_components.back();
+    last.m_renderSceneIndex                  = index;
+
+    p_components.pop_back();
+
+    component.m_renderScene      = nullptr;
+    component.m_renderSceneIndex = -1;
+}
\ No newline at end of file
@@ -4,11 +4,44 @@
 #include "Renderer.hpp"
 #include "ThreadPool.hpp"
 #include "AssetManager.hpp"
+#include "GameUserSettings.hpp"
+
+// ============================== [Internal Constants] ============================== //
+
+/** Bits of the key sorted by a pass of the radix sort. */
+static constexpr uint32 RadixBits       = 8u;
+
+static constexpr size_t RadixBuckets    = 1u << RadixBits;
+
+// ============================== [Internal Functions] ============================== //
+
+/**
+ * Quantized positions are mapped back to the mesh's bounds by its transform.
+ */
+static Matrix4x4    GetMeshMatrix   (Matrix4x4 const&   p_modelMatrix,
+                                     Mesh const&        p_mesh) noexcept
+{
+    return p_mesh.vertexFormat == EVertexFormat::QUANTIZED ? p_modelMatrix * p_mesh.dequantization : p_modelMatrix;
+}
+
+static void LogWaitStatistics   (char const*                p_name,
+                                 SignalStatistics const&    p_statistics) noexcept
+{
+    uint64 waitCount = p_statistics.waitCount  .load(std::memory_order_relaxed);
+    uint64 waitTime  = p_statistics.waitTime   .load(std::memory_order_relaxed);
+    uint64 maxTime   = p_statistics.maxWaitTime.load(std::memory_order_relaxed);
+
+    LOG(LogRenderer, Display, "%s waited %llu times (%llu parked) for %.3f ms, %.3f ms on average, %.3f ms at most",
+        p_name, waitCount, p_statistics.parkCount.load(std::memory_order_relaxed),
+        waitTime * 1e-6, waitCount ? waitTime * 1e-6 / waitCount : 0.0, maxTime * 1e-6);
+}
 
 // ============================== [Public Constructor] ============================== //
 
 Renderer::Renderer  () :
-    m_running { false }
+    m_running       { false },
+    m_frameReady    { false },
+    m_sceneReleased { true  }
 {
 
 }
@@ -19,13 +52,11 @@ void    Renderer::Initialize    (EngineKey const& p_passkey)
 {
     LOG(LogRenderer, Warning, "\nInitializing Renderer...\n");
 
-    m_renderList = std::make_unique<RenderList>();
-
-    m_activeScene   = std::make_unique<RenderScene>();
-    m_inactiveScene = std::make_unique<RenderScene>();
+    m_renderList      = std::make_unique<RenderList>();
+    m_frameRenderList = std::make_unique<RenderList>();
 
-    m_activeScene  ->isAvailable.store(false, std::memory_order_relaxed);
-    m_inactiveScene->isAvailable.store(true,  std::memory_order_relaxed);
+    m_backoff.spinCount  = GEngine->GetGameUserSettings()->GetFrameSpinCount ();
+    m_backoff.yieldCount = GEngine->GetGameUserSettings()->GetFrameYieldCount();
 
     m_initialized = true;
 
@@ -40,33 +71,36 @@ void    Renderer::Update        (EngineKey const& p_passkey)
         return;
     }
 
-    ThreadPool& threadPool = ThreadPool::Get();
-    RHI&        rhi        = RHI       ::Get();
+    RHI& rhi = RHI::Get();
+
+    Profiler::SetThreadName("Render Thread");
 
     m_running.store(true, std::memory_order_relaxed);
 
-    while (GEngine->IsRunning())
+    while (true)
     {
-        if (!m_activeScene->isAvailable.load(std::memory_order_acquire))
-        {
-            threadPool.ExecuteTask();
-            continue;
-        }
+        // Waits for the game thread to build a frame, Shutdown also notifies to stop the loop.
+        m_frameReady.Wait(m_backoff, &m_renderThreadWait);
 
-        m_activeScene->isAvailable.store(false, std::memory_order_relaxed);
+        if (!GEngine->IsRunning())
+            break;
 
-        // Swaps the scenes.
-        m_activeScene.swap(m_inactiveScene);
+        // Notifies that the frame has been taken, the game thread builds the next one in the other list while this one is drawn.
+        RenderList* renderList = m_frameRenderList.get();
 
-        // Notifies that the scenes have been swapped.
-        m_inactiveScene->isAvailable.store(true, std::memory_order_release);
+        m_sceneReleased.Notify();
 
         // Draws the scene.
-        rhi.NextFrame(p_passkey).renderList = m_renderList.get();
+        NAMED_PROFILER_MARKER(DrawFrame)
+
+        rhi.NextFrame(p_passkey).renderList = renderList;
         rhi.DrawFrame(p_passkey);
     }
 
-    m_running.store(false, std::memory_order_relaxed);
+    m_running.store(false, std::memory_order_release);
+
+    // The game thread may be waiting for a scene on its last frame.
+    m_sceneReleased.Notify();
 }
 
 void    Renderer::Shutdown      (EngineKey const& p_passkey)
@@ -75,16 +109,35 @@ void    Renderer::Shutdown      (EngineKey const& p_passkey)
 
     ThreadPool& threadPool = ThreadPool::Get();
 
+    m_frameReady.Notify();
+
     while (m_running.load(std::memory_order_acquire))
     {
-        threadPool.ExecuteTask();
+        if (!threadPool.TryExecuteTask())
+            std::this_thread::yield();
     }
 
+    LogWaitStatistics("Render thread", m_renderThreadWait);
+    LogWaitStatistics("Game thread",   m_gameThreadWait);
+
     RHI::Get().GetDevice()->WaitIdle();
 
-    m_activeScene  .reset();
-    m_inactiveScene.reset();
-    m_renderList   .reset();
+    m_renderList     .reset();
+    m_frameRenderList.reset();
+
+    // The components keep their proxy, the scene is rebuilt from scratch if the Renderer is initialized again.
+    m_meshHierarchy   = BoundingVolumeHierarchy();
+    m_sceneID         = 0u;
+    m_submittedMeshes = 0u;
+    m_meshProxies.clear();
+    m_removedProxies.clear();
+    m_dirtyMeshes.clear();
+    m_visibleProxies.clear();
+    m_renderChunks.clear();
+    m_materialIndices.clear();
+    m_meshIndices.clear();
+    m_sortScratch.clear();
+    m_sortHistograms.clear();
 
     m_initialized = false;
 
@@ -94,7 +147,7 @@ void    Renderer::Shutdown      (EngineKey const& p_passkey)
 // ============================== [Public Local Methods] ============================== //
 
 void    Renderer::Render    (EngineKey const& p_passkey,
-                             Level     const& p_level) noexcept
+                             Level&           p_level) noexcept
 {
     if (!m_initialized)
     {
@@ -102,156 +155,620 @@ void    Renderer::Render    (EngineKey const& p_passkey,
         return;
     }
 
+    PROFILER_MARKER
+
     #ifndef EDITOR
 
-    ThreadPool& threadPool = ThreadPool::Get();
+    // Waits for the render thread to take the last frame before the render list is built again.
+    m_sceneReleased.Wait(m_backoff, &m_gameThreadWait);
 
-    while (!m_inactiveScene->isAvailable.load(std::memory_order_acquire) && m_running.load(std::memory_order_relaxed))
-    {
-        threadPool.ExecuteTask();
-    }
+    #endif
 
-    m_inactiveScene->isAvailable.store(false, std::memory_order_relaxed);
+    RenderScene& scene = p_level.GetRenderScene();
 
-    #endif
+    m_statistics = {};
+
+    // The proxies follow the scene even without a camera, so its changes do not pile up.
+    UpdateMeshHierarchy(scene);
 
-    m_activeScene->spotLightComponents       .clear();
-    m_activeScene->pointLightComponents      .clear();
-    m_activeScene->directionalLightComponents.clear();
-    m_activeScene->meshComponents            .clear();
+    m_statistics.submittedMeshes = m_submittedMeshes;
 
     if (p_level.GetWorld() && p_level.GetWorld()->GetMainCamera())
     {
-        m_activeScene->camera = p_level.GetWorld()->GetMainCamera();
+        CameraComponent* camera         = p_level.GetWorld()->GetMainCamera();
+        Vector3 const    cameraLocation = camera->GetWorldLocation();
 
-        m_renderList->camera.position   = m_activeScene->camera->GetWorldLocation ();
-        m_renderList->camera.view       = m_activeScene->camera->GetWorldTransform().GetMatrixInverse       ();
-        m_renderList->camera.projection = m_activeScene->camera->GetCameraView    ().ComputeProjectionMatrix();
-
-        p_level.GetVisibleComponents<SpotLightComponent>       (m_activeScene->spotLightComponents);
-        p_level.GetVisibleComponents<PointLightComponent>      (m_activeScene->pointLightComponents);
-        p_level.GetVisibleComponents<DirectionalLightComponent>(m_activeScene->directionalLightComponents);
-        p_level.GetVisibleComponents<StaticMeshComponent>      (m_activeScene->meshComponents);
+        m_renderList->camera.position   = cameraLocation;
+        m_renderList->camera.view       = camera->GetWorldTransform().GetMatrixInverse       ();
+        m_renderList->camera.projection = camera->GetCameraView    ().ComputeProjectionMatrix();
 
         m_renderList->spotLights       .clear();
         m_renderList->pointLights      .clear();
         m_renderList->directionalLights.clear();
 
-        for (auto const& lightComponent : m_activeScene->spotLightComponents)
+        for (auto const& lightComponent : scene.GetSpotLightComponents())
         {
-            m_renderList->spotLights.emplace_back(lightComponent->GetRenderData());
+            if (lightComponent->IsVisible())
+                m_renderList->spotLights.emplace_back(lightComponent->GetRenderData());
         }
 
-        for (auto const& lightComponent : m_activeScene->pointLightComponents)
+        for (auto const& lightComponent : scene.GetPointLightComponents())
         {
-            m_renderList->pointLights.emplace_back(lightComponent->GetRenderData());
+            if (lightComponent->IsVisible())
+                m_renderList->pointLights.emplace_back(lightComponent->GetRenderData());
         }
 
-        for (auto const& lightComponent : m_activeScene->directionalLightComponents)
+        for (auto const& lightComponent : scene.GetDirectionalLightComponents())
         {
-            m_renderList->directionalLights.emplace_back(lightComponent->GetRenderData());
+            if (lightComponent->IsVisible())
+                m_renderList->directionalLights.emplace_back(lightComponent->GetRenderData());
         }
 
         m_renderList->materials        .clear();
+        m_renderList->transforms       .clear();
         m_renderList->opaqueMeshes     .clear();
         m_renderList->transparentMeshes.clear();
+        m_renderList->shadowCasters    .clear();
+        m_casterBounds                 .clear();
+
+        ++m_frame;
+
+        Frustum const cameraFrustum(m_renderList->camera.projection * m_renderList->camera.view);
+
+        GatherVisibleMeshes(cameraFrustum, cameraLocation);
+        GatherShadowCasters();
 
-        for (auto const& meshComponent : m_activeScene->meshComponents)
+        // The opaque draws sharing a material are grouped by vertex format so their pipeline is bound once, the transparent ones go back to front.
+        SortDraws(m_renderList->opaqueMeshes);
+        SortDraws(m_renderList->transparentMeshes);
+
+        BuildBatches();
+    }
+
+    else
+    {
+        m_renderList->spotLights        .clear();
+        m_renderList->pointLights       .clear();
+        m_renderList->directionalLights .clear();
+        m_renderList->materials         .clear();
+        m_renderList->transforms        .clear();
+        m_renderList->opaqueMeshes      .clear();
+        m_renderList->transparentMeshes .clear();
+        m_renderList->shadowCasters     .clear();
+        m_renderList->instances         .clear();
+        m_renderList->opaqueBatches     .clear();
+        m_renderList->transparentBatches.clear();
+        m_renderList->shadow2DBatches   .clear();
+        m_renderList->shadowCubeBatches .clear();
+
+        LOG(LogRenderer, Error, "There is no main camera in the level");
+    }
+
+    m_statistics.culledMeshes        = m_statistics.submittedMeshes - m_renderList->opaqueMeshes.size() - m_renderList->transparentMeshes.size();
+    m_statistics.shadowCasters       = m_renderList->shadowCasters.size();
+    m_statistics.culledShadowCasters = m_statistics.submittedMeshes - m_statistics.shadowCasters;
+    m_statistics.drawCalls           = m_renderList->opaqueBatches  .size() + m_renderList->transparentBatches.size() +
+                                       m_renderList->shadow2DBatches.size() + m_renderList->shadowCubeBatches .size();
+
+    Profiler::Get()->SetCounter("Opaque Meshes",         static_cast<double>(m_renderList->opaqueMeshes     .size()));
+    Profiler::Get()->SetCounter("Transparent Meshes",    static_cast<double>(m_renderList->transparentMeshes.size()));
+    Profiler::Get()->SetCounter("Submitted Meshes",      static_cast<double>(m_statistics.submittedMeshes));
+    Profiler::Get()->SetCounter("Culled Meshes",         static_cast<double>(m_statistics.culledMeshes));
+    Profiler::Get()->SetCounter("Shadow Casters",        static_cast<double>(m_statistics.shadowCasters));
+    Profiler::Get()->SetCounter("Culled Shadow Casters", static_cast<double>(m_statistics.culledShadowCasters));
+    Profiler::Get()->SetCounter("Draw Calls",            static_cast<double>(m_statistics.drawCalls));
+
+    #if EDITOR
+
+    RHI::Get().NextFrame(p_passkey).renderList = m_renderList.get();
+    RHI::Get().DrawFrame(p_passkey);
+
+    #else
+
+    // The render thread took the previous list when it released the scene, it may still be drawing it but not this one.
+    std::swap(m_renderList, m_frameRenderList);
+
+    m_frameReady.Notify();
+
+    #endif
+}
+
+StaticMeshComponent*    Renderer::PickMeshComponent (Vector3 const& p_origin,
+                                                     Vector3 const& p_direction,
+                                                     float const    p_maxDistance) const noexcept
+{
+    Vector3 const        inverseDirection(1.0f / p_direction.m_x, 1.0f / p_direction.m_y, 1.0f / p_direction.m_z);
+    StaticMeshComponent* closest         = nullptr;
+    float                closestDistance = p_maxDistance;
+
+    m_meshHierarchy.RayCast(p_origin, p_direction, p_maxDistance, [&] (int32 p_proxy, float p_distance)
+    {
+        StaticMeshComponent* component = m_meshProxies[p_proxy].component;
+
+        if (!component->IsVisible())
+            return closestDistance;
+
+        // The component's bounds may be hit between its meshes.
+        for (Bounds const& bounds : component->GetMeshWorldBounds())
         {
-            if (!meshComponent->GetModel() || !meshComponent->GetModel()->IsValid())
-                continue;
-
-            Matrix4x4   modelMatrix       = meshComponent->GetRenderMatrix     ();
-            auto const& meshes            = meshComponent->GetModel            ()->GetMeshes();
-            auto const& materialInstances = meshComponent->GetMaterialInstances();
-            
-            for (size_t i = 0; i < meshes.size() && i < materialInstances.size(); ++i)
+            if (bounds.IsIntersectingRay(p_origin, inverseDirection, closestDistance, p_distance) && p_distance < closestDistance)
             {
-                if (!materialInstances[i]->IsValid() || !materialInstances[i]->GetMaterial()->IsValid())
-                    continue;
-
-                auto const& it = std::find_if(m_renderList->materials.begin(),
-                                              m_renderList->materials.end  (), [&] (MaterialRenderData const* p_material)
-                {
-                    return p_material == materialInstances[i]->GetMaterialRenderDataPtr();
-                });
-
-                if (it != m_renderList->materials.end())
-                {
-                    if (materialInstances[i]->IsOpaque())
-                    {
-                        m_renderList->opaqueMeshes.push_back(std::make_tuple(std::distance(m_renderList->materials.begin(), it),
-                                                             modelMatrix,
-                                                             materialInstances[i]->GetMaterialDataPtr(),
-                                                             &meshes[i]));
-                    }
-
-                    else
-                    {
-                        m_renderList->transparentMeshes.push_back(std::make_tuple(std::distance(m_renderList->materials.begin(), it),
-                                                                                  modelMatrix,
-                                                                                  materialInstances[i]->GetMaterialDataPtr(),
-                                                                                  &meshes[i]));
-                    }
-                }
-
-                else
-                {
-                    if (materialInstances[i]->IsOpaque())
-                    {
-                        m_renderList->opaqueMeshes.push_back(std::make_tuple(m_renderList->materials.size(),
-                                                                             modelMatrix,
-                                                                             materialInstances[i]->GetMaterialDataPtr(),
-                                                                             &meshes[i]));
-                    }
-
-                    else
-                    {
-                        m_renderList->transparentMeshes.push_back(std::make_tuple(m_renderList->materials.size(),
-                                                                                  modelMatrix,
-                                                                                  materialInstances[i]->GetMaterialDataPtr(),
-                                                                                  &meshes[i]));
-                    }
-
-                    m_renderList->materials.push_back(materialInstances[i]->GetMaterialRenderDataPtr());
-                }
+                closest         = component;
+                closestDistance = p_distance;
             }
         }
 
-        std::sort(m_renderList->opaqueMeshes.begin(), m_renderList->opaqueMeshes.end(), [this] (MeshInstance const& lhs,
-                                                                                                MeshInstance const& rhs)
+        return closestDistance;
+    });
+
+    return closest;
+}
+
+// ============================== [Private Local Methods] ============================== //
+
+void    Renderer::UpdateMeshHierarchy   (RenderScene& p_scene) noexcept
+{
+    p_scene.TakeChanges(m_removedProxies, m_dirtyMeshes);
+
+    // Another level is drawn, every component of the new one gets a proxy and the changes were made to the proxies of the old one.
+    if (p_scene.GetID() != m_sceneID)
+    {
+        m_sceneID         = p_scene.GetID();
+        m_meshHierarchy   = BoundingVolumeHierarchy();
+        m_submittedMeshes = 0u;
+
+        m_meshProxies   .clear();
+        m_removedProxies.clear();
+        m_dirtyMeshes   .assign(p_scene.GetMeshComponents().begin(), p_scene.GetMeshComponents().end());
+    }
+
+    for (int32 proxy : m_removedProxies)
+        DestroyMeshProxy(proxy);
+
+    for (StaticMeshComponent* component : m_dirtyMeshes)
+    {
+        int32      proxy    = component->GetRenderProxy();
+        bool const hasProxy = proxy != BoundingVolumeHierarchy::NullProxy && static_cast<size_t>(proxy) < m_meshProxies.size() &&
+                              m_meshProxies[proxy].component == component;
+
+        // A model still loading has nothing to draw yet, so the component is updated again on the next frame.
+        if (!component->GetModel() || !component->GetModel()->IsValid())
+        {
+            if (hasProxy)
+                DestroyMeshProxy(proxy);
+
+            component->SetRenderProxy(BoundingVolumeHierarchy::NullProxy);
+
+            if (component->GetModel())
+                p_scene.MarkDirty(*component);
+
+            continue;
+        }
+
+        Bounds const& bounds = component->GetWorldBounds();
+
+        if (!hasProxy)
+        {
+            proxy = m_meshHierarchy.CreateProxy(bounds, component);
+
+            component->SetRenderProxy(proxy);
+
+            if (static_cast<size_t>(proxy) >= m_meshProxies.size())
+                m_meshProxies.resize(static_cast<size_t>(proxy) + 1u);
+
+            m_meshProxies[proxy].component = component;
+        }
+
+        else
+            m_meshHierarchy.MoveProxy(proxy, bounds);
+
+        MeshProxy&  meshProxy         = m_meshProxies[proxy];
+        Matrix4x4   modelMatrix       = component->GetRenderMatrix     ();
+        auto const& meshes            = component->GetModel            ()->GetMeshes();
+        auto const& materialInstances = component->GetMaterialInstances();
+
+        m_submittedMeshes -= meshProxy.draws.size();
+
+        meshProxy.draws.resize(std::min(meshes.size(), materialInstances.size()));
+
+        for (size_t i = 0u; i < meshProxy.draws.size(); ++i)
+            meshProxy.draws[i] = { GetMeshMatrix(modelMatrix, meshes[i]), &meshes[i], materialInstances[i].get() };
+
+        m_submittedMeshes += meshProxy.draws.size();
+    }
+
+    m_meshHierarchy.Update(HierarchyReinsertionBudget);
+}
+
+void    Renderer::DestroyMeshProxy      (int32 p_proxy) noexcept
+{
+    m_submittedMeshes -= m_meshProxies[p_proxy].draws.size();
+
+    m_meshHierarchy.DestroyProxy(p_proxy);
+
+    m_meshProxies[p_proxy] = MeshProxy();
+}
+
+void    Renderer::GatherVisibleMeshes   (Frustum const& p_frustum,
+                                         Vector3 const& p_cameraLocation) noexcept
+{
+    // Only the components whose bounds intersect the view are visited, their meshes are culled one by one.
+    m_visibleProxies.clear();
+
+    m_meshHierarchy.Query(p_frustum, [this] (int32 p_proxy)
+    {
+        m_visibleProxies.push_back(p_proxy);
+    });
+
+    // The chunks only depend on the order of the proxies, so the render list does not depend on the tasks which gathered them.
+    size_t const chunkCount = (m_visibleProxies.size() + RenderChunkSize - 1u) / RenderChunkSize;
+
+    if (m_renderChunks.size() < chunkCount)
+        m_renderChunks.resize(chunkCount);
+
+    ThreadPool& threadPool = ThreadPool::Get();
+
+    threadPool.ParallelFor(0u, chunkCount, 1u, [this, &p_frustum, &p_cameraLocation] (size_t p_chunk)
+    {
+        RenderChunk& chunk = m_renderChunks[p_chunk];
+
+        chunk.opaqueMeshes     .clear();
+        chunk.transparentMeshes.clear();
+        chunk.transforms       .clear();
+        chunk.materials        .clear();
+        chunk.materialIndices  .clear();
+        chunk.meshes           .clear();
+        chunk.meshIndices      .clear();
+
+        size_t const last = std::min((p_chunk + 1u) * RenderChunkSize, m_visibleProxies.size());
+
+        for (size_t i = p_chunk * RenderChunkSize; i < last; ++i)
+            AddVisibleMeshes(m_meshProxies[m_visibleProxies[i]], p_frustum, p_cameraLocation, chunk);
+    });
+
+    // Resolves the materials and meshes of the chunks in order, so their index in the frame is the same from run to run.
+    size_t opaqueCount      = 0u;
+    size_t transparentCount = 0u;
+    size_t transformCount   = 0u;
+
+    m_materialIndices.clear();
+    m_meshIndices    .clear();
+
+    for (size_t i = 0u; i < chunkCount; ++i)
+    {
+        RenderChunk& chunk = m_renderChunks[i];
+
+        chunk.opaqueOffset      = opaqueCount;
+        chunk.transparentOffset = transparentCount;
+        chunk.transformOffset   = transformCount;
+        opaqueCount            += chunk.opaqueMeshes     .size();
+        transparentCount       += chunk.transparentMeshes.size();
+        transformCount         += chunk.transforms       .size();
+
+        chunk.materialRemap.resize(chunk.materials.size());
+        chunk.meshRemap    .resize(chunk.meshes   .size());
+
+        for (size_t material = 0u; material < chunk.materials.size(); ++material)
         {
-            return std::get<0>(lhs) < std::get<0>(rhs);
+            auto const [it, isNew] = m_materialIndices.try_emplace(chunk.materials[material], static_cast<uint32>(m_renderList->materials.size()));
+
+            if (isNew)
+                m_renderList->materials.push_back(chunk.materials[material]);
+
+            chunk.materialRemap[material] = it->second;
+        }
+
+        for (size_t mesh = 0u; mesh < chunk.meshes.size(); ++mesh)
+            chunk.meshRemap[mesh] = m_meshIndices.try_emplace(chunk.meshes[mesh], static_cast<uint32>(m_meshIndices.size())).first->second;
+    }
+
+    m_renderList->transforms       .resize(transformCount);
+    m_renderList->opaqueMeshes     .resize(opaqueCount);
+    m_renderList->transparentMeshes.resize(transparentCount);
+
+    threadPool.ParallelFor(0u, chunkCount, 1u, [this] (size_t p_chunk)
+    {
+        RenderChunk const& chunk = m_renderChunks[p_chunk];
+
+        std::copy(chunk.transforms.begin(), chunk.transforms.end(), m_renderList->transforms.begin() + chunk.transformOffset);
+
+        auto const copy = [&chunk] (std::vector<DrawRecord> const& p_source, DrawRecord* p_destination, auto&& p_makeKey)
+        {
+            for (size_t i = 0u; i < p_source.size(); ++i)
+            {
+                DrawRecord const& draw  = p_source[i];
+                uint32     const  depth = static_cast<uint32>(draw.sortKey);
+
+                p_destination[i]           = draw;
+                p_destination[i].material  = chunk.materialRemap[draw.material];
+                p_destination[i].transform = static_cast<uint32>(chunk.transformOffset) + draw.transform;
+                p_destination[i].sortKey   = p_makeKey(p_destination[i].material, draw.mesh->vertexFormat, chunk.meshRemap[draw.sortKey >> 32u], depth);
+            }
+        };
+
+        copy(chunk.opaqueMeshes,      m_renderList->opaqueMeshes     .data() + chunk.opaqueOffset,      DrawRecord::MakeOpaqueKey);
+        copy(chunk.transparentMeshes, m_renderList->transparentMeshes.data() + chunk.transparentOffset, DrawRecord::MakeTransparentKey);
+    });
+}
+
+void    Renderer::AddVisibleMeshes      (MeshProxy const&       p_proxy,
+                                         Frustum const&         p_frustum,
+                                         Vector3 const&         p_cameraLocation,
+                                         RenderChunk&           p_chunk) noexcept
+{
+    if (!p_proxy.component->IsVisible())
+        return;
+
+    auto const& worldBounds = p_proxy.component->GetMeshWorldBounds();
+
+    p_chunk.visibility.resize(Frustum::GetVisibilityWordCount(worldBounds.size()));
+
+    p_frustum.CullBounds(worldBounds.data(), worldBounds.size(), p_chunk.visibility.data());
+
+    for (size_t i = 0; i < p_proxy.draws.size(); ++i)
+    {
+        MeshDraw         const& meshDraw         = p_proxy.draws[i];
+        MaterialInstance const& materialInstance = *meshDraw.materialInstance;
+
+        // The materials load asynchronously, so they are checked every frame rather than when the component is updated.
+        if (!materialInstance.IsValid() || !materialInstance.GetMaterial()->IsValid())
+            continue;
+
+        if ((p_chunk.visibility[i / 64u] & (1ull << (i % 64u))) == 0ull)
+            continue;
+
+        auto const [material, isNewMaterial] = p_chunk.materialIndices.try_emplace(materialInstance.GetMaterialRenderDataPtr(), static_cast<uint32>(p_chunk.materials.size()));
+        auto const [mesh,     isNewMesh]     = p_chunk.meshIndices    .try_emplace(meshDraw.mesh,                               static_cast<uint32>(p_chunk.meshes   .size()));
+
+        if (isNewMaterial)
+            p_chunk.materials.push_back(materialInstance.GetMaterialRenderDataPtr());
+
+        if (isNewMesh)
+            p_chunk.meshes.push_back(meshDraw.mesh);
+
+        // The depth is computed once per draw, from the squared distance which keeps the order without a square root.
+        uint32 const depth = DrawRecord::QuantizeDepth(Vector3::DistanceSquared(p_cameraLocation, meshDraw.transform.GetOrigin()));
+
+        DrawRecord const draw { (static_cast<uint64>(mesh->second) << 32u) | depth,
+                                material->second,
+                                static_cast<uint32>(p_chunk.transforms.size()),
+                                materialInstance.GetMaterialDataPtr(),
+                                meshDraw.mesh };
+
+        p_chunk.transforms.push_back(meshDraw.transform);
+
+        if (materialInstance.IsOpaque())
+            p_chunk.opaqueMeshes.push_back(draw);
+
+        else
+            p_chunk.transparentMeshes.push_back(draw);
+    }
+}
+
+void    Renderer::SortDraws             (std::vector<DrawRecord>& p_draws) noexcept
+{
+    size_t const count = p_draws.size();
+
+    if (count < 2u)
+        return;
+
+    // Bits which differ between at least two keys, the passes over the other bytes would not move anything.
+    uint64 differingBits = 0u;
+
+    for (DrawRecord const& draw : p_draws)
+        differingBits |= draw.sortKey ^ p_draws.front().sortKey;
+
+    size_t const blockCount = (count + RenderSortGrain - 1u) / RenderSortGrain;
+
+    m_sortScratch   .resize(count);
+    m_sortHistograms.resize(blockCount * RadixBuckets);
+
+    ThreadPool& threadPool  = ThreadPool::Get();
+    DrawRecord* source      = p_draws         .data();
+    DrawRecord* destination = m_sortScratch   .data();
+    size_t*     histograms  = m_sortHistograms.data();
+
+    for (uint32 shift = 0u; shift < 64u; shift += RadixBits)
+    {
+        if (((differingBits >> shift) & (RadixBuckets - 1u)) == 0u)
+            continue;
+
+        threadPool.ParallelFor(0u, blockCount, 1u, [=] (size_t p_block)
+        {
+            size_t*      histogram = histograms + p_block * RadixBuckets;
+            size_t const last      = std::min((p_block + 1u) * RenderSortGrain, count);
+
+            std::fill_n(histogram, RadixBuckets, size_t(0u));
+
+            for (size_t i = p_block * RenderSortGrain; i < last; ++i)
+                ++histogram[(source[i].sortKey >> shift) & (RadixBuckets - 1u)];
         });
 
-        std::sort(m_renderList->transparentMeshes.begin(), m_renderList->transparentMeshes.end(), [this] (MeshInstance const& lhs,
-                                                                                                          MeshInstance const& rhs)
+        // Digit by digit then block by block, so the draws sharing a digit keep their order and the sort is stable.
+        size_t offset = 0u;
+
+        for (size_t digit = 0u; digit < RadixBuckets; ++digit)
         {
-            return Vector3::Distance(m_activeScene->camera->GetWorldLocation(), std::get<1>(lhs).GetOrigin())
-                 > Vector3::Distance(m_activeScene->camera->GetWorldLocation(), std::get<1>(rhs).GetOrigin());
+            for (size_t block = 0u; block < blockCount; ++block)
+            {
+                size_t const digitCount = histograms[block * RadixBuckets + digit];
+
+                histograms[block * RadixBuckets + digit]  = offset;
+                offset                                   += digitCount;
+            }
+        }
+
+        threadPool.ParallelFor(0u, blockCount, 1u, [=] (size_t p_block)
+        {
+            size_t*      histogram = histograms + p_block * RadixBuckets;
+            size_t const last      = std::min((p_block + 1u) * RenderSortGrain, count);
+
+            for (size_t i = p_block * RenderSortGrain; i < last; ++i)
+                destination[histogram[(source[i].sortKey >> shift) & (RadixBuckets - 1u)]++] = source[i];
         });
+
+        std::swap(source, destination);
     }
 
-    else
+    // An odd number of passes leaves the draws in the scratch buffer, which takes over the draws' one.
+    if (source != p_draws.data())
+        p_draws.swap(m_sortScratch);
+}
+
+Renderer::MeshProxy const&  Renderer::AddShadowCasters  (int32 p_proxy) noexcept
+{
+    MeshProxy& meshProxy = m_meshProxies[p_proxy];
+
+    if (meshProxy.casterFrame == m_frame)
+        return meshProxy;
+
+    std::vector<ShadowCaster>& casters = m_renderList->shadowCasters;
+
+    meshProxy.casterFrame  = m_frame;
+    meshProxy.casterOffset = casters.size();
+    meshProxy.casterCount  = 0u;
+
+    // A hidden component casts no shadow.
+    if (!meshProxy.component->IsVisible())
+        return meshProxy;
+
+    auto const& worldBounds = meshProxy.component->GetMeshWorldBounds();
+
+    for (size_t i = 0; i < meshProxy.draws.size(); ++i)
     {
-        m_renderList->spotLights       .clear();
-        m_renderList->pointLights      .clear();
-        m_renderList->directionalLights.clear();
-        m_renderList->materials        .clear();
-        m_renderList->opaqueMeshes     .clear();
-        m_renderList->transparentMeshes.clear();
+        MeshDraw         const& meshDraw         = meshProxy.draws[i];
+        MaterialInstance const& materialInstance = *meshDraw.materialInstance;
 
-        LOG(LogRenderer, Error, "There is no main camera in the level");
+        if (!materialInstance.IsValid() || !materialInstance.GetMaterial()->IsValid() || !materialInstance.IsOpaque())
+            continue;
+
+        uint32 const meshIndex = m_meshIndices.try_emplace(meshDraw.mesh, static_cast<uint32>(m_meshIndices.size())).first->second;
+
+        casters       .push_back({ meshDraw.transform, 0u, 0u, meshIndex, meshDraw.mesh });
+        m_casterBounds.push_back(worldBounds[i]);
     }
 
-    #if EDITOR
+    meshProxy.casterCount = casters.size() - meshProxy.casterOffset;
 
-    RHI::Get().NextFrame(p_passkey).renderList = m_renderList.get();
-    RHI::Get().DrawFrame(p_passkey);
+    return meshProxy;
+}
 
-    #else
-    
-    m_activeScene->isAvailable.store(true, std::memory_order_release);
+void    Renderer::GatherShadowCasters   () noexcept
+{
+    std::vector<ShadowCaster>& casters = m_renderList->shadowCasters;
 
-    #endif
+    size_t const spotCount  = m_renderList->spotLights       .size();
+    size_t const layerCount = m_renderList->directionalLights.size() + spotCount;
+    size_t const cubeCount  = m_renderList->pointLights      .size();
+
+    // The shadow layers are drawn from the light's view, a mesh out of its frustum cannot shade anything in it.
+    for (size_t layer = 0u; layer < layerCount; ++layer)
+    {
+        Frustum const frustum(layer < spotCount ?
+                              m_renderList->spotLights       [layer]            .projection * m_renderList->spotLights       [layer]            .view :
+                              m_renderList->directionalLights[layer - spotCount].projection * m_renderList->directionalLights[layer - spotCount].view);
+
+        m_meshHierarchy.Query(frustum, [&] (int32 p_proxy)
+        {
+            MeshProxy const& meshProxy = AddShadowCasters(p_proxy);
+
+            // The layers past the masked ones are drawn for every caster.
+            if (layer >= ShadowCaster::MaskedLightCount)
+                return;
+
+            for (size_t i = meshProxy.casterOffset; i < meshProxy.casterOffset + meshProxy.casterCount; ++i)
+                casters[i].layerMask |= static_cast<uint32>(frustum.IsVisible(m_casterBounds[i])) << layer;
+        });
+    }
+
+    // A point light's shadow only reaches as far as its range.
+    for (size_t light = 0u; light < cubeCount; ++light)
+    {
+        PointLightData const& pointLight   = m_renderList->pointLights[light];
+        float          const  rangeSquared = pointLight.intensity * pointLight.intensity;
+
+        m_meshHierarchy.Query(Bounds(pointLight.position, pointLight.position).GetExpanded(pointLight.intensity), [&] (int32 p_proxy)
+        {
+            MeshProxy const& meshProxy = AddShadowCasters(p_proxy);
+
+            if (light >= ShadowCaster::MaskedLightCount)
+                return;
+
+            for (size_t i = meshProxy.casterOffset; i < meshProxy.casterOffset + meshProxy.casterCount; ++i)
+                casters[i].cubeMask |= static_cast<uint32>(m_casterBounds[i].GetDistanceSquared(pointLight.position) <= rangeSquared) << light;
+        });
+    }
+
+    // The meshes of a component in a light volume may all be out of it. The lights past the masked ones are not culled, so any caster is kept for them.
+    bool const keepLayers = layerCount > ShadowCaster::MaskedLightCount;
+    bool const keepCubes  = cubeCount  > ShadowCaster::MaskedLightCount;
+
+    casters.erase(std::remove_if(casters.begin(), casters.end(), [keepLayers, keepCubes] (ShadowCaster const& p_caster)
+    {
+        return !keepLayers && !keepCubes && p_caster.layerMask == 0u && p_caster.cubeMask == 0u;
+    }), casters.end());
+
+    // Groups the casters by vertex format so each shadow pipeline is bound once, then by mesh so they are drawn as instances.
+    std::stable_sort(casters.begin(), casters.end(), [] (ShadowCaster const& p_lhs,
+                                                         ShadowCaster const& p_rhs)
+    {
+        if (p_lhs.mesh->vertexFormat != p_rhs.mesh->vertexFormat)
+            return p_lhs.mesh->vertexFormat < p_rhs.mesh->vertexFormat;
+
+        return p_lhs.meshIndex < p_rhs.meshIndex;
+    });
+}
+
+void    Renderer::BuildBatches          () noexcept
+{
+    RenderList& renderList = *m_renderList;
+
+    renderList.instances         .clear();
+    renderList.opaqueBatches     .clear();
+    renderList.transparentBatches.clear();
+    renderList.shadow2DBatches   .clear();
+    renderList.shadowCubeBatches .clear();
+
+    // The instances of a batch follow each other, so a draw extends the last batch when it shares its material and mesh.
+    auto const addInstance = [&renderList] (std::vector<DrawBatch>& p_batches,
+                                            uint32 const            p_material,
+                                            Mesh const*             p_mesh,
+                                            InstanceData const&     p_instance)
+    {
+        uint32 const instance = static_cast<uint32>(renderList.instances.size());
+
+        renderList.instances.push_back(p_instance);
+
+        if (!p_batches.empty() && p_batches.back().material == p_material && p_batches.back().mesh == p_mesh)
+            ++p_batches.back().instanceCount;
+
+        else
+            p_batches.push_back({ p_material, instance, 1u, p_mesh });
+    };
+
+    // The opaque draws are sorted by material then mesh, the transparent ones only merge when consecutive so they stay back to front.
+    for (DrawRecord const& draw : renderList.opaqueMeshes)
+        addInstance(renderList.opaqueBatches, draw.material, draw.mesh, { renderList.transforms[draw.transform], *draw.materialData, 0u, 0u });
+
+    for (DrawRecord const& draw : renderList.transparentMeshes)
+        addInstance(renderList.transparentBatches, draw.material, draw.mesh, { renderList.transforms[draw.transform], *draw.materialData, 0u, 0u });
+
+    size_t const layerCount = renderList.spotLights.size() + renderList.directionalLights.size();
+    size_t const cubeCount  = renderList.pointLights.size();
+
+    // The lights past the masked ones are not culled, so no caster can be skipped when there are some.
+    bool const isLayerMasked = layerCount <= ShadowCaster::MaskedLightCount;
+    bool const isCubeMasked  = cubeCount  <= ShadowCaster::MaskedLightCount;
+
+    for (ShadowCaster const& caster : renderList.shadowCasters)
+    {
+        if (layerCount > 0u && (!isLayerMasked || caster.layerMask != 0u))
+            addInstance(renderList.shadow2DBatches, 0u, caster.mesh, { caster.transform, {}, caster.layerMask, caster.cubeMask });
+    }
+
+    for (ShadowCaster const& caster : renderList.shadowCasters)
+    {
+        if (cubeCount > 0u && (!isCubeMasked || caster.cubeMask != 0u))
+            addInstance(renderList.shadowCubeBatches, 0u, caster.mesh, { caster.transform, {}, caster.layerMask, caster.cubeMask });
+    }
 }
\ No newline at end of file
@@ -0,0 +1,229 @@
+#ifndef __BOUNDING_VOLUME_HIERARCHY_HPP__
+#define __BOUNDING_VOLUME_HIERARCHY_HPP__
+
+#include "Mathematic/Bounds.hpp"
+#include "Mathematic/Frustum.hpp"
+
+/**
+ * Dynamic AABB tree over the bounds of render primitives, kept balanced with AVL rotations.
+ *
+ * Each proxy is stored with a "fat" copy of its bounds, grown by a margin, so a primitive moving within it
+ * only updates its leaf. A proxy leaving its fat bounds is queued and reinserted by Update, which takes a budget:
+ * the queued proxies are tested one by one by the queries until they are reinserted, so the tree stays exact
+ * while the cost of its upkeep is bounded per frame. The budget grows with the queue, which therefore never holds
+ * more than QueueFrames updates worth of moves.
+ *
+ * @thread_safety The queries may run concurrently, the modifications may not.
+ */
+class ENGINE_API BoundingVolumeHierarchy
+{
+    public:
+
+    // ============================== [Public Static Properties] ============================== //
+
+        static constexpr int32  NullProxy   = -1;
+
+        /** Update reinserts at least 1 / QueueFrames of the queue, whatever its budget. */
+        static constexpr uint32 QueueFrames = 4u;
+
+    // ============================== [Public Constructor and Destructor] ============================== //
+
+        /**
+         * @param p_margin  Margin of the fat bounds, relative to the size of the proxy's bounds.
+         */
+        explicit BoundingVolumeHierarchy    (float const p_margin = 0.1f) noexcept;
+
+        BoundingVolumeHierarchy (BoundingVolumeHierarchy const& p_copy) = default;
+
+        BoundingVolumeHierarchy (BoundingVolumeHierarchy&&      p_move) = default;
+
+        ~BoundingVolumeHierarchy()                                      = default;
+
+    // ============================== [Public Local Methods] ============================== //
+
+        /**
+         * Inserts a proxy in the tree.
+         *
+         * @return The proxy, which stays valid until it is destroyed.
+         */
+        int32   CreateProxy     (Bounds const&  p_bounds,
+                                 void*          p_userData) noexcept;
+
+        void    DestroyProxy    (int32 const    p_proxy)    noexcept;
+
+        /**
+         * Updates the bounds of a proxy. The proxy is queued for reinsertion when they leave its fat bounds.
+         *
+         * @return True if the proxy was queued, false otherwise.
+         */
+        bool    MoveProxy       (int32 const    p_proxy,
+                                 Bounds const&  p_bounds)   noexcept;
+
+        /**
+         * Reinserts the oldest queued proxies.
+         *
+         * @param p_budget  The number of proxies reinserted at most while the queue is short,
+         *                  1 / QueueFrames of the queue is reinserted when it is more.
+         *
+         * @return The number of proxies reinserted.
+         */
+        uint32  Update          (uint32 const   p_budget)   noexcept;
+
+        /**
+         * Calls p_callback(int32 proxy) for each proxy whose bounds intersect the frustum.
+         */
+        template<typename Callback>
+        void    Query           (Frustum const& p_frustum,
+                                 Callback&&     p_callback) const;
+
+        /**
+         * Calls p_callback(int32 proxy) for each proxy whose bounds intersect p_bounds.
+         */
+        template<typename Callback>
+        void    Query           (Bounds const&  p_bounds,
+                                 Callback&&     p_callback) const;
+
+        /**
+         * Calls p_callback(int32 proxy, float distance) for each proxy whose bounds the ray hits, in no particular order.
+         * The callback returns the new length of the ray: the distance of an exact hit shortens it, p_maxDistance keeps it.
+         *
+         * @param p_direction   The direction of the ray, the distances are in units of it.
+         */
+        template<typename Callback>
+        void    RayCast         (Vector3 const& p_origin,
+                                 Vector3 const& p_direction,
+                                 float const    p_maxDistance,
+                                 Callback&&     p_callback) const;
+
+    // ==================================================================================== //
+
+        INLINE Bounds const&    GetBounds       (int32 const p_proxy)   const noexcept  { return m_nodes[p_proxy].bounds; }
+
+        INLINE void*            GetUserData     (int32 const p_proxy)   const noexcept  { return m_nodes[p_proxy].userData; }
+
+        INLINE size_t           GetProxyCount   ()                      const noexcept  { return m_proxyCount; }
+
+        INLINE size_t           GetQueuedCount  ()                      const noexcept  { return m_queuedCount; }
+
+        /**
+         * @return The height of the tree, 0 for a single leaf and -1 when empty.
+         */
+        INLINE int32            GetHeight       ()                      const noexcept  { return m_root == NullProxy ? -1 : m_nodes[m_root].height; }
+
+    // ==================================================================================== //
+
+        BoundingVolumeHierarchy&    operator=   (BoundingVolumeHierarchy const& p_copy) = default;
+
+        BoundingVolumeHierarchy&    operator=   (BoundingVolumeHierarchy&&      p_move) = default;
+
+    private:
+
+    // ============================== [Private Static Properties] ============================== //
+
+        /** Depth of the traversal stacks, an AVL tree of 2^32 leaves is at most 46 levels deep. */
+        static constexpr size_t MaxStackSize        = 128u;
+
+        /** Initial capacity of the reinsertion queue. */
+        static constexpr size_t MinQueueCapacity    = 64u;
+
+    // ============================== [Private Structures] ============================== //
+
+        struct Node
+        {
+            /** Fat bounds of a leaf, union of the children of an internal node. */
+            Bounds  fatBounds;
+
+            /** Exact bounds of a leaf. */
+            Bounds  bounds;
+
+            void*   userData    = nullptr;
+
+            /** Parent of a node in the tree, next free node otherwise. */
+            int32   parent      = NullProxy;
+
+            int32   child1      = NullProxy;
+
+            int32   child2      = NullProxy;
+
+            /** 0 for a leaf, -1 for a free node. */
+            int32   height      = -1;
+
+            /** Slot of a leaf in the reinsertion queue. */
+            int32   queueIndex  = NullProxy;
+
+            INLINE bool IsLeaf  () const noexcept   { return child1 == NullProxy; }
+        };
+
+    // ============================== [Private Local Properties] ============================== //
+
+        std::vector<Node>   m_nodes;
+
+        /**
+         * Leaves out of their fat bounds, oldest first. It is a ring buffer which only grows,
+         * a leaf destroyed while queued leaves a NullProxy hole which is skipped.
+         */
+        std::vector<int32>  m_queue;
+
+        /** Slot of the oldest queued leaf. */
+        size_t              m_queueHead     = 0u;
+
+        /** Number of slots in use, holes included. */
+        size_t              m_queueSize     = 0u;
+
+        /** Number of queued leaves. */
+        size_t              m_queuedCount   = 0u;
+
+        int32               m_root          = NullProxy;
+
+        int32               m_freeList      = NullProxy;
+
+        size_t              m_proxyCount    = 0u;
+
+        float               m_margin;
+
+    // ============================== [Private Local Methods] ============================== //
+
+        int32   AllocateNode    ()                      noexcept;
+
+        void    FreeNode        (int32 const p_node)    noexcept;
+
+        void    InsertLeaf      (int32 const p_leaf)    noexcept;
+
+        void    RemoveLeaf      (int32 const p_leaf)    noexcept;
+
+        /**
+         * Rotates the subtree of p_node if it is unbalanced.
+         *
+         * @return The new root of the subtree.
+         */
+        int32   Balance         (int32 const p_node)    noexcept;
+
+        /**
+         * Walks from p_node to the root, balancing and refitting each node.
+         */
+        void    Refit           (int32       p_node)    noexcept;
+
+        void    Enqueue         (int32 const p_leaf)    noexcept;
+
+        void    Dequeue         (int32 const p_leaf)    noexcept;
+
+        /**
+         * Calls p_callback(int32 leaf) for each queued leaf.
+         */
+        template<typename Callback>
+        void    ForEachQueued   (Callback&&     p_callback) const;
+
+        /**
+         * Calls p_callback(int32 proxy) for each proxy whose bounds pass p_test(Bounds), skipping the subtrees whose fat bounds fail it.
+         */
+        template<typename Test, typename Callback>
+        void    Traverse        (Test const&    p_test,
+                                 Callback&      p_callback) const;
+
+        Bounds  GetFatBounds    (Bounds const& p_bounds)    const noexcept;
+
+};  // !class BoundingVolumeHierarchy
+
+#include "BoundingVolumeHierarchy.inl"
+
+#endif // !__BOUNDING_VOLUME_HIERARCHY_HPP__
\ No newline at end of file
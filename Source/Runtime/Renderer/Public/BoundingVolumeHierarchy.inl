@@ -0,0 +1,154 @@
+#include "BoundingVolumeHierarchy.hpp"
+
+// ============================== [Public Local Methods] ============================== //
+
+template<typename Callback>
+INLINE void BoundingVolumeHierarchy::Query      (Frustum const& p_frustum,
+                                                 Callback&&     p_callback) const
+{
+    if (m_root != NullProxy)
+    {
+        // Each node carries the planes its parent straddles, a node inside all of them reports its subtree untested.
+        std::pair<int32, uint32> stack[MaxStackSize];
+        size_t                   size = 0u;
+
+        stack[size++] = { m_root, Frustum::AllPlanes };
+
+        while (size > 0u)
+        {
+            auto [index, planeMask] = stack[--size];
+            Node const& node        = m_nodes[index];
+
+            if (planeMask != 0u && !p_frustum.IsVisible(node.fatBounds, planeMask))
+                continue;
+
+            if (!node.IsLeaf())
+            {
+                assert(size + 2u <= MaxStackSize);
+
+                stack[size++] = { node.child1, planeMask };
+                stack[size++] = { node.child2, planeMask };
+            }
+
+            // A queued leaf may be out of its fat bounds, so it is tested with the others below.
+            else if (node.queueIndex == NullProxy && (planeMask == 0u || p_frustum.IsVisible(node.bounds, planeMask)))
+                p_callback(index);
+        }
+    }
+
+    ForEachQueued([&] (int32 const p_leaf)
+    {
+        if (p_frustum.IsVisible(m_nodes[p_leaf].bounds))
+            p_callback(p_leaf);
+    });
+}
+
+template<typename Callback>
+INLINE void BoundingVolumeHierarchy::Query      (Bounds const&  p_bounds,
+                                                 Callback&&     p_callback) const
+{
+    Traverse([&p_bounds] (Bounds const& p_other) { return p_bounds.IsIntersecting(p_other); }, p_callback);
+}
+
+template<typename Callback>
+INLINE void BoundingVolumeHierarchy::RayCast    (Vector3 const& p_origin,
+                                                 Vector3 const& p_direction,
+                                                 float const    p_maxDistance,
+                                                 Callback&&     p_callback) const
+{
+    Vector3 const inverseDirection(1.0f / p_direction.m_x, 1.0f / p_direction.m_y, 1.0f / p_direction.m_z);
+
+    // The callback shortens the ray as it finds closer hits, which prunes the farther subtrees.
+    float maxDistance = p_maxDistance;
+    float distance    = 0.0f;
+
+    if (m_root != NullProxy)
+    {
+        int32  stack[MaxStackSize];
+        size_t size = 0u;
+
+        stack[size++] = m_root;
+
+        while (size > 0u)
+        {
+            int32 const index = stack[--size];
+            Node  const& node = m_nodes[index];
+
+            if (!node.fatBounds.IsIntersectingRay(p_origin, inverseDirection, maxDistance, distance))
+                continue;
+
+            if (!node.IsLeaf())
+            {
+                assert(size + 2u <= MaxStackSize);
+
+                stack[size++] = node.child1;
+                stack[size++] = node.child2;
+            }
+
+            else if (node.queueIndex == NullProxy && node.bounds.IsIntersectingRay(p_origin, inverseDirection, maxDistance, distance))
+                maxDistance = p_callback(index, distance);
+        }
+    }
+
+    ForEachQueued([&] (int32 const p_leaf)
+    {
+        if (m_nodes[p_leaf].bounds.IsIntersectingRay(p_origin, inverseDirection, maxDistance, distance))
+            maxDistance = p_callback(p_leaf, distance);
+    });
+}
+
+// ============================== [Private Local Methods] ============================== //
+
+template<typename Callback>
+INLINE void BoundingVolumeHierarchy::ForEachQueued  (Callback&&     p_callback) const
+{
+    size_t const capacity = m_queue.size();
+
+    for (size_t i = 0u; i < m_queueSize; ++i)
+    {
+        int32 const leaf = m_queue[(m_queueHead + i) % capacity];
+
+        if (leaf != NullProxy)
+            p_callback(leaf);
+    }
+}
+
+template<typename Test, typename Callback>
+INLINE void BoundingVolumeHierarchy::Traverse   (Test const&    p_test,
+                                                 Callback&      p_callback) const
+{
+    if (m_root != NullProxy)
+    {
+        int32  stack[MaxStackSize];
+        size_t size = 0u;
+
+        stack[size++] = m_root;
+
+        while (size > 0u)
+        {
+            int32 const index = stack[--size];
+            Node  const& node = m_nodes[index];
+
+            if (!p_test(node.fatBounds))
+                continue;
+
+            if (!node.IsLeaf())
+            {
+                assert(size + 2u <= MaxStackSize);
+
+                stack[size++] = node.child1;
+                stack[size++] = node.child2;
+            }
+
+            // A queued leaf may be out of its fat bounds, so it is tested with the others below.
+            else if (node.queueIndex == NullProxy && p_test(node.bounds))
+                p_callback(index);
+        }
+    }
+
+    ForEachQueued([&] (int32 const p_leaf)
+    {
+        if (p_test(m_nodes[p_leaf].bounds))
+            p_callback(p_leaf);
+    });
+}
\ No newline at end of file
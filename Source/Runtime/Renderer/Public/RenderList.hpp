@@ -16,9 +16,125 @@ struct MS_ALIGN(16) Camera
     Matrix4x4 projection;
 };
 
-// ============================== [Using Declaration] ============================== //
+/**
+ * Opaque mesh drawn in the shadow maps, with the lights it may cast a shadow for.
+ * Bit N of a mask is set when the mesh's bounds intersect the volume of the light drawn in the shadow layer N.
+ * Only the first MaskedLightCount layers are culled, the following ones are always drawn.
+ */
+struct MS_ALIGN(16) ShadowCaster
+{
+    static constexpr size_t MaskedLightCount = 32u;
+
+    Matrix4x4   transform;
+
+    /** Spot lights then directional lights, in the order of their shadow layers. */
+    uint32      layerMask;
+
+    /** Point lights. */
+    uint32      cubeMask;
+
+    /** Index of the mesh in the frame, the casters sharing it are drawn as instances. */
+    uint32      meshIndex;
+    Mesh const* mesh;
+};
+
+/**
+ * Data of an instance in the frame's storage buffer, read by the shaders at gl_InstanceIndex.
+ * It follows the std430 layout of the shaders' Instance structure.
+ */
+struct MS_ALIGN(16) InstanceData
+{
+    Matrix4x4       transform;
+
+    /** Unused by the shadow casters. */
+    MaterialData    material;
+
+    /** Light masks of a shadow caster, see ShadowCaster. */
+    uint32          layerMask;
+    uint32          cubeMask;
+};
 
-using MeshInstance = std::tuple<size_t, Matrix4x4, MaterialData const*, Mesh const*>;
+static_assert(offsetof(InstanceData, material)  == 64u,  "InstanceData must follow the std430 layout of the shaders");
+static_assert(offsetof(InstanceData, layerMask) == 92u,  "InstanceData must follow the std430 layout of the shaders");
+static_assert(sizeof  (InstanceData)            == 112u, "InstanceData must follow the std430 layout of the shaders");
+
+/**
+ * Consecutive draws of a mesh with the same material, drawn in one call: its instances are [firstInstance, firstInstance + instanceCount) in the render list.
+ */
+struct DrawBatch
+{
+    /** Index in the render list's materials, unused by the shadow batches. */
+    uint32      material;
+    uint32      firstInstance;
+    uint32      instanceCount;
+    Mesh const* mesh;
+};
+
+/**
+ * Draw of a mesh, ordered by its 64-bit key. Its transform is stored apart in the render list, so sorting moves 32 bytes per draw instead of a matrix.
+ *
+ * From the most significant bit, an opaque key holds the pass, the material, the vertex format, the mesh and the depth (front to back),
+ * a transparent key holds the pass, the inverted depth (back to front), the material, the vertex format and the mesh.
+ * The material and mesh fields are indices in the frame, clamped to their width: two draws sharing a clamped value are only grouped less.
+ */
+struct DrawRecord
+{
+    static constexpr uint32 PassBits        = 1u;
+    static constexpr uint32 MaterialBits    = 20u;
+    static constexpr uint32 FormatBits      = 3u;
+    static constexpr uint32 MeshBits        = 16u;
+    static constexpr uint32 DepthBits       = 24u;
+
+    static_assert(PassBits + MaterialBits + FormatBits + MeshBits + DepthBits == 64u,       "The fields must fill the key");
+    static_assert(static_cast<uint32>(EVertexFormat::COUNT) <= (1u << FormatBits),         "The vertex formats must fit their field");
+
+    /**
+     * Maps a squared distance to the camera to DepthBits bits, keeping the order.
+     * The bits of a positive float grow with it, so the depth is its top bits and needs no range.
+     */
+    static INLINE uint32    QuantizeDepth       (float const p_distanceSquared) noexcept
+    {
+        uint32 bits;
+
+        std::memcpy(&bits, &p_distanceSquared, sizeof(bits));
+
+        // The sign bit of a positive float is 0.
+        return bits >> (31u - DepthBits);
+    }
+
+    static INLINE uint64    MakeOpaqueKey       (uint32 const           p_material,
+                                                 EVertexFormat const    p_format,
+                                                 uint32 const           p_mesh,
+                                                 uint32 const           p_depth) noexcept
+    {
+        return (static_cast<uint64>(std::min(p_material, (1u << MaterialBits) - 1u))  << (FormatBits + MeshBits + DepthBits))
+             | (static_cast<uint64>(p_format)                                       << (MeshBits + DepthBits))
+             | (static_cast<uint64>(std::min(p_mesh, (1u << MeshBits) - 1u))          << DepthBits)
+             |  static_cast<uint64>(p_depth);
+    }
+
+    static INLINE uint64    MakeTransparentKey  (uint32 const           p_material,
+                                                 EVertexFormat const    p_format,
+                                                 uint32 const           p_mesh,
+                                                 uint32 const           p_depth) noexcept
+    {
+        return (1ull                                                                 << (64u - PassBits))
+             | (static_cast<uint64>((1u << DepthBits) - 1u - p_depth)                 << (MaterialBits + FormatBits + MeshBits))
+             | (static_cast<uint64>(std::min(p_material, (1u << MaterialBits) - 1u))  << (FormatBits + MeshBits))
+             | (static_cast<uint64>(p_format)                                       << MeshBits)
+             |  static_cast<uint64>(std::min(p_mesh, (1u << MeshBits) - 1u));
+    }
+
+    uint64              sortKey;
+
+    /** Index in the render list's materials. */
+    uint32              material;
+
+    /** Index in the render list's transforms. */
+    uint32              transform;
+    MaterialData const* materialData;
+    Mesh const*         mesh;
+};
 
 // ================================================================================= //
 
@@ -29,8 +145,17 @@ struct RenderList : public UniqueObject
     std::vector<PointLightData>            pointLights;
     std::vector<DirectionalLightData>      directionalLights;
     std::vector<MaterialRenderData const*> materials;
-    std::vector<MeshInstance>              opaqueMeshes;
-    std::vector<MeshInstance>              transparentMeshes;
+    std::vector<Matrix4x4>                 transforms;
+    std::vector<DrawRecord>                opaqueMeshes;
+    std::vector<DrawRecord>                transparentMeshes;
+    std::vector<ShadowCaster>              shadowCasters;
+
+    /** Draws merged by batch, the ones drawn by the passes. */
+    std::vector<InstanceData>              instances;
+    std::vector<DrawBatch>                 opaqueBatches;
+    std::vector<DrawBatch>                 transparentBatches;
+    std::vector<DrawBatch>                 shadow2DBatches;
+    std::vector<DrawBatch>                 shadowCubeBatches;
 
 };  // !class RenderList
 
@@ -1,21 +1,117 @@
 #ifndef __RENDER_SCENE_HPP__
 #define __RENDER_SCENE_HPP__
 
-#include "Light/SpotLightComponent.hpp"
-#include "Light/PointLightComponent.hpp"
-#include "Light/DirectionalLightComponent.hpp"
+#include "CoreMinimal.hpp"
 
-#include "Camera/CameraComponent.hpp"
-#include "Components/StaticMeshComponent.hpp"
+class Entity;
+class EntityComponent;
+class SceneComponent;
+class StaticMeshComponent;
+class SpotLightComponent;
+class PointLightComponent;
+class DirectionalLightComponent;
 
-struct RenderScene : public UniqueObject
+/**
+ * Components of a level the Renderer draws, registered as their entity enters the level and unregistered as it leaves,
+ * so the Renderer does not search the level for them every frame.
+ *
+ * A mesh component is marked dirty when it moves or its model or materials change: the Renderer only updates
+ * the proxy of the dirty components, and destroys the proxy of the removed ones.
+ *
+ * @thread_safety This class must be used from the game thread.
+ */
+class ENGINE_API RenderScene : public UniqueObject
 {
-    std::atomic_bool                        isAvailable;
-    CameraComponent*                        camera;
-    std::vector<SpotLightComponent*>        spotLightComponents;
-    std::vector<PointLightComponent*>       pointLightComponents;
-    std::vector<DirectionalLightComponent*> directionalLightComponents;
-    std::vector<StaticMeshComponent*>       meshComponents;
+    public:
+
+    // ============================== [Public Constructor and Destructor] ============================== //
+
+        RenderScene     () noexcept;
+
+        ~RenderScene    () = default;
+
+    // ============================== [Public Local Methods] ============================== //
+
+        /**
+         * Registers the render components of an entity, and the ones added to it later on.
+         */
+        void    AddEntity       (Entity&            p_entity)       noexcept;
+
+        void    RemoveEntity    (Entity&            p_entity)       noexcept;
+
+        /**
+         * Registers a component if the Renderer draws it, a mesh component starts dirty.
+         */
+        void    AddComponent    (EntityComponent*   p_component)    noexcept;
+
+        void    RemoveComponent (EntityComponent*   p_component)    noexcept;
+
+        /**
+         * Queues a registered mesh component for the Renderer to update its proxy, once however many times it is marked.
+         */
+        void    MarkDirty       (SceneComponent&    p_component)    noexcept;
+
+        /**
+         * Hands the changes since the last call over to the Renderer, which owns the proxies.
+         *
+         * @param p_outRemovedProxies   The proxies of the mesh components removed from the scene.
+         * @param p_outDirtyMeshes      The mesh components marked dirty, which are not anymore.
+         */
+        void    TakeChanges     (std::vector<int32>&                p_outRemovedProxies,
+                                 std::vector<StaticMeshComponent*>& p_outDirtyMeshes)   noexcept;
+
+    // ==================================================================================== //
+
+        /**
+         * @return A number identifying the scene, never reused by another one unlike its address.
+         */
+        INLINE uint64                                           GetID                         ()  const noexcept  { return m_id; }
+
+        INLINE std::vector<StaticMeshComponent*>        const&  GetMeshComponents             ()  const noexcept  { return m_meshComponents; }
+
+        INLINE std::vector<SpotLightComponent*>         const&  GetSpotLightComponents        ()  const noexcept  { return m_spotLightComponents; }
+
+        INLINE std::vector<PointLightComponent*>        const&  GetPointLightComponents       ()  const noexcept  { return m_pointLightComponents; }
+
+        INLINE std::vector<DirectionalLightComponent*>  const&  GetDirectionalLightComponents ()  const noexcept  { return m_directionalLightComponents; }
+
+    private:
+
+    // ============================== [Private Local Properties] ============================== //
+
+        uint64                                  m_id;
+
+        std::vector<StaticMeshComponent*>       m_meshComponents;
+
+        std::vector<SpotLightComponent*>        m_spotLightComponents;
+
+        std::vector<PointLightComponent*>       m_pointLightComponents;
+
+        std::vector<DirectionalLightComponent*> m_directionalLightComponents;
+
+        std::vector<StaticMeshComponent*>       m_dirtyMeshes;
+
+        std::vector<int32>                      m_removedProxies;
+
+    // ============================== [Private Local Methods] ============================== //
+
+        /**
+         * @return True if the component is at its index in p_components.
+         */
+        template<typename T>
+        bool    IsRegistered    (std::vector<T*> const& p_components,
+                                 T&                     p_component)    const noexcept;
+
+        template<typename T>
+        void    Register        (std::vector<T*>&       p_components,
+                                 T&                     p_component)    noexcept;
+
+        /**
+         * Removes a component by moving the last one in its place.
+         */
+        template<typename T>
+        void    Unregister      (std::vector<T*>&       p_components,
+                                 T&                     p_component)    noexcept;
 
 };  // !class RenderScene
 
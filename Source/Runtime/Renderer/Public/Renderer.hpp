@@ -1,15 +1,43 @@
 #ifndef __RENDERER_HPP__
 #define __RENDERER_HPP__
 
+#include "Signal.hpp"
 #include "EngineModule.hpp"
 
 #include "RenderScene.hpp"
 #include "RenderList.hpp"
+#include "BoundingVolumeHierarchy.hpp"
+
+#include "Camera/CameraComponent.hpp"
+#include "Components/StaticMeshComponent.hpp"
 
 class ENGINE_API Renderer : public EngineModule
 {
     public:
 
+    // ============================== [Public Structures] ============================== //
+
+        /**
+         * Meshes the last built frame went through, and how many of them culling removed.
+         */
+        struct Statistics
+        {
+            /** Meshes of the components registered in the level whose model is loaded, hidden ones included. */
+            size_t submittedMeshes      = 0u;
+
+            /** Meshes hidden, out of the camera frustum or whose material is not loaded. */
+            size_t culledMeshes         = 0u;
+
+            /** Opaque meshes drawn in at least one shadow map. */
+            size_t shadowCasters        = 0u;
+
+            /** Meshes drawn in no shadow map: out of every light volume, transparent or whose material is not loaded. */
+            size_t culledShadowCasters  = 0u;
+
+            /** Batches of instances drawn by the passes, one draw call each. */
+            size_t drawCalls            = 0u;
+        };
+
     // ============================== [Public Static Methods] ============================== //
 
         static INLINE Renderer& Get() noexcept
@@ -33,20 +61,244 @@ class ENGINE_API Renderer : public EngineModule
 
     // ============================== [Public Local Methods] ============================== //
 
-        void    Render  (EngineKey   const& p_passkey,
-                         class Level const& p_level) noexcept;
+        /**
+         * Builds the render list of a level from its render scene, only updating the proxies of the components marked dirty since the last frame.
+         * The proxies are rebuilt from scratch when the level is not the one of the last frame.
+         */
+        void    Render  (EngineKey const& p_passkey,
+                         class Level&     p_level) noexcept;
+
+        /**
+         * Finds the closest mesh component whose bounds a ray hits, for instance to pick an entity in the editor.
+         * Only the meshes of the last frame built by Render are tested, against their bounds rather than their triangles.
+         *
+         * @param p_direction   The normalized direction of the ray.
+         *
+         * @return The component hit, nullptr if none.
+         */
+        StaticMeshComponent*    PickMeshComponent   (Vector3 const& p_origin,
+                                                     Vector3 const& p_direction,
+                                                     float const    p_maxDistance)  const noexcept;
+
+        /**
+         * @return The time the render thread spent waiting for the game thread to build a frame.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        INLINE SignalStatistics const&  GetRenderThreadWaitStatistics   ()  const noexcept  { return m_renderThreadWait; }
+
+        /**
+         * @return The time the game thread spent waiting for the render thread to release a scene.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        INLINE SignalStatistics const&  GetGameThreadWaitStatistics     ()  const noexcept  { return m_gameThreadWait; }
+
+        /**
+         * @return The culling statistics of the last frame built by Render.
+         */
+        INLINE Statistics const&        GetStatistics                   ()  const noexcept  { return m_statistics; }
+
+        /**
+         * @return The hierarchy over the world bounds of the mesh components, the user data of a proxy is its StaticMeshComponent.
+         */
+        INLINE BoundingVolumeHierarchy const&   GetMeshHierarchy        ()  const noexcept  { return m_meshHierarchy; }
 
     private:
 
+    // ============================== [Private Static Properties] ============================== //
+
+        /**
+         * Proxies of the mesh hierarchy reinserted per frame while few of them move, the others are tested one by one until their turn.
+         * The hierarchy raises it to a part of its queue when more of them move, see BoundingVolumeHierarchy::QueueFrames.
+         */
+        static constexpr uint32 HierarchyReinsertionBudget  = 256u;
+
+        /** Visible mesh components gathered by a task of Render. */
+        static constexpr size_t RenderChunkSize             = 32u;
+
+        /** Draws counted and scattered by a task of the radix sort. */
+        static constexpr size_t RenderSortGrain             = 4096u;
+
+    // ============================== [Private Structures] ============================== //
+
+        /**
+         * Mesh of a component, with its world transform and material as of the last time the component was marked dirty.
+         * The data of the material is read when the frame is built, so editing a material instance needs no update.
+         */
+        struct MeshDraw
+        {
+            Matrix4x4               transform;
+
+            Mesh const*             mesh                = nullptr;
+
+            MaterialInstance const* materialInstance    = nullptr;
+        };
+
+        struct MeshProxy
+        {
+            StaticMeshComponent*    component       = nullptr;
+
+            /** One per mesh of the component with a material, in the order of its world bounds. */
+            std::vector<MeshDraw>   draws;
+
+            /** Frame and range of the component's meshes in the render list's shadow casters. */
+            uint64                  casterFrame     = 0u;
+
+            size_t                  casterOffset    = 0u;
+
+            size_t                  casterCount     = 0u;
+        };
+
+        /**
+         * Meshes gathered by a task of Render from a range of the visible components, merged in the render list in the order of the chunks.
+         * Until the merge, the material and transform of a draw are indices in the chunk, and its key only holds its depth
+         * with the index of its mesh in the chunk in the upper 32 bits.
+         */
+        struct RenderChunk
+        {
+            std::vector<DrawRecord>                                         opaqueMeshes;
+
+            std::vector<DrawRecord>                                         transparentMeshes;
+
+            std::vector<Matrix4x4>                                          transforms;
+
+            std::vector<MaterialRenderData const*>                          materials;
+
+            std::unordered_map<MaterialRenderData const*, uint32>           materialIndices;
+
+            std::vector<Mesh const*>                                        meshes;
+
+            std::unordered_map<Mesh const*, uint32>                         meshIndices;
+
+            /** Index of each of the chunk's materials and meshes in the frame. */
+            std::vector<uint32>                                             materialRemap;
+
+            std::vector<uint32>                                             meshRemap;
+
+            /** Visibility bits of the bounds being culled. */
+            std::vector<uint64>                                             visibility;
+
+            /** Position of the chunk's draws and transforms in the render list. */
+            size_t                                                          opaqueOffset        = 0u;
+
+            size_t                                                          transparentOffset   = 0u;
+
+            size_t                                                          transformOffset     = 0u;
+        };
+
     // ============================== [Private Local Properties] ============================== //
 
         std::atomic_bool                m_running;
 
-        std::unique_ptr<RenderScene>    m_activeScene;
+        /** Render list built by the game thread. */
+        std::unique_ptr<RenderList>     m_renderList;
+
+        /** Render list of the last frame handed to the render thread, drawn while the game thread builds the next one in the other. */
+        std::unique_ptr<RenderList>     m_frameRenderList;
 
-        std::unique_ptr<RenderScene>    m_inactiveScene;
+        /** Set by the game thread once the render list is built and swapped in, waited on by the render thread. */
+        Signal                          m_frameReady;
 
-        std::unique_ptr<RenderList>     m_renderList;
+        /**
+         * Set by the render thread once it took the last frame, waited on by the game thread before building the next one.
+         * The render thread only takes a frame after drawing the previous one, so the list built next is not drawn anymore.
+         */
+        Signal                          m_sceneReleased;
+
+        SignalBackoff                   m_backoff;
+
+        SignalStatistics                m_renderThreadWait;
+
+        SignalStatistics                m_gameThreadWait;
+
+        Statistics                      m_statistics;
+
+        BoundingVolumeHierarchy         m_meshHierarchy;
+
+        /** Indexed by proxy. */
+        std::vector<MeshProxy>          m_meshProxies;
+
+        /** Render scene the proxies belong to, 0 before the first frame. */
+        uint64                          m_sceneID           = 0u;
+
+        /** Draws of the proxies, kept up to date as they are created, updated and destroyed. */
+        size_t                          m_submittedMeshes   = 0u;
+
+        /** Changes taken from the render scene, reused from frame to frame. */
+        std::vector<int32>                  m_removedProxies;
+
+        std::vector<StaticMeshComponent*>   m_dirtyMeshes;
+
+        uint64                          m_frame = 0u;
+
+        /** World bounds of the render list's shadow casters, in the same order. */
+        std::vector<Bounds>             m_casterBounds;
+
+        /** Proxies of the mesh components in the camera frustum, in the order of the hierarchy. */
+        std::vector<int32>              m_visibleProxies;
+
+        /** Reused from frame to frame, only the first ones are used. */
+        std::vector<RenderChunk>        m_renderChunks;
+
+        /** Index of each material in the render list. */
+        std::unordered_map<MaterialRenderData const*, uint32>  m_materialIndices;
+
+        /** Index of each mesh drawn in the frame, in the order they are first met. */
+        std::unordered_map<Mesh const*, uint32>                m_meshIndices;
+
+        /** Buffers of the radix sort, reused from frame to frame. */
+        std::vector<DrawRecord>         m_sortScratch;
+
+        std::vector<size_t>             m_sortHistograms;
+
+    // ============================== [Private Local Methods] ============================== //
+
+        /**
+         * Destroys the proxies of the mesh components removed from the scene, then creates or moves the proxy of the dirty ones
+         * and refreshes their draws.
+         */
+        void                UpdateMeshHierarchy (RenderScene&           p_scene)        noexcept;
+
+        void                DestroyMeshProxy    (int32                  p_proxy)        noexcept;
+
+        /**
+         * Gathers the meshes of the visible components into chunks across the ThreadPool, then merges them in the render list.
+         */
+        void                GatherVisibleMeshes (Frustum const&         p_frustum,
+                                                 Vector3 const&         p_cameraLocation)   noexcept;
+
+        /**
+         * Adds the meshes of a component in the view to a chunk, with their distance to the camera.
+         */
+        static void         AddVisibleMeshes    (MeshProxy const&       p_proxy,
+                                                 Frustum const&         p_frustum,
+                                                 Vector3 const&         p_cameraLocation,
+                                                 RenderChunk&           p_chunk)        noexcept;
+
+        /**
+         * Sorts draws by key with a stable LSD radix sort, whose passes are split across the ThreadPool.
+         * The bytes all the keys share are skipped.
+         */
+        void                SortDraws           (std::vector<DrawRecord>& p_draws)      noexcept;
+
+        /**
+         * Adds the opaque meshes of a component to the shadow casters, once per frame.
+         *
+         * @return The proxy, with the range of its casters.
+         */
+        MeshProxy const&    AddShadowCasters    (int32                  p_proxy)        noexcept;
+
+        /**
+         * Adds the meshes in the volume of each light to the shadow casters, masking the lights each one is in.
+         */
+        void                GatherShadowCasters ()                                      noexcept;
+
+        /**
+         * Merges the consecutive draws of a mesh with the same material into batches drawn as instances,
+         * and writes the data of each instance for the frame's storage buffer.
+         */
+        void                BuildBatches        ()                                      noexcept;
 
 };  // !class Renderer
 
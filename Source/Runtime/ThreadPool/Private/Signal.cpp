@@ -0,0 +1,126 @@
+#include "PCH.hpp"
+
+#include "Signal.hpp"
+#include "ThreadPool.hpp"
+
+#if defined(_WIN32) || defined(_WIN64)
+    #pragma comment(lib, "Synchronization.lib")
+#elif defined(__linux__)
+    #include <unistd.h>
+    #include <sys/syscall.h>
+    #include <linux/futex.h>
+#endif
+
+// ============================== [Internal Functions] ============================== //
+
+/**
+ * Hints the processor that the thread is busy-waiting.
+ */
+static FORCEINLINE void CpuRelax    () noexcept
+{
+    #if defined(_MSC_VER)
+        YieldProcessor();
+    #elif defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+    #endif
+}
+
+/**
+ * Raises "p_maximum" to "p_value" if it is lower.
+ */
+static INLINE void      StoreMaximum    (std::atomic<uint64>&   p_maximum,
+                                         uint64                 p_value) noexcept
+{
+    uint64 current = p_maximum.load(std::memory_order_relaxed);
+
+    while (current < p_value && !p_maximum.compare_exchange_weak(current, p_value, std::memory_order_relaxed));
+}
+
+// ============================== [Private Local Methods] ============================== //
+
+void    Signal::WaitSlow    (SignalBackoff const&   p_backoff,
+                             SignalStatistics*      p_statistics) noexcept
+{
+    auto start  = std::chrono::steady_clock::now();
+    bool parked = false;
+    bool isSet  = false;
+
+    for (uint32 i = 0u; i < p_backoff.spinCount && !isSet; ++i)
+    {
+        CpuRelax();
+
+        isSet = IsSet() && TryWait();
+    }
+
+    for (uint32 i = 0u; i < p_backoff.yieldCount && !isSet; ++i)
+    {
+        if (!p_backoff.helpThreadPool || !ThreadPool::Get().TryExecuteTask())
+            std::this_thread::yield();
+
+        isSet = TryWait();
+    }
+
+    while (!isSet)
+    {
+        parked = true;
+
+        Park();
+
+        isSet = TryWait();
+    }
+
+    if (!p_statistics)
+        return;
+
+    uint64 elapsed = static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+
+    // Each statistics object has a single writer, relaxed accesses are only there for concurrent readers.
+    p_statistics->waitCount.fetch_add(1u,      std::memory_order_relaxed);
+    p_statistics->waitTime .fetch_add(elapsed, std::memory_order_relaxed);
+
+    if (parked)
+        p_statistics->parkCount.fetch_add(1u, std::memory_order_relaxed);
+
+    StoreMaximum(p_statistics->maxWaitTime, elapsed);
+}
+
+void    Signal::Park        () noexcept
+{
+    m_parkedCount.fetch_add(1u, std::memory_order_seq_cst);
+
+    // The kernel only puts the thread to sleep if the state is still 0, so a Notify
+    // happening between this check and the system call is never lost.
+    if (m_state.load(std::memory_order_seq_cst) == 0u)
+    {
+        #if defined(_WIN32) || defined(_WIN64)
+
+        uint32 undesired = 0u;
+
+        WaitOnAddress(&m_state, &undesired, sizeof(uint32), INFINITE);
+
+        #elif defined(__linux__)
+
+        syscall(SYS_futex, reinterpret_cast<uint32*>(&m_state), FUTEX_WAIT_PRIVATE, 0u, nullptr, nullptr, 0u);
+
+        #else
+
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+
+        #endif
+    }
+
+    m_parkedCount.fetch_sub(1u, std::memory_order_relaxed);
+}
+
+void    Signal::Wake        () noexcept
+{
+    #if defined(_WIN32) || defined(_WIN64)
+
+    WakeByAddressSingle(&m_state);
+
+    #elif defined(__linux__)
+
+    syscall(SYS_futex, reinterpret_cast<uint32*>(&m_state), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0u);
+
+    #endif
+}
\ No newline at end of file
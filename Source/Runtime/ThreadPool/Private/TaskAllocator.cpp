@@ -0,0 +1,130 @@
+#include "PCH.hpp"
+
+#include "TaskAllocator.hpp"
+
+// ============================== [Internal Structures] ============================== //
+
+struct alignas(TaskAllocator::BlockAlignment) Block
+{
+    union
+    {
+        /** Next free block, only meaningful while the block is in a free list. */
+        Block*          next;
+
+        unsigned char   data[TaskAllocator::BlockSize];
+    };
+};
+
+/**
+ * Memory and free lists shared by every thread.
+ */
+struct SharedPool
+{
+    std::mutex                              mutex;
+
+    /** Heads of free lists of exactly BatchSize blocks. */
+    std::vector<Block*>                     batches;
+
+    /** Every allocation made to the system, released at exit. */
+    std::vector<std::unique_ptr<Block[]>>   slabs;
+};
+
+// ============================== [Internal Variables] ============================== //
+
+/** Number of blocks moved at once between a thread and the shared pool. */
+static constexpr uint32 BatchSize = 64u;
+
+/** Number of blocks requested from the system when the shared pool is empty. */
+static constexpr uint32 SlabSize  = 4u * BatchSize;
+
+/** Free list of this thread. */
+static thread_local Block*  LocalBlocks     = nullptr;
+
+/** Length of the free list of this thread. */
+static thread_local uint32  LocalBlockCount = 0u;
+
+static INLINE SharedPool& GetSharedPool () noexcept
+{
+    static SharedPool pool;
+
+    return pool;
+}
+
+/**
+ * Fills the empty free list of this thread with a batch from the shared pool, or with a new slab.
+ */
+static void Refill  () noexcept
+{
+    SharedPool&      pool = GetSharedPool();
+    std::unique_lock lock(pool.mutex);
+
+    if (!pool.batches.empty())
+    {
+        LocalBlocks     = pool.batches.back();
+        LocalBlockCount = BatchSize;
+
+        pool.batches.pop_back();
+        return;
+    }
+
+    Block* slab = pool.slabs.emplace_back(std::make_unique<Block[]>(SlabSize)).get();
+
+    for (uint32 i = 0u; i + 1u < SlabSize; ++i)
+        slab[i].next = &slab[i + 1u];
+
+    slab[SlabSize - 1u].next = nullptr;
+
+    LocalBlocks     = slab;
+    LocalBlockCount = SlabSize;
+}
+
+/**
+ * Hands a batch of the free list of this thread over to the shared pool.
+ * Threads which mostly free blocks allocated elsewhere (the workers) would otherwise hoard them.
+ */
+static void Spill   () noexcept
+{
+    Block* batch = LocalBlocks;
+    Block* last  = batch;
+
+    for (uint32 i = 1u; i < BatchSize; ++i)
+        last = last->next;
+
+    LocalBlocks      = last->next;
+    LocalBlockCount -= BatchSize;
+    last->next       = nullptr;
+
+    SharedPool&      pool = GetSharedPool();
+    std::unique_lock lock(pool.mutex);
+
+    pool.batches.emplace_back(batch);
+}
+
+// ============================== [Public Static Methods] ============================== //
+
+void*   TaskAllocator::Allocate ()              noexcept
+{
+    if (!LocalBlocks)
+        Refill();
+
+    Block* block = LocalBlocks;
+
+    LocalBlocks = block->next;
+    --LocalBlockCount;
+
+    return block->data;
+}
+
+void    TaskAllocator::Free     (void* p_block) noexcept
+{
+    if (!p_block)
+        return;
+
+    Block* block = static_cast<Block*>(p_block);
+
+    block->next = LocalBlocks;
+    LocalBlocks = block;
+
+    if (++LocalBlockCount >= 2u * BatchSize)
+        Spill();
+}
\ No newline at end of file
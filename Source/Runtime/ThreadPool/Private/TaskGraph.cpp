@@ -0,0 +1,159 @@
+#include "PCH.hpp"
+
+#include "TaskGraph.hpp"
+
+// ============================== [Node Public Constructor] ============================== //
+
+TaskGraph::Node::Node   (TaskGraph&     p_graph,
+                         InlineTask&&   p_task,
+                         char const*    p_name) noexcept :
+    m_graph               { p_graph },
+    m_task                { std::move(p_task) },
+    m_name                { p_name },
+    m_predecessorCount    { 0u },
+    m_pendingPredecessors { 0u }
+{}
+
+// ============================== [Node Public Local Methods] ============================== //
+
+TaskGraph::Node&    TaskGraph::Node::Then   (Node& p_next) noexcept
+{
+    // The other graph would never count this edge down.
+    if (&p_next.m_graph != &m_graph)
+    {
+        m_graph.m_hasForeignEdge = true;
+
+        return p_next;
+    }
+
+    m_successors.emplace_back(&p_next);
+
+    ++p_next.m_predecessorCount;
+
+    m_graph.m_isDirty = true;
+
+    return p_next;
+}
+
+// ============================== [Public Constructor] ============================== //
+
+TaskGraph::TaskGraph    (TaskScheduler& p_scheduler) noexcept :
+    m_scheduler      { p_scheduler },
+    m_isDirty        { false },
+    m_isValid        { true  },
+    m_hasForeignEdge { false },
+    m_pendingNodes   { 0u    }
+{}
+
+// ============================== [Public Local Methods] ============================== //
+
+bool    TaskGraph::Execute  () noexcept
+{
+    if (m_isDirty)
+        Build();
+
+    if (!m_isValid || m_hasForeignEdge)
+        return false;
+
+    if (m_nodes.empty())
+        return true;
+
+    for (auto const& node : m_nodes)
+        node->m_pendingPredecessors.store(node->m_predecessorCount, std::memory_order_relaxed);
+
+    m_pendingNodes.store(m_nodes.size(), std::memory_order_relaxed);
+
+    for (size_t i = 1u; i < m_roots.size(); ++i)
+        Schedule(m_roots[i]);
+
+    Run(m_roots.front());
+
+    while (m_pendingNodes.load(std::memory_order_acquire) != 0u)
+    {
+        if (!m_scheduler.TryExecuteTask())
+            std::this_thread::yield();
+    }
+
+    return true;
+}
+
+void    TaskGraph::Clear    () noexcept
+{
+    m_nodes.clear();
+    m_roots.clear();
+
+    m_isDirty        = false;
+    m_isValid        = true;
+    m_hasForeignEdge = false;
+}
+
+// ============================== [Private Local Methods] ============================== //
+
+void    TaskGraph::Build    () noexcept
+{
+    m_roots.clear();
+
+    for (auto const& node : m_nodes)
+    {
+        if (node->m_predecessorCount == 0u)
+            m_roots.emplace_back(node.get());
+    }
+
+    // Kahn's algorithm, every node is visited once if and only if there is no cycle.
+    // The counters are reset before each execution, they can be used here.
+    for (auto const& node : m_nodes)
+        node->m_pendingPredecessors.store(node->m_predecessorCount, std::memory_order_relaxed);
+
+    std::vector<Node*> visit(m_roots);
+    size_t             visited = 0u;
+
+    while (!visit.empty())
+    {
+        Node* node = visit.back();
+
+        visit.pop_back();
+
+        ++visited;
+
+        for (Node* successor : node->m_successors)
+        {
+            if (successor->m_pendingPredecessors.fetch_sub(1u, std::memory_order_relaxed) == 1u)
+                visit.emplace_back(successor);
+        }
+    }
+
+    m_isValid = visited == m_nodes.size();
+    m_isDirty = false;
+}
+
+void    TaskGraph::Run      (Node* p_node) noexcept
+{
+    while (p_node)
+    {
+        p_node->m_task();
+
+        Node* next = nullptr;
+
+        for (Node* successor : p_node->m_successors)
+        {
+            if (successor->m_pendingPredecessors.fetch_sub(1u, std::memory_order_acq_rel) != 1u)
+                continue;
+
+            // Keeps the first ready successor for this thread.
+            if (!next)
+                next = successor;
+            else
+                Schedule(successor);
+        }
+
+        // Successors have been accounted for before, so the count cannot reach 0 while nodes are left.
+        m_pendingNodes.fetch_sub(1u, std::memory_order_acq_rel);
+
+        p_node = next;
+    }
+}
+
+void    TaskGraph::Schedule (Node* p_node) noexcept
+{
+    m_scheduler.SubmitDetachedTask([this, p_node] { Run(p_node); });
+}
\ No newline at end of file
@@ -0,0 +1,366 @@
+#include "PCH.hpp"
+
+#include "TaskScheduler.hpp"
+
+// ============================== [Thread Local Variables] ============================== //
+
+/** Scheduler the calling thread is a worker of, nullptr if it is not part of any. */
+static thread_local TaskScheduler const*    LocalScheduler      = nullptr;
+
+/** Index of the worker running on this thread in LocalScheduler. */
+static thread_local uint32                  LocalWorkerIndex    = 0u;
+
+/** State of the random generator used by the threads which are not part of the scheduler. */
+static thread_local uint32                  LocalSeed           = 0u;
+
+/** Number of unsuccessful lookups a worker does before going to sleep. */
+static constexpr uint32 SpinCount = 64u;
+
+/** Initial capacity of the global queue. */
+static constexpr size_t GlobalCapacity = 1024u;
+
+/**
+ * Xorshift32 generator, only used to pick the victim of a steal.
+ */
+static INLINE uint32 NextRandom (uint32& p_seed) noexcept
+{
+    if (p_seed == 0u)
+        p_seed = static_cast<uint32>(std::hash<std::thread::id>()(std::this_thread::get_id())) | 1u;
+
+    p_seed ^= p_seed << 13;
+    p_seed ^= p_seed >> 17;
+    p_seed ^= p_seed << 5;
+
+    return p_seed;
+}
+
+// ============================== [Public Local Methods] ============================== //
+
+void    TaskScheduler::Start            (uint32 p_threadCount) noexcept
+{
+    m_running        .store(true, std::memory_order_relaxed);
+    m_pendingTasks   .store(0,    std::memory_order_relaxed);
+    m_sleepingThreads.store(0,    std::memory_order_relaxed);
+    m_tasksCount     .store(0u,   std::memory_order_relaxed);
+
+    m_tasks.assign(GlobalCapacity, nullptr);
+    m_tasksHead = 0u;
+
+    // Every queue must exist before any thread starts stealing.
+    for (uint32 i = 0u; i < p_threadCount; ++i)
+    {
+        m_workers.emplace_back(std::make_unique<Worker>());
+
+        m_workers.back()->seed = (i + 1u) * 2654435761u;
+    }
+
+    for (uint32 i = 0u; i < p_threadCount; ++i)
+    {
+        m_threads.emplace_back([this, i] { Work(i); });
+    }
+}
+
+void    TaskScheduler::Stop             () noexcept
+{
+    {
+        std::unique_lock lock(m_sleepMutex);
+
+        m_running.store(false, std::memory_order_seq_cst);
+    }
+
+    m_condition.notify_all();
+
+    for (auto& thread : m_threads)
+    {
+        if (thread.joinable())
+            thread.join();
+    }
+
+    m_threads.clear();
+    m_workers.clear();
+}
+
+void    TaskScheduler::ExecuteTask      () noexcept
+{
+    TryExecuteTask();
+}
+
+bool    TaskScheduler::TryExecuteTask   () noexcept
+{
+    Task* task = FindTask();
+
+    if (!task)
+        return false;
+
+    RunTask(task);
+
+    return true;
+}
+
+// ============================== [Protected Local Methods] ============================== //
+
+void    TaskScheduler::Schedule     (Task* const*   p_tasks,
+                                     size_t         p_count,
+                                     bool           p_isHighPriority) noexcept
+{
+    if (p_count == 0u)
+        return;
+
+    Worker* worker = GetLocalWorker();
+
+    // A worker keeps its own tasks local, they will be stolen if it is busy.
+    if (worker && !p_isHighPriority)
+    {
+        for (size_t i = 0u; i < p_count; ++i)
+            worker->queue.Push(p_tasks[i]);
+    }
+
+    else
+    {
+        std::unique_lock lock(m_mutex);
+
+        for (size_t i = 0u; i < p_count; ++i)
+            PushGlobal(p_tasks[i], p_isHighPriority);
+    }
+
+    // Must be sequentially consistent with the read of "m_sleepingThreads", see "Work".
+    m_pendingTasks.fetch_add(static_cast<int64>(p_count), std::memory_order_seq_cst);
+
+    if (m_sleepingThreads.load(std::memory_order_seq_cst) > 0)
+    {
+        // Taking the lock ensures a worker cannot be between its check and its wait.
+        {
+            std::unique_lock lock(m_sleepMutex);
+        }
+
+        if (p_count == 1u)
+            m_condition.notify_one();
+        else
+            m_condition.notify_all();
+    }
+}
+
+void    TaskScheduler::OnWorkerStart    (uint32 p_index) noexcept
+{
+    (void)p_index;
+}
+
+// ============================== [Private Static Methods] ============================== //
+
+void    TaskScheduler::RunTask      (Task* p_task) noexcept
+{
+    (*p_task)();
+
+    p_task->~Task();
+
+    TaskAllocator::Free(p_task);
+}
+
+// ============================== [Private Local Methods] ============================== //
+
+TaskScheduler::Worker*  TaskScheduler::GetLocalWorker   () noexcept
+{
+    return LocalScheduler == this ? m_workers[LocalWorkerIndex].get() : nullptr;
+}
+
+TaskScheduler::Task*    TaskScheduler::FindTask         () noexcept
+{
+    Task*   task   = nullptr;
+    Worker* worker = GetLocalWorker();
+
+    // Local queue.
+    if (worker && worker->queue.Pop(task))
+    {
+        m_pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+        return task;
+    }
+
+    // Global queue.
+    if (m_tasksCount.load(std::memory_order_relaxed) > 0u)
+    {
+        std::unique_lock lock(m_mutex);
+
+        task = PopGlobal();
+    }
+
+    if (task)
+    {
+        m_pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+        return task;
+    }
+
+    // Steals from a random victim, then from every other worker.
+    size_t workerCount = m_workers.size();
+
+    if (workerCount == 0u)
+        return nullptr;
+
+    uint32& seed  = worker ? worker->seed : LocalSeed;
+    size_t  first = NextRandom(seed) % workerCount;
+
+    for (size_t i = 0u; i < workerCount; ++i)
+    {
+        Worker& victim = *m_workers[(first + i) % workerCount];
+
+        if (&victim == worker)
+            continue;
+
+        if (victim.queue.Steal(task))
+        {
+            m_pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+            return task;
+        }
+    }
+
+    return nullptr;
+}
+
+void    TaskScheduler::RunParallel  (ParallelRange& p_range,
+                                     size_t         p_begin,
+                                     size_t         p_end) noexcept
+{
+    size_t count = p_end - p_begin;
+
+    if (p_range.grain == 0u)
+        p_range.grain = std::max<size_t>(count / (ChunksPerThread * (m_workers.size() + 1u)), 1u);
+
+    p_range.remaining.store(count, std::memory_order_relaxed);
+
+    SplitRange(p_range, p_begin, p_end);
+
+    // Single join, executes whatever is available (most likely pieces of this range) until the range is done.
+    while (p_range.remaining.load(std::memory_order_acquire) != 0u)
+    {
+        if (!TryExecuteTask())
+            std::this_thread::yield();
+    }
+}
+
+void    TaskScheduler::SplitRange   (ParallelRange& p_range,
+                                     size_t         p_begin,
+                                     size_t         p_end) noexcept
+{
+    Worker* worker   = GetLocalWorker();
+    size_t  executed = 0u;
+
+    while (p_begin < p_end)
+    {
+        // Nothing left for the thieves, hands half of the range over.
+        bool isQueueEmpty = worker ? worker->queue.IsEmpty() : m_tasksCount.load(std::memory_order_relaxed) == 0u;
+
+        if (isQueueEmpty && !m_workers.empty() && p_end - p_begin > p_range.grain)
+        {
+            size_t middle = p_begin + (p_end - p_begin) / 2u;
+            Task*  task   = CreateTask([this, &p_range, middle, p_end] { SplitRange(p_range, middle, p_end); });
+
+            Schedule(&task, 1u, false);
+
+            p_end = middle;
+            continue;
+        }
+
+        size_t last = std::min(p_begin + p_range.grain, p_end);
+
+        p_range.execute(p_range.context, p_begin, last);
+
+        executed += last - p_begin;
+        p_begin   = last;
+    }
+
+    // Last access to the range, which may be destroyed as soon as "remaining" reaches 0.
+    p_range.remaining.fetch_sub(executed, std::memory_order_acq_rel);
+}
+
+void    TaskScheduler::PushGlobal   (Task*  p_task,
+                                     bool   p_isHighPriority) noexcept
+{
+    size_t count    = m_tasksCount.load(std::memory_order_relaxed);
+    size_t capacity = m_tasks.size();
+
+    // Unrolls the ring into a buffer twice as big.
+    if (count == capacity)
+    {
+        std::vector<Task*> tasks(capacity * 2u, nullptr);
+
+        for (size_t i = 0u; i < count; ++i)
+            tasks[i] = m_tasks[(m_tasksHead + i) % capacity];
+
+        m_tasks     = std::move(tasks);
+        m_tasksHead = 0u;
+        capacity   *= 2u;
+    }
+
+    if (p_isHighPriority)
+    {
+        m_tasksHead          = (m_tasksHead + capacity - 1u) % capacity;
+        m_tasks[m_tasksHead] = p_task;
+    }
+
+    else
+        m_tasks[(m_tasksHead + count) % capacity] = p_task;
+
+    m_tasksCount.store(count + 1u, std::memory_order_relaxed);
+}
+
+TaskScheduler::Task*    TaskScheduler::PopGlobal    () noexcept
+{
+    size_t count = m_tasksCount.load(std::memory_order_relaxed);
+
+    if (count == 0u)
+        return nullptr;
+
+    Task* task = m_tasks[m_tasksHead];
+
+    m_tasksHead = (m_tasksHead + 1u) % m_tasks.size();
+
+    m_tasksCount.store(count - 1u, std::memory_order_relaxed);
+
+    return task;
+}
+
+void    TaskScheduler::Work         (uint32 p_index) noexcept
+{
+    LocalScheduler   = this;
+    LocalWorkerIndex = p_index;
+
+    OnWorkerStart(p_index);
+
+    uint32 failedLookups = 0u;
+
+    while (true)
+    {
+        if (Task* task = FindTask())
+        {
+            RunTask(task);
+
+            failedLookups = 0u;
+            continue;
+        }
+
+        if (++failedLookups < SpinCount)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        failedLookups = 0u;
+
+        std::unique_lock lock(m_sleepMutex);
+
+        m_sleepingThreads.fetch_add(1, std::memory_order_seq_cst);
+
+        // Waits for a task to be available or the shutdown.
+        m_condition.wait(lock, [&]
+        {
+            return !m_running.load(std::memory_order_seq_cst) || m_pendingTasks.load(std::memory_order_seq_cst) > 0;
+        });
+
+        m_sleepingThreads.fetch_sub(1, std::memory_order_relaxed);
+
+        // Stops running when the scheduler has been stopped and the queues have been emptied.
+        if (!m_running.load(std::memory_order_relaxed) && m_pendingTasks.load(std::memory_order_relaxed) <= 0)
+            break;
+    }
+
+    LocalScheduler = nullptr;
+}
\ No newline at end of file
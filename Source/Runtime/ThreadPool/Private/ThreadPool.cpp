@@ -8,40 +8,9 @@ void    ThreadPool::Initialize    (EngineKey const& p_passkey) noexcept
 {
     LOG(LogThreadPool, Warning, "\nInitializing ThreadPool...\n");
 
-    m_running = true;
+    Start(std::max(std::thread::hardware_concurrency(), 2u) - 1u);
 
-    for (uint32 i = 0u; i < std::thread::hardware_concurrency() - 1u; ++i)
-    {
-        m_threads.emplace_back( [&]
-        {
-            while (true)
-            {
-                Task task;
-
-                {
-                    std::unique_lock lock(m_mutex);
-
-                    // Waits for a task to be available or the shutdown.
-                    m_condition.wait(lock, [&] { return !m_running || !m_tasks.empty(); });
-
-                    // Stops running when the module has been shut down and the queue has been emptied.
-                    if (!m_running && m_tasks.empty())
-                        break;
-
-                    if (!m_tasks.empty())
-                    {
-                        task = std::move(m_tasks.front());
-
-                        m_tasks.pop_front();
-                    }
-                }
-
-                std::invoke(task);
-            }
-        });
-    }
-
-    LOG(LogThreadPool, Display, "%d threads were created", m_threads.size());
+    LOG(LogThreadPool, Display, "%d threads were created", GetThreads().size());
 
     m_initialized = true;
 
@@ -60,42 +29,21 @@ void    ThreadPool::Update        (EngineKey const& p_passkey) noexcept
 void    ThreadPool::Shutdown      (EngineKey const& p_passkey) noexcept
 {
     LOG(LogThreadPool, Warning, "\nShutting down ThreadPool...\n");
-    
-    {
-        std::unique_lock lock(m_mutex);
-
-        m_running = false;
-    }
-    
-    m_condition.notify_all();
 
-    for (auto& thread : m_threads)
-    {
-        if (thread.joinable())
-            thread.join();
-    }
+    Stop();
 
     m_initialized = false;
 
     LOG(LogThreadPool, Warning, "\nThreadPool shut down\n");
 }
 
-// ============================== [Public Local Methods] ============================== //
+// ============================== [Protected Local Methods] ============================== //
 
-void    ThreadPool::ExecuteTask () noexcept
+void    ThreadPool::OnWorkerStart (uint32 p_index) noexcept
 {
-    Task task;
+    char name[32];
 
-    {
-        std::unique_lock lock(m_mutex);
-
-        if (m_tasks.empty())
-            return;
-            
-        task = std::move(m_tasks.front());
-
-        m_tasks.pop_front();
-    }
+    std::snprintf(name, sizeof(name), "Worker %u", p_index);
 
-    std::invoke(task);
+    Profiler::SetThreadName(name);
 }
\ No newline at end of file
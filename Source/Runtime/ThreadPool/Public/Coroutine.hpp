@@ -0,0 +1,31 @@
+#ifndef __COROUTINE_HPP__
+#define __COROUTINE_HPP__
+
+/**
+ * Coroutine support, from <coroutine> when the compiler implements C++20 coroutines,
+ * otherwise from the Coroutines TS (<experimental/coroutine>, /await with the v141 toolset).
+ */
+
+#if __has_include(<coroutine>) && defined(__cpp_impl_coroutine)
+
+    #include <coroutine>
+
+    template<typename T = void>
+    using CoroutineHandle = std::coroutine_handle<T>;
+
+    using SuspendAlways   = std::suspend_always;
+    using SuspendNever    = std::suspend_never;
+
+#else
+
+    #include <experimental/coroutine>
+
+    template<typename T = void>
+    using CoroutineHandle = std::experimental::coroutine_handle<T>;
+
+    using SuspendAlways   = std::experimental::suspend_always;
+    using SuspendNever    = std::experimental::suspend_never;
+
+#endif
+
+#endif // !__COROUTINE_HPP__
\ No newline at end of file
@@ -0,0 +1,90 @@
+#ifndef __INLINE_TASK_HPP__
+#define __INLINE_TASK_HPP__
+
+#include "HAL/Platform.hpp"
+
+/**
+ * Move-only, type-erased "void()" callable.
+ *
+ * Unlike std::function, callables up to InlineSize bytes are stored inside the task itself,
+ * so wrapping a lambda with a few captures never touches the allocator.
+ * Bigger callables still work but are moved to the heap.
+ */
+class InlineTask
+{
+    public:
+
+    // ============================== [Public Static Properties] ============================== //
+
+        /** Size of the inline storage, in bytes. */
+        static constexpr size_t InlineSize      = 64u;
+
+        /** Alignment of the inline storage, in bytes. */
+        static constexpr size_t InlineAlignment = 16u;
+
+        /**
+         * Whether or not a callable of type T is stored inline.
+         */
+        template<typename T>
+        static constexpr bool   IsStoredInline  = sizeof(T)  <= InlineSize      &&
+                                                  alignof(T) <= InlineAlignment &&
+                                                  std::is_nothrow_move_constructible_v<T>;
+
+    // ============================== [Public Constructors and Destructor] ============================== //
+
+        InlineTask  ()                          noexcept = default;
+
+        template<typename T, typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, InlineTask>>>
+        InlineTask  (T&&                p_function) noexcept;
+
+        InlineTask  (InlineTask&&       p_move)     noexcept;
+
+        InlineTask  (InlineTask const&  p_copy)     = delete;
+
+        ~InlineTask ()                          noexcept;
+
+    // ============================== [Public Local Operators] ============================== //
+
+        InlineTask& operator=   (InlineTask&&       p_move) noexcept;
+
+        InlineTask& operator=   (InlineTask const&  p_copy) = delete;
+
+        /**
+         * Invokes the stored callable, which must be valid.
+         */
+        void        operator()  ()                          noexcept;
+
+        explicit    operator bool   ()                      const noexcept;
+
+    private:
+
+    // ============================== [Private Structures] ============================== //
+
+        struct Operations
+        {
+            void (*invoke)  (void* p_storage);
+            void (*move)    (void* p_destination, void* p_source);
+            void (*destroy) (void* p_storage);
+        };
+
+        template<typename T>
+        struct InlineOperations;
+
+        template<typename T>
+        struct HeapOperations;
+
+    // ============================== [Private Local Properties] ============================== //
+
+        alignas(InlineAlignment) unsigned char  m_storage[InlineSize];
+
+        Operations const*                       m_operations = nullptr;
+
+    // ============================== [Private Local Methods] ============================== //
+
+        void    Reset   ()  noexcept;
+
+};  // !class InlineTask
+
+#include "InlineTask.inl"
+
+#endif // !__INLINE_TASK_HPP__
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include "InlineTask.hpp"
+
+// ============================== [Private Structures] ============================== //
+
+/**
+ * Operations of a callable living in the inline storage.
+ */
+template<typename T>
+struct InlineTask::InlineOperations
+{
+    static void Invoke  (void* p_storage) noexcept
+    {
+        (*static_cast<T*>(p_storage))();
+    }
+
+    static void Move    (void* p_destination,
+                         void* p_source) noexcept
+    {
+        new (p_destination) T(std::move(*static_cast<T*>(p_source)));
+
+        static_cast<T*>(p_source)->~T();
+    }
+
+    static void Destroy (void* p_storage) noexcept
+    {
+        static_cast<T*>(p_storage)->~T();
+    }
+
+    static constexpr Operations Table { &Invoke, &Move, &Destroy };
+};
+
+/**
+ * Operations of a callable too big for the inline storage, which only holds a pointer to it.
+ */
+template<typename T>
+struct InlineTask::HeapOperations
+{
+    static void Invoke  (void* p_storage) noexcept
+    {
+        (**static_cast<T**>(p_storage))();
+    }
+
+    static void Move    (void* p_destination,
+                         void* p_source) noexcept
+    {
+        *static_cast<T**>(p_destination) = *static_cast<T**>(p_source);
+    }
+
+    static void Destroy (void* p_storage) noexcept
+    {
+        delete *static_cast<T**>(p_storage);
+    }
+
+    static constexpr Operations Table { &Invoke, &Move, &Destroy };
+};
+
+// ============================== [Public Constructors and Destructor] ============================== //
+
+template<typename T, typename>
+INLINE InlineTask::InlineTask   (T&& p_function) noexcept
+{
+    using Function = std::decay_t<T>;
+
+    if constexpr (IsStoredInline<Function>)
+    {
+        new (m_storage) Function(std::forward<T>(p_function));
+
+        m_operations = &InlineOperations<Function>::Table;
+    }
+
+    else
+    {
+        *reinterpret_cast<Function**>(m_storage) = new Function(std::forward<T>(p_function));
+
+        m_operations = &HeapOperations<Function>::Table;
+    }
+}
+
+INLINE InlineTask::InlineTask   (InlineTask&& p_move) noexcept :
+    m_operations { p_move.m_operations }
+{
+    if (m_operations)
+    {
+        m_operations->move(m_storage, p_move.m_storage);
+
+        p_move.m_operations = nullptr;
+    }
+}
+
+INLINE InlineTask::~InlineTask  () noexcept
+{
+    Reset();
+}
+
+// ============================== [Public Local Operators] ============================== //
+
+INLINE InlineTask&  InlineTask::operator=   (InlineTask&& p_move) noexcept
+{
+    if (this == &p_move)
+        return *this;
+
+    Reset();
+
+    m_operations = p_move.m_operations;
+
+    if (m_operations)
+    {
+        m_operations->move(m_storage, p_move.m_storage);
+
+        p_move.m_operations = nullptr;
+    }
+
+    return *this;
+}
+
+INLINE void         InlineTask::operator()  () noexcept
+{
+    m_operations->invoke(m_storage);
+}
+
+INLINE              InlineTask::operator bool   () const noexcept
+{
+    return m_operations != nullptr;
+}
+
+// ============================== [Private Local Methods] ============================== //
+
+INLINE void         InlineTask::Reset       () noexcept
+{
+    if (m_operations)
+    {
+        m_operations->destroy(m_storage);
+
+        m_operations = nullptr;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,124 @@
+#ifndef __SIGNAL_HPP__
+#define __SIGNAL_HPP__
+
+#include "HAL/Platform.hpp"
+
+/**
+ * How a thread waits for a Signal: it first spins, then yields (optionally helping the ThreadPool),
+ * and finally parks until the Signal is notified.
+ */
+struct SignalBackoff
+{
+    /** Number of busy-wait iterations before yielding. */
+    uint32  spinCount       = 256u;
+
+    /** Number of yields (or executed ThreadPool tasks) before parking. */
+    uint32  yieldCount      = 16u;
+
+    /** Whether or not the waiting thread executes ThreadPool tasks instead of yielding. */
+    bool    helpThreadPool  = true;
+
+};  // !struct SignalBackoff
+
+/**
+ * Time spent waiting on a Signal, accumulated by every Wait call given these statistics.
+ */
+struct SignalStatistics
+{
+    /** Number of waits that did not find the Signal already set. */
+    std::atomic<uint64> waitCount   { 0u };
+
+    /** Number of waits that had to park the thread. */
+    std::atomic<uint64> parkCount   { 0u };
+
+    /** Total time spent waiting, in nanoseconds. */
+    std::atomic<uint64> waitTime    { 0u };
+
+    /** Longest single wait, in nanoseconds. */
+    std::atomic<uint64> maxWaitTime { 0u };
+
+};  // !struct SignalStatistics
+
+/**
+ * Auto-reset binary signal, used to hand work over from one thread to another.
+ *
+ * Notify sets the signal and wakes a parked waiter, Wait blocks until the signal is set and resets it.
+ * Parked threads sleep in the kernel (WaitOnAddress on Windows, futex on Linux),
+ * so a waiting thread costs no CPU time once its backoff is exhausted.
+ */
+class ENGINE_API Signal
+{
+    public:
+
+    // ============================== [Public Constructors and Destructor] ============================== //
+
+        explicit Signal (bool p_isSet = false)  noexcept;
+
+        Signal          (Signal const& p_copy)  = delete;
+
+        ~Signal         ()                      = default;
+
+    // ============================== [Public Local Operators] ============================== //
+
+        Signal& operator=   (Signal const& p_copy)  = delete;
+
+    // ============================== [Public Local Methods] ============================== //
+
+        /**
+         * Sets the signal and wakes a parked waiter, if any.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        void    Notify  ()  noexcept;
+
+        /**
+         * Resets the signal if it was set.
+         *
+         * @return Whether or not the signal was set.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        bool    TryWait ()  noexcept;
+
+        /**
+         * Blocks until the signal is set, then resets it.
+         *
+         * @param p_backoff     How long to spin and yield before parking.
+         * @param p_statistics  Statistics to accumulate the time spent waiting into, may be null.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        void    Wait    (SignalBackoff const&   p_backoff,
+                         SignalStatistics*      p_statistics = nullptr) noexcept;
+
+        /**
+         * @return Whether or not the signal is set.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        bool    IsSet   ()  const noexcept;
+
+    private:
+
+    // ============================== [Private Local Properties] ============================== //
+
+        /** 1 when set, 0 otherwise. 32 bits wide to be waited on by the kernel. */
+        std::atomic<uint32> m_state;
+
+        /** Number of parked threads, lets Notify skip the system call when nobody sleeps. */
+        std::atomic<uint32> m_parkedCount;
+
+    // ============================== [Private Local Methods] ============================== //
+
+        void    WaitSlow    (SignalBackoff const&   p_backoff,
+                             SignalStatistics*      p_statistics)   noexcept;
+
+        void    Park        ()  noexcept;
+
+        void    Wake        ()  noexcept;
+
+};  // !class Signal
+
+#include "Signal.inl"
+
+#endif // !__SIGNAL_HPP__
\ No newline at end of file
@@ -0,0 +1,41 @@
+#include "Signal.hpp"
+
+// ============================== [Public Constructors and Destructor] ============================== //
+
+INLINE Signal::Signal   (bool p_isSet) noexcept :
+    m_state         { p_isSet ? 1u : 0u },
+    m_parkedCount   { 0u }
+{
+
+}
+
+// ============================== [Public Local Methods] ============================== //
+
+INLINE void Signal::Notify  () noexcept
+{
+    // Sequentially consistent on both sides: either Notify sees the parked thread,
+    // or the thread sees the new state before going to sleep.
+    m_state.store(1u, std::memory_order_seq_cst);
+
+    if (m_parkedCount.load(std::memory_order_seq_cst) != 0u)
+        Wake();
+}
+
+INLINE bool Signal::TryWait () noexcept
+{
+    uint32 expected = 1u;
+
+    return m_state.compare_exchange_strong(expected, 0u, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+INLINE void Signal::Wait    (SignalBackoff const&   p_backoff,
+                             SignalStatistics*      p_statistics) noexcept
+{
+    if (!TryWait())
+        WaitSlow(p_backoff, p_statistics);
+}
+
+INLINE bool Signal::IsSet   () const noexcept
+{
+    return m_state.load(std::memory_order_acquire) != 0u;
+}
\ No newline at end of file
@@ -0,0 +1,202 @@
+#ifndef __TASK_HPP__
+#define __TASK_HPP__
+
+#include "Coroutine.hpp"
+#include "ThreadPool.hpp"
+
+// ============================== [Coroutine Result] ============================== //
+
+/**
+ * Storage of the value returned by a Task's coroutine.
+ */
+template<typename T>
+class CoroutineResult
+{
+    public:
+
+    // ============================== [Public Local Methods] ============================== //
+
+        template<typename U>
+        void    return_value    (U&& p_value)   noexcept;
+
+        T       GetResult       ()              noexcept;
+
+    private:
+
+    // ============================== [Private Local Properties] ============================== //
+
+        std::optional<T>    m_value;
+
+};  // !class CoroutineResult
+
+template<>
+class CoroutineResult<void>
+{
+    public:
+
+    // ============================== [Public Local Methods] ============================== //
+
+        INLINE void return_void ()  noexcept {}
+
+        INLINE void GetResult   ()  noexcept {}
+
+};  // !class CoroutineResult<void>
+
+// ============================== [Task] ============================== //
+
+/**
+ * Lazy coroutine returning T.
+ *
+ * A Task does not run until it is awaited with "co_await", or started with "Start".
+ * When it is awaited, the awaiting coroutine is resumed by the thread which completes the Task,
+ * so a Task which suspends on a ThreadPoolAwaitable or an AssetAwaitable gives its thread back while it waits.
+ *
+ * Coroutine frames small enough are allocated from the TaskAllocator.
+ * A Task whose frame could not be allocated, or which was moved from, is empty: awaiting it logs an error
+ * and gives a value-initialized result.
+ */
+template<typename T = void>
+class Task
+{
+    public:
+
+    // ============================== [Public Classes] ============================== //
+
+        class promise_type;
+
+        /**
+         * Suspends the coroutine at its end, unless it was started, and resumes the awaiting coroutine.
+         */
+        class FinalAwaiter
+        {
+            public:
+
+                bool    await_ready     ()                                          const noexcept  { return false; }
+
+                bool    await_suspend   (CoroutineHandle<promise_type>  p_handle)   const noexcept;
+
+                void    await_resume    ()                                          const noexcept  {}
+        };
+
+        class promise_type : public CoroutineResult<T>
+        {
+            friend class Task;
+            friend class FinalAwaiter;
+
+            public:
+
+            // ============================== [Public Static Methods] ============================== //
+
+                static void*    operator new    (size_t p_size)                 noexcept;
+
+                static void     operator delete (void*  p_pointer,
+                                                 size_t p_size)                 noexcept;
+
+                static Task     get_return_object_on_allocation_failure ()      noexcept;
+
+            // ============================== [Public Local Methods] ============================== //
+
+                Task            get_return_object   ()  noexcept;
+
+                SuspendAlways   initial_suspend     ()  const noexcept  { return {}; }
+
+                FinalAwaiter    final_suspend       ()  const noexcept  { return {}; }
+
+                void            unhandled_exception ()  const noexcept  { std::terminate(); }
+
+            private:
+
+            // ============================== [Private Local Properties] ============================== //
+
+                /** Coroutine awaiting this one. */
+                CoroutineHandle<>   m_continuation;
+
+                /** Set by the awaiter once it has resumed the task, and by the task once it has completed, the second one resumes the continuation. */
+                std::atomic_bool    m_isHandedOver { false };
+
+                /** A started task destroys itself when it completes. */
+                bool                m_isDetached   = false;
+        };
+
+    // ============================== [Alias] ============================== //
+
+        using Handle = CoroutineHandle<promise_type>;
+
+    // ============================== [Public Constructors and Destructor] ============================== //
+
+        Task    ()                      noexcept = default;
+
+        Task    (Task&&         p_move) noexcept;
+
+        Task    (Task const&    p_copy) = delete;
+
+        ~Task   ()                      noexcept;
+
+    // ============================== [Public Local Operators] ============================== //
+
+        Task&   operator=   (Task&&         p_move) noexcept;
+
+        Task&   operator=   (Task const&    p_copy) = delete;
+
+    // ============================== [Public Local Methods] ============================== //
+
+        /**
+         * Runs the task on the calling thread until its first suspension, without awaiting it.
+         * Its coroutine frame is destroyed when it completes, and its result is discarded.
+         */
+        void            Start           ()                          noexcept;
+
+        INLINE bool     IsValid         ()  const noexcept  { return static_cast<bool>(m_handle); }
+
+    // ============================== [Awaitable Methods] ============================== //
+
+        bool            await_ready     ()                          const noexcept;
+
+        bool            await_suspend   (CoroutineHandle<> p_awaiter)     noexcept;
+
+        decltype(auto)  await_resume    ()                                noexcept;
+
+    private:
+
+    // ============================== [Private Constructor] ============================== //
+
+        explicit Task   (Handle p_handle)   noexcept;
+
+    // ============================== [Private Local Properties] ============================== //
+
+        Handle  m_handle;
+
+};  // !class Task
+
+// ============================== [ThreadPool Awaitable] ============================== //
+
+/**
+ * Suspends the awaiting coroutine and resumes it on the ThreadPool.
+ */
+class ThreadPoolAwaitable
+{
+    public:
+
+    // ============================== [Public Constructor] ============================== //
+
+        explicit ThreadPoolAwaitable    (bool p_isHighPriority = false) noexcept;
+
+    // ============================== [Awaitable Methods] ============================== //
+
+        bool    await_ready     ()                          const noexcept  { return false; }
+
+        void    await_suspend   (CoroutineHandle<> p_handle) const noexcept;
+
+        void    await_resume    ()                          const noexcept  {}
+
+    private:
+
+    // ============================== [Private Local Properties] ============================== //
+
+        bool    m_isHighPriority;
+
+};  // !class ThreadPoolAwaitable
+
+#include "Task.inl"
+
+#endif // !__TASK_HPP__
\ No newline at end of file
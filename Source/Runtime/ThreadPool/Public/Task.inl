@@ -0,0 +1,178 @@
+#include "Task.hpp"
+
+// ============================== [Coroutine Result] ============================== //
+
+template<typename T>
+template<typename U>
+INLINE void CoroutineResult<T>::return_value    (U&& p_value) noexcept
+{
+    m_value.emplace(std::forward<U>(p_value));
+}
+
+template<typename T>
+INLINE T    CoroutineResult<T>::GetResult       () noexcept
+{
+    return std::move(*m_value);
+}
+
+// ============================== [Task Final Awaiter] ============================== //
+
+template<typename T>
+INLINE bool Task<T>::FinalAwaiter::await_suspend    (CoroutineHandle<promise_type> p_handle) const noexcept
+{
+    promise_type& promise = p_handle.promise();
+
+    // Not suspending lets the frame of a started task be destroyed.
+    if (promise.m_isDetached)
+        return false;
+
+    if (promise.m_isHandedOver.exchange(true, std::memory_order_acq_rel))
+        promise.m_continuation.resume();
+
+    return true;
+}
+
+// ============================== [Task Promise] ============================== //
+
+template<typename T>
+INLINE void*    Task<T>::promise_type::operator new     (size_t p_size) noexcept
+{
+    if (p_size <= TaskAllocator::BlockSize)
+        return TaskAllocator::Allocate();
+
+    return ::operator new(p_size, std::nothrow);
+}
+
+template<typename T>
+INLINE void     Task<T>::promise_type::operator delete  (void*  p_pointer,
+                                                         size_t p_size) noexcept
+{
+    if (p_size <= TaskAllocator::BlockSize)
+        TaskAllocator::Free(p_pointer);
+    else
+        ::operator delete(p_pointer);
+}
+
+template<typename T>
+INLINE Task<T>  Task<T>::promise_type::get_return_object_on_allocation_failure  () noexcept
+{
+    return Task();
+}
+
+template<typename T>
+INLINE Task<T>  Task<T>::promise_type::get_return_object                        () noexcept
+{
+    return Task(Handle::from_promise(*this));
+}
+
+// ============================== [Public Constructors and Destructor] ============================== //
+
+template<typename T>
+INLINE Task<T>::Task    (Handle p_handle) noexcept :
+    m_handle { p_handle }
+{}
+
+template<typename T>
+INLINE Task<T>::Task    (Task&& p_move) noexcept :
+    m_handle { std::exchange(p_move.m_handle, nullptr) }
+{}
+
+template<typename T>
+INLINE Task<T>::~Task   () noexcept
+{
+    if (m_handle)
+        m_handle.destroy();
+}
+
+// ============================== [Public Local Operators] ============================== //
+
+template<typename T>
+INLINE Task<T>&         Task<T>::operator=      (Task&& p_move) noexcept
+{
+    if (this != &p_move)
+    {
+        if (m_handle)
+            m_handle.destroy();
+
+        m_handle = std::exchange(p_move.m_handle, nullptr);
+    }
+
+    return *this;
+}
+
+// ============================== [Public Local Methods] ============================== //
+
+template<typename T>
+INLINE void             Task<T>::Start          () noexcept
+{
+    if (!m_handle)
+        return;
+
+    Handle handle = std::exchange(m_handle, nullptr);
+
+    handle.promise().m_isDetached = true;
+
+    handle.resume();
+}
+
+// ============================== [Awaitable Methods] ============================== //
+
+template<typename T>
+INLINE bool             Task<T>::await_ready    () const noexcept
+{
+    // An empty task has no result to hand over, await_resume reports it.
+    return m_handle && m_handle.done();
+}
+
+template<typename T>
+INLINE bool             Task<T>::await_suspend  (CoroutineHandle<> p_awaiter) noexcept
+{
+    if (!m_handle)
+        return false;
+
+    promise_type& promise = m_handle.promise();
+
+    promise.m_continuation = p_awaiter;
+
+    m_handle.resume();
+
+    // If the task has already completed, the awaiter goes on without being suspended.
+    return !promise.m_isHandedOver.exchange(true, std::memory_order_acq_rel);
+}
+
+template<typename T>
+INLINE decltype(auto)   Task<T>::await_resume   () noexcept
+{
+    if (!m_handle)
+    {
+        LOG(LogThreadPool, Error, "An empty task was awaited, its frame could not be allocated or it was moved from");
+
+        if constexpr (!std::is_void_v<T>)
+        {
+            if constexpr (std::is_default_constructible_v<T>)
+                return T();
+            else
+            {
+                LOG(LogThreadPool, Fatal, "The result of an empty task cannot be value-initialized");
+
+                std::abort();
+            }
+        }
+
+        else
+            return;
+    }
+
+    return m_handle.promise().GetResult();
+}
+
+// ============================== [ThreadPool Awaitable] ============================== //
+
+INLINE ThreadPoolAwaitable::ThreadPoolAwaitable (bool p_isHighPriority) noexcept :
+    m_isHighPriority { p_isHighPriority }
+{}
+
+INLINE void ThreadPoolAwaitable::await_suspend  (CoroutineHandle<> p_handle) const noexcept
+{
+    ThreadPool::Get().SubmitDetachedTask([p_handle] () mutable { p_handle.resume(); }, m_isHighPriority);
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef __TASK_ALLOCATOR_HPP__
+#define __TASK_ALLOCATOR_HPP__
+
+#include "HAL/Platform.hpp"
+
+/**
+ * Fixed-size block allocator backing the ThreadPool tasks and the TaskFuture states.
+ *
+ * Each thread keeps a free list of its own, so allocating and freeing a block is a pointer swap.
+ * Free lists are exchanged with a shared pool by batches, which is the only place a lock is taken,
+ * and new memory is only requested from the system when every free list is empty.
+ * Blocks are never given back to the system before the program exits.
+ */
+class ENGINE_API TaskAllocator
+{
+    public:
+
+    // ============================== [Public Static Properties] ============================== //
+
+        /** Size of a block, in bytes. */
+        static constexpr size_t BlockSize      = 128u;
+
+        /** Alignment of a block, in bytes. */
+        static constexpr size_t BlockAlignment = 64u;
+
+        /**
+         * Whether or not an object of type T fits in a block.
+         */
+        template<typename T>
+        static constexpr bool   Fits           = sizeof(T) <= BlockSize && alignof(T) <= BlockAlignment;
+
+    // ============================== [Public Static Methods] ============================== //
+
+        /**
+         * @return A block of BlockSize bytes.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        static void*    Allocate    ()                  noexcept;
+
+        /**
+         * Gives a block back, it may have been allocated by any thread.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        static void     Free        (void* p_block)     noexcept;
+
+};  // !class TaskAllocator
+
+#endif // !__TASK_ALLOCATOR_HPP__
\ No newline at end of file
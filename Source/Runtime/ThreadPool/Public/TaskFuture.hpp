@@ -0,0 +1,179 @@
+#ifndef __TASK_FUTURE_HPP__
+#define __TASK_FUTURE_HPP__
+
+#include "TaskAllocator.hpp"
+
+/**
+ * Lightweight replacement of the std::promise / std::future pair returned by ThreadPool::SubmitTask.
+ *
+ * The shared state is reference counted and lives in a TaskAllocator block whenever it fits,
+ * so no allocation is made per task. Waiting on a future executes other tasks of the ThreadPool,
+ * which makes it safe to wait from a worker thread.
+ *
+ * A promise destroyed without being fulfilled (its task was dropped) breaks the shared state,
+ * which makes the future ready without a result instead of leaving its waiters spinning forever.
+ *
+ * This header is included by ThreadPool.hpp, include the latter.
+ */
+
+// ============================== [Shared State] ============================== //
+
+template<typename T>
+class TaskState
+{
+    public:
+
+    // ============================== [Alias] ============================== //
+
+        /** Type actually stored, void results are stored as a flag. */
+        using Value = std::conditional_t<std::is_void_v<T>, bool, T>;
+
+    // ============================== [Public Static Methods] ============================== //
+
+        static TaskState*   Create  () noexcept;
+
+    // ============================== [Public Local Methods] ============================== //
+
+        void                AddReference    () noexcept;
+
+        void                RemoveReference () noexcept;
+
+    // ==================================================================================== //
+
+        std::atomic<uint32>     references { 1u };
+
+        /** Set once the task has completed, or once its promise has been broken. */
+        std::atomic_bool        isReady    { false };
+
+        /** Set before "isReady" when the promise was destroyed without being fulfilled. */
+        std::atomic_bool        isBroken   { false };
+
+        std::optional<Value>    value;
+
+};  // !class TaskState
+
+// ============================== [Future] ============================== //
+
+template<typename T>
+class TaskFuture
+{
+    template<typename>
+    friend class TaskPromise;
+
+    public:
+
+    // ============================== [Public Constructors and Destructor] ============================== //
+
+        TaskFuture  ()                          noexcept = default;
+
+        TaskFuture  (TaskFuture&&       p_move) noexcept;
+
+        TaskFuture  (TaskFuture const&  p_copy) = delete;
+
+        ~TaskFuture ()                          noexcept;
+
+    // ============================== [Public Local Operators] ============================== //
+
+        TaskFuture& operator=   (TaskFuture&&       p_move) noexcept;
+
+        TaskFuture& operator=   (TaskFuture const&  p_copy) = delete;
+
+    // ============================== [Public Local Methods] ============================== //
+
+        /**
+         * @return Whether or not this future is bound to a task.
+         */
+        bool            IsValid ()  const noexcept;
+
+        /**
+         * @return Whether or not the task has completed or its promise has been broken, without blocking.
+         */
+        bool            IsReady     ()  const noexcept;
+
+        /**
+         * @return Whether or not the promise was destroyed without being fulfilled, the future then holds no result.
+         */
+        bool            IsBroken    ()  const noexcept;
+
+        /**
+         * Executes other tasks until this one has completed or its promise has been broken.
+         */
+        void            Wait        ()  const noexcept;
+
+        /**
+         * Waits for the task and moves its result out, the future can only be read once.
+         *
+         * If the promise was broken, an error is logged and a value-initialized result is returned
+         * (a result which cannot be value-initialized is a fatal error).
+         */
+        decltype(auto)  Get         ()  noexcept;
+
+    private:
+
+    // ============================== [Private Constructor] ============================== //
+
+        explicit TaskFuture (TaskState<T>* p_state) noexcept;
+
+    // ============================== [Private Local Properties] ============================== //
+
+        TaskState<T>*   m_state = nullptr;
+
+};  // !class TaskFuture
+
+// ============================== [Promise] ============================== //
+
+template<typename T>
+class TaskPromise
+{
+    public:
+
+    // ============================== [Public Constructors and Destructor] ============================== //
+
+        TaskPromise     ()                          noexcept;
+
+        TaskPromise     (TaskPromise&&      p_move) noexcept;
+
+        TaskPromise     (TaskPromise const& p_copy) = delete;
+
+        /**
+         * Breaks the shared state if the promise was not fulfilled, which releases the threads waiting on the future.
+         */
+        ~TaskPromise    ()                          noexcept;
+
+    // ============================== [Public Local Operators] ============================== //
+
+        TaskPromise&    operator=   (TaskPromise&&      p_move) noexcept;
+
+        TaskPromise&    operator=   (TaskPromise const& p_copy) = delete;
+
+    // ============================== [Public Local Methods] ============================== //
+
+        /**
+         * @return The future bound to this promise, must be called once.
+         */
+        TaskFuture<T>   GetFuture   ()                  noexcept;
+
+        /**
+         * Invokes the function and stores its result, making the future ready.
+         */
+        template<typename Function>
+        void            Fulfill     (Function& p_function) noexcept;
+
+    private:
+
+    // ============================== [Private Local Properties] ============================== //
+
+        TaskState<T>*   m_state = nullptr;
+
+    // ============================== [Private Local Methods] ============================== //
+
+        /**
+         * Breaks the shared state if it is not ready and gives up the reference to it.
+         */
+        void            Release     ()                  noexcept;
+
+};  // !class TaskPromise
+
+#include "TaskFuture.inl"
+
+#endif // !__TASK_FUTURE_HPP__
\ No newline at end of file
@@ -0,0 +1,201 @@
+#include "TaskFuture.hpp"
+
+// ============================== [Shared State] ============================== //
+
+template<typename T>
+INLINE TaskState<T>*    TaskState<T>::Create            () noexcept
+{
+    if constexpr (TaskAllocator::Fits<TaskState>)
+        return new (TaskAllocator::Allocate()) TaskState();
+    else
+        return new TaskState();
+}
+
+template<typename T>
+INLINE void             TaskState<T>::AddReference      () noexcept
+{
+    references.fetch_add(1u, std::memory_order_relaxed);
+}
+
+template<typename T>
+INLINE void             TaskState<T>::RemoveReference   () noexcept
+{
+    if (references.fetch_sub(1u, std::memory_order_acq_rel) != 1u)
+        return;
+
+    if constexpr (TaskAllocator::Fits<TaskState>)
+    {
+        this->~TaskState();
+
+        TaskAllocator::Free(this);
+    }
+
+    else
+        delete this;
+}
+
+// ============================== [Future] ============================== //
+
+template<typename T>
+INLINE TaskFuture<T>::TaskFuture    (TaskState<T>* p_state) noexcept :
+    m_state { p_state }
+{}
+
+template<typename T>
+INLINE TaskFuture<T>::TaskFuture    (TaskFuture&& p_move) noexcept :
+    m_state { std::exchange(p_move.m_state, nullptr) }
+{}
+
+template<typename T>
+INLINE TaskFuture<T>::~TaskFuture   () noexcept
+{
+    if (m_state)
+        m_state->RemoveReference();
+}
+
+template<typename T>
+INLINE TaskFuture<T>&   TaskFuture<T>::operator=    (TaskFuture&& p_move) noexcept
+{
+    if (this != &p_move)
+    {
+        if (m_state)
+            m_state->RemoveReference();
+
+        m_state = std::exchange(p_move.m_state, nullptr);
+    }
+
+    return *this;
+}
+
+template<typename T>
+INLINE bool             TaskFuture<T>::IsValid      () const noexcept
+{
+    return m_state != nullptr;
+}
+
+template<typename T>
+INLINE bool             TaskFuture<T>::IsReady      () const noexcept
+{
+    return m_state && m_state->isReady.load(std::memory_order_acquire);
+}
+
+template<typename T>
+INLINE bool             TaskFuture<T>::IsBroken     () const noexcept
+{
+    return IsReady() && m_state->isBroken.load(std::memory_order_relaxed);
+}
+
+template<typename T>
+INLINE void             TaskFuture<T>::Wait         () const noexcept
+{
+    // Helping the pool rather than blocking, the awaited task may be queued behind the caller.
+    ThreadPool& threadPool = ThreadPool::Get();
+
+    while (!IsReady())
+    {
+        if (!threadPool.TryExecuteTask())
+            std::this_thread::yield();
+    }
+}
+
+template<typename T>
+INLINE decltype(auto)   TaskFuture<T>::Get          () noexcept
+{
+    Wait();
+
+    if (IsBroken())
+    {
+        LOG(LogThreadPool, Error, "The task of this future was destroyed without being executed");
+
+        if constexpr (!std::is_void_v<T>)
+        {
+            if constexpr (std::is_default_constructible_v<T>)
+                return T();
+            else
+            {
+                LOG(LogThreadPool, Fatal, "The result of a broken task cannot be value-initialized");
+
+                std::abort();
+            }
+        }
+
+        else
+            return;
+    }
+
+    if constexpr (!std::is_void_v<T>)
+        return T(std::move(*m_state->value));
+}
+
+// ============================== [Promise] ============================== //
+
+template<typename T>
+INLINE TaskPromise<T>::TaskPromise  () noexcept :
+    m_state { TaskState<T>::Create() }
+{}
+
+template<typename T>
+INLINE TaskPromise<T>::TaskPromise  (TaskPromise&& p_move) noexcept :
+    m_state { std::exchange(p_move.m_state, nullptr) }
+{}
+
+template<typename T>
+INLINE TaskPromise<T>::~TaskPromise () noexcept
+{
+    Release();
+}
+
+template<typename T>
+INLINE TaskPromise<T>&  TaskPromise<T>::operator=   (TaskPromise&& p_move) noexcept
+{
+    if (this != &p_move)
+    {
+        Release();
+
+        m_state = std::exchange(p_move.m_state, nullptr);
+    }
+
+    return *this;
+}
+
+template<typename T>
+INLINE TaskFuture<T>    TaskPromise<T>::GetFuture   () noexcept
+{
+    m_state->AddReference();
+
+    return TaskFuture<T>(m_state);
+}
+
+template<typename T>
+template<typename Function>
+INLINE void             TaskPromise<T>::Fulfill     (Function& p_function) noexcept
+{
+    if constexpr (std::is_void_v<T>)
+    {
+        p_function();
+
+        m_state->value.emplace(true);
+    }
+
+    else
+        m_state->value.emplace(p_function());
+
+    m_state->isReady.store(true, std::memory_order_release);
+}
+
+template<typename T>
+INLINE void             TaskPromise<T>::Release     () noexcept
+{
+    if (!m_state)
+        return;
+
+    // Only this promise writes the state, it is either fulfilled or never will be.
+    if (!m_state->isReady.load(std::memory_order_relaxed))
+    {
+        m_state->isBroken.store(true, std::memory_order_relaxed);
+        m_state->isReady .store(true, std::memory_order_release);
+    }
+
+    m_state->RemoveReference();
+    m_state = nullptr;
+}
\ No newline at end of file
@@ -0,0 +1,171 @@
+#ifndef __TASK_GRAPH_HPP__
+#define __TASK_GRAPH_HPP__
+
+#include "TaskScheduler.hpp"
+
+/**
+ * Directed acyclic graph of tasks executed on a TaskScheduler, the ThreadPool in the Engine.
+ *
+ * A graph is meant to be built once and executed many times (typically once per frame):
+ * nodes keep their callable and their edges between executions, only their counters are reset,
+ * so executing a graph does not allocate.
+ *
+ * A node is executed once every node it depends on has completed. When a node completes,
+ * the thread which executed it continues with one of the nodes it made ready and schedules the others,
+ * so a chain of nodes runs on a single thread without going through the queues.
+ */
+class ENGINE_API TaskGraph
+{
+    public:
+
+    // ============================== [Public Class] ============================== //
+
+        class ENGINE_API Node
+        {
+            friend class TaskGraph;
+
+            public:
+
+            // ============================== [Public Constructor and Destructor] ============================== //
+
+                Node    (TaskGraph&     p_graph,
+                         InlineTask&&   p_task,
+                         char const*    p_name)     noexcept;
+
+                ~Node   () = default;
+
+            // ============================== [Public Local Methods] ============================== //
+
+                /**
+                 * Makes "p_next" wait for this node.
+                 *
+                 * @return "p_next", so continuations can be chained.
+                 *
+                 * @warning Both nodes must belong to the same graph, which must not be executing.
+                 *          An edge to a node of another graph is not added, and the graph is not executed until it is cleared.
+                 */
+                Node&   Then    (Node&  p_next) noexcept;
+
+                /**
+                 * Adds a node to the graph which waits for this node.
+                 *
+                 * @return The new node, so continuations can be chained.
+                 *
+                 * @warning The graph must not be executing.
+                 */
+                template<typename T>
+                Node&   Then    (T&&            p_function,
+                                 char const*    p_name = nullptr)   noexcept;
+
+            // ==================================================================================== //
+
+                INLINE char const*  GetName ()  const noexcept  { return m_name; }
+
+            private:
+
+            // ============================== [Private Local Properties] ============================== //
+
+                TaskGraph&              m_graph;
+
+                InlineTask              m_task;
+
+                char const*             m_name;
+
+                /** Nodes waiting for this one. */
+                std::vector<Node*>      m_successors;
+
+                /** Number of nodes this one waits for. */
+                uint32                  m_predecessorCount;
+
+                /** Number of nodes this one still waits for during an execution. */
+                std::atomic<uint32>     m_pendingPredecessors;
+
+        };  // !class Node
+
+    // ============================== [Public Constructor and Destructor] ============================== //
+
+        explicit TaskGraph  (TaskScheduler&     p_scheduler)    noexcept;
+
+        TaskGraph           (TaskGraph const&   p_copy)         = delete;
+
+        ~TaskGraph          ()                                  = default;
+
+    // ============================== [Public Local Operator] ============================== //
+
+        TaskGraph&  operator=   (TaskGraph const&   p_copy) = delete;
+
+    // ============================== [Public Local Methods] ============================== //
+
+        /**
+         * Adds a node without any dependency.
+         *
+         * @param p_name    Static string identifying the node, may be null.
+         *
+         * @warning         The graph must not be executing.
+         */
+        template<typename T>
+        Node&   AddNode     (T&&            p_function,
+                             char const*    p_name = nullptr)   noexcept;
+
+        /**
+         * Executes every node, respecting the dependencies, and returns once they have all completed.
+         * The calling thread executes a root itself and then helps the scheduler.
+         *
+         * @return  Whether or not the graph was executed, a graph with a cycle or an edge to another graph is not.
+         *
+         * @warning A graph cannot be executed by several threads at the same time.
+         */
+        bool    Execute     ()                                  noexcept;
+
+        /**
+         * Removes every node.
+         *
+         * @warning The graph must not be executing.
+         */
+        void    Clear       ()                                  noexcept;
+
+    // ==================================================================================== //
+
+        INLINE size_t   GetNodeCount    ()  const noexcept  { return m_nodes.size(); }
+
+    private:
+
+    // ============================== [Private Local Properties] ============================== //
+
+        TaskScheduler&                      m_scheduler;
+
+        std::vector<std::unique_ptr<Node>>  m_nodes;
+
+        /** Nodes without any dependency, computed again when an edge or a node is added. */
+        std::vector<Node*>                  m_roots;
+
+        bool                                m_isDirty;
+
+        /** Whether or not the graph has no cycle, valid when it is not dirty. */
+        bool                                m_isValid;
+
+        /** Whether or not an edge to a node of another graph was rejected since the last Clear. */
+        bool                                m_hasForeignEdge;
+
+        /** Number of nodes which have not completed yet during an execution. */
+        std::atomic<size_t>                 m_pendingNodes;
+
+    // ============================== [Private Local Methods] ============================== //
+
+        /**
+         * Computes the roots and checks the graph is acyclic.
+         */
+        void    Build       ()              noexcept;
+
+        /**
+         * Executes a node, then the nodes it made ready.
+         */
+        void    Run         (Node*  p_node) noexcept;
+
+        void    Schedule    (Node*  p_node) noexcept;
+
+};  // !class TaskGraph
+
+#include "TaskGraph.inl"
+
+#endif // !__TASK_GRAPH_HPP__
\ No newline at end of file
@@ -0,0 +1,21 @@
+#include "TaskGraph.hpp"
+
+// ============================== [Node Public Local Methods] ============================== //
+
+template<typename T>
+INLINE TaskGraph::Node& TaskGraph::Node::Then   (T&&            p_function,
+                                                 char const*    p_name) noexcept
+{
+    return Then(m_graph.AddNode(std::forward<T>(p_function), p_name));
+}
+
+// ============================== [Public Local Methods] ============================== //
+
+template<typename T>
+INLINE TaskGraph::Node& TaskGraph::AddNode      (T&&            p_function,
+                                                 char const*    p_name) noexcept
+{
+    m_isDirty = true;
+
+    return *m_nodes.emplace_back(std::make_unique<Node>(*this, InlineTask(std::forward<T>(p_function)), p_name));
+}
\ No newline at end of file
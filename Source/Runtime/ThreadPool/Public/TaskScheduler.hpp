@@ -0,0 +1,262 @@
+#ifndef __TASK_SCHEDULER_HPP__
+#define __TASK_SCHEDULER_HPP__
+
+#include "InlineTask.hpp"
+#include "TaskAllocator.hpp"
+#include "WorkStealingQueue.hpp"
+
+/**
+ * Work-stealing scheduler the ThreadPool is built on.
+ *
+ * Each worker thread owns a Chase-Lev deque: it pushes and pops its own tasks without locking, and idle workers steal
+ * from a random victim. The threads which are not part of the scheduler, and the high priority tasks, go through a global
+ * injection queue guarded by a mutex. Workers spin briefly, then sleep until a task is pending.
+ *
+ * It does not depend on the Engine, so it can be started on its own, which is how the benchmarks drive it.
+ */
+class ENGINE_API TaskScheduler
+{
+    public:
+
+    // ============================== [Alias] ============================== //
+
+        /** Tasks are stored in TaskAllocator blocks, submitting one does not allocate. */
+        using Task = InlineTask;
+
+    // ============================== [Public Constructors and Destructor] ============================== //
+
+        TaskScheduler           ()                              = default;
+
+        TaskScheduler           (TaskScheduler const&   p_copy) = delete;
+
+        virtual ~TaskScheduler  ()                              = default;
+
+    // ============================== [Public Local Operators] ============================== //
+
+        TaskScheduler&  operator=   (TaskScheduler const&   p_copy) = delete;
+
+    // ============================== [Public Local Methods] ============================== //
+
+        /**
+         * Spawns "p_threadCount" threads, each one owning a work-stealing queue,
+         * and launches them in an infinite loop until Stop is called.
+         *
+         * @thread_safety This function must only be called from the thread which owns the scheduler.
+         */
+        void    Start           (uint32 p_threadCount)  noexcept;
+
+        /**
+         * Notifies each thread to stop running after the queues have been emptied and waits for them to finish execution.
+         *
+         * @thread_safety This function must only be called from the thread which owns the scheduler.
+         */
+        void    Stop            ()                      noexcept;
+
+        /**
+         * Retrieves one task and executes it, if any.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        void    ExecuteTask     ()                      noexcept;
+
+        /**
+         * Retrieves one task and executes it, this is how a thread helps the scheduler while it waits.
+         *
+         * A worker thread first pops its own queue, then the global queue, then tries to steal from the other workers.
+         * Any other thread only looks at the global queue and the workers' queues.
+         *
+         * @return Whether or not a task was executed.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        bool    TryExecuteTask  ()                      noexcept;
+
+    // ==================================================================================== //
+
+        template<typename T>
+        void            SubmitDetachedTask  (T&&                p_task,
+                                             bool               p_isHighPriority = false)   noexcept;
+
+        template<typename T>
+        void            SubmitDetachedTasks (std::vector<T>&&   p_tasks,
+                                             bool               p_isHighPriority = false)   noexcept;
+
+    // ==================================================================================== //
+
+        template<typename Function>
+        void            ParallelFor         (size_t             p_begin,
+                                             size_t             p_end,
+                                             size_t             p_grain,
+                                             Function&&         p_function)                 noexcept;
+
+        template<typename T, typename Map, typename Reduce>
+        T               ParallelReduce      (size_t             p_begin,
+                                             size_t             p_end,
+                                             size_t             p_grain,
+                                             T                  p_identity,
+                                             Map&&              p_map,
+                                             Reduce&&           p_reduce)                   noexcept;
+
+        template<typename Iterator, typename Compare>
+        void            ParallelSort        (Iterator           p_first,
+                                             Iterator           p_last,
+                                             size_t             p_grain,
+                                             Compare&&          p_compare)                  noexcept;
+
+    // ==================================================================================== //
+
+        INLINE std::vector<std::thread> const& GetThreads() const noexcept { return m_threads; }
+
+    protected:
+
+    // ============================== [Protected Static Methods] ============================== //
+
+        /**
+         * Constructs a task in a TaskAllocator block.
+         */
+        template<typename T>
+        static Task*    CreateTask  (T&&            p_function)         noexcept;
+
+    // ============================== [Protected Local Methods] ============================== //
+
+        /**
+         * Dispatches tasks to the calling worker's queue, or to the global queue, and wakes sleeping workers up.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        void            Schedule    (Task* const*   p_tasks,
+                                     size_t         p_count,
+                                     bool           p_isHighPriority)   noexcept;
+
+        /**
+         * Called by each worker thread before it executes its first task.
+         */
+        virtual void    OnWorkerStart   (uint32     p_index)            noexcept;
+
+    private:
+
+    // ============================== [Private Static Properties] ============================== //
+
+        /** Number of chunks per thread a ParallelFor or a ParallelReduce aims for when no grain is given. */
+        static constexpr size_t ChunksPerThread = 8u;
+
+    // ============================== [Private Structure] ============================== //
+
+        struct Worker
+        {
+            /** Tasks submitted by this worker, popped by it and stolen by the others. */
+            WorkStealingQueue<Task*>    queue;
+
+            /** State of the random generator used to pick a victim. */
+            uint32                      seed;
+        };
+
+        /**
+         * Loop shared by every task of a ParallelFor, it lives on the stack of the calling thread.
+         */
+        struct ParallelRange
+        {
+            /** Type-erased loop body, executes [p_begin, p_end). */
+            void                (*execute)  (void* p_context, size_t p_begin, size_t p_end);
+
+            void*               context;
+
+            /** Minimum number of iterations of a task. */
+            size_t              grain;
+
+            /** Number of iterations left to execute, the loop is done when it reaches 0. */
+            std::atomic<size_t> remaining;
+        };
+
+    // ============================== [Private Local Properties] ============================== //
+
+        std::atomic_bool                        m_running;
+
+        /** Number of tasks which have been submitted but not retrieved yet, used to put the workers to sleep. */
+        std::atomic<int64>                      m_pendingTasks;
+
+        /** Number of workers waiting on the condition. */
+        std::atomic<int32>                      m_sleepingThreads;
+
+        /** Guards the global queue. */
+        std::mutex                              m_mutex;
+
+        /** Guards the condition, never held while a queue is accessed. */
+        std::mutex                              m_sleepMutex;
+
+        std::condition_variable                 m_condition;
+
+        /**
+         * Global injection queue, used by the threads which are not part of the scheduler and for high priority tasks.
+         * It is a ring buffer which only grows, std::deque allocates and frees its chunks as tasks go through it.
+         */
+        std::vector<Task*>                      m_tasks;
+
+        /** Index of the front of the global queue. */
+        size_t                                  m_tasksHead;
+
+        /** Size of the global queue, read without locking to skip it when it is empty. */
+        std::atomic<size_t>                     m_tasksCount;
+
+        std::vector<std::unique_ptr<Worker>>    m_workers;
+
+        std::vector<std::thread>                m_threads;
+
+    // ============================== [Private Static Methods] ============================== //
+
+        /**
+         * Executes a task and gives its block back to the TaskAllocator.
+         */
+        static void     RunTask     (Task*          p_task)             noexcept;
+
+    // ============================== [Private Local Methods] ============================== //
+
+        /**
+         * @return The worker running on the calling thread, or nullptr if the thread is not part of this scheduler.
+         */
+        Worker* GetLocalWorker  ()                                      noexcept;
+
+        /**
+         * @return A task to execute, or nullptr if no task could be found.
+         *
+         * @thread_safety This function may be called from any thread.
+         */
+        Task*   FindTask        ()                                      noexcept;
+
+        /**
+         * Appends or prepends a task to the global queue, m_mutex must be held.
+         */
+        void    PushGlobal      (Task*          p_task,
+                                 bool           p_isHighPriority)       noexcept;
+
+        /**
+         * @return The front of the global queue, or nullptr if it is empty. m_mutex must be held.
+         */
+        Task*   PopGlobal       ()                                      noexcept;
+
+        /**
+         * Runs a ParallelFor over its whole range, the calling thread executes a part of it and helps until it is done.
+         */
+        void    RunParallel     (ParallelRange& p_range,
+                                 size_t         p_begin,
+                                 size_t         p_end)                  noexcept;
+
+        /**
+         * Executes [p_begin, p_end) of a range by chunks of "grain" iterations.
+         * Half of what is left is handed over to the scheduler whenever the current queue runs dry,
+         * so a range is only split as much as there are threads to steal it.
+         */
+        void    SplitRange      (ParallelRange& p_range,
+                                 size_t         p_begin,
+                                 size_t         p_end)                  noexcept;
+
+        /**
+         * Main loop of a worker thread.
+         */
+        void    Work            (uint32         p_index)                noexcept;
+
+};  // !class TaskScheduler
+
+#include "TaskScheduler.inl"
+
+#endif // !__TASK_SCHEDULER_HPP__
\ No newline at end of file
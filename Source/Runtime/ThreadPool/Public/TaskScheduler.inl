@@ -0,0 +1,199 @@
+#include "TaskScheduler.hpp"
+
+// ============================== [Public Local Methods] ============================== //
+
+/**
+ * Submits a single task whose completion is not tracked, which is the cheapest way to run something on the scheduler.
+ *
+ * @param p_isHighPriority  If this task is high priority, it will be added to the front of the global queue.
+ *
+ * @thread_safety           This function may be called from any thread.
+ */
+template<typename T>
+void            TaskScheduler::SubmitDetachedTask  (T&&  p_task,
+                                                    bool p_isHighPriority) noexcept
+{
+    Task* task = CreateTask(std::forward<T>(p_task));
+
+    Schedule(&task, 1u, p_isHighPriority);
+}
+
+/**
+ * Submits a bunch of tasks whose completion is not tracked.
+ * The tasks are moved out of the vector, which keeps its capacity and can be reused.
+ *
+ * @param p_isHighPriority  If the tasks are high priority, they will be added to the front of the global queue.
+ *
+ * @thread_safety           This function may be called from any thread.
+ */
+template<typename T>
+void            TaskScheduler::SubmitDetachedTasks (std::vector<T>&& p_tasks,
+                                                    bool             p_isHighPriority) noexcept
+{
+    constexpr size_t BatchSize = 64u;
+
+    Task* tasks[BatchSize];
+
+    // Scheduled by batches to avoid a temporary vector.
+    for (size_t first = 0u; first < p_tasks.size(); first += BatchSize)
+    {
+        size_t count = std::min(BatchSize, p_tasks.size() - first);
+
+        for (size_t i = 0u; i < count; ++i)
+            tasks[i] = CreateTask(std::move(p_tasks[first + i]));
+
+        Schedule(tasks, count, p_isHighPriority);
+    }
+}
+
+/**
+ * Calls "p_function(i)" for every i in [p_begin, p_end), splitting the range across the workers.
+ *
+ * The calling thread executes a part of the range itself and then helps the workers until the whole range is done,
+ * there is no task or future per chunk.
+ *
+ * @param p_grain       Minimum number of iterations executed by a task, 0 picks one from the size of the range.
+ *
+ * @thread_safety       This function may be called from any thread, including from a task.
+ */
+template<typename Function>
+void            TaskScheduler::ParallelFor         (size_t     p_begin,
+                                                    size_t     p_end,
+                                                    size_t     p_grain,
+                                                    Function&& p_function) noexcept
+{
+    if (p_begin >= p_end)
+        return;
+
+    ParallelRange range;
+
+    range.context = &p_function;
+    range.grain   = p_grain;
+    range.execute = [] (void* p_context, size_t p_first, size_t p_last)
+    {
+        auto& function = *static_cast<std::remove_reference_t<Function>*>(p_context);
+
+        for (size_t i = p_first; i < p_last; ++i)
+            function(i);
+    };
+
+    RunParallel(range, p_begin, p_end);
+}
+
+/**
+ * Reduces "p_map(i)" for every i in [p_begin, p_end) with "p_reduce", splitting the range across the workers.
+ *
+ * The range is cut in chunks of "p_grain" iterations, each one reduced by a task into a partial of its own.
+ * The partials are then combined in chunk order by the calling thread.
+ *
+ * @param p_grain       Number of iterations of a chunk, 0 picks one from the size of the range.
+ * @param p_identity    Neutral element of "p_reduce".
+ *
+ * @return              The reduction of the whole range.
+ *
+ * @warning             "p_reduce" must be associative. The chunks only depend on "p_grain",
+ *                      so for a given grain the result does not depend on the number of threads nor on their timing.
+ *
+ * @thread_safety       This function may be called from any thread, including from a task.
+ */
+template<typename T, typename Map, typename Reduce>
+T               TaskScheduler::ParallelReduce      (size_t     p_begin,
+                                                    size_t     p_end,
+                                                    size_t     p_grain,
+                                                    T          p_identity,
+                                                    Map&&      p_map,
+                                                    Reduce&&   p_reduce) noexcept
+{
+    /** Wrapped so that a chunk never shares a std::vector<bool> word with another. */
+    struct Partial
+    {
+        T value;
+    };
+
+    if (p_begin >= p_end)
+        return p_identity;
+
+    size_t const count = p_end - p_begin;
+
+    if (p_grain == 0u)
+        p_grain = std::max<size_t>(count / (ChunksPerThread * (m_workers.size() + 1u)), 1u);
+
+    std::vector<Partial> partials((count + p_grain - 1u) / p_grain, Partial { p_identity });
+
+    ParallelFor(0u, partials.size(), 1u, [&] (size_t p_chunk)
+    {
+        size_t const first   = p_begin + p_chunk * p_grain;
+        size_t const last    = std::min(first + p_grain, p_end);
+        T            partial = p_identity;
+
+        for (size_t i = first; i < last; ++i)
+            partial = p_reduce(std::move(partial), p_map(i));
+
+        partials[p_chunk].value = std::move(partial);
+    });
+
+    T result = std::move(p_identity);
+
+    for (Partial& partial : partials)
+        result = p_reduce(std::move(result), std::move(partial.value));
+
+    return result;
+}
+
+/**
+ * Sorts [p_first, p_last) with "p_compare", splitting the range across the workers.
+ *
+ * Runs of "p_grain" elements are sorted in parallel, then merged two by two in parallel until one run is left.
+ * The runs only depend on "p_grain", so for a given grain the result does not depend on the number of threads.
+ *
+ * @param p_grain       Number of elements sorted by a task, 0 picks one from the size of the range.
+ *
+ * @warning             The sort is not stable. The last merge runs on the calling thread alone.
+ *
+ * @thread_safety       This function may be called from any thread, including from a task.
+ */
+template<typename Iterator, typename Compare>
+void            TaskScheduler::ParallelSort        (Iterator   p_first,
+                                                    Iterator   p_last,
+                                                    size_t     p_grain,
+                                                    Compare&&  p_compare) noexcept
+{
+    size_t const count = static_cast<size_t>(std::distance(p_first, p_last));
+
+    if (p_grain == 0u)
+        p_grain = std::max<size_t>(count / (m_workers.size() + 1u), 1u);
+
+    if (count <= p_grain)
+    {
+        std::sort(p_first, p_last, p_compare);
+        return;
+    }
+
+    ParallelFor(0u, (count + p_grain - 1u) / p_grain, 1u, [&] (size_t p_run)
+    {
+        std::sort(p_first + p_run * p_grain, p_first + std::min((p_run + 1u) * p_grain, count), p_compare);
+    });
+
+    for (size_t width = p_grain; width < count; width *= 2u)
+    {
+        ParallelFor(0u, (count + 2u * width - 1u) / (2u * width), 1u, [&] (size_t p_pair)
+        {
+            size_t const first  = p_pair * 2u * width;
+            size_t const middle = std::min(first + width,      count);
+            size_t const last   = std::min(first + 2u * width, count);
+
+            if (middle < last)
+                std::inplace_merge(p_first + first, p_first + middle, p_first + last, p_compare);
+        });
+    }
+}
+
+// ============================== [Protected Static Methods] ============================== //
+
+template<typename T>
+INLINE TaskScheduler::Task* TaskScheduler::CreateTask  (T&& p_function) noexcept
+{
+    static_assert(TaskAllocator::Fits<Task>, "A task must fit in a TaskAllocator block");
+
+    return new (TaskAllocator::Allocate()) Task(std::forward<T>(p_function));
+}
\ No newline at end of file
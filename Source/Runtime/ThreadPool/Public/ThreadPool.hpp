@@ -3,18 +3,23 @@
 
 #include "EngineModule.hpp"
 
-class ENGINE_API ThreadPool : public EngineModule
-{
-    public:
+#include "TaskScheduler.hpp"
 
-    // ============================== [Alias] ============================== //
+/** Defined in TaskFuture.hpp, which needs the ThreadPool. */
+template<typename T>
+class TaskFuture;
 
-        using Task = std::function<void()>;
+/**
+ * Engine module owning the TaskScheduler every system submits its tasks to, with one worker per hardware thread but one.
+ */
+class ENGINE_API ThreadPool : public EngineModule, public TaskScheduler
+{
+    public:
 
     // ============================== [Public Static Method] ============================== //
 
         static INLINE ThreadPool& Get() noexcept
-        { 
+        {
             return GEngine->GetModuleManager()->Get<ThreadPool>();
         }
 
@@ -29,7 +34,7 @@ class ENGINE_API ThreadPool : public EngineModule
     // ============================== [Module Public Local Methods] ============================== //
 
         /**
-         * Spawns the maximum number of threads (hardware_concurrency - 1) and launches them in an infinite loop while the ThreadPool is running.
+         * Starts the maximum number of threads (hardware_concurrency - 1), see TaskScheduler::Start.
          */
         void    Initialize  (EngineKey const& p_passkey) noexcept final override;
 
@@ -39,49 +44,33 @@ class ENGINE_API ThreadPool : public EngineModule
         void    Update      (EngineKey const& p_passkey) noexcept final override;
 
         /**
-         * Notifies each thread to stop running after the queue has been emptied and waits for them to finish execution.
+         * Notifies each thread to stop running after the queues have been emptied and waits for them to finish execution.
          */
         void    Shutdown    (EngineKey const& p_passkey) noexcept final override;
 
     // ============================== [Public Local Methods] ============================== //
 
-        /**
-         * Retrieves one task from the queue and executes it.
-         *
-         * @thread_safety This function may be called from any thread.
-         */
-        void ExecuteTask() noexcept;
-
-    // ==================================================================================== //
-
         template<typename T>
-        decltype(auto)  SubmitTask  (T&&                p_task,
-                                     bool               p_isHighPriority = false)   noexcept;
+        decltype(auto)  SubmitTask          (T&&                p_task,
+                                             bool               p_isHighPriority = false)   noexcept;
 
         template<typename T>
-        decltype(auto)  SubmitTasks (std::vector<T>&&   p_tasks,
-                                     bool               p_isHighPriority = false)   noexcept;
+        void            SubmitTasks         (std::vector<T>&&                                       p_tasks,
+                                             std::vector<TaskFuture<std::invoke_result_t<T&>>>&     p_futures,
+                                             bool                                                   p_isHighPriority = false)   noexcept;
 
-    // ==================================================================================== //
+    protected:
 
-        INLINE std::vector<std::thread> const& GetThreads() const noexcept { return m_threads; }
+    // ============================== [Protected Local Methods] ============================== //
 
-    private:
-
-    // ============================== [Private Local Properties] ============================== //
-        
-        bool                        m_running;
-
-        std::mutex                  m_mutex;
-
-        std::condition_variable     m_condition;
-
-        std::deque<Task>            m_tasks;
-
-        std::vector<std::thread>    m_threads;
+        /**
+         * Names the worker thread for the Profiler.
+         */
+        void    OnWorkerStart   (uint32 p_index) noexcept final override;
 
 };  // !class ThreadPool
 
+#include "TaskFuture.hpp"
 #include "ThreadPool.inl"
 
 #endif // !__THREAD_POOL_HPP__
\ No newline at end of file
@@ -3,66 +3,74 @@
 // ============================== [Public Local Methods] ============================== //
 
 /**
- * Submits a single task to the queue.
+ * Submits a single task.
  *
- * @param p_isHighPriority  If this task is high priority, it will be added to the front of the queue.
+ * @param p_isHighPriority  If this task is high priority, it will be added to the front of the global queue.
+ *                          Otherwise, it will be added to the calling worker's queue, or the back of the global queue.
  *
- * @return                  A future containing the return value of the task.
+ * @return                  A TaskFuture containing the return value of the task.
  *
  * @thread_safety           This function may be called from any thread.
  */
 template<typename T>
-decltype(auto)  ThreadPool::SubmitTask  (T&&  p_task,
-                                         bool p_isHighPriority) noexcept
+decltype(auto)  ThreadPool::SubmitTask          (T&&  p_task,
+                                                 bool p_isHighPriority) noexcept
 {
-    auto wrapper = std::make_shared<std::packaged_task<decltype(p_task()) ()>>(std::move(p_task));
-    
-    {
-        std::unique_lock lock(m_mutex);
+    using Result = std::invoke_result_t<std::decay_t<T>&>;
 
-        if (p_isHighPriority)
-            m_tasks.emplace_front( [wrapper] { (*wrapper)(); });
-        else
-            m_tasks.emplace_back ( [wrapper] { (*wrapper)(); });
-    }
+    TaskPromise<Result> promise;
+    TaskFuture <Result> future = promise.GetFuture();
+
+    Task* task = CreateTask([promise = std::move(promise), function = std::forward<T>(p_task)] () mutable
+    {
+        promise.Fulfill(function);
+    });
 
-    m_condition.notify_one();
+    Schedule(&task, 1u, p_isHighPriority);
 
-    return wrapper->get_future();
+    return future;
 }
 
 /**
- * Submits a bunch of tasks to the queue.
- *
- * @param p_isHighPriority  If the tasks are high priority, they will be added to the front of the queue.
+ * Submits a bunch of tasks.
+ * The tasks are moved out of the vector, which keeps its capacity and can be reused.
  *
- * @return                  A vector of futures containing the return values of the tasks.
+ * @param p_futures         Vector the TaskFutures containing the return values of the tasks are appended to, in order.
+ *                          Kept by the caller across submissions, it only grows when its capacity is exceeded.
+ * @param p_isHighPriority  If the tasks are high priority, they will be added to the front of the global queue.
  *
- * @thread_safety           This function may be called from any thread..
+ * @thread_safety           This function may be called from any thread.
  */
 template<typename T>
-decltype(auto)  ThreadPool::SubmitTasks (std::vector<T>&& p_tasks,
-                                         bool             p_isHighPriority) noexcept
+void            ThreadPool::SubmitTasks         (std::vector<T>&&                                   p_tasks,
+                                                 std::vector<TaskFuture<std::invoke_result_t<T&>>>& p_futures,
+                                                 bool                                               p_isHighPriority) noexcept
 {
-    std::vector<std::future<decltype(T() ())>> futures(p_tasks.size());
+    using Result = std::invoke_result_t<T&>;
 
+    constexpr size_t BatchSize = 64u;
+
+    Task* tasks[BatchSize];
+
+    p_futures.reserve(p_futures.size() + p_tasks.size());
+
+    // Scheduled by batches to avoid a temporary vector, as SubmitDetachedTasks does.
+    for (size_t first = 0u; first < p_tasks.size(); first += BatchSize)
     {
-        std::unique_lock lock(m_mutex);
+        size_t count = std::min(BatchSize, p_tasks.size() - first);
 
-        for (size_t i = 0; i < p_tasks.size(); ++i)
+        for (size_t i = 0u; i < count; ++i)
         {
-            auto wrapper = std::make_shared<std::packaged_task<decltype(p_tasks[i]()) ()>>(std::move(p_tasks[i]));
+            TaskPromise<Result> promise;
 
-            if (p_isHighPriority)
-                m_tasks.emplace_front( [wrapper] { (*wrapper)(); });
-            else
-                m_tasks.emplace_back ( [wrapper] { (*wrapper)(); });
+            p_futures.emplace_back(promise.GetFuture());
 
-            futures[i] = wrapper->get_future();
+            tasks[i] = CreateTask([promise = std::move(promise), function = std::move(p_tasks[first + i])] () mutable
+            {
+                promise.Fulfill(function);
+            });
         }
-    }
-
-    m_condition.notify_all();
 
-    return futures;
+        Schedule(tasks, count, p_isHighPriority);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,106 @@
+#ifndef __WORK_STEALING_QUEUE_HPP__
+#define __WORK_STEALING_QUEUE_HPP__
+
+#include "HAL/Platform.hpp"
+
+/**
+ * Chase-Lev work-stealing deque.
+ *
+ * The owner thread pushes and pops at the bottom (LIFO) without taking any lock,
+ * while any other thread may steal from the top (FIFO) with a single CAS.
+ * The circular buffer grows when it is full, the previous buffers are kept alive until the queue is destroyed
+ * since a thief may still be reading from them.
+ *
+ * @warning T must be trivially copyable (i.e. a pointer), elements are read racily by the thieves.
+ */
+template<typename T>
+class WorkStealingQueue
+{
+    static_assert(std::is_trivially_copyable_v<T>, "WorkStealingQueue elements must be trivially copyable");
+
+    public:
+
+    // ============================== [Public Constructor and Destructor] ============================== //
+
+        explicit WorkStealingQueue  (int64 p_capacity = 1024) noexcept;
+
+        ~WorkStealingQueue          () = default;
+
+        WorkStealingQueue           (WorkStealingQueue const&   p_copy) = delete;
+
+        WorkStealingQueue           (WorkStealingQueue&&        p_move) = delete;
+
+    // ============================== [Public Local Methods] ============================== //
+
+        /**
+         * @thread_safety This function must only be called from the owner thread.
+         */
+        void    Push    (T      p_item)     noexcept;
+
+        /**
+         * @thread_safety This function must only be called from the owner thread.
+         */
+        bool    Pop     (T&     p_outItem)  noexcept;
+
+        /**
+         * @thread_safety This function may be called from any thread.
+         */
+        bool    Steal   (T&     p_outItem)  noexcept;
+
+        /**
+         * @thread_safety This function may be called from any thread, the result is only a hint.
+         */
+        bool    IsEmpty ()                  const noexcept;
+
+        /**
+         * @thread_safety This function may be called from any thread, the result is only a hint.
+         */
+        int64   Size    ()                  const noexcept;
+
+    // ============================== [Public Local Operators] ============================== //
+
+        WorkStealingQueue&  operator=   (WorkStealingQueue const&   p_copy) = delete;
+
+        WorkStealingQueue&  operator=   (WorkStealingQueue&&        p_move) = delete;
+
+    private:
+
+    // ============================== [Private Structure] ============================== //
+
+        struct Buffer
+        {
+            int64                               capacity;
+            int64                               mask;
+            std::unique_ptr<std::atomic<T>[]>   elements;
+
+            explicit Buffer (int64 p_capacity) noexcept;
+
+            T       Get     (int64 p_index)             const noexcept;
+            void    Put     (int64 p_index, T p_item)   noexcept;
+        };
+
+    // ============================== [Private Local Properties] ============================== //
+
+        /** Index of the next element to steal, only ever incremented. */
+        alignas(64) std::atomic<int64>          m_top;
+
+        /** Index of the next free slot, only written by the owner thread. */
+        alignas(64) std::atomic<int64>          m_bottom;
+
+        /** Current circular buffer. */
+        alignas(64) std::atomic<Buffer*>        m_buffer;
+
+        /** Every buffer ever allocated by this queue, including the current one. */
+        std::vector<std::unique_ptr<Buffer>>    m_buffers;
+
+    // ============================== [Private Local Methods] ============================== //
+
+        Buffer* Grow    (Buffer* p_buffer,
+                         int64   p_bottom,
+                         int64   p_top)     noexcept;
+
+};  // !class WorkStealingQueue
+
+#include "WorkStealingQueue.inl"
+
+#endif // !__WORK_STEALING_QUEUE_HPP__
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include "WorkStealingQueue.hpp"
+
+// ============================== [Public Constructor] ============================== //
+
+/**
+ * @param p_capacity    Initial capacity of the queue, must be a power of two.
+ */
+template<typename T>
+WorkStealingQueue<T>::WorkStealingQueue (int64 p_capacity) noexcept :
+    m_top       { 0 },
+    m_bottom    { 0 },
+    m_buffer    { nullptr }
+{
+    assert(p_capacity > 0 && (p_capacity & (p_capacity - 1)) == 0);
+
+    m_buffers.emplace_back(std::make_unique<Buffer>(p_capacity));
+
+    m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+}
+
+// ============================== [Public Local Methods] ============================== //
+
+/**
+ * Pushes an element at the bottom of the queue, grows the buffer if needed.
+ */
+template<typename T>
+void    WorkStealingQueue<T>::Push      (T p_item) noexcept
+{
+    int64   bottom = m_bottom.load(std::memory_order_relaxed);
+    int64   top    = m_top   .load(std::memory_order_acquire);
+    Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+
+    if (bottom - top > buffer->capacity - 1)
+        buffer = Grow(buffer, bottom, top);
+
+    buffer->Put(bottom, p_item);
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+}
+
+/**
+ * Pops the most recently pushed element.
+ *
+ * @return Whether or not an element was retrieved, it may fail if a thief won the race for the last element.
+ */
+template<typename T>
+bool    WorkStealingQueue<T>::Pop       (T& p_outItem) noexcept
+{
+    int64   bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+
+    m_bottom.store(bottom, std::memory_order_relaxed);
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    int64 top = m_top.load(std::memory_order_relaxed);
+
+    // The queue was empty.
+    if (top > bottom)
+    {
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    p_outItem = buffer->Get(bottom);
+
+    // More than one element left, no thief can reach this one.
+    if (top < bottom)
+        return true;
+
+    // Last element, races against the thieves.
+    bool won = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+    return won;
+}
+
+/**
+ * Steals the oldest element of the queue.
+ *
+ * @return Whether or not an element was retrieved, it fails when the queue is empty or another thread won the race.
+ */
+template<typename T>
+bool    WorkStealingQueue<T>::Steal     (T& p_outItem) noexcept
+{
+    int64 top = m_top.load(std::memory_order_acquire);
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    int64 bottom = m_bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom)
+        return false;
+
+    T item = m_buffer.load(std::memory_order_acquire)->Get(top);
+
+    if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return false;
+
+    p_outItem = item;
+
+    return true;
+}
+
+template<typename T>
+bool    WorkStealingQueue<T>::IsEmpty   () const noexcept
+{
+    return Size() <= 0;
+}
+
+template<typename T>
+int64   WorkStealingQueue<T>::Size      () const noexcept
+{
+    return m_bottom.load(std::memory_order_relaxed) - m_top.load(std::memory_order_relaxed);
+}
+
+// ============================== [Private Local Methods] ============================== //
+
+/**
+ * Copies the live elements into a buffer twice as large and publishes it.
+ *
+ * @thread_safety This function must only be called from the owner thread.
+ */
+template<typename T>
+typename WorkStealingQueue<T>::Buffer*  WorkStealingQueue<T>::Grow  (Buffer* p_buffer,
+                                                                     int64   p_bottom,
+                                                                     int64   p_top) noexcept
+{
+    m_buffers.emplace_back(std::make_unique<Buffer>(p_buffer->capacity * 2));
+
+    Buffer* buffer = m_buffers.back().get();
+
+    for (int64 i = p_top; i < p_bottom; ++i)
+        buffer->Put(i, p_buffer->Get(i));
+
+    m_buffer.store(buffer, std::memory_order_release);
+
+    return buffer;
+}
+
+// ============================== [Buffer] ============================== //
+
+template<typename T>
+WorkStealingQueue<T>::Buffer::Buffer    (int64 p_capacity) noexcept :
+    capacity    { p_capacity },
+    mask        { p_capacity - 1 },
+    elements    { std::make_unique<std::atomic<T>[]>(static_cast<size_t>(p_capacity)) }
+{
+
+}
+
+template<typename T>
+T       WorkStealingQueue<T>::Buffer::Get   (int64 p_index) const noexcept
+{
+    return elements[p_index & mask].load(std::memory_order_relaxed);
+}
+
+template<typename T>
+void    WorkStealingQueue<T>::Buffer::Put   (int64 p_index,
+                                             T     p_item) noexcept
+{
+    elements[p_index & mask].store(p_item, std::memory_order_relaxed);
+}
\ No newline at end of file